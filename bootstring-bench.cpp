@@ -0,0 +1,200 @@
+/*
+bootstring-bench.cpp
+
+This is C++17 code timing the codecs of bootstring.hpp with their
+adaptation and threshold tables against the same codecs computing
+adapt() and the thresholds, for each parameter set on short labels (a
+few code points each, where adapt() runs once per code point and the
+deltas are small) and on long ones.
+
+Build it on its own, for example:
+
+    c++ -std=c++17 -O2 -o bootstring-bench bootstring-bench.cpp
+
+*/
+
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <vector>
+
+#include "bootstring.hpp"
+
+namespace {
+
+/* arithmetic<P> is policy P with the tables turned off: */
+
+template <class P>
+struct arithmetic : P {
+  static constexpr bool tables = false;
+};
+
+enum {
+  short_length = 12,          /* code points in a short label     */
+  long_length = 1024,         /* code points in a long label      */
+  total_length = 1 << 14      /* code points timed per call       */
+};
+
+/* The corpora are those of punycode-bench.c, less the all-ASCII */
+/* one, which never calls adapt():                               */
+
+struct corpus {
+  const char *name;
+  unsigned basic_percent;     /* share of ASCII letters           */
+  punycode_uint first, count; /* range of non-basic code points   */
+};
+
+const corpus corpora[] = {
+  { "latin", 80, 0xC0, 0xC0 },
+  { "cjk", 10, 0x4E00, 0x5200 },
+  { "emoji", 20, 0x1F300, 0x300 }
+};
+
+unsigned long seed = 1;
+
+unsigned long next_random()
+{
+  seed = (seed * 1103515245UL + 12345UL) & 0xFFFFFFFFUL;
+  return seed >> 8;
+}
+
+/* A workload is total_length code points cut into labels of one */
+/* length, with their encodings under one parameter set:         */
+
+struct workload {
+  std::vector<punycode_uint> input;
+  std::vector<std::size_t> lengths;
+  std::string ace;
+  std::vector<std::size_t> ace_lengths;
+};
+
+template <class C>
+workload generate(const corpus &c, std::size_t length)
+{
+  workload w;
+  std::size_t j, k, ace_length;
+  char ace[8 * long_length];
+
+  w.input.resize(total_length);
+
+  for (j = 0;  j < total_length;  ++j) {
+    w.input[j] = next_random() % 100 < c.basic_percent ?
+                 'a' + next_random() % 26 :
+                 c.first + next_random() % c.count;
+  }
+
+  for (j = 0;  j < total_length;  j += length) {
+    k = total_length - j < length ? total_length - j : length;
+    ace_length = sizeof ace;
+    if (C::encode(k, &w.input[j], 0, &ace_length, ace) != punycode_success) {
+      std::fputs("encoding failed\n", stderr);
+      std::exit(EXIT_FAILURE);
+    }
+    w.lengths.push_back(k);
+    w.ace.append(ace, ace_length);
+    w.ace_lengths.push_back(ace_length);
+  }
+
+  return w;
+}
+
+/* time_calls() returns the average time of f() in nanoseconds per */
+/* code point, repeating it for at least 100 ms.                   */
+
+template <class F>
+double time_calls(F f)
+{
+  std::clock_t start, elapsed;
+  unsigned long calls = 0, batch = 1, j;
+
+  start = std::clock();
+
+  do {
+    for (j = 0;  j < batch;  ++j) f();
+    calls += batch;
+    batch *= 2;
+    elapsed = std::clock() - start;
+  } while (elapsed < CLOCKS_PER_SEC / 10);
+
+  return static_cast<double>(elapsed) / CLOCKS_PER_SEC * 1e9
+         / calls / total_length;
+}
+
+template <class C>
+double time_encode(const workload &w)
+{
+  char output[8 * long_length];
+
+  return time_calls([&] {
+    std::size_t j, in = 0, output_length;
+
+    for (j = 0;  j < w.lengths.size();  in += w.lengths[j++]) {
+      output_length = sizeof output;
+      if (C::encode(w.lengths[j], &w.input[in], 0, &output_length,
+                    output) != punycode_success) {
+        std::fputs("encoding failed\n", stderr);
+        std::exit(EXIT_FAILURE);
+      }
+    }
+  });
+}
+
+template <class C>
+double time_decode(const workload &w)
+{
+  punycode_uint output[long_length];
+
+  return time_calls([&] {
+    std::size_t j, in = 0, output_length;
+
+    for (j = 0;  j < w.ace_lengths.size();  in += w.ace_lengths[j++]) {
+      output_length = long_length;
+      if (C::decode(w.ace_lengths[j], &w.ace[in], &output_length,
+                    output, 0) != punycode_success) {
+        std::fputs("decoding failed\n", stderr);
+        std::exit(EXIT_FAILURE);
+      }
+    }
+  });
+}
+
+template <class P>
+void bench(const char *name)
+{
+  typedef bootstring::codec<P> table;
+  typedef bootstring::codec<arithmetic<P>> computed;
+  const std::size_t lengths[] = { short_length, long_length };
+  std::size_t j, k;
+  double encode_table, encode_computed, decode_table, decode_computed;
+
+  std::printf("\n%s, ns per code point\n", name);
+  std::printf("%-6s %6s %10s %10s %8s %10s %10s %8s\n",
+              "corpus", "length", "enc table", "enc arith", "speedup",
+              "dec table", "dec arith", "speedup");
+
+  for (j = 0;  j < sizeof corpora / sizeof *corpora;  ++j) {
+    for (k = 0;  k < sizeof lengths / sizeof *lengths;  ++k) {
+      workload w = generate<table>(corpora[j], lengths[k]);
+      encode_table = time_encode<table>(w);
+      encode_computed = time_encode<computed>(w);
+      decode_table = time_decode<table>(w);
+      decode_computed = time_decode<computed>(w);
+      std::printf("%-6s %6lu %10.2f %10.2f %8.2f %10.2f %10.2f %8.2f\n",
+                  corpora[j].name, static_cast<unsigned long>(lengths[k]),
+                  encode_table, encode_computed,
+                  encode_computed / encode_table,
+                  decode_table, decode_computed,
+                  decode_computed / decode_table);
+    }
+  }
+}
+
+} /* namespace */
+
+int main()
+{
+  bench<bootstring::punycode_params>("punycode");
+  bench<bootstring::base64_params>("base64");
+  bench<bootstring::base85_params>("base85");
+  return EXIT_SUCCESS;
+}
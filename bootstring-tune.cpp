@@ -0,0 +1,596 @@
+/*
+bootstring-tune.cpp
+
+This is C++17 code searching for the Bootstring parameters that encode
+a corpus of labels in the fewest characters.  punycode.js says of the
+tmin, tmax, skew, damp and initial_bias of its Base64Params and
+Base85Params that nobody checked whether they are good; this checks,
+for those two and for Punycode itself.
+
+Starting from the parameter set and from random valid ones, every core
+runs a coordinate descent, changing one parameter at a time by a step
+that halves whenever no change helps, on the total length of the
+encoded corpus.  The parameter sets that encoded it shortest are then
+timed encoding and decoding it, one at a time so that the timings do
+not disturb each other, and those that no other set beats on length,
+encoding time and decoding time together are printed, shortest first,
+as policies for bootstring.hpp or, with -J, as the numeric members of
+a Params object of punycode.js.
+
+Build it on its own, for example:
+
+    c++ -std=c++17 -O2 -pthread -o bootstring-tune bootstring-tune.cpp
+
+*/
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "bootstring.hpp"
+
+namespace {
+
+/* Limits on the numbers of the options, well beyond any useful run: */
+
+enum { max_starts = 1 << 16, max_candidates = 1000, max_repeats = 1000 };
+
+void usage(char **argv)
+{
+  std::fprintf(stderr,
+    "\n"
+    "%s [-p punycode|base64|base85] [-j threads] [-s starts]\n"
+    "    [-k candidates] [-r repeats] [-J] [file...]\n"
+    "\n"
+    "Reads host names or labels, one per line in UTF-8, from the files\n"
+    "or from stdin, and searches for the parameters of the given set\n"
+    "(default punycode) that encode the labels with non-ASCII code\n"
+    "points in the fewest characters.  The base, alphabet, delimiter\n"
+    "and initial_n stay those of the set.  The search makes the given\n"
+    "number of descents (default twice the threads, which default to\n"
+    "one per processor), the first from the set's own parameters.  The\n"
+    "given number of shortest results (default 12) are timed, taking\n"
+    "the best of the given number of runs (default 5), and the Pareto-\n"
+    "optimal ones are printed as bootstring.hpp policies, or with -J\n"
+    "in the form of punycode.js, searching with its adapt().  The\n"
+    "numbers must be positive, with at most four threads per processor,\n"
+    "%d starts, %d candidates and %d repeats.\n"
+    , argv[0], max_starts, max_candidates, max_repeats);
+  std::exit(EXIT_FAILURE);
+}
+
+void fail(const char *msg)
+{
+  std::fputs(msg, stderr);
+  std::exit(EXIT_FAILURE);
+}
+
+/* number() reads the argument of an option as a number from 1 to */
+/* max, printing the usage for anything else:  a sign, characters */
+/* after the digits, zero, or a larger value.                     */
+
+unsigned long number(const char *s, unsigned long max, char **argv)
+{
+  unsigned long n;
+  char *end;
+
+  if (!std::isdigit((unsigned char) s[0])) usage(argv);
+  n = std::strtoul(s, &end, 10);
+  if (*end != 0 || n < 1 || n > max) usage(argv);
+  return n;
+}
+
+/*** Corpus ***/
+
+/* The labels, as code points one after another: */
+
+struct corpus {
+  std::vector<punycode_uint> code_points;
+  std::vector<std::size_t> lengths;
+  unsigned long invalid = 0;      /* lines that were not UTF-8 */
+};
+
+/* utf8_decode() appends the code points of n bytes of UTF-8 to out, */
+/* returning false if they are not well-formed:                      */
+
+bool utf8_decode(const unsigned char *s, std::size_t n,
+                 std::vector<punycode_uint> &out)
+{
+  static const punycode_uint min[4] = { 0, 0x80, 0x800, 0x10000 };
+  std::size_t j = 0, k, extra;
+  punycode_uint c;
+
+  while (j < n) {
+    c = s[j];
+
+    if (c < 0x80) extra = 0;
+    else if (c - 0xC2 < 0x1E) extra = 1, c &= 0x1F;
+    else if (c - 0xE0 < 0x10) extra = 2, c &= 0x0F;
+    else if (c - 0xF0 < 0x05) extra = 3, c &= 0x07;
+    else return false;
+
+    if (n - j <= extra) return false;
+
+    for (k = 1;  k <= extra;  ++k) {
+      if ((s[j + k] & 0xC0) != 0x80) return false;
+      c = c << 6 | (s[j + k] & 0x3F);
+    }
+
+    if (c < min[extra] || c > 0x10FFFF || c - 0xD800 < 0x800) return false;
+    out.push_back(c);
+    j += extra + 1;
+  }
+
+  return true;
+}
+
+/* add_line() adds the labels of a host name that are not all ASCII, */
+/* the others encoding the same whatever the parameters:             */
+
+void add_line(corpus &c, const std::string &line)
+{
+  std::vector<punycode_uint> label;
+  std::size_t begin = 0, end;
+
+  for (;;) {
+    end = line.find('.', begin);
+    if (end == std::string::npos) end = line.size();
+
+    label.clear();
+    if (!utf8_decode(reinterpret_cast<const unsigned char *>(&line[begin]),
+                     end - begin, label)) {
+      ++c.invalid;
+      return;
+    }
+
+    if (std::any_of(label.begin(), label.end(),
+                    [](punycode_uint cp) { return cp >= 0x80; })) {
+      c.code_points.insert(c.code_points.end(), label.begin(), label.end());
+      c.lengths.push_back(label.size());
+    }
+
+    if (end == line.size()) return;
+    begin = end + 1;
+  }
+}
+
+void read_corpus(corpus &c, std::FILE *f)
+{
+  std::string line;
+  int ch;
+
+  while ((ch = std::getc(f)) != EOF) {
+    if (ch == '\n') {
+      if (!line.empty() && line.back() == '\r') line.pop_back();
+      add_line(c, line);
+      line.clear();
+    }
+    else line += static_cast<char>(ch);
+  }
+
+  if (!line.empty()) add_line(c, line);
+}
+
+/*** Scoring ***/
+
+/* The tunable parameters, as a point of the search space: */
+
+enum { tmin, tmax, skew, damp, initial_bias, dimensions };
+
+typedef std::array<punycode_uint, dimensions> point;
+
+bootstring::parameters with(bootstring::parameters p, const point &x)
+{
+  p.tmin = x[tmin];
+  p.tmax = x[tmax];
+  p.skew = x[skew];
+  p.damp = x[damp];
+  p.initial_bias = x[initial_bias];
+  return p;
+}
+
+/* A label may encode to at most this many chars per code point;  */
+/* parameters that need more (base - tmax = 1 makes the deltas    */
+/* unary) are out of the question, and this keeps them from being */
+/* slow to reject.                                                */
+
+enum { max_growth = 16 };
+
+const unsigned long long rejected = ~0ULL;
+
+/* encoded_length() returns the length of the encoded corpus, or  */
+/* rejected if a label fails to encode or does not decode back to  */
+/* itself.  Valid parameters can still overflow the decoder (tmin  */
+/* 0 with a large bias makes weights of 1), and a set whose output  */
+/* cannot be read must neither be recommended nor reach timing.     */
+
+unsigned long long encoded_length(const corpus &c,
+                                  const bootstring::dynamic_codec &codec)
+{
+  std::vector<char> output;
+  std::vector<punycode_uint> decoded;
+  unsigned long long total = 0;
+  std::size_t j, in = 0, length, decoded_length;
+
+  for (j = 0;  j < c.lengths.size();  in += c.lengths[j++]) {
+    length = max_growth * c.lengths[j] + 8;
+    if (output.size() < length) output.resize(length);
+    if (codec.encode(c.lengths[j], &c.code_points[in], 0, &length,
+                     output.data()) != punycode_success) {
+      return rejected;
+    }
+
+    decoded_length = c.lengths[j];
+    if (decoded.size() < decoded_length) decoded.resize(decoded_length);
+    if (codec.decode(length, output.data(), &decoded_length,
+                     decoded.data(), 0) != punycode_success ||
+        decoded_length != c.lengths[j] ||
+        !std::equal(decoded.begin(), decoded.begin() + decoded_length,
+                    c.code_points.begin() + in)) {
+      return rejected;
+    }
+
+    total += length;
+  }
+
+  return total;
+}
+
+/* The lengths found so far, shared by the searching threads: */
+
+class scores {
+public:
+  scores(const corpus &c, const bootstring::parameters &own)
+    : corpus_(c), own_(own) {}
+
+  unsigned long long operator()(const point &x)
+  {
+    bootstring::parameters p = with(own_, x);
+    unsigned long long length;
+
+    if (!p.valid()) return rejected;
+
+    {
+      std::lock_guard<std::mutex> hold(lock_);
+      auto found = known_.find(x);
+      if (found != known_.end()) return found->second;
+    }
+
+    length = encoded_length(corpus_, bootstring::dynamic_codec(p));
+
+    std::lock_guard<std::mutex> hold(lock_);
+    known_[x] = length;
+    return length;
+  }
+
+  std::vector<std::pair<unsigned long long, point>> shortest(std::size_t k)
+  {
+    std::vector<std::pair<unsigned long long, point>> all;
+
+    for (const auto &e : known_) {
+      if (e.second != rejected) all.emplace_back(e.second, e.first);
+    }
+
+    std::sort(all.begin(), all.end());
+    if (all.size() > k) all.resize(k);
+    return all;
+  }
+
+private:
+  const corpus &corpus_;
+  bootstring::parameters own_;
+  std::mutex lock_;
+  std::map<point, unsigned long long> known_;
+};
+
+/*** Search ***/
+
+/* The ranges searched, given the base:  the thresholds as they must */
+/* be, and the others generously around the values in use.          */
+
+point upper_bounds(punycode_uint base)
+{
+  return {{ base - 1, base - 1, 16 * base, 16 * 700, 8 * base }};
+}
+
+point random_point(punycode_uint base, std::mt19937 &random)
+{
+  point hi = upper_bounds(base), x;
+  std::size_t d;
+
+  for (d = 0;  d < dimensions;  ++d) x[d] = random() % (hi[d] + 1);
+  if (x[tmin] > x[tmax]) std::swap(x[tmin], x[tmax]);
+  x[tmin] = std::min<punycode_uint>(x[tmin], 1 + random() % 4);
+  x[skew] += 1;
+  x[damp] += 2;
+  return x;
+}
+
+/* descend() moves from x while a single parameter can be changed  */
+/* by its step to shorten the encoding, halving every step once    */
+/* none helps, and stops when the steps are down to nothing.       */
+
+void descend(point x, punycode_uint base, scores &score)
+{
+  point hi = upper_bounds(base), step, y;
+  unsigned long long best = score(x), s;
+  std::size_t d;
+  bool moved;
+  int sign;
+
+  for (d = 0;  d < dimensions;  ++d) {
+    step[d] = std::max<punycode_uint>(hi[d] / 8, 1);
+  }
+
+  for (;;) {
+    moved = false;
+
+    for (d = 0;  d < dimensions;  ++d) {
+      for (sign = -1;  sign <= 1;  sign += 2) {
+        y = x;
+        if (sign < 0 && y[d] < step[d]) continue;
+        y[d] = sign < 0 ? y[d] - step[d] : y[d] + step[d];
+        if (y[d] > hi[d] + 2) continue;
+
+        s = score(y);
+
+        if (s < best) {
+          best = s;
+          x = y;
+          moved = true;
+          break;
+        }
+      }
+    }
+
+    if (moved) continue;
+    if (*std::max_element(step.begin(), step.end()) == 1) return;
+    for (d = 0;  d < dimensions;  ++d) {
+      step[d] = std::max<punycode_uint>(step[d] / 2, 1);
+    }
+  }
+}
+
+/*** Timing ***/
+
+struct candidate {
+  point x;
+  unsigned long long length;
+  double encode_ns, decode_ns;    /* per code point */
+};
+
+/* time_candidate() takes the best of repeats runs over the corpus: */
+
+void time_candidate(candidate &k, const corpus &c,
+                    const bootstring::parameters &own, unsigned repeats)
+{
+  typedef std::chrono::steady_clock clock;
+  bootstring::dynamic_codec codec(with(own, k.x));
+  std::size_t longest =
+    *std::max_element(c.lengths.begin(), c.lengths.end());
+  std::vector<char> scratch(max_growth * longest + 8);
+  std::vector<punycode_uint> output(longest);
+  std::string ace;
+  std::vector<std::size_t> ace_lengths;
+  std::size_t j, in, length;
+  double encode = 1e300, decode = 1e300, seconds;
+  clock::time_point start;
+  unsigned r;
+
+  for (j = 0, in = 0;  j < c.lengths.size();  in += c.lengths[j++]) {
+    length = scratch.size();
+    codec.encode(c.lengths[j], &c.code_points[in], 0, &length,
+                 scratch.data());
+    ace.append(scratch.data(), length);
+    ace_lengths.push_back(length);
+  }
+
+  for (r = 0;  r < repeats;  ++r) {
+    start = clock::now();
+    for (j = 0, in = 0;  j < c.lengths.size();  in += c.lengths[j++]) {
+      length = scratch.size();
+      codec.encode(c.lengths[j], &c.code_points[in], 0, &length,
+                   scratch.data());
+    }
+    seconds = std::chrono::duration<double>(clock::now() - start).count();
+    encode = std::min(encode, seconds);
+
+    start = clock::now();
+    for (j = 0, in = 0;  j < ace_lengths.size();  in += ace_lengths[j++]) {
+      length = output.size();
+      if (codec.decode(ace_lengths[j], &ace[in], &length, output.data(),
+                       0) != punycode_success) {
+        fail("decoding failed\n");
+      }
+    }
+    seconds = std::chrono::duration<double>(clock::now() - start).count();
+    decode = std::min(decode, seconds);
+  }
+
+  k.encode_ns = encode * 1e9 / c.code_points.size();
+  k.decode_ns = decode * 1e9 / c.code_points.size();
+}
+
+bool dominates(const candidate &a, const candidate &b)
+{
+  return a.length <= b.length && a.encode_ns <= b.encode_ns &&
+         a.decode_ns <= b.decode_ns &&
+         (a.length < b.length || a.encode_ns < b.encode_ns ||
+          a.decode_ns < b.decode_ns);
+}
+
+/*** Output ***/
+
+/* print() prints candidate k as a policy deriving from the one in */
+/* use, or as the members of a punycode.js Params object:           */
+
+void print(const candidate &k, const candidate &own,
+           const bootstring::parameters &p, const char *name,
+           unsigned number, bool js)
+{
+  double change = 100.0 * (static_cast<double>(k.length) / own.length - 1);
+  unsigned long x[dimensions];
+  std::size_t d;
+
+  for (d = 0;  d < dimensions;  ++d) x[d] = k.x[d];
+
+  if (js) {
+    std::printf("// %llu chars (%+.2f%%), encode %.1f ns, decode %.1f ns\n"
+                "\tbase: %lu, tmin: %lu, tmax:%lu, skew:%lu, damp:%lu,\n"
+                "\tinitial_bias:%lu, initial_n:%lu,\n\n",
+                k.length, change, k.encode_ns, k.decode_ns,
+                static_cast<unsigned long>(p.base), x[tmin], x[tmax],
+                x[skew], x[damp], x[initial_bias],
+                static_cast<unsigned long>(p.initial_n));
+    return;
+  }
+
+  std::printf("/* %llu chars (%+.2f%%), encode %.1f ns, decode %.1f ns */\n"
+              "struct %s_%u : bootstring::%s {\n"
+              "  static constexpr punycode_uint tmin = %lu, tmax = %lu, "
+              "skew = %lu,\n"
+              "    damp = %lu, initial_bias = %lu;\n"
+              "};\n\n",
+              k.length, change, k.encode_ns, k.decode_ns,
+              name, number, name,
+              x[tmin], x[tmax], x[skew], x[damp], x[initial_bias]);
+}
+
+} /* namespace */
+
+int main(int argc, char **argv)
+{
+  const char *name = "punycode_params";
+  bootstring::parameters own =
+    bootstring::parameters::of<bootstring::punycode_params>();
+  unsigned processors = std::max(std::thread::hardware_concurrency(), 1u);
+  unsigned threads = processors;
+  unsigned starts = 0, repeats = 5, j;
+  std::size_t k = 12;
+  bool js = false;
+  int argi = 1;
+  corpus c;
+
+  for (;  argi < argc && argv[argi][0] == '-' && argv[argi][1];  ++argi) {
+    if (std::strcmp(argv[argi], "-J") == 0) {
+      js = true;
+      continue;
+    }
+
+    if (argi + 1 == argc || std::strlen(argv[argi]) != 2) usage(argv);
+
+    switch (argv[argi][1]) {
+      case 'p':
+        ++argi;
+        if (std::strcmp(argv[argi], "punycode") == 0) {}
+        else if (std::strcmp(argv[argi], "base64") == 0) {
+          name = "base64_params";
+          own = bootstring::parameters::of<bootstring::base64_params>();
+        }
+        else if (std::strcmp(argv[argi], "base85") == 0) {
+          name = "base85_params";
+          own = bootstring::parameters::of<bootstring::base85_params>();
+        }
+        else usage(argv);
+        break;
+
+      case 'j': threads = number(argv[++argi], 4 * processors, argv);  break;
+      case 's': starts = number(argv[++argi], max_starts, argv);  break;
+      case 'k': k = number(argv[++argi], max_candidates, argv);  break;
+      case 'r': repeats = number(argv[++argi], max_repeats, argv);  break;
+      default: usage(argv);
+    }
+  }
+
+  /* punycode.js damps its own way, for every parameter set: */
+
+  if (js) own.js_damping = true;
+
+  if (starts == 0) starts = 2 * threads;
+
+  if (argi == argc) read_corpus(c, stdin);
+
+  for (;  argi < argc;  ++argi) {
+    std::FILE *f = std::fopen(argv[argi], "rb");
+    if (f == 0) {
+      std::perror(argv[argi]);
+      return EXIT_FAILURE;
+    }
+    read_corpus(c, f);
+    std::fclose(f);
+  }
+
+  if (c.invalid > 0) {
+    std::fprintf(stderr, "%s: skipped %lu lines that are not UTF-8\n",
+                 argv[0], c.invalid);
+  }
+  if (c.lengths.empty()) fail("no labels with non-ASCII code points\n");
+
+  /* Search on every core: */
+
+  point start = {{ own.tmin, own.tmax, own.skew, own.damp,
+                   own.initial_bias }};
+  scores score(c, own);
+  std::atomic<unsigned> next(0);
+  std::vector<std::thread> pool;
+
+  for (j = 0;  j < threads;  ++j) {
+    pool.emplace_back([&] {
+      unsigned s;
+
+      while ((s = next++) < starts) {
+        std::mt19937 random(s);
+        descend(s == 0 ? start : random_point(own.base, random), own.base,
+                score);
+      }
+    });
+  }
+
+  for (auto &t : pool) t.join();
+
+  /* Time the shortest, and the parameters in use for comparison: */
+
+  std::vector<candidate> candidates, front;
+  candidate mine = { start, score(start), 0, 0 };
+
+  time_candidate(mine, c, own, repeats);
+
+  for (const auto &e : score.shortest(k)) {
+    candidate cand = { e.second, e.first, 0, 0 };
+    if (cand.x == start) cand = mine;
+    else time_candidate(cand, c, own, repeats);
+    candidates.push_back(cand);
+  }
+
+  for (const candidate &a : candidates) {
+    if (std::none_of(candidates.begin(), candidates.end(),
+                     [&](const candidate &b) { return dominates(b, a); })) {
+      front.push_back(a);
+    }
+  }
+
+  std::printf(js ? "// %lu labels, %lu code points:  %s takes %llu chars,\n"
+                   "// encode %.1f ns, decode %.1f ns per code point\n\n"
+                 : "/* %lu labels, %lu code points:  %s takes %llu chars,\n"
+                   "   encode %.1f ns, decode %.1f ns per code point */\n\n",
+              static_cast<unsigned long>(c.lengths.size()),
+              static_cast<unsigned long>(c.code_points.size()), name,
+              mine.length, mine.encode_ns, mine.decode_ns);
+
+  for (j = 0;  j < front.size();  ++j) {
+    print(front[j], mine, own, name, j + 1, js);
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,1173 @@
+/*
+bootstring.hpp
+
+This is C++17 code implementing the general Bootstring algorithm of
+RFC 3492 over a parameter policy, the counterpart of the Params objects
+in punycode.js.  Everything that depends only on the parameters (the
+digit tables, the constants in adapt(), the divisions by base - t, and
+tables of bias adaptations and thresholds) is worked out at compile time
+for each policy, and the encoder itself can run at compile time.
+Instantiations for Punycode and for the Base64 and Base85 parameter
+sets of punycode.js are provided at the end, followed by a codec whose
+parameters are chosen at run time.  It uses the status codes and code
+point type of punycode.h but does not need punycode.c.
+
+*/
+
+#ifndef BOOTSTRING_HPP
+#define BOOTSTRING_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "punycode.h"
+
+namespace bootstring {
+
+namespace detail {
+
+/* fold(c) lowers an ASCII letter for a case_insensitive alphabet: */
+
+constexpr unsigned char fold(char c, bool case_insensitive)
+{
+  return case_insensitive && static_cast<unsigned char>(c) - 65u < 26
+         ? static_cast<unsigned char>(c | 0x20)
+         : static_cast<unsigned char>(c);
+}
+
+/* valid_alphabet() checks what the tables below assume: */
+
+constexpr bool valid_alphabet(const char *alphabet, punycode_uint base,
+                              punycode_uint initial_n, char delimiter,
+                              bool case_insensitive)
+{
+  std::size_t j = 0, k = 0;
+
+  for (j = 0;  j < base;  ++j) {
+    if (alphabet[j] == 0) return false;
+    if (static_cast<unsigned char>(alphabet[j]) >= initial_n) return false;
+    if (alphabet[j] == delimiter) return false;
+    for (k = 0;  k < j;  ++k) {
+      if (fold(alphabet[k], case_insensitive) ==
+          fold(alphabet[j], case_insensitive)) {
+        return false;
+      }
+    }
+  }
+
+  return alphabet[base] == 0;
+}
+
+template <class P>
+constexpr bool valid_alphabet()
+{
+  return valid_alphabet(P::alphabet, P::base, P::initial_n, P::delimiter,
+                        P::case_insensitive);
+}
+
+/*** Digit tables ***/
+
+struct digit_tables {
+  char encode[2][256];          /* [flag][d]: unflagged and flagged  */
+  unsigned char decode[256];    /* digit value, or base if none      */
+};
+
+template <class P>
+constexpr digit_tables make_digit_tables()
+{
+  digit_tables tables{};
+  char c = 0;
+  unsigned j = 0;
+
+  for (j = 0;  j < 256;  ++j) {
+    tables.decode[j] = static_cast<unsigned char>(P::base);
+  }
+
+  for (j = 0;  j < P::base;  ++j) {
+    c = P::alphabet[j];
+    tables.encode[0][j] = tables.encode[1][j] = c;
+    tables.decode[static_cast<unsigned char>(c)] =
+      static_cast<unsigned char>(j);
+
+    if (P::case_insensitive &&
+        static_cast<unsigned char>(c | 0x20) - 97u < 26) {
+      tables.encode[0][j] = static_cast<char>(c | 0x20);
+      tables.encode[1][j] = static_cast<char>(c & ~0x20);
+      tables.decode[static_cast<unsigned char>(c ^ 0x20)] =
+        static_cast<unsigned char>(j);
+    }
+  }
+
+  return tables;
+}
+
+/*** Division tables ***/
+
+/* Every digit divides by base - t for some t in tmin..tmax, so     */
+/* with 32-bit code points each of those divisors gets the constant */
+/* c = ceil(2**64 / d) of Lemire, Kaser and Kurz, "Faster remainder */
+/* by direct computation", which turns the quotient and remainder   */
+/* into multiplications.  Elsewhere the hardware divide is used.    */
+
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 wide;
+
+template <class P>
+constexpr bool fast_division()
+{
+  return sizeof (punycode_uint) <= 4 && P::base - P::tmax >= 2;
+}
+#else
+typedef unsigned long long wide;
+
+template <class P>
+constexpr bool fast_division() { return false; }
+#endif
+
+struct division_tables {
+  unsigned long long magic[256];    /* [t]: ceil(2**64 / (base - t))  */
+  punycode_uint max_weight[256];    /* [t]: maxint / (base - t)       */
+};
+
+template <class P>
+constexpr division_tables make_division_tables()
+{
+  division_tables tables{};
+  punycode_uint t = 0;
+
+  for (t = P::tmin;  t <= P::tmax;  ++t) {
+    tables.magic[t] = ~0ULL / (P::base - t) + 1;
+    tables.max_weight[t] = static_cast<punycode_uint>(-1) / (P::base - t);
+  }
+
+  return tables;
+}
+
+/*** Adaptation tables ***/
+
+/* scaled_bias(delta) is the rest of adapt() once delta has been */
+/* damped and scaled, including its division loop:               */
+
+template <class P>
+constexpr punycode_uint scaled_bias(punycode_uint delta)
+{
+  punycode_uint k = 0;
+
+  for (k = 0;  delta > ((P::base - P::tmin) * P::tmax) / 2;  k += P::base) {
+    delta /= P::base - P::tmin;
+  }
+
+  return k + (P::base - P::tmin + 1) * delta / (delta + P::skew);
+}
+
+/* scaled_bias() grows with delta, each division adding base while   */
+/* the last term stays below base - tmin + 1, so no bias is above    */
+/* max_bias(), and every digit position from threshold_positions()  */
+/* on has k >= bias + tmax, giving the threshold tmax.               */
+
+template <class P>
+constexpr punycode_uint max_bias()
+{
+  punycode_uint bias = scaled_bias<P>(static_cast<punycode_uint>(-1));
+  return P::initial_bias > bias ? P::initial_bias : bias;
+}
+
+template <class P>
+constexpr std::size_t threshold_positions()
+{
+  return (max_bias<P>() + P::tmax) / P::base + 1;
+}
+
+/* Scaled deltas below adapt_range are looked up; they cover most   */
+/* deltas of short labels and of dense scripts, and larger ones are */
+/* rare enough for the division loop.                               */
+
+enum { adapt_range = 1 << 12 };
+
+template <class P>
+struct bias_tables {
+  typedef std::conditional_t<max_bias<P>() < 256,
+                             unsigned char, unsigned short> bias_type;
+
+  bias_type adapt[adapt_range];     /* [delta]: scaled_bias(delta)    */
+  unsigned char threshold           /* [bias][p]: threshold of digit  */
+    [max_bias<P>() + 1]             /* position p, counting from 0    */
+    [threshold_positions<P>()];
+};
+
+template <class P>
+constexpr bias_tables<P> make_bias_tables()
+{
+  bias_tables<P> tables{};
+  punycode_uint bias = 0, k = 0;
+  std::size_t j = 0;
+
+  for (j = 0;  j < adapt_range;  ++j) {
+    tables.adapt[j] = static_cast<typename bias_tables<P>::bias_type>(
+                        scaled_bias<P>(static_cast<punycode_uint>(j)));
+  }
+
+  for (bias = 0;  bias <= max_bias<P>();  ++bias) {
+    for (j = 0;  j < threshold_positions<P>();  ++j) {
+      k = static_cast<punycode_uint>((j + 1) * P::base);
+      tables.threshold[bias][j] = static_cast<unsigned char>(
+        k <= bias + P::tmin ? P::tmin :
+        k >= bias + P::tmax ? P::tmax : k - bias);
+    }
+  }
+
+  return tables;
+}
+
+/* A policy may turn the tables off with a tables member, as */
+/* bootstring-bench.cpp does to time the arithmetic:         */
+
+template <class P, class = void>
+struct tabulated : std::true_type {};
+
+template <class P>
+struct tabulated<P, std::void_t<decltype(P::tables)>>
+  : std::integral_constant<bool, P::tables> {};
+
+/* and may damp as punycode.js does with a js_damping member: */
+
+template <class P, class = void>
+struct js_damped : std::false_type {};
+
+template <class P>
+struct js_damped<P, std::void_t<decltype(P::js_damping)>>
+  : std::integral_constant<bool, P::js_damping> {};
+
+} /* namespace detail */
+
+/*
+    A parameter policy is a class with these static constexpr members,
+    named as in RFC 3492 section 5:
+
+        base, tmin, tmax, skew, damp, initial_bias, initial_n
+            The Bootstring parameters, of type punycode_uint.  Code
+            points below initial_n are basic.
+
+        delimiter
+            The delimiter, a basic code point (char).
+
+        alphabet
+            A string of base basic code points (const char *); the
+            character at index d represents digit value d.
+
+        case_insensitive
+            Whether the alphabet's letters are also accepted in the
+            other case when decoding, which lets case flags be carried
+            by the case of the final digit of each delta, as Punycode
+            does.  It must be false for alphabets containing both cases
+            of a letter.
+
+    A policy may also have a static constexpr bool member tables; if
+    it is false, adapt() and the thresholds are computed instead of
+    looked up.  And it may have a static constexpr bool member
+    js_damping; if it is true, adapt() halves the first delta and
+    divides later ones by damp, as adapt() in punycode.js does, instead
+    of the reverse, as RFC 3492 section 6.1 does.
+*/
+
+template <class P>
+class codec {
+public:
+  static constexpr enum punycode_status encode(
+    std::size_t input_length,
+    const punycode_uint input[],
+    const unsigned char case_flags[],
+    std::size_t *output_length,
+    char output[] );
+
+  static enum punycode_status decode(
+    std::size_t input_length,
+    const char input[],
+    std::size_t *output_length,
+    punycode_uint output[],
+    unsigned char case_flags[] );
+
+  /*
+      encode() and decode() take the same arguments and return the same
+      values as punycode_encode() and punycode_decode() in punycode.h,
+      with "basic code point" meaning one below P::initial_n.  For a
+      policy that is not case_insensitive, case flags still apply to
+      basic code points, but the case flags of other code points are
+      not encoded and decode as unflagged.  encode() is constexpr, so
+      it can also run at compile time, as punycode.hpp does for host
+      name literals.
+  */
+
+  class decoder;
+  class encoder;
+
+  /*
+      decoder and encoder convert input that arrives in pieces; they
+      are described below.
+  */
+
+private:
+  static constexpr punycode_uint base = P::base, tmin = P::tmin,
+    tmax = P::tmax, skew = P::skew, damp = P::damp,
+    initial_bias = P::initial_bias, initial_n = P::initial_n;
+
+  /* maxint is the maximum value of a punycode_uint variable: */
+  static constexpr punycode_uint maxint = static_cast<punycode_uint>(-1);
+
+  static_assert(tmin <= tmax && tmax <= base - 1, "need tmin <= tmax < base");
+  static_assert(skew >= 1 && damp >= 2, "need skew >= 1 and damp >= 2");
+  static_assert(initial_bias % base <= base - tmin, "bad initial_bias");
+  static_assert(base <= 256 && initial_n <= 256, "digits must be chars");
+  static_assert(static_cast<unsigned char>(P::delimiter) < initial_n,
+                "the delimiter must be a basic code point");
+  static_assert(detail::valid_alphabet<P>(), "the alphabet must have base "
+                "distinct basic code points, excluding the delimiter");
+
+  /*** Digits ***/
+
+  static constexpr detail::digit_tables digits =
+    detail::make_digit_tables<P>();
+
+  static constexpr punycode_uint decode_digit(char c)
+  {
+    return digits.decode[static_cast<unsigned char>(c)];
+  }
+
+  static constexpr char encode_digit(punycode_uint d, int flag)
+  {
+    return digits.encode[flag != 0][d];
+  }
+
+  /* basic(cp) and flagged(bcp) are as in punycode.c, and */
+  /* encode_basic() forces the case of an ASCII letter:   */
+
+  static constexpr bool basic(punycode_uint cp) { return cp < initial_n; }
+
+  static constexpr bool flagged(punycode_uint bcp) { return bcp - 65 < 26; }
+
+  static constexpr char encode_basic(punycode_uint bcp, int flag)
+  {
+    bcp -= (bcp - 97 < 26) << 5;
+    return static_cast<char>(bcp + ((!flag && (bcp - 65 < 26)) << 5));
+  }
+
+  /*** Division by base - t ***/
+
+  static constexpr detail::division_tables division =
+    detail::make_division_tables<P>();
+
+  /* divide(q,t) sets *r to q % (base - t) and returns q / (base - t): */
+
+  static constexpr punycode_uint divide(punycode_uint q, punycode_uint t,
+                                        punycode_uint *r)
+  {
+    if constexpr (detail::fast_division<P>()) {
+      unsigned long long low = division.magic[t] * q;
+      *r = static_cast<punycode_uint>(
+             (static_cast<detail::wide>(low) * (base - t)) >> 64);
+      return static_cast<punycode_uint>(
+               (static_cast<detail::wide>(division.magic[t]) * q) >> 64);
+    }
+    else {
+      *r = q % (base - t);
+      return q / (base - t);
+    }
+  }
+
+  /*** Bias adaptation function ***/
+
+  static constexpr bool tables = detail::tabulated<P>::value;
+  static constexpr bool js_damping = detail::js_damped<P>::value;
+
+  static_assert(detail::max_bias<P>() < 65536, "bias too large for tables");
+
+  static constexpr detail::bias_tables<P> biases =
+    detail::make_bias_tables<P>();
+
+  /* threshold(p,bias) is the threshold of digit position p, which */
+  /* clamps k - bias to tmin..tmax, with k = base * (p + 1):      */
+
+  static constexpr punycode_uint threshold(punycode_uint p,
+                                           punycode_uint bias)
+  {
+    if constexpr (tables) {
+      return p < detail::threshold_positions<P>()
+             ? biases.threshold[bias][p] : tmax;
+    }
+    else {
+      punycode_uint k = base * (p + 1);
+
+      return k <= bias /* + tmin */ ? tmin :     /* +tmin not needed */
+             k >= bias + tmax ? tmax : k - bias;
+    }
+  }
+
+  static constexpr punycode_uint adapt(
+    punycode_uint delta, punycode_uint numpoints, bool firsttime )
+  {
+    delta = firsttime != js_damping ? delta / damp : delta >> 1;
+    delta += delta / numpoints;
+
+    if constexpr (tables) {
+      if (delta < detail::adapt_range) return biases.adapt[delta];
+    }
+
+    return detail::scaled_bias<P>(delta);
+  }
+};
+
+/*** Main encode function ***/
+
+template <class P>
+constexpr enum punycode_status codec<P>::encode(
+  std::size_t input_length_orig,
+  const punycode_uint input[],
+  const unsigned char case_flags[],
+  std::size_t *output_length,
+  char output[] )
+{
+  punycode_uint input_length = 0, n = 0, delta = 0, h = 0, b = 0, bias = 0,
+    j = 0, m = 0, q = 0, p = 0, t = 0, r = 0;
+  std::size_t out = 0, max_out = 0;
+
+  if (input_length_orig > maxint) return punycode_overflow;
+  input_length = static_cast<punycode_uint>(input_length_orig);
+
+  n = initial_n;
+  delta = 0;
+  out = 0;
+  max_out = *output_length;
+  bias = initial_bias;
+
+  /* Handle the basic code points: */
+
+  for (j = 0;  j < input_length;  ++j) {
+    if (basic(input[j])) {
+      if (max_out - out < 2) return punycode_big_output;
+      output[out++] = case_flags ?
+        encode_basic(input[j], case_flags[j]) : static_cast<char>(input[j]);
+    }
+  }
+
+  h = b = static_cast<punycode_uint>(out);
+  if (b > 0) output[out++] = P::delimiter;
+
+  /* Main encoding loop: */
+
+  while (h < input_length) {
+    /* All non-basic code points < n have been     */
+    /* handled already.  Find the next larger one: */
+
+    for (m = maxint, j = 0;  j < input_length;  ++j) {
+      if (input[j] >= n && input[j] < m) m = input[j];
+    }
+
+    if (m - n > (maxint - delta) / (h + 1)) return punycode_overflow;
+    delta += (m - n) * (h + 1);
+    n = m;
+
+    for (j = 0;  j < input_length;  ++j) {
+      /* Every basic code point is below initial_n <= n, */
+      /* so they need not be checked for separately:     */
+
+      if (input[j] < n) {
+        if (++delta == 0) return punycode_overflow;
+      }
+
+      if (input[j] == n) {
+        /* Represent delta as a generalized variable-length integer: */
+
+        for (q = delta, p = 0;  ;  ++p) {
+          if (out >= max_out) return punycode_big_output;
+          t = threshold(p, bias);
+          if (q < t) break;
+          q = divide(q - t, t, &r);
+          output[out++] = encode_digit(t + r, 0);
+        }
+
+        output[out++] = encode_digit(q, P::case_insensitive &&
+                                        case_flags && case_flags[j]);
+        bias = adapt(delta, h + 1, h == b);
+        delta = 0;
+        ++h;
+      }
+    }
+
+    ++delta, ++n;
+  }
+
+  *output_length = out;
+  return punycode_success;
+}
+
+/*** Main decode function ***/
+
+template <class P>
+enum punycode_status codec<P>::decode(
+  std::size_t input_length,
+  const char input[],
+  std::size_t *output_length,
+  punycode_uint output[],
+  unsigned char case_flags[] )
+{
+  punycode_uint n, out, i, max_out, bias, oldi, w, p, digit, t;
+  std::size_t b, j, in;
+
+  n = initial_n;
+  out = i = 0;
+  max_out = *output_length > maxint ? maxint
+            : static_cast<punycode_uint>(*output_length);
+  bias = initial_bias;
+
+  /* Let b be the number of input code points before the last */
+  /* delimiter, or 0 if there is none, then copy them:        */
+
+  for (b = j = 0;  j < input_length;  ++j) {
+    if (input[j] == P::delimiter) b = j;
+  }
+
+  if (b > max_out) return punycode_big_output;
+
+  for (j = 0;  j < b;  ++j) {
+    punycode_uint c = static_cast<unsigned char>(input[j]);
+    if (case_flags) case_flags[out] = flagged(c);
+    if (!basic(c)) return punycode_bad_input;
+    output[out++] = c;
+  }
+
+  /* Main decoding loop: */
+
+  for (in = b > 0 ? b + 1 : 0;  in < input_length;  ++out) {
+    for (oldi = i, w = 1, p = 0;  ;  ++p) {
+      if (in >= input_length) return punycode_bad_input;
+      digit = decode_digit(input[in++]);
+      if (digit >= base) return punycode_bad_input;
+      if (digit > (maxint - i) / w) return punycode_overflow;
+      i += digit * w;
+      t = threshold(p, bias);
+      if (digit < t) break;
+      if (w > division.max_weight[t]) return punycode_overflow;
+      w *= (base - t);
+    }
+
+    bias = adapt(i - oldi, out + 1, oldi == 0);
+
+    /* i was supposed to wrap around from out+1 to 0,   */
+    /* incrementing n each time, so we'll fix that now: */
+
+    if (i / (out + 1) > maxint - n) return punycode_overflow;
+    n += i / (out + 1);
+    i %= (out + 1);
+
+    /* Insert n at position i of the output: */
+
+    if (out >= max_out) return punycode_big_output;
+
+    if (case_flags) {
+      std::memmove(case_flags + i + 1, case_flags + i, out - i);
+      /* Case of last ASCII code point determines case flag: */
+      case_flags[i] = P::case_insensitive && flagged(
+        static_cast<unsigned char>(input[in - 1]));
+    }
+
+    std::memmove(output + i + 1, output + i, (out - i) * sizeof *output);
+    output[i++] = n;
+  }
+
+  *output_length = out;
+  return punycode_success;
+}
+
+/*** Streaming decoder ***/
+
+/*
+    A codec<P>::decoder decodes input fed to it in pieces of any size,
+    keeping the decoder state (n, i, bias, w, p) and the output between
+    calls, so that a large payload is decoded while it arrives instead
+    of being collected first.
+
+        feed(input_length, input)
+            Decodes the next piece.  It returns punycode_bad_input if
+            the input can no longer be valid whatever follows, and
+            punycode_success otherwise, including when the input so
+            far is invalid only if it ends here.
+
+        finish()
+            Ends the input and returns the status codec<P>::decode()
+            would return for the whole of it, given enough output space.
+            Feeding after finish() starts a new input.
+
+        output(), case_flags()
+            The code points and case flags decoded so far, which are
+            final once finish() has returned punycode_success.
+
+    The basic code points are the ones before the last delimiter, which
+    is not known until the end, so the decoder assumes that the latest
+    delimiter seen is the last.  It keeps the characters fed since then
+    and, if another delimiter arrives, removes the code points it has
+    decoded from them and appends them as basic code points instead.
+    That costs time proportional to the output for each delimiter after
+    which something was decoded, so input with many delimiters that are
+    followed by digits is quadratic, like codec<P>::decode().
+*/
+
+template <class P>
+class codec<P>::decoder {
+public:
+  decoder() { restart(); }
+
+  enum punycode_status feed(std::size_t input_length, const char input[]);
+  enum punycode_status finish();
+
+  const std::vector<punycode_uint> &output() const { return output_; }
+  const std::vector<unsigned char> &case_flags() const { return flags_; }
+
+private:
+  void restart();
+  void end_basic();
+  enum punycode_status digit(char c);
+
+  std::vector<punycode_uint> output_;
+  std::vector<unsigned char> flags_;
+  std::string pending_;           /* fed since the latest delimiter    */
+  std::size_t position_;          /* number of characters fed          */
+  std::size_t basics_;            /* basic code points in output_      */
+  bool delimited_;                /* a delimiter seen past position 0  */
+  bool ended_;                    /* finish() was the last call        */
+  enum punycode_status status_;   /* of everything since the delimiter */
+  enum punycode_status broken_;   /* of everything before it           */
+  punycode_uint n_, i_, bias_, oldi_, w_, p_;
+};
+
+template <class P>
+void codec<P>::decoder::restart()
+{
+  output_.clear();
+  flags_.clear();
+  pending_.clear();
+  position_ = basics_ = 0;
+  delimited_ = ended_ = false;
+  status_ = broken_ = punycode_success;
+  n_ = initial_n;
+  i_ = oldi_ = 0;
+  bias_ = initial_bias;
+  w_ = 1;
+  p_ = 0;
+}
+
+/* end_basic() handles a delimiter after position 0:  everything fed */
+/* before it is basic, so the code points decoded since the previous */
+/* delimiter are dropped and the characters they came from appended. */
+
+template <class P>
+void codec<P>::decoder::end_basic()
+{
+  std::size_t j, kept = 0;
+
+  if (output_.size() > basics_) {
+    for (j = 0;  j < output_.size();  ++j) {
+      if (basic(output_[j])) {
+        output_[kept] = output_[j];
+        flags_[kept++] = flags_[j];
+      }
+    }
+
+    output_.resize(kept);
+    flags_.resize(kept);
+  }
+
+  if (delimited_) pending_.insert(pending_.begin(), P::delimiter);
+
+  for (j = 0;  j < pending_.size();  ++j) {
+    punycode_uint c = static_cast<unsigned char>(pending_[j]);
+    if (!basic(c)) broken_ = punycode_bad_input;
+    output_.push_back(c);
+    flags_.push_back(flagged(c));
+  }
+
+  pending_.clear();
+  delimited_ = true;
+  basics_ = output_.size();
+  status_ = punycode_success;
+  n_ = initial_n;
+  i_ = oldi_ = 0;
+  bias_ = initial_bias;
+  w_ = 1;
+  p_ = 0;
+}
+
+/* digit() takes one step of the inner loop of codec<P>::decode(): */
+
+template <class P>
+enum punycode_status codec<P>::decoder::digit(char c)
+{
+  punycode_uint d = decode_digit(c), t, out;
+
+  if (d >= base) return punycode_bad_input;
+  if (d > (maxint - i_) / w_) return punycode_overflow;
+  i_ += d * w_;
+  t = threshold(p_, bias_);
+
+  if (d >= t) {
+    if (w_ > division.max_weight[t]) return punycode_overflow;
+    w_ *= base - t;
+    ++p_;
+    return punycode_success;
+  }
+
+  /* The delta is complete, so insert its code point: */
+
+  out = static_cast<punycode_uint>(output_.size());
+  bias_ = adapt(i_ - oldi_, out + 1, oldi_ == 0);
+  if (i_ / (out + 1) > maxint - n_) return punycode_overflow;
+  n_ += i_ / (out + 1);
+  i_ %= (out + 1);
+  if (out == maxint) return punycode_big_output;
+
+  output_.insert(output_.begin() + i_, n_);
+  flags_.insert(flags_.begin() + i_, P::case_insensitive &&
+                  flagged(static_cast<unsigned char>(c)));
+  oldi_ = ++i_;
+  w_ = 1;
+  p_ = 0;
+  return punycode_success;
+}
+
+template <class P>
+enum punycode_status codec<P>::decoder::feed(
+  std::size_t input_length,
+  const char input[] )
+{
+  std::size_t j;
+
+  if (ended_) restart();
+
+  for (j = 0;  j < input_length;  ++j, ++position_) {
+    if (input[j] == P::delimiter && position_ > 0) {
+      end_basic();
+      continue;
+    }
+
+    /* Until another delimiter arrives, this is a digit: */
+
+    pending_ += input[j];
+    if (status_ == punycode_success) status_ = digit(input[j]);
+  }
+
+  return broken_;
+}
+
+template <class P>
+enum punycode_status codec<P>::decoder::finish()
+{
+  ended_ = true;
+  if (broken_ != punycode_success) return broken_;
+  if (status_ != punycode_success) return status_;
+
+  /* A delta cut off by the end of the input: */
+
+  return w_ != 1 || p_ != 0 ? punycode_bad_input : punycode_success;
+}
+
+/*** Streaming encoder ***/
+
+/*
+    A codec<P>::encoder takes input in pieces like codec<P>::decoder,
+    with feed(input_length, input, case_flags) appending code points
+    and their case flags (case_flags may be a null pointer, meaning
+    unflagged with ASCII letters left as they are, as for encode()).
+    Encoding cannot start before the end of the input, since every
+    basic code point is output first and the deltas depend on the
+    smallest code points of the whole input, so feed() only collects
+    the input, and finish() encodes it into output() and returns the
+    status of codec<P>::encode().  Feeding after finish() starts a new
+    input.
+*/
+
+template <class P>
+class codec<P>::encoder {
+public:
+  void feed(std::size_t input_length, const punycode_uint input[],
+            const unsigned char case_flags[]);
+  enum punycode_status finish();
+
+  const std::string &output() const { return output_; }
+
+private:
+  std::vector<punycode_uint> input_;
+  std::vector<unsigned char> flags_;
+  std::string output_;
+  bool ended_ = false;
+};
+
+/* A piece without case flags is kept with the flags that leave its */
+/* ASCII letters as they are, so pieces with and without flags mix. */
+
+template <class P>
+void codec<P>::encoder::feed(
+  std::size_t input_length,
+  const punycode_uint input[],
+  const unsigned char case_flags[] )
+{
+  std::size_t j;
+
+  if (ended_) {
+    input_.clear();
+    flags_.clear();
+    ended_ = false;
+  }
+
+  for (j = 0;  j < input_length;  ++j) {
+    input_.push_back(input[j]);
+    flags_.push_back(case_flags ? case_flags[j] != 0
+                                : basic(input[j]) && flagged(input[j]));
+  }
+}
+
+template <class P>
+enum punycode_status codec<P>::encoder::finish()
+{
+  std::size_t length, size = input_.size() + 1;
+  enum punycode_status status;
+
+  ended_ = true;
+
+  /* The output is rarely much longer than the input; */
+  /* start there and double until it fits:            */
+
+  for (;;) {
+    output_.resize(size);
+    length = size;
+    status = encode(input_.size(), input_.data(), flags_.data(),
+                    &length, &output_[0]);
+    if (status != punycode_big_output || size > output_.max_size() / 2) {
+      break;
+    }
+    size *= 2;
+  }
+
+  output_.resize(status == punycode_success ? length : 0);
+  return status;
+}
+
+/*** Parameter sets ***/
+
+/* The Punycode parameters of RFC 3492 section 5.  Params of  */
+/* punycode.js has the same values but damps as js_damping     */
+/* does, so its strings differ from these on some labels.      */
+
+struct punycode_params {
+  static constexpr punycode_uint base = 36, tmin = 1, tmax = 26, skew = 38,
+    damp = 700, initial_bias = 72, initial_n = 0x80;
+  static constexpr char delimiter = '-';
+  static constexpr const char *alphabet =
+    "abcdefghijklmnopqrstuvwxyz0123456789";
+  static constexpr bool case_insensitive = true;
+};
+
+/* Base64Params of punycode.js:  the Base64 alphabet of RFC 4648, */
+/* with the Punycode delimiter.  It is only defined by punycode.js, */
+/* so it damps as punycode.js does, to read and write its strings.  */
+
+struct base64_params {
+  static constexpr punycode_uint base = 64, tmin = 1, tmax = 42, skew = 70,
+    damp = 700, initial_bias = 128, initial_n = 0x80;
+  static constexpr char delimiter = '-';
+  static constexpr const char *alphabet =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  static constexpr bool case_insensitive = false;
+  static constexpr bool js_damping = true;
+};
+
+/* Base85Params of punycode.js:  the alphabet of RFC 1924, which */
+/* contains "-", so "." is the delimiter instead, damping as     */
+/* base64_params does.                                           */
+
+struct base85_params {
+  static constexpr punycode_uint base = 85, tmin = 1, tmax = 60, skew = 92,
+    damp = 700, initial_bias = 170, initial_n = 0x80;
+  static constexpr char delimiter = '.';
+  static constexpr const char *alphabet =
+    "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz"
+    "!#$%&()*+-;<=>?@^_`{|}~";
+  static constexpr bool case_insensitive = false;
+  static constexpr bool js_damping = true;
+};
+
+typedef codec<punycode_params> punycode;
+typedef codec<base64_params> base64;
+typedef codec<base85_params> base85;
+
+/*** Run-time parameters ***/
+
+/*
+    parameters holds the values of a parameter policy at run time, for
+    programs that choose them while running, such as bootstring-tune.cpp,
+    which searches for the parameters that encode a corpus best.
+    parameters::of<P>() returns those of policy P, and valid() checks
+    what codec<P> checks at compile time, which includes the conditions
+    of isValidParams() in punycode.js.
+
+    A dynamic_codec encodes and decodes like codec<P> with the
+    parameters it is constructed with, which must be valid.  Its digit
+    tables are built by the constructor, and it computes adapt() and
+    the thresholds instead of looking them up, so it is about as fast
+    as codec<P> with the tables turned off.
+*/
+
+struct parameters {
+  punycode_uint base, tmin, tmax, skew, damp, initial_bias, initial_n;
+  char delimiter;
+  const char *alphabet;
+  bool case_insensitive;
+  bool js_damping = false;
+
+  template <class P>
+  static constexpr parameters of()
+  {
+    return { P::base, P::tmin, P::tmax, P::skew, P::damp, P::initial_bias,
+             P::initial_n, P::delimiter, P::alphabet, P::case_insensitive,
+             detail::js_damped<P>::value };
+  }
+
+  constexpr bool valid() const
+  {
+    return base >= 2 && base <= 256 && initial_n <= 256 &&
+           tmin <= tmax && tmax <= base - 1 && skew >= 1 && damp >= 2 &&
+           initial_bias % base <= base - tmin &&
+           static_cast<unsigned char>(delimiter) < initial_n &&
+           detail::valid_alphabet(alphabet, base, initial_n, delimiter,
+                                  case_insensitive);
+  }
+};
+
+class dynamic_codec {
+public:
+  explicit dynamic_codec(const parameters &params);
+
+  enum punycode_status encode(
+    std::size_t input_length,
+    const punycode_uint input[],
+    const unsigned char case_flags[],
+    std::size_t *output_length,
+    char output[] ) const;
+
+  enum punycode_status decode(
+    std::size_t input_length,
+    const char input[],
+    std::size_t *output_length,
+    punycode_uint output[],
+    unsigned char case_flags[] ) const;
+
+  const parameters &params() const { return p_; }
+
+private:
+  static constexpr punycode_uint maxint = static_cast<punycode_uint>(-1);
+
+  bool basic(punycode_uint cp) const { return cp < p_.initial_n; }
+
+  static bool flagged(punycode_uint bcp) { return bcp - 65 < 26; }
+
+  static char encode_basic(punycode_uint bcp, int flag)
+  {
+    bcp -= (bcp - 97 < 26) << 5;
+    return static_cast<char>(bcp + ((!flag && (bcp - 65 < 26)) << 5));
+  }
+
+  /* threshold(p,bias) and adapt() as in RFC 3492 section 6, */
+  /* but for js_damping:                                       */
+
+  punycode_uint threshold(punycode_uint p, punycode_uint bias) const
+  {
+    punycode_uint k = p_.base * (p + 1);
+
+    return k <= bias + p_.tmin ? p_.tmin :
+           k >= bias + p_.tmax ? p_.tmax : k - bias;
+  }
+
+  punycode_uint adapt(punycode_uint delta, punycode_uint numpoints,
+                      bool firsttime) const;
+
+  parameters p_;
+  detail::digit_tables digits_;
+};
+
+inline dynamic_codec::dynamic_codec(const parameters &params)
+  : p_(params), digits_()
+{
+  char c;
+  unsigned j;
+
+  for (j = 0;  j < 256;  ++j) {
+    digits_.decode[j] = static_cast<unsigned char>(p_.base);
+  }
+
+  for (j = 0;  j < p_.base;  ++j) {
+    c = p_.alphabet[j];
+    digits_.encode[0][j] = digits_.encode[1][j] = c;
+    digits_.decode[static_cast<unsigned char>(c)] =
+      static_cast<unsigned char>(j);
+
+    if (p_.case_insensitive &&
+        static_cast<unsigned char>(c | 0x20) - 97u < 26) {
+      digits_.encode[0][j] = static_cast<char>(c | 0x20);
+      digits_.encode[1][j] = static_cast<char>(c & ~0x20);
+      digits_.decode[static_cast<unsigned char>(c ^ 0x20)] =
+        static_cast<unsigned char>(j);
+    }
+  }
+}
+
+inline punycode_uint dynamic_codec::adapt(
+  punycode_uint delta, punycode_uint numpoints, bool firsttime ) const
+{
+  punycode_uint k;
+
+  delta = firsttime != p_.js_damping ? delta / p_.damp : delta >> 1;
+  delta += delta / numpoints;
+
+  for (k = 0;  delta > ((p_.base - p_.tmin) * p_.tmax) / 2;  k += p_.base) {
+    delta /= p_.base - p_.tmin;
+  }
+
+  return k + (p_.base - p_.tmin + 1) * delta / (delta + p_.skew);
+}
+
+inline enum punycode_status dynamic_codec::encode(
+  std::size_t input_length_orig,
+  const punycode_uint input[],
+  const unsigned char case_flags[],
+  std::size_t *output_length,
+  char output[] ) const
+{
+  punycode_uint input_length, n, delta, h, b, bias, j, m, q, p, t;
+  std::size_t out, max_out;
+
+  if (input_length_orig > maxint) return punycode_overflow;
+  input_length = static_cast<punycode_uint>(input_length_orig);
+
+  n = p_.initial_n;
+  delta = 0;
+  out = 0;
+  max_out = *output_length;
+  bias = p_.initial_bias;
+
+  for (j = 0;  j < input_length;  ++j) {
+    if (basic(input[j])) {
+      if (max_out - out < 2) return punycode_big_output;
+      output[out++] = case_flags ?
+        encode_basic(input[j], case_flags[j]) : static_cast<char>(input[j]);
+    }
+  }
+
+  h = b = static_cast<punycode_uint>(out);
+  if (b > 0) output[out++] = p_.delimiter;
+
+  while (h < input_length) {
+    for (m = maxint, j = 0;  j < input_length;  ++j) {
+      if (input[j] >= n && input[j] < m) m = input[j];
+    }
+
+    if (m - n > (maxint - delta) / (h + 1)) return punycode_overflow;
+    delta += (m - n) * (h + 1);
+    n = m;
+
+    for (j = 0;  j < input_length;  ++j) {
+      if (input[j] < n) {
+        if (++delta == 0) return punycode_overflow;
+      }
+
+      if (input[j] == n) {
+        for (q = delta, p = 0;  ;  ++p) {
+          if (out >= max_out) return punycode_big_output;
+          t = threshold(p, bias);
+          if (q < t) break;
+          output[out++] = digits_.encode[0][t + (q - t) % (p_.base - t)];
+          q = (q - t) / (p_.base - t);
+        }
+
+        output[out++] = digits_.encode[p_.case_insensitive && case_flags &&
+                                       case_flags[j]][q];
+        bias = adapt(delta, h + 1, h == b);
+        delta = 0;
+        ++h;
+      }
+    }
+
+    ++delta, ++n;
+  }
+
+  *output_length = out;
+  return punycode_success;
+}
+
+inline enum punycode_status dynamic_codec::decode(
+  std::size_t input_length,
+  const char input[],
+  std::size_t *output_length,
+  punycode_uint output[],
+  unsigned char case_flags[] ) const
+{
+  punycode_uint n, out, i, max_out, bias, oldi, w, p, digit, t, c;
+  std::size_t b, j, in;
+
+  n = p_.initial_n;
+  out = i = 0;
+  max_out = *output_length > maxint ? maxint
+            : static_cast<punycode_uint>(*output_length);
+  bias = p_.initial_bias;
+
+  for (b = j = 0;  j < input_length;  ++j) {
+    if (input[j] == p_.delimiter) b = j;
+  }
+
+  if (b > max_out) return punycode_big_output;
+
+  for (j = 0;  j < b;  ++j) {
+    c = static_cast<unsigned char>(input[j]);
+    if (case_flags) case_flags[out] = flagged(c);
+    if (!basic(c)) return punycode_bad_input;
+    output[out++] = c;
+  }
+
+  for (in = b > 0 ? b + 1 : 0;  in < input_length;  ++out) {
+    for (oldi = i, w = 1, p = 0;  ;  ++p) {
+      if (in >= input_length) return punycode_bad_input;
+      digit = digits_.decode[static_cast<unsigned char>(input[in++])];
+      if (digit >= p_.base) return punycode_bad_input;
+      if (digit > (maxint - i) / w) return punycode_overflow;
+      i += digit * w;
+      t = threshold(p, bias);
+      if (digit < t) break;
+      if (w > maxint / (p_.base - t)) return punycode_overflow;
+      w *= p_.base - t;
+    }
+
+    bias = adapt(i - oldi, out + 1, oldi == 0);
+
+    if (i / (out + 1) > maxint - n) return punycode_overflow;
+    n += i / (out + 1);
+    i %= (out + 1);
+
+    if (out >= max_out) return punycode_big_output;
+
+    if (case_flags) {
+      std::memmove(case_flags + i + 1, case_flags + i, out - i);
+      case_flags[i] = p_.case_insensitive && flagged(
+        static_cast<unsigned char>(input[in - 1]));
+    }
+
+    std::memmove(output + i + 1, output + i, (out - i) * sizeof *output);
+    output[i++] = n;
+  }
+
+  *output_length = out;
+  return punycode_success;
+}
+
+} /* namespace bootstring */
+
+#endif /* BOOTSTRING_HPP */
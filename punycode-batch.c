@@ -0,0 +1,283 @@
+/*
+punycode-batch.c
+
+This is ANSI C code (C89) implementing the batch interface declared in
+punycode-batch.h on top of the single-label functions in punycode.c.
+The cached versions are in punycode-cached.c, which passes the cache
+in through punycode-lookup.h.
+
+*/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "punycode-cache.h"
+#include "punycode-lookup.h"
+
+/* Inputs at least this long go to the O(n log n) engines, following */
+/* the crossover points measured by punycode-bench.c:                */
+
+enum {
+  sorted_min_length = 64,
+  deferred_min_length = 16384
+};
+
+void punycode_arena_init(struct punycode_arena *arena, int options)
+{
+  arena->data = 0;
+  arena->case_flags = 0;
+  arena->length = arena->capacity = 0;
+  arena->options = options | punycode_arena_grow;
+}
+
+void punycode_arena_free(struct punycode_arena *arena)
+{
+  if (!(arena->options & punycode_arena_grow)) return;
+  free(arena->data);
+  free(arena->case_flags);
+  arena->data = 0;
+  arena->case_flags = 0;
+  arena->length = arena->capacity = 0;
+}
+
+/* reserve(arena,size,need) makes room for need more elements of  */
+/* the given size, growing the arena to exactly that if it may.  A  */
+/* batch reserves once for all of its outputs, so there is nothing  */
+/* to amortize.  It returns zero if that is not possible.           */
+
+static int reserve(struct punycode_arena *arena, size_t size, size_t need)
+{
+  size_t capacity, limit = ((size_t) -1) / size;
+  void *data;
+  unsigned char *flags;
+
+  if (arena->capacity - arena->length >= need) return 1;
+  if (!(arena->options & punycode_arena_grow)) return 0;
+  if (need > limit - arena->length) return 0;
+
+  capacity = arena->length + need;
+
+  data = realloc(arena->data, capacity * size);
+  if (data == 0) return 0;
+  arena->data = data;
+
+  if (arena->options & punycode_arena_case_flags) {
+    flags = realloc(arena->case_flags, capacity);
+    if (flags == 0) return 0;
+    arena->case_flags = flags;
+  }
+
+  arena->capacity = capacity;
+  return 1;
+}
+
+/* Both batch functions work in two passes.  The first sizes every  */
+/* output exactly, storing its end in offsets[k+1] and its status,  */
+/* so that the arena can be grown once for the whole batch.  The    */
+/* second converts each input straight into its place.  An input    */
+/* that still does not fit, because growing failed or the arena is  */
+/* caller-provided, fails alone and later outputs move up.  With a  */
+/* lookup, the second pass looks each input up before converting    */
+/* it; inputs with case flags, in either direction, are not cached. */
+
+size_t punycode_encode_batch_lookup(
+  const struct punycode_lookup *lookup,
+  size_t count,
+  const struct punycode_label inputs[],
+  struct punycode_arena *arena,
+  size_t offsets[],
+  enum punycode_status status[] )
+{
+  size_t k, need, avail, end, failures = 0;
+  int cached;
+
+  /* First pass: */
+
+  for (end = arena->length, k = 0;  k < count;  ++k) {
+    offsets[k] = end;
+    status[k] = punycode_encoded_length(inputs[k].length, inputs[k].input,
+                                        &need);
+    if (status[k] == punycode_success) {
+      if (need > ((size_t) -1) - end) status[k] = punycode_big_output;
+      else end += need;
+    }
+  }
+
+  offsets[count] = end;
+  reserve(arena, 1, end - arena->length);
+
+  /* Second pass: */
+
+  for (k = 0;  k < count;  ++k) {
+    need = offsets[k + 1] - offsets[k];
+    offsets[k] = arena->length;
+    cached = lookup != 0 && inputs[k].case_flags == 0;
+
+    if (status[k] == punycode_success) {
+      avail = need;
+
+      if (arena->capacity - arena->length < need) {
+        status[k] = punycode_big_output;
+      }
+      else if (cached && lookup->find(
+                           lookup->cache, punycode_cache_encode,
+                           inputs[k].length * sizeof (punycode_uint),
+                           inputs[k].input, &avail,
+                           (char *) arena->data + arena->length)) {
+        status[k] = punycode_success;
+      }
+      else {
+        status[k] = (inputs[k].length >= sorted_min_length ?
+                     punycode_encode_sorted : punycode_encode)(
+                       inputs[k].length, inputs[k].input,
+                       inputs[k].case_flags, &avail,
+                       (char *) arena->data + arena->length);
+
+        if (cached && status[k] == punycode_success) {
+          lookup->add(lookup->cache, punycode_cache_encode,
+                      inputs[k].length * sizeof (punycode_uint),
+                      inputs[k].input, avail,
+                      (char *) arena->data + arena->length);
+        }
+      }
+
+      if (status[k] == punycode_success) arena->length += avail;
+    }
+
+    if (status[k] != punycode_success) ++failures;
+  }
+
+  offsets[count] = arena->length;
+  return failures;
+}
+
+size_t punycode_decode_batch_lookup(
+  const struct punycode_lookup *lookup,
+  size_t count,
+  const struct punycode_ace inputs[],
+  struct punycode_arena *arena,
+  size_t offsets[],
+  enum punycode_status status[] )
+{
+  size_t k, need, avail, bytes, end, failures = 0;
+  int flags = arena->options & punycode_arena_case_flags;
+  int cached = lookup != 0 && !flags;
+
+  /* First pass: */
+
+  for (end = arena->length, k = 0;  k < count;  ++k) {
+    offsets[k] = end;
+    status[k] = punycode_decoded_length(inputs[k].length, inputs[k].input,
+                                        &need);
+    if (status[k] == punycode_success) {
+      if (need > ((size_t) -1) - end) status[k] = punycode_big_output;
+      else end += need;
+    }
+  }
+
+  offsets[count] = end;
+  reserve(arena, sizeof (punycode_uint), end - arena->length);
+
+  /* Second pass: */
+
+  for (k = 0;  k < count;  ++k) {
+    need = offsets[k + 1] - offsets[k];
+    offsets[k] = arena->length;
+
+    if (status[k] == punycode_success) {
+      avail = need;
+      bytes = need * sizeof (punycode_uint);
+
+      if (arena->capacity - arena->length < need) {
+        status[k] = punycode_big_output;
+      }
+      else if (cached && lookup->find(
+                           lookup->cache, punycode_cache_decode,
+                           inputs[k].length, inputs[k].input, &bytes,
+                           (punycode_uint *) arena->data + arena->length)) {
+        avail = bytes / sizeof (punycode_uint);
+        status[k] = punycode_success;
+      }
+      else {
+        status[k] = (inputs[k].length >= deferred_min_length ?
+                     punycode_decode_deferred : punycode_decode)(
+                       inputs[k].length, inputs[k].input, &avail,
+                       (punycode_uint *) arena->data + arena->length,
+                       flags ? arena->case_flags + arena->length : 0);
+
+        if (cached && status[k] == punycode_success) {
+          lookup->add(lookup->cache, punycode_cache_decode,
+                      inputs[k].length, inputs[k].input,
+                      avail * sizeof (punycode_uint),
+                      (punycode_uint *) arena->data + arena->length);
+        }
+      }
+
+      if (status[k] == punycode_success) arena->length += avail;
+    }
+
+    if (status[k] != punycode_success) ++failures;
+  }
+
+  offsets[count] = arena->length;
+  return failures;
+}
+
+size_t punycode_encode_batch(
+  size_t count,
+  const struct punycode_label inputs[],
+  struct punycode_arena *arena,
+  size_t offsets[],
+  enum punycode_status status[] )
+{
+  return punycode_encode_batch_lookup(0, count, inputs, arena, offsets,
+                                      status);
+}
+
+size_t punycode_decode_batch(
+  size_t count,
+  const struct punycode_ace inputs[],
+  struct punycode_arena *arena,
+  size_t offsets[],
+  enum punycode_status status[] )
+{
+  return punycode_decode_batch_lookup(0, count, inputs, arena, offsets,
+                                      status);
+}
+
+/* In place, as in punycode_decode_in_place() but for the inputs all  */
+/* together, the unconsumed input stays ahead of the outputs written */
+/* so far, failed ones included, since no output is longer than its  */
+/* input.                                                            */
+
+size_t punycode_decode_batch_in_place(
+  size_t count,
+  const size_t lengths[],
+  punycode_uint buffer[],
+  unsigned char case_flags[],
+  size_t offsets[],
+  enum punycode_status status[] )
+{
+  size_t k, total, out, length, failures = 0;
+  char *input;
+
+  for (total = 0, k = 0;  k < count;  ++k) total += lengths[k];
+
+  input = (char *) buffer + (sizeof *buffer - 1) * total;
+  memmove(input, buffer, total);
+
+  for (out = 0, k = 0;  k < count;  ++k) {
+    offsets[k] = out;
+    length = total - out;
+    status[k] = punycode_decode(lengths[k], input, &length, buffer + out,
+                                case_flags ? case_flags + out : 0);
+
+    if (status[k] == punycode_success) out += length;
+    else ++failures;
+
+    input += lengths[k];
+  }
+
+  offsets[count] = out;
+  return failures;
+}
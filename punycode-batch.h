@@ -0,0 +1,195 @@
+/*
+punycode-batch.h
+
+This is ANSI C code (C89) for converting many Punycode labels in one
+call, writing all of the results contiguously into a single arena.
+The implementation is in punycode-batch.c, apart from
+punycode_decode_lanes(), which is with the other vector kernels in
+punycode-simd.c.
+
+*/
+
+#ifndef PUNYCODE_BATCH_H
+#define PUNYCODE_BATCH_H
+
+#include "punycode.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* An input to punycode_encode_batch(), with the meaning */
+/* of the corresponding punycode_encode() arguments:     */
+
+struct punycode_label {
+  size_t length;
+  const punycode_uint *input;
+  const unsigned char *case_flags;  /* may be a null pointer */
+};
+
+/* An input to punycode_decode_batch(): */
+
+struct punycode_ace {
+  size_t length;
+  const char *input;
+};
+
+/* The arena receives the outputs of a batch back to back.  data */
+/* points to chars for punycode_encode_batch() and punycode_uints */
+/* for punycode_decode_batch(); case_flags, if used, is parallel  */
+/* to data.  capacity and length count elements, not bytes.       */
+
+struct punycode_arena {
+  void *data;
+  unsigned char *case_flags;
+  size_t length;
+  size_t capacity;
+  int options;
+};
+
+enum {
+  punycode_arena_grow       = 1, /* data may be (re)allocated with   */
+                                 /* realloc() when it runs out       */
+  punycode_arena_case_flags = 2  /* decode also fills in case_flags  */
+};
+
+void punycode_arena_init(struct punycode_arena *, int options);
+
+void punycode_arena_free(struct punycode_arena *);
+
+/*
+    punycode_arena_init() sets up an empty growable arena, which will be
+    allocated on first use; options may add punycode_arena_case_flags.
+    A caller-provided arena is set up by filling in the fields directly.
+    punycode_arena_free() releases the storage of a growable arena and
+    leaves it empty; it does nothing to a caller-provided one.
+*/
+
+size_t punycode_encode_batch(
+  size_t,                        /* count   */
+  const struct punycode_label [],/* inputs  */
+  struct punycode_arena *,       /* arena   */
+  size_t [],                     /* offsets */
+  enum punycode_status []        /* status  */
+);
+
+size_t punycode_decode_batch(
+  size_t,                        /* count   */
+  const struct punycode_ace [],  /* inputs  */
+  struct punycode_arena *,       /* arena   */
+  size_t [],                     /* offsets */
+  enum punycode_status []        /* status  */
+);
+
+/*
+    punycode_encode_batch() and punycode_decode_batch() convert count
+    inputs as punycode_encode() and punycode_decode() would, appending
+    the outputs to the arena starting at arena->length.
+
+    Output arguments:
+
+        offsets
+            An array of count+1 elements.  The output for inputs[k] is
+            elements offsets[k] through offsets[k+1]-1 of arena->data
+            (and arena->case_flags).  The range is empty for an input
+            that failed.
+
+        status
+            An array of count elements receiving the punycode_status
+            of each input.  A failure only affects its own input.
+
+    The outputs are first sized exactly with punycode_encoded_length()
+    or punycode_decoded_length(), and a growable arena is then enlarged
+    once, to exactly the total, so that it fails only if realloc() does.
+    Each input whose output does not fit in the space left then fails
+    with punycode_big_output, as it does with a caller-provided arena
+    that is too small.
+
+    Return value:
+
+        The number of inputs that failed.
+*/
+
+struct punycode_cache;
+
+size_t punycode_encode_batch_cached(
+  struct punycode_cache *,       /* cache   */
+  size_t,                        /* count   */
+  const struct punycode_label [],/* inputs  */
+  struct punycode_arena *,       /* arena   */
+  size_t [],                     /* offsets */
+  enum punycode_status []        /* status  */
+);
+
+size_t punycode_decode_batch_cached(
+  struct punycode_cache *,       /* cache   */
+  size_t,                        /* count   */
+  const struct punycode_ace [],  /* inputs  */
+  struct punycode_arena *,       /* arena   */
+  size_t [],                     /* offsets */
+  enum punycode_status []        /* status  */
+);
+
+/*
+    punycode_encode_batch_cached() and punycode_decode_batch_cached()
+    are the batch functions looking up each input in a cache created
+    by punycode_cache_create() (see punycode-cache.h) and adding the
+    ones they convert, with exactly the same outputs.  Inputs with case
+    flags, and all inputs when the arena receives case flags, bypass
+    the cache.  A null cache is allowed.  They are in punycode-cached.c
+    and need punycode-cache.c, which the uncached functions do not.
+*/
+
+size_t punycode_decode_batch_in_place(
+  size_t,                        /* count      */
+  const size_t [],               /* lengths    */
+  punycode_uint [],              /* buffer     */
+  unsigned char [],              /* case_flags */
+  size_t [],                     /* offsets    */
+  enum punycode_status []        /* status     */
+);
+
+/*
+    punycode_decode_batch_in_place() decodes count inputs with
+    punycode_decode_in_place()'s trick, so a batch needs no second
+    buffer either.  The caller places the inputs back to back at the
+    start of buffer, inputs[k] being lengths[k] chars long, and buffer
+    must have room for as many code points as the inputs have chars in
+    total.  The outputs are then written back to back from the start
+    of buffer, and those of case_flags (a null pointer, or an array
+    parallel to buffer) alongside them, with offsets and status as for
+    punycode_decode_batch().  Every input is decoded by
+    punycode_decode(), even long ones.  It returns the number of
+    inputs that failed.
+*/
+
+size_t punycode_decode_lanes(
+  size_t,                        /* count         */
+  const struct punycode_ace [],  /* inputs        */
+  size_t,                        /* max_output    */
+  punycode_uint [],              /* output        */
+  size_t [],                     /* output_length */
+  enum punycode_status []        /* status        */
+);
+
+/*
+    punycode_decode_lanes() decodes count inputs as punycode_decode()
+    would, without case flags, each into its own row of max_output
+    code points:  the output for inputs[k] is written to
+    output[k * max_output] onwards, its length to output_length[k] (0
+    if it failed), and its punycode_status to status[k].  It returns
+    the number of inputs that failed.
+
+    It is meant for long lists of short labels.  The decoding of one
+    label is a chain of dependent steps, so on x86 processors with
+    AVX2 eight labels are decoded side by side in the lanes of vector
+    registers instead, each lane taking the next label as soon as its
+    own is done.  Labels longer than 64 characters, and all labels on
+    other processors, go through punycode_decode() one at a time.
+*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PUNYCODE_BATCH_H */
@@ -0,0 +1,382 @@
+/*
+punycode-bench.c
+
+This is ANSI C code (C89) timing the Punycode functions in punycode.c
+against each other on generated input, to show where the faster
+engines start paying for their setup cost, passing short all-ASCII
+labels through with and without punycode_copy_basic(), and decoding a
+list of short labels one at a time against punycode_decode_lanes().
+
+Build it together with punycode.c, for example:
+
+    cc -O2 -o punycode-bench punycode-bench.c punycode.c punycode-simd.c
+
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "punycode-batch.h"
+
+enum {
+  max_length = 1 << 14,       /* longest input, in code points   */
+  max_ace_length = 8 * max_length,
+  max_label_length = 24       /* longest label for the lane test  */
+};
+
+/* The corpora differ in how many distinct non-basic code points */
+/* they contain, which is what the reference encoder's running   */
+/* time depends on.                                              */
+
+struct corpus {
+  const char *name;
+  unsigned basic_percent;     /* share of ASCII letters           */
+  punycode_uint first, count; /* range of non-basic code points   */
+};
+
+static const struct corpus corpora[] = {
+  { "ascii", 100, 0x80, 1 },
+  { "latin", 80, 0xC0, 0xC0 },
+  { "cjk", 10, 0x4E00, 0x5200 },
+  { "emoji", 20, 0x1F300, 0x300 }
+};
+
+/* A small linear congruential generator, so that every run */
+/* times exactly the same input:                            */
+
+static unsigned long seed = 1;
+
+static unsigned long next_random(void)
+{
+  seed = (seed * 1103515245UL + 12345UL) & 0xFFFFFFFFUL;
+  return seed >> 8;
+}
+
+static void generate(const struct corpus *c, size_t length,
+                     punycode_uint input[])
+{
+  size_t j;
+
+  for (j = 0;  j < length;  ++j) {
+    input[j] = next_random() % 100 < c->basic_percent ?
+               'a' + next_random() % 26 :
+               c->first + next_random() % c->count;
+  }
+}
+
+typedef enum punycode_status (*encoder)(
+  size_t, const punycode_uint [], const unsigned char [], size_t *, char []
+);
+
+/* time_encoder() returns the average time of one call in */
+/* nanoseconds, repeating the call for at least 100 ms.   */
+
+static double time_encoder(encoder f, size_t length,
+                           const punycode_uint input[], char output[])
+{
+  clock_t start, elapsed;
+  unsigned long calls = 0, batch = 1, j;
+  size_t output_length;
+
+  start = clock();
+
+  do {
+    for (j = 0;  j < batch;  ++j) {
+      output_length = max_ace_length;
+      if (f(length, input, 0, &output_length, output) != punycode_success) {
+        fputs("encoding failed\n", stderr);
+        exit(EXIT_FAILURE);
+      }
+    }
+
+    calls += batch;
+    batch *= 2;
+    elapsed = clock() - start;
+  } while (elapsed < CLOCKS_PER_SEC / 10);
+
+  return (double) elapsed / CLOCKS_PER_SEC * 1e9 / calls;
+}
+
+typedef enum punycode_status (*decoder)(
+  size_t, const char [], size_t *, punycode_uint [], unsigned char []
+);
+
+static double time_decoder(decoder f, size_t length,
+                           const char input[], punycode_uint output[])
+{
+  clock_t start, elapsed;
+  unsigned long calls = 0, batch = 1, j;
+  size_t output_length;
+
+  start = clock();
+
+  do {
+    for (j = 0;  j < batch;  ++j) {
+      output_length = max_length;
+      if (f(length, input, &output_length, output, 0) != punycode_success) {
+        fputs("decoding failed\n", stderr);
+        exit(EXIT_FAILURE);
+      }
+    }
+
+    calls += batch;
+    batch *= 2;
+    elapsed = clock() - start;
+  } while (elapsed < CLOCKS_PER_SEC / 10);
+
+  return (double) elapsed / CLOCKS_PER_SEC * 1e9 / calls;
+}
+
+static void bench_encode(const struct corpus *c,
+                         punycode_uint input[], char output[])
+{
+  size_t length, crossover = 0;
+  double reference, sorted;
+
+  printf("\nencode, %s corpus\n", c->name);
+  printf("%8s %14s %14s %8s\n",
+         "length", "reference ns", "sorted ns", "speedup");
+
+  for (length = 1;  length <= max_length;  length *= 2) {
+    generate(c, length, input);
+    reference = time_encoder(punycode_encode, length, input, output);
+    sorted = time_encoder(punycode_encode_sorted, length, input, output);
+    printf("%8lu %14.0f %14.0f %8.2f\n",
+           (unsigned long) length, reference, sorted, reference / sorted);
+    if (sorted >= reference) crossover = 0;
+    else if (crossover == 0) crossover = length;
+  }
+
+  if (crossover) {
+    printf("punycode_encode_sorted() wins from %lu code points\n",
+           (unsigned long) crossover);
+  }
+  else puts("punycode_encode_sorted() never wins");
+}
+
+static void bench_decode(const struct corpus *c, punycode_uint input[],
+                         char ace[], punycode_uint output[])
+{
+  size_t length, ace_length, crossover = 0;
+  double reference, deferred;
+
+  printf("\ndecode, %s corpus\n", c->name);
+  printf("%8s %14s %14s %8s\n",
+         "length", "reference ns", "deferred ns", "speedup");
+
+  for (length = 1;  length <= max_length;  length *= 2) {
+    generate(c, length, input);
+    ace_length = max_ace_length;
+    punycode_encode_sorted(length, input, 0, &ace_length, ace);
+    reference = time_decoder(punycode_decode, ace_length, ace, output);
+    deferred = time_decoder(punycode_decode_deferred, ace_length, ace,
+                            output);
+    printf("%8lu %14.0f %14.0f %8.2f\n",
+           (unsigned long) length, reference, deferred,
+           reference / deferred);
+    if (deferred >= reference) crossover = 0;
+    else if (crossover == 0) crossover = length;
+  }
+
+  if (crossover) {
+    printf("punycode_decode_deferred() wins from %lu code points\n",
+           (unsigned long) crossover);
+  }
+  else puts("punycode_decode_deferred() never wins");
+}
+
+/* copy_scalar() and copy_kernel() pass an all-ASCII label through */
+/* as punycode_encode() does, with its scalar loop and with          */
+/* punycode_copy_basic():                                            */
+
+static enum punycode_status copy_scalar(
+  size_t length, const punycode_uint input[],
+  const unsigned char case_flags[], size_t *output_length, char output[] )
+{
+  size_t j, out = 0;
+
+  (void) case_flags;
+
+  for (j = 0;  j < length;  ++j) {
+    if (input[j] < 0x80) {
+      if (*output_length - out < 2) return punycode_big_output;
+      output[out++] = (char) input[j];
+    }
+  }
+
+  *output_length = out;
+  return punycode_success;
+}
+
+static enum punycode_status copy_kernel(
+  size_t length, const punycode_uint input[],
+  const unsigned char case_flags[], size_t *output_length, char output[] )
+{
+  (void) case_flags;
+  *output_length = punycode_copy_basic(length, input, output);
+  return punycode_success;
+}
+
+/* bench_copy() times short all-ASCII labels, where the dispatch of */
+/* punycode_copy_basic() costs more than its vectors save:          */
+
+static void bench_copy(punycode_uint input[], char output[])
+{
+  static const size_t lengths[] = { 1, 4, 7, 8, 12, 16, 24, 32, 64 };
+  size_t j, crossover = 0;
+  double scalar, kernel, encode;
+
+  printf("\npass-through, ascii labels\n");
+  printf("%8s %14s %14s %14s\n",
+         "length", "scalar ns", "kernel ns", "encode ns");
+
+  for (j = 0;  j < sizeof lengths / sizeof *lengths;  ++j) {
+    generate(&corpora[0], lengths[j], input);
+    scalar = time_encoder(copy_scalar, lengths[j], input, output);
+    kernel = time_encoder(copy_kernel, lengths[j], input, output);
+    encode = time_encoder(punycode_encode, lengths[j], input, output);
+    printf("%8lu %14.1f %14.1f %14.1f\n",
+           (unsigned long) lengths[j], scalar, kernel, encode);
+    if (kernel >= scalar) crossover = 0;
+    else if (crossover == 0) crossover = lengths[j];
+  }
+
+  if (crossover) {
+    printf("punycode_copy_basic() wins from %lu code points\n",
+           (unsigned long) crossover);
+  }
+  else puts("punycode_copy_basic() never wins");
+}
+
+/* time_labels() returns the average time per label in nanoseconds */
+/* of decoding count labels one at a time (if lanes is 0) or with   */
+/* punycode_decode_lanes(), repeating it for at least 100 ms.       */
+
+static double time_labels(int lanes, size_t count,
+                          const struct punycode_ace aces[],
+                          size_t max_output, punycode_uint output[],
+                          size_t output_length[],
+                          enum punycode_status status[])
+{
+  clock_t start, elapsed;
+  unsigned long calls = 0, batch = 1, j;
+  size_t k, failed;
+
+  start = clock();
+
+  do {
+    for (j = 0;  j < batch;  ++j) {
+      if (lanes) {
+        failed = punycode_decode_lanes(count, aces, max_output, output,
+                                       output_length, status);
+      }
+      else {
+        for (k = failed = 0;  k < count;  ++k) {
+          output_length[k] = max_output;
+          if (punycode_decode(aces[k].length, aces[k].input,
+                              &output_length[k], output + k * max_output,
+                              0) != punycode_success) ++failed;
+        }
+      }
+
+      if (failed != 0) {
+        fputs("decoding failed\n", stderr);
+        exit(EXIT_FAILURE);
+      }
+    }
+
+    calls += batch;
+    batch *= 2;
+    elapsed = clock() - start;
+  } while (elapsed < CLOCKS_PER_SEC / 10);
+
+  return (double) elapsed / CLOCKS_PER_SEC * 1e9 / calls / count;
+}
+
+/* bench_lanes() cuts max_length code points into labels of a few */
+/* lengths, all of which fit in a lane:                           */
+
+static void bench_lanes(const struct corpus *c, punycode_uint input[],
+                        char ace[], punycode_uint output[])
+{
+  static const size_t lengths[] = { 4, 8, 12, 16, max_label_length };
+  struct punycode_ace *aces;
+  size_t *output_length;
+  enum punycode_status *status;
+  size_t j, k, count, ace_length, used;
+  double one, lanes;
+
+  aces = malloc(max_length * sizeof *aces);
+  output_length = malloc(max_length * sizeof *output_length);
+  status = malloc(max_length * sizeof *status);
+
+  if (aces == 0 || output_length == 0 || status == 0) {
+    fputs("out of memory\n", stderr);
+    exit(EXIT_FAILURE);
+  }
+
+  printf("\ndecode labels, %s corpus\n", c->name);
+  printf("%8s %14s %14s %8s\n",
+         "length", "one at a time", "lanes", "speedup");
+
+  for (j = 0;  j < sizeof lengths / sizeof *lengths;  ++j) {
+    count = max_length / lengths[j];
+
+    for (k = used = 0;  k < count;  ++k) {
+      generate(c, lengths[j], input);
+      ace_length = max_ace_length - used;
+      punycode_encode(lengths[j], input, 0, &ace_length, ace + used);
+      aces[k].length = ace_length;
+      aces[k].input = ace + used;
+      used += ace_length;
+    }
+
+    one = time_labels(0, count, aces, lengths[j], output,
+                      output_length, status);
+    lanes = time_labels(1, count, aces, lengths[j], output,
+                        output_length, status);
+    printf("%8lu %14.1f %14.1f %8.2f\n",
+           (unsigned long) lengths[j], one, lanes, one / lanes);
+  }
+
+  free(aces);
+  free(output_length);
+  free(status);
+}
+
+int main(void)
+{
+  punycode_uint *input, *decoded;
+  char *output;
+  size_t j;
+
+  input = malloc(max_length * sizeof *input);
+  decoded = malloc(max_length * sizeof *decoded);
+  output = malloc(max_ace_length);
+
+  if (input == 0 || decoded == 0 || output == 0) {
+    fputs("out of memory\n", stderr);
+    return EXIT_FAILURE;
+  }
+
+  for (j = 0;  j < sizeof corpora / sizeof *corpora;  ++j) {
+    bench_encode(&corpora[j], input, output);
+  }
+
+  bench_copy(input, output);
+
+  for (j = 0;  j < sizeof corpora / sizeof *corpora;  ++j) {
+    bench_decode(&corpora[j], input, output, decoded);
+  }
+
+  for (j = 0;  j < sizeof corpora / sizeof *corpora;  ++j) {
+    bench_lanes(&corpora[j], input, output, decoded);
+  }
+
+  free(input);
+  free(decoded);
+  free(output);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,1068 @@
+/*
+punycode-binary.c
+
+This is C code implementing the binary-to-text encodings declared in
+punycode-binary.h.  The portable version is ANSI C (C89).  When
+compiled by GCC or Clang for x86, AVX2 kernels for Base64 and hex are
+added and chosen at run time if the processor supports them.
+
+*/
+
+#include <string.h>
+
+#include "punycode-binary.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__)))
+#define PUNYCODE_X86 1
+#include <immintrin.h>
+#endif
+
+/*** Alphabets ***/
+
+/* The digits of each encoding, by value, and the chars and bytes */
+/* in a whole group:                                              */
+
+static const char *const digits[4] = {
+  "0123456789abcdef",
+  "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/",
+  "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz"
+  "!#$%&()*+-;<=>?@^_`{|}~",
+  "!\"#$%&'()*+,-./0123456789:;<=>?@ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+  "[\\]^_`abcdefghijklmnopqrstu"
+};
+
+static const unsigned char group_chars[4] = { 2, 4, 5, 5 };
+static const unsigned char group_bytes[4] = { 1, 3, 4, 4 };
+
+/* char_values[encoding][c] is the value of c as a digit, or 0xFF */
+/* if it is not one; upper case hexadecimal digits are accepted.  */
+
+static const unsigned char char_values[4][256] = {
+  { /* hex */
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+      0,  1,  2,  3,  4,  5,  6,  7,  8,  9,255,255,255,255,255,255,
+    255, 10, 11, 12, 13, 14, 15,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255, 10, 11, 12, 13, 14, 15,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255
+  },
+  { /* Base64 */
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255, 62,255,255,255, 63,
+     52, 53, 54, 55, 56, 57, 58, 59, 60, 61,255,255,255,255,255,255,
+    255,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,
+     15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,255,255,255,255,255,
+    255, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+     41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255
+  },
+  { /* Base85 */
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255, 62,255, 63, 64, 65, 66,255, 67, 68, 69, 70,255, 71,255,255,
+      0,  1,  2,  3,  4,  5,  6,  7,  8,  9,255, 72, 73, 74, 75, 76,
+     77, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24,
+     25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35,255,255,255, 78, 79,
+     80, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50,
+     51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 81, 82, 83, 84,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255
+  },
+  { /* Ascii85 */
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,
+     15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30,
+     31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46,
+     47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62,
+     63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78,
+     79, 80, 81, 82, 83, 84,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+    255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255
+  }
+};
+
+/* Base85 groups are big-endian 32-bit values: */
+
+#define get32(s) ((unsigned long) (s)[0] << 24 | (unsigned long) (s)[1] << 16 \
+                  | (unsigned long) (s)[2] << 8 | (unsigned long) (s)[3])
+
+#define put32(s,v) ((s)[0] = (unsigned char) ((v) >> 24), \
+                    (s)[1] = (unsigned char) ((v) >> 16), \
+                    (s)[2] = (unsigned char) ((v) >> 8), \
+                    (s)[3] = (unsigned char) (v))
+
+/*** Portable kernels ***/
+
+/* An encode kernel converts whole groups, input_length bytes of */
+/* them, and returns the number of chars written.  A decode      */
+/* kernel converts whole groups of input_length chars until one  */
+/* is invalid, and returns the number of chars consumed.         */
+
+static size_t hex_encode_scalar(size_t input_length,
+                                const unsigned char input[], char output[])
+{
+  size_t j;
+
+  for (j = 0;  j < input_length;  ++j) {
+    output[2 * j] = digits[punycode_hex][input[j] >> 4];
+    output[2 * j + 1] = digits[punycode_hex][input[j] & 0xF];
+  }
+
+  return 2 * input_length;
+}
+
+static size_t hex_decode_scalar(size_t input_length, const char input[],
+                                unsigned char output[])
+{
+  const unsigned char *values = char_values[punycode_hex];
+  unsigned hi, lo;
+  size_t j;
+
+  for (j = 0;  j + 2 <= input_length;  j += 2) {
+    hi = values[(unsigned char) input[j]];
+    lo = values[(unsigned char) input[j + 1]];
+    if ((hi | lo) > 0xF) break;
+    output[j / 2] = (unsigned char) (hi << 4 | lo);
+  }
+
+  return j;
+}
+
+static size_t base64_encode_scalar(size_t input_length,
+                                   const unsigned char input[], char output[])
+{
+  const char *d = digits[punycode_base64];
+  unsigned long v;
+  size_t j, out = 0;
+
+  for (j = 0;  j + 3 <= input_length;  j += 3) {
+    v = (unsigned long) input[j] << 16 | input[j + 1] << 8 | input[j + 2];
+    output[out++] = d[v >> 18];
+    output[out++] = d[v >> 12 & 0x3F];
+    output[out++] = d[v >> 6 & 0x3F];
+    output[out++] = d[v & 0x3F];
+  }
+
+  return out;
+}
+
+static size_t base64_decode_scalar(size_t input_length, const char input[],
+                                   unsigned char output[])
+{
+  const unsigned char *values = char_values[punycode_base64];
+  const unsigned char *s = (const unsigned char *) input;
+  unsigned a, b, c, d;
+  unsigned long v;
+  size_t j, out = 0;
+
+  for (j = 0;  j + 4 <= input_length;  j += 4) {
+    a = values[s[j]], b = values[s[j + 1]];
+    c = values[s[j + 2]], d = values[s[j + 3]];
+    if ((a | b | c | d) > 0x3F) break;
+    v = (unsigned long) a << 18 | (unsigned long) b << 12 | c << 6 | d;
+    output[out++] = (unsigned char) (v >> 16);
+    output[out++] = (unsigned char) (v >> 8);
+    output[out++] = (unsigned char) v;
+  }
+
+  return j;
+}
+
+/* base85_digits() writes the five digits of a group.  Splitting */
+/* the value at 85**3 leaves two independent chains of divisions */
+/* by constants, which the compiler turns into multiplications.  */
+
+static void base85_digits(unsigned long v, const char d[], char output[])
+{
+  unsigned long high = v / 614125, low = v % 614125;
+
+  output[0] = d[high / 85];
+  output[1] = d[high % 85];
+  output[2] = d[low / 7225];
+  low %= 7225;
+  output[3] = d[low / 85];
+  output[4] = d[low % 85];
+}
+
+static size_t base85_encode_scalar(int encoding, size_t input_length,
+                                   const unsigned char input[], char output[])
+{
+  const char *d = digits[encoding];
+  int ascii85 = encoding == punycode_ascii85;
+  unsigned long v;
+  size_t j, out = 0;
+
+  for (j = 0;  j + 4 <= input_length;  j += 4) {
+    v = get32(input + j);
+
+    if (ascii85 && v == 0) output[out++] = 'z';
+    else if (ascii85 && v == 0x20202020UL) output[out++] = 'y';
+    else {
+      base85_digits(v, d, output + out);
+      out += 5;
+    }
+  }
+
+  return out;
+}
+
+/* base85_value() returns the value of the five digits a..e, or */
+/* sets *bad if it exceeds 32 bits:                             */
+
+#define base85_value(a,b,c,d,e,bad) \
+  (rest = (((unsigned long) (b) * 85 + (c)) * 85 + (d)) * 85 + (e), \
+   *(bad) |= (a) > 82 || rest > 0xFFFFFFFFUL - (a) * 52200625UL, \
+   ((a) * 52200625UL + rest) & 0xFFFFFFFFUL)
+
+static size_t base85_decode_scalar(int encoding, size_t input_length,
+                                   const char input[], unsigned char output[])
+{
+  const unsigned char *values = char_values[encoding];
+  const unsigned char *s = (const unsigned char *) input;
+  unsigned a, b, c, d, e;
+  unsigned long v, rest;
+  size_t j, out = 0;
+  int bad = 0;
+
+  for (j = 0;  j + 5 <= input_length;  j += 5) {
+    a = values[s[j]], b = values[s[j + 1]], c = values[s[j + 2]];
+    d = values[s[j + 3]], e = values[s[j + 4]];
+    if ((a | b | c | d | e) & 0x80) break;
+    v = base85_value(a, b, c, d, e, &bad);
+    if (bad) break;
+    put32(output + out, v);
+    out += 4;
+  }
+
+  return j;
+}
+
+#ifdef PUNYCODE_X86
+
+/*** AVX2 kernels ***/
+
+#define AVX2 __attribute__((target("avx2")))
+
+/* Hex:  the nibbles of 32 bytes index a table of the 16 digits, */
+/* and interleaving them gives 64 digits, in two halves that the */
+/* 128-bit lanes of the unpacks leave to be put back in order.   */
+
+AVX2 static size_t hex_encode_avx2(size_t input_length,
+                                   const unsigned char input[], char output[])
+{
+  const __m256i table = _mm256_setr_epi8(
+    '0','1','2','3','4','5','6','7','8','9','a','b','c','d','e','f',
+    '0','1','2','3','4','5','6','7','8','9','a','b','c','d','e','f');
+  const __m256i nibble = _mm256_set1_epi8(0xF);
+  __m256i v, hi, lo, a, b;
+  size_t j;
+
+  for (j = 0;  j + 32 <= input_length;  j += 32) {
+    v = _mm256_loadu_si256((const __m256i *) (input + j));
+    hi = _mm256_shuffle_epi8(table,
+           _mm256_and_si256(_mm256_srli_epi16(v, 4), nibble));
+    lo = _mm256_shuffle_epi8(table, _mm256_and_si256(v, nibble));
+    a = _mm256_unpacklo_epi8(hi, lo);
+    b = _mm256_unpackhi_epi8(hi, lo);
+    _mm256_storeu_si256((__m256i *) (output + 2 * j),
+                        _mm256_permute2x128_si256(a, b, 0x20));
+    _mm256_storeu_si256((__m256i *) (output + 2 * j + 32),
+                        _mm256_permute2x128_si256(a, b, 0x31));
+  }
+
+  _mm256_zeroupper();
+  return 2 * j + hex_encode_scalar(input_length - j, input + j,
+                                   output + 2 * j);
+}
+
+/* A char is a decimal digit if c - '0' is at most 9, and a letter */
+/* digit if (c | 0x20) - 'a' is at most 5, both unsigned; pairs of */
+/* values are then combined as 16 * hi + lo by a multiply-add.     */
+
+AVX2 static __m256i hex_values_avx2(__m256i c, __m256i *valid)
+{
+  const __m256i zero = _mm256_set1_epi8('0'),
+                a = _mm256_set1_epi8('a'), fold = _mm256_set1_epi8(0x20),
+                nine = _mm256_set1_epi8(9), five = _mm256_set1_epi8(5),
+                ten = _mm256_set1_epi8(10);
+  __m256i d = _mm256_sub_epi8(c, zero),
+          l = _mm256_sub_epi8(_mm256_or_si256(c, fold), a),
+          is_d = _mm256_cmpeq_epi8(_mm256_min_epu8(d, nine), d),
+          is_l = _mm256_cmpeq_epi8(_mm256_min_epu8(l, five), l);
+
+  *valid = _mm256_and_si256(*valid, _mm256_or_si256(is_d, is_l));
+  return _mm256_or_si256(_mm256_and_si256(is_d, d),
+                         _mm256_and_si256(is_l, _mm256_add_epi8(l, ten)));
+}
+
+AVX2 static size_t hex_decode_avx2(size_t input_length, const char input[],
+                                   unsigned char output[])
+{
+  const __m256i pair = _mm256_set1_epi16(0x0110);
+  __m256i valid, a, b;
+  size_t j;
+
+  for (j = 0;  j + 64 <= input_length;  j += 64) {
+    valid = _mm256_set1_epi8(-1);
+    a = hex_values_avx2(
+          _mm256_loadu_si256((const __m256i *) (input + j)), &valid);
+    b = hex_values_avx2(
+          _mm256_loadu_si256((const __m256i *) (input + j + 32)), &valid);
+    if (_mm256_movemask_epi8(valid) != -1) break;
+    a = _mm256_maddubs_epi16(a, pair);
+    b = _mm256_maddubs_epi16(b, pair);
+    _mm256_storeu_si256((__m256i *) (output + j / 2),
+      _mm256_permute4x64_epi64(_mm256_packus_epi16(a, b), 0xD8));
+  }
+
+  _mm256_zeroupper();
+  return j + hex_decode_scalar(input_length - j, input + j, output + j / 2);
+}
+
+/* Base64, after Mula and Lemire, "Faster Base64 encoding and       */
+/* decoding using AVX2 instructions".  Encoding spreads each 3-byte */
+/* group over a dword, cuts out its four 6-bit fields with two      */
+/* multiplies, and maps each field to its digit by adding an offset */
+/* looked up by range.  The loads read 28 bytes to convert 24.      */
+
+AVX2 static size_t base64_encode_avx2(size_t input_length,
+                                      const unsigned char input[],
+                                      char output[])
+{
+  const __m256i spread = _mm256_setr_epi8(
+    1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+    1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+  const __m256i offsets = _mm256_setr_epi8(
+    'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+    '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+    'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+    '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+  __m256i v, fields, range;
+  size_t j, out = 0;
+
+  for (j = 0;  j + 32 <= input_length;  j += 24, out += 32) {
+    v = _mm256_inserti128_si256(_mm256_castsi128_si256(
+          _mm_loadu_si128((const __m128i *) (input + j))),
+          _mm_loadu_si128((const __m128i *) (input + j + 12)), 1);
+    v = _mm256_shuffle_epi8(v, spread);
+    fields = _mm256_or_si256(
+      _mm256_mulhi_epu16(_mm256_and_si256(v, _mm256_set1_epi32(0x0FC0FC00)),
+                         _mm256_set1_epi32(0x04000040)),
+      _mm256_mullo_epi16(_mm256_and_si256(v, _mm256_set1_epi32(0x003F03F0)),
+                         _mm256_set1_epi32(0x01000010)));
+    range = _mm256_or_si256(
+      _mm256_subs_epu8(fields, _mm256_set1_epi8(51)),
+      _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), fields),
+                       _mm256_set1_epi8(13)));
+    _mm256_storeu_si256((__m256i *) (output + out), _mm256_add_epi8(
+      fields, _mm256_shuffle_epi8(offsets, range)));
+  }
+
+  _mm256_zeroupper();
+  return out + base64_encode_scalar(input_length - j, input + j,
+                                    output + out);
+}
+
+/* Decoding classifies each char by its two nibbles, a char being  */
+/* valid when the bits its nibbles look up have nothing in common, */
+/* adds the offset for its range, and packs the 6-bit fields with  */
+/* two multiply-adds and a shuffle.  Exactly 24 bytes are stored.  */
+
+AVX2 static size_t base64_decode_avx2(size_t input_length,
+                                      const char input[],
+                                      unsigned char output[])
+{
+  const __m256i lo_bits = _mm256_setr_epi8(
+    0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+    0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+  const __m256i hi_bits = _mm256_setr_epi8(
+    0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+    0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08,
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+  const __m256i offsets = _mm256_setr_epi8(
+    0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+  const __m256i pack = _mm256_setr_epi8(
+    2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+    2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+  const __m256i slash = _mm256_set1_epi8(0x2F);
+  __m256i v, hi, lo;
+  size_t j, out = 0;
+
+  for (j = 0;  j + 32 <= input_length;  j += 32, out += 24) {
+    v = _mm256_loadu_si256((const __m256i *) (input + j));
+    hi = _mm256_and_si256(_mm256_srli_epi32(v, 4), slash);
+    lo = _mm256_and_si256(v, slash);
+    if (!_mm256_testz_si256(_mm256_shuffle_epi8(lo_bits, lo),
+                            _mm256_shuffle_epi8(hi_bits, hi))) {
+      break;
+    }
+    v = _mm256_add_epi8(v, _mm256_shuffle_epi8(offsets,
+          _mm256_add_epi8(_mm256_cmpeq_epi8(v, slash), hi)));
+    v = _mm256_madd_epi16(
+          _mm256_maddubs_epi16(v, _mm256_set1_epi32(0x01400140)),
+          _mm256_set1_epi32(0x00011000));
+    v = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(v, pack),
+          _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+    _mm_storeu_si128((__m128i *) (output + out),
+                     _mm256_castsi256_si128(v));
+    _mm_storel_epi64((__m128i *) (output + out + 16),
+                     _mm256_extracti128_si256(v, 1));
+  }
+
+  _mm256_zeroupper();
+  return j + base64_decode_scalar(input_length - j, input + j,
+                                  output + out);
+}
+
+#undef AVX2
+
+#define have_avx2() __builtin_cpu_supports("avx2")
+
+#endif /* PUNYCODE_X86 */
+
+/*** Dispatch ***/
+
+static size_t encode_groups(int encoding, size_t input_length,
+                            const unsigned char input[], char output[])
+{
+  switch (encoding) {
+    case punycode_hex:
+#ifdef PUNYCODE_X86
+      if (have_avx2()) return hex_encode_avx2(input_length, input, output);
+#endif
+      return hex_encode_scalar(input_length, input, output);
+
+    case punycode_base64:
+#ifdef PUNYCODE_X86
+      if (have_avx2()) {
+        return base64_encode_avx2(input_length, input, output);
+      }
+#endif
+      return base64_encode_scalar(input_length, input, output);
+
+    default:
+      return base85_encode_scalar(encoding, input_length, input, output);
+  }
+}
+
+static size_t decode_groups(int encoding, size_t input_length,
+                            const char input[], unsigned char output[])
+{
+  switch (encoding) {
+    case punycode_hex:
+#ifdef PUNYCODE_X86
+      if (have_avx2()) return hex_decode_avx2(input_length, input, output);
+#endif
+      return hex_decode_scalar(input_length, input, output);
+
+    case punycode_base64:
+#ifdef PUNYCODE_X86
+      if (have_avx2()) {
+        return base64_decode_avx2(input_length, input, output);
+      }
+#endif
+      return base64_decode_scalar(input_length, input, output);
+
+    default:
+      return base85_decode_scalar(encoding, input_length, input, output);
+  }
+}
+
+/*** Streams ***/
+
+/* Where a stream is in the syntax around the groups.  An Ascii85  */
+/* decoder starts at phase_start, where a "<" may begin the "<~"   */
+/* delimiter or be a digit, and is at phase_lt until it knows.     */
+/* A Base64 decoder reaches phase_end once its padding is complete */
+/* and an encoder phase_body once it has written any prefix.       */
+
+enum {
+  phase_start, phase_lt, phase_body, phase_tilde, phase_end
+};
+
+/* ascii85_space(c) tests for the whitespace that Ascii85 skips: */
+
+#define ascii85_space(c) ((c) == ' ' || (c) - 9u < 5)
+
+void punycode_binary_stream_init(struct punycode_binary_stream *s,
+                                 int encoding)
+{
+  s->encoding = encoding;
+  s->phase = phase_start;
+  s->held_length = 0;
+  s->padding = 0;
+}
+
+/* put() appends length chars or bytes to the output: */
+
+static enum punycode_status put(const void *data, size_t length,
+                                size_t *out, size_t max_out, void *output)
+{
+  if (max_out - *out < length) return punycode_big_output;
+  memcpy((char *) output + *out, data, length);
+  *out += length;
+  return punycode_success;
+}
+
+/* encode_run() and encode_end() do the work of the update and */
+/* finish functions, appending to the output at *out:          */
+
+static enum punycode_status encode_run(
+  struct punycode_binary_stream *s,
+  size_t input_length,
+  const unsigned char input[],
+  size_t *out,
+  size_t max_out,
+  char output[] )
+{
+  size_t j = 0, group = group_bytes[s->encoding], groups, room;
+  int encoding = s->encoding;
+  unsigned long v;
+
+  if (s->phase == phase_start) {
+    if (encoding == punycode_ascii85) {
+      if (put("<~", 2, out, max_out, output)) return punycode_big_output;
+    }
+    s->phase = phase_body;
+  }
+
+  if (s->held_length > 0) {
+    while (s->held_length < group && j < input_length) {
+      s->held[s->held_length++] = input[j++];
+    }
+
+    if (s->held_length < group) return punycode_success;
+    if (max_out - *out < group_chars[encoding]) return punycode_big_output;
+    *out += encode_groups(encoding, group, s->held, output + *out);
+    s->held_length = 0;
+  }
+
+  /* Ascii85 groups may take one char, so output that does not */
+  /* fit five chars a group may yet fit them in a few passes:  */
+
+  for (groups = (input_length - j) / group;  groups > 0;  ) {
+    room = (max_out - *out) / group_chars[encoding];
+    if (encoding != punycode_ascii85) {
+      if (groups > room) return punycode_big_output;
+    }
+    else if (room == 0) {
+      v = get32(input + j);
+      if (*out == max_out || (v != 0 && v != 0x20202020UL)) {
+        return punycode_big_output;
+      }
+      room = 1;
+    }
+    if (room > groups) room = groups;
+    *out += encode_groups(encoding, room * group, input + j, output + *out);
+    j += room * group;
+    groups -= room;
+  }
+
+  while (j < input_length) s->held[s->held_length++] = input[j++];
+  return punycode_success;
+}
+
+static enum punycode_status encode_end(
+  struct punycode_binary_stream *s,
+  size_t *out,
+  size_t max_out,
+  char output[] )
+{
+  const char *d = digits[s->encoding];
+  size_t r = s->held_length;
+  unsigned char group[4];
+  unsigned long v;
+  char chars[5];
+
+  if (encode_run(s, 0, 0, out, max_out, output)) return punycode_big_output;
+
+  if (r > 0) {
+    memset(group, 0, sizeof group);
+    memcpy(group, s->held, r);
+
+    if (s->encoding == punycode_base64) {
+      v = (unsigned long) group[0] << 16 | group[1] << 8;
+      chars[0] = d[v >> 18];
+      chars[1] = d[v >> 12 & 0x3F];
+      chars[2] = r > 1 ? d[v >> 6 & 0x3F] : '=';
+      chars[3] = '=';
+      if (put(chars, 4, out, max_out, output)) return punycode_big_output;
+    }
+    else {
+      base85_digits(get32(group), d, chars);
+      if (put(chars, r + 1, out, max_out, output)) {
+        return punycode_big_output;
+      }
+    }
+
+    s->held_length = 0;
+  }
+
+  if (s->encoding == punycode_ascii85) {
+    if (put("~>", 2, out, max_out, output)) return punycode_big_output;
+  }
+
+  return punycode_success;
+}
+
+/* flush() converts the digits held by a decoder, r of them short */
+/* of a whole group, into the bytes they stand for:               */
+
+static enum punycode_status flush(struct punycode_binary_stream *s,
+                                  size_t *out, size_t max_out,
+                                  unsigned char output[])
+{
+  const unsigned char *h = s->held;
+  unsigned char bytes[4];
+  size_t n = s->held_length;
+  unsigned long v, rest;
+  int bad = 0;
+
+  s->held_length = 0;
+  if (n == 0) return punycode_success;
+  if (n == 1) return punycode_bad_input;
+
+  switch (s->encoding) {
+    case punycode_hex:
+      bytes[0] = (unsigned char) (h[0] << 4 | h[1]);
+      break;
+
+    case punycode_base64:
+      v = (unsigned long) h[0] << 18 | (unsigned long) h[1] << 12 |
+          (n > 2 ? h[2] << 6 : 0) | (n > 3 ? h[3] : 0);
+      bytes[0] = (unsigned char) (v >> 16);
+      bytes[1] = (unsigned char) (v >> 8);
+      bytes[2] = (unsigned char) v;
+      break;
+
+    default:
+      /* A short group is padded with the highest digit: */
+      v = base85_value(h[0], h[1], n > 2 ? h[2] : 84, n > 3 ? h[3] : 84,
+                       n > 4 ? h[4] : 84, &bad);
+      if (bad) return punycode_bad_input;
+      put32(bytes, v);
+  }
+
+  return put(bytes, n - 1, out, max_out, output);
+}
+
+/* decode_run() and decode_end() are the decoding counterparts of */
+/* encode_run() and encode_end().  Whole groups go to the kernels */
+/* whenever the stream is between groups, and the rest is handled */
+/* a char at a time.  With a null output they only count, which   */
+/* punycode_binary_decoded_length() uses for Ascii85.             */
+
+static enum punycode_status decode_run(
+  struct punycode_binary_stream *s,
+  size_t input_length,
+  const char input[],
+  size_t *out,
+  size_t max_out,
+  unsigned char output[] )
+{
+  int encoding = s->encoding;
+  const unsigned char *values = char_values[encoding];
+  size_t j = 0, group = group_chars[encoding], groups, room, used;
+  unsigned char word[4];
+  unsigned c, v;
+  enum punycode_status status;
+
+  if (encoding != punycode_ascii85 && s->phase == phase_start) {
+    s->phase = phase_body;
+  }
+
+  while (j < input_length) {
+    if (s->held_length == 0 && s->phase == phase_body && s->padding == 0) {
+      groups = (input_length - j) / group;
+
+      if (output == 0) {
+        for (used = 0;  used < groups * group;  ++used) {
+          if (values[(unsigned char) input[j + used]] == 0xFF) break;
+        }
+        used -= used % group;
+      }
+      else {
+        room = (max_out - *out) / group_bytes[encoding];
+        if (groups > room) groups = room;
+        used = decode_groups(encoding, groups * group, input + j,
+                             output + *out);
+      }
+
+      j += used;
+      *out += used / group * group_bytes[encoding];
+      if (j == input_length) break;
+    }
+
+    c = (unsigned char) input[j++];
+    v = values[c];
+
+    if (encoding == punycode_ascii85) {
+      if (ascii85_space(c)) continue;
+
+      switch (s->phase) {
+        case phase_start:
+          if (c == '<') {
+            s->phase = phase_lt;
+            continue;
+          }
+          s->phase = phase_body;
+          break;
+
+        case phase_lt:
+          s->phase = phase_body;
+          if (c == '~') continue;
+          s->held[s->held_length++] = values['<'];
+          break;
+
+        case phase_tilde:
+          if (c != '>') return punycode_bad_input;
+          s->phase = phase_end;
+          continue;
+
+        case phase_end:
+          return punycode_bad_input;
+      }
+
+      if (c == '~') {
+        s->phase = phase_tilde;
+        continue;
+      }
+
+      if (c == 'z' || c == 'y') {
+        if (s->held_length != 0) return punycode_bad_input;
+        memset(word, c == 'z' ? 0 : 0x20, 4);
+        if (output == 0) *out += 4;
+        else if (put(word, 4, out, max_out, output)) {
+          return punycode_big_output;
+        }
+        continue;
+      }
+    }
+    else if (encoding == punycode_base64) {
+      if (s->phase == phase_end) return punycode_bad_input;
+
+      if (c == '=') {
+        if (s->held_length < 2) return punycode_bad_input;
+        if (s->held_length + ++s->padding < 4) continue;
+        status = flush(s, out, max_out, output);
+        if (status != punycode_success) return status;
+        s->phase = phase_end;
+        continue;
+      }
+
+      if (s->padding > 0) return punycode_bad_input;
+    }
+
+    if (v == 0xFF) return punycode_bad_input;
+
+    s->held[s->held_length++] = (unsigned char) v;
+
+    if (s->held_length == group) {
+      if (output == 0) {
+        *out += group_bytes[encoding];
+        s->held_length = 0;
+      }
+      else {
+        status = flush(s, out, max_out, output);
+        if (status != punycode_success) return status;
+      }
+    }
+  }
+
+  return punycode_success;
+}
+
+static enum punycode_status decode_end(
+  struct punycode_binary_stream *s,
+  size_t *out,
+  size_t max_out,
+  unsigned char output[] )
+{
+  if (s->phase == phase_lt) {
+    s->held[s->held_length++] = char_values[punycode_ascii85]['<'];
+  }
+
+  if (s->phase == phase_tilde) return punycode_bad_input;
+  if (s->encoding == punycode_hex && s->held_length > 0) {
+    return punycode_bad_input;
+  }
+  if (s->padding > 0 && s->phase != phase_end) return punycode_bad_input;
+
+  if (output == 0) {
+    if (s->held_length == 1) return punycode_bad_input;
+    *out += s->held_length > 0 ? s->held_length - 1 : 0;
+    s->held_length = 0;
+    return punycode_success;
+  }
+
+  return flush(s, out, max_out, output);
+}
+
+/*** Entry points ***/
+
+/* The bounds are generous by a few groups; limit keeps them, and */
+/* the exact lengths, from wrapping around.                       */
+
+static const size_t limit = ((size_t) -1) / 4 - 16;
+
+size_t punycode_binary_encode_bound(
+  const struct punycode_binary_stream *s,
+  size_t input_length )
+{
+  size_t n = input_length + s->held_length;
+
+  if (input_length > limit) return (size_t) -1;
+  if (s->encoding == punycode_hex) return 2 * n;
+  return (n / group_bytes[s->encoding] + 1) * group_chars[s->encoding] + 4;
+}
+
+size_t punycode_binary_decode_bound(
+  const struct punycode_binary_stream *s,
+  size_t input_length )
+{
+  size_t n = input_length + s->held_length + 1;
+
+  if (input_length > limit) return (size_t) -1;
+  if (s->encoding == punycode_ascii85) return 4 * n;
+  return (n / group_chars[s->encoding] + 1) * group_bytes[s->encoding];
+}
+
+enum punycode_status punycode_binary_encode_update(
+  struct punycode_binary_stream *s,
+  size_t input_length,
+  const unsigned char input[],
+  size_t *output_length,
+  char output[] )
+{
+  size_t out = 0;
+  enum punycode_status status;
+
+  if (*output_length < punycode_binary_encode_bound(s, input_length)) {
+    return punycode_big_output;
+  }
+
+  status = encode_run(s, input_length, input, &out, *output_length, output);
+  if (status == punycode_success) *output_length = out;
+  return status;
+}
+
+enum punycode_status punycode_binary_encode_finish(
+  struct punycode_binary_stream *s,
+  size_t *output_length,
+  char output[] )
+{
+  size_t out = 0;
+  enum punycode_status status;
+
+  if (*output_length < punycode_binary_encode_bound(s, 0)) {
+    return punycode_big_output;
+  }
+
+  status = encode_end(s, &out, *output_length, output);
+  if (status == punycode_success) *output_length = out;
+  return status;
+}
+
+enum punycode_status punycode_binary_decode_update(
+  struct punycode_binary_stream *s,
+  size_t input_length,
+  const char input[],
+  size_t *output_length,
+  unsigned char output[] )
+{
+  size_t out = 0;
+  enum punycode_status status;
+
+  if (*output_length < punycode_binary_decode_bound(s, input_length)) {
+    return punycode_big_output;
+  }
+
+  status = decode_run(s, input_length, input, &out, *output_length, output);
+  if (status == punycode_success) *output_length = out;
+  return status;
+}
+
+enum punycode_status punycode_binary_decode_finish(
+  struct punycode_binary_stream *s,
+  size_t *output_length,
+  unsigned char output[] )
+{
+  size_t out = 0;
+  enum punycode_status status;
+
+  if (*output_length < punycode_binary_decode_bound(s, 0)) {
+    return punycode_big_output;
+  }
+
+  status = decode_end(s, &out, *output_length, output);
+  if (status == punycode_success) *output_length = out;
+  return status;
+}
+
+enum punycode_status punycode_binary_encoded_length(
+  int encoding,
+  size_t input_length,
+  const unsigned char input[],
+  size_t *output_length )
+{
+  size_t whole = input_length / group_bytes[encoding],
+         r = input_length % group_bytes[encoding], j, length;
+  unsigned long v;
+
+  if (input_length > limit) return punycode_overflow;
+
+  switch (encoding) {
+    case punycode_hex:
+      length = 2 * input_length;
+      break;
+
+    case punycode_base64:
+      length = 4 * whole + (r > 0 ? 4 : 0);
+      break;
+
+    default:
+      length = 5 * whole + (r > 0 ? r + 1 : 0);
+
+      if (encoding == punycode_ascii85) {
+        for (length += 4, j = 0;  j < whole;  ++j) {
+          v = get32(input + 4 * j);
+          if (v == 0 || v == 0x20202020UL) length -= 4;
+        }
+      }
+  }
+
+  *output_length = length;
+  return punycode_success;
+}
+
+enum punycode_status punycode_binary_decoded_length(
+  int encoding,
+  size_t input_length,
+  const char input[],
+  size_t *output_length )
+{
+  struct punycode_binary_stream s;
+  size_t pad = 0, n, length = 0;
+  enum punycode_status status;
+
+  if (input_length > limit) return punycode_overflow;
+
+  switch (encoding) {
+    case punycode_hex:
+      if (input_length % 2 != 0) return punycode_bad_input;
+      length = input_length / 2;
+      break;
+
+    case punycode_base64:
+      while (pad < 2 && pad < input_length &&
+             input[input_length - 1 - pad] == '=') {
+        ++pad;
+      }
+
+      n = input_length - pad;
+      if (n % 4 == 1 || (pad > 0 && n % 4 + pad != 4)) {
+        return punycode_bad_input;
+      }
+      length = n / 4 * 3 + (n % 4 > 0 ? n % 4 - 1 : 0);
+      break;
+
+    case punycode_base85:
+      if (input_length % 5 == 1) return punycode_bad_input;
+      length = input_length / 5 * 4 +
+               (input_length % 5 > 0 ? input_length % 5 - 1 : 0);
+      break;
+
+    default:
+      punycode_binary_stream_init(&s, encoding);
+      status = decode_run(&s, input_length, input, &length, 0, 0);
+      if (status == punycode_success) status = decode_end(&s, &length, 0, 0);
+      if (status != punycode_success) return status;
+  }
+
+  *output_length = length;
+  return punycode_success;
+}
+
+enum punycode_status punycode_binary_encode(
+  int encoding,
+  size_t input_length,
+  const unsigned char input[],
+  size_t *output_length,
+  char output[] )
+{
+  struct punycode_binary_stream s;
+  size_t length, out = 0;
+  enum punycode_status status;
+
+  status = punycode_binary_encoded_length(encoding, input_length, input,
+                                          &length);
+  if (status != punycode_success) return status;
+  if (length > *output_length) return punycode_big_output;
+
+  punycode_binary_stream_init(&s, encoding);
+  status = encode_run(&s, input_length, input, &out, length, output);
+  if (status == punycode_success) status = encode_end(&s, &out, length,
+                                                      output);
+  if (status == punycode_success) *output_length = out;
+  return status;
+}
+
+enum punycode_status punycode_binary_decode(
+  int encoding,
+  size_t input_length,
+  const char input[],
+  size_t *output_length,
+  unsigned char output[] )
+{
+  struct punycode_binary_stream s;
+  size_t length, out = 0;
+  enum punycode_status status;
+
+  status = punycode_binary_decoded_length(encoding, input_length, input,
+                                          &length);
+  if (status != punycode_success) return status;
+  if (length > *output_length) return punycode_big_output;
+
+  punycode_binary_stream_init(&s, encoding);
+  status = decode_run(&s, input_length, input, &out, length, output);
+  if (status == punycode_success) status = decode_end(&s, &out, length,
+                                                      output);
+  if (status == punycode_success) *output_length = out;
+  return status;
+}
@@ -0,0 +1,181 @@
+/*
+punycode-binary.h
+
+This is ANSI C code (C89) converting binary data to and from the text
+encodings that utils.js offers next to the Bootstring variants:
+hexadecimal, Base64, the Base85 of RFC 1924, and Adobe's Ascii85.  The
+implementation is in punycode-binary.c.  It does not need punycode.c.
+
+*/
+
+#ifndef PUNYCODE_BINARY_H
+#define PUNYCODE_BINARY_H
+
+#include "punycode.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The encodings, as in ByteArray.toHex(), toBase64(), toBase85() */
+/* and toAscii85() of utils.js:                                   */
+
+enum punycode_binary_encoding {
+  punycode_hex     = 0,  /* two lowercase hexadecimal digits a byte    */
+  punycode_base64  = 1,  /* RFC 4648 Base64, padded with "="           */
+  punycode_base85  = 2,  /* four bytes to five digits, RFC 1924 digits */
+  punycode_ascii85 = 3   /* likewise with Adobe's digits, "z" and "y"  */
+                         /* for all-zero and all-space groups, between */
+                         /* "<~" and "~>"                              */
+};
+
+enum punycode_status punycode_binary_encode(
+  int,                    /* encoding      */
+  size_t,                 /* input_length  */
+  const unsigned char [], /* input         */
+  size_t *,               /* output_length */
+  char []                 /* output        */
+);
+
+enum punycode_status punycode_binary_decode(
+  int,                    /* encoding      */
+  size_t,                 /* input_length  */
+  const char [],          /* input         */
+  size_t *,               /* output_length */
+  unsigned char []        /* output        */
+);
+
+/*
+    punycode_binary_encode() encodes input_length bytes as text, and
+    punycode_binary_decode() decodes such text back to bytes.
+    *output_length is as for punycode_encode():  the caller passes in
+    the size of the output, which receives the number of chars or
+    bytes used.  The output is not null-terminated.
+
+    A final group shorter than a whole one (three bytes for Base64,
+    four for Base85 and Ascii85) is encoded as utils.js does it:  with
+    "=" padding in Base64, and in the others as one digit more than
+    the group has bytes.  Decoding accepts:
+
+        hex      upper and lower case digits, in pairs;
+        Base64   a final group with or without its padding;
+        Base85   any final group of two to five digits;
+        Ascii85  whitespace anywhere, and optional "<~" and "~>"
+                 around the groups, outside which only whitespace
+                 may appear.  "z" and "y" stand for whole groups.
+
+    Return value:
+
+        punycode_bad_input if the text is not in the encoding, or has a
+        group whose value exceeds 32 bits (Base85 and Ascii85), and
+        punycode_big_output if the output is too small, as determined
+        before converting.  The encoder cannot fail otherwise.
+
+    On x86 processors with AVX2, Base64 and hex are converted 24 or 32
+    bytes at a time in vector registers; Base85 and Ascii85 groups are
+    converted by a scalar kernel with the divisions by 85 split into
+    two short chains, "z" and "y" being tested for in the same pass.
+*/
+
+enum punycode_status punycode_binary_encoded_length(
+  int,                    /* encoding      */
+  size_t,                 /* input_length  */
+  const unsigned char [], /* input         */
+  size_t *                /* output_length */
+);
+
+enum punycode_status punycode_binary_decoded_length(
+  int,                    /* encoding      */
+  size_t,                 /* input_length  */
+  const char [],          /* input         */
+  size_t *                /* output_length */
+);
+
+/*
+    These store in *output_length the exact size of the output of
+    punycode_binary_encode() or punycode_binary_decode(), so that it
+    can be allocated exactly.  Only Ascii85 depends on more than the
+    input length, and is scanned for "z", "y", whitespace and the
+    delimiters.  punycode_binary_decoded_length() returns
+    punycode_bad_input if the length or that scan shows the input to
+    be invalid, but does not check every character.  Both return
+    punycode_overflow if the size does not fit in a size_t.
+*/
+
+/*** Streaming ***/
+
+/* The state of a conversion fed its input in pieces.  The fields */
+/* are private.                                                   */
+
+struct punycode_binary_stream {
+  int encoding;
+  int phase;
+  unsigned char held[5];    /* bytes or digits of a partial group */
+  unsigned char held_length;
+  unsigned char padding;    /* Base64 "=" seen so far             */
+};
+
+void punycode_binary_stream_init(struct punycode_binary_stream *,
+                                 int encoding);
+
+size_t punycode_binary_encode_bound(
+  const struct punycode_binary_stream *,
+  size_t                                 /* input_length */
+);
+
+size_t punycode_binary_decode_bound(
+  const struct punycode_binary_stream *,
+  size_t                                 /* input_length */
+);
+
+enum punycode_status punycode_binary_encode_update(
+  struct punycode_binary_stream *,
+  size_t,                 /* input_length  */
+  const unsigned char [], /* input         */
+  size_t *,               /* output_length */
+  char []                 /* output        */
+);
+
+enum punycode_status punycode_binary_encode_finish(
+  struct punycode_binary_stream *,
+  size_t *,               /* output_length */
+  char []                 /* output        */
+);
+
+enum punycode_status punycode_binary_decode_update(
+  struct punycode_binary_stream *,
+  size_t,                 /* input_length  */
+  const char [],          /* input         */
+  size_t *,               /* output_length */
+  unsigned char []        /* output        */
+);
+
+enum punycode_status punycode_binary_decode_finish(
+  struct punycode_binary_stream *,
+  size_t *,               /* output_length */
+  unsigned char []        /* output        */
+);
+
+/*
+    A stream converts input that arrives in pieces, with the same
+    result as converting it all at once.  punycode_binary_stream_init()
+    starts a conversion in either direction.  Each call of the update
+    function for that direction converts all the whole groups it can
+    and keeps the rest of the input (at most a group) for the next
+    call; the finish function converts what is left, and must be
+    called once at the end.  Both take *output_length as for
+    punycode_binary_encode(), writing only the output of that call.
+
+    The bound functions return the largest output that an update with
+    input_length more chars or bytes, or a finish (for input_length
+    zero), can produce.  An update or finish whose output is smaller
+    than that returns punycode_big_output without doing anything, so
+    the call can be repeated with more room.  After any other failure
+    the stream must be initialized again before it is used.
+*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PUNYCODE_BINARY_H */
@@ -0,0 +1,117 @@
+#!/bin/sh
+#
+# punycode-bulk-test.sh
+#
+# This is POSIX shell code checking that the trie modes of
+# punycode-bulk agree with its line mode.  With -t, the output and the
+# reports on stderr must be exactly those of line mode, but for the
+# trie: line.  With -s, the names read back from the trie must be the
+# distinct names that line mode converts, and the reports must again
+# be the same.  Each mode runs in both directions, with one thread and
+# with several, and with and without a cache, whose statistics on
+# stderr are left out of the comparison.  The inputs are
+# punycode-bulk-test.txt and a generated file of names that share
+# their suffixes, as in a zone file.
+#
+# Build punycode-bulk as its header says and run, for example:
+#
+#     sh punycode-bulk-test.sh ./punycode-bulk
+#
+# Each mismatch is reported on stderr, and the exit status is nonzero
+# if there are any.
+
+bulk=${1:-./punycode-bulk}
+dir=$(dirname "$0")
+tmp=$(mktemp -d) || exit 1
+trap 'rm -rf "$tmp"' EXIT
+failures=0
+
+# A few thousand names under a few suffixes, some of them absolute:
+
+awk 'BEGIN {
+  split("com example.com b\303\274cher.de \344\270\255\345\233\275.cn " \
+        "xn--mnchen-3ya.de org.", suffix, " ")
+  split("www mail \303\251t\303\251 \320\274\320\270\321\200 " \
+        "\343\201\202\343\201\204 ns1", prefix, " ")
+  for (j = 0;  j < 3000;  ++j) {
+    print prefix[j % 6 + 1] (j % 7 ? "" : j) "." suffix[j % 5 + 1 + (j % 11 == 0)]
+  }
+}' > "$tmp/names.txt"
+
+# flatten() reads the -s output back into host names:  each line is a
+# label below the last one indented by one tab less, and one ending in
+# a full stop ends a name.
+
+flatten() {
+  awk -F '\t' '{
+    depth = NF > 0 ? NF - 1 : 0
+    label = NF > 0 ? $NF : ""
+    ends = sub(/\.$/, "", label)
+    stack[depth] = label
+    if (ends) {
+      name = label
+      for (k = depth - 1;  k >= 0;  --k) name = name "." stack[k]
+      print name
+    }
+  }'
+}
+
+# converted() drops the lines that stderr reports as not converted:
+
+converted() {
+  awk -v reports="$2" 'BEGIN {
+    while ((getline line < reports) > 0) {
+      if (match(line, /: line [0-9]+:/)) {
+        failed[substr(line, RSTART + 7, RLENGTH - 8) + 0] = 1
+      }
+    }
+  }
+  !(FNR in failed)' "$1"
+}
+
+# reports() keeps the lines of stderr that report input lines:
+
+reports() {
+  grep -v -e ': trie: ' -e ': cache: ' "$1"
+}
+
+fail() {
+  echo "$bulk $*: differs from line mode" >&2
+  failures=$((failures + 1))
+}
+
+check() {
+  input=$1
+  shift
+
+  "$bulk" "$@" "$input" > "$tmp/lines" 2> "$tmp/lines.all"
+  status=$?
+  reports "$tmp/lines.all" > "$tmp/lines.err"
+
+  "$bulk" -t "$@" "$input" > "$tmp/trie" 2> "$tmp/trie.err"
+  [ $? = $status ] &&
+  cmp -s "$tmp/lines" "$tmp/trie" &&
+  reports "$tmp/trie.err" | cmp -s "$tmp/lines.err" - ||
+    fail -t "$@" "$input"
+
+  "$bulk" "$@" -s "$input" > "$tmp/compact" 2> "$tmp/compact.err"
+  [ $? = $status ] &&
+  converted "$tmp/lines" "$tmp/lines.err" | sort -u > "$tmp/expected" &&
+  flatten < "$tmp/compact" | sort -u | cmp -s "$tmp/expected" - &&
+  reports "$tmp/compact.err" | cmp -s "$tmp/lines.err" - ||
+    fail -s "$@" "$input"
+}
+
+"$bulk" -a -j 1 "$tmp/names.txt" > "$tmp/aces.txt" 2> /dev/null
+
+for input in "$dir/punycode-bulk-test.txt" "$tmp/names.txt" "$tmp/aces.txt"
+do
+  for direction in -a -u; do
+    check "$input" $direction -j 1
+    check "$input" -j 4 $direction
+    check "$input" -c 1 $direction -j 3
+  done
+done
+
+echo "$failures failed"
+[ $failures = 0 ]
@@ -0,0 +1,1098 @@
+/*
+punycode-bulk.c
+
+This is C code for POSIX systems (it uses threads and mmap()) that
+converts a file of host names, one per line, between UTF-8 and ACE
+using the functions in punycode-idna.h.  Unlike punycode-test.c, which
+converts a single label for testing, it is meant for bulk conversion
+of zone files and logs:  the input is mapped into memory and split
+into chunks of whole lines, the chunks are converted by a pool of
+threads, and the results are written in input order.  A line that
+fails to convert is copied to the output unchanged and reported on
+stderr, and conversion carries on.  Optionally, the threads share a
+cache of converted labels (see punycode-cache.h), which pays off when
+the same labels come up again and again.
+
+For highly redundant input, where millions of names end in the same
+few suffixes, the names can instead be gathered first into a trie of
+their labels read from the right.  Every distinct node of it is
+converted once, by all threads together, and the names are put back
+together from the converted nodes, either line by line in input order
+or as the trie itself, in which each shared suffix appears only once.
+
+Build it together with the library, for example:
+
+    cc -O2 -pthread -o punycode-bulk punycode-bulk.c punycode-idna.c \
+       punycode-batch.c punycode-cached.c punycode-cache.c punycode.c \
+       punycode-simd.c
+
+Built with -DPUNYCODE_STATS and punycode-stats.c as well, it reports the
+counters of punycode-stats.h on stderr at the end, in the Prometheus
+text format.
+
+punycode-bulk-test.txt holds names with over-long labels that once
+overran a buffer; every mode should get through it, reporting the
+lines it cannot convert, in a build with -fsanitize=address:
+
+    ./punycode-bulk -u -j 1 -s punycode-bulk-test.txt
+
+punycode-bulk-test.sh checks that the -t and -s modes convert what
+line mode converts, on that file and on generated names:
+
+    sh punycode-bulk-test.sh ./punycode-bulk
+
+*/
+
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "punycode-cache.h"
+#include "punycode-idna.h"
+#include "punycode-stats.h"
+
+enum {
+  chunk_size = 1 << 20,     /* input bytes per chunk, rounded up to a line */
+  chunks_per_thread = 4,    /* converted chunks allowed ahead of output    */
+  max_labels = 128,         /* a host name has at most 127 labels          */
+  max_threads = 256,
+  nodes_per_block = 1024,   /* trie nodes per block, the unit of work      */
+  arena_block_size = 65536  /* bytes per block of converted labels         */
+};
+
+static void usage(char **argv)
+{
+  fprintf(stderr,
+    "\n"
+    "%s -a [-j threads] [-c megabytes] [-t | -s] [file]\n"
+    "    converts host names to ACE.\n"
+    "%s -u [-j threads] [-c megabytes] [-t | -s] [file]\n"
+    "    converts host names to Unicode.\n"
+    "\n"
+    "Input and output are UTF-8 text with one host name per line;\n"
+    "the input is read from the file if given, otherwise from stdin.\n"
+    "Lines that cannot be converted are copied unchanged and reported\n"
+    "on stderr, and the exit status is then nonzero.  By default one\n"
+    "thread is used per online processor.  With -c, converted labels\n"
+    "are cached in up to the given number of megabytes, and the cache\n"
+    "statistics are reported on stderr at the end.\n"
+    "\n"
+    "With -t, the host names are first gathered into a trie of their\n"
+    "shared suffixes, so that each distinct suffix is converted only\n"
+    "once; the output is the same.  With -s, the trie itself is output\n"
+    "instead, one converted label per line below the label to its\n"
+    "right, indented by one tab more.  A label followed by a full stop\n"
+    "ends a host name of the input; absolute names are found under an\n"
+    "empty line.  Each suffix appears once, in order of appearance.\n"
+    , argv[0], argv[0]);
+  exit(EXIT_FAILURE);
+}
+
+static void fail(const char *msg)
+{
+  fputs(msg, stderr);
+  exit(EXIT_FAILURE);
+}
+
+static const char out_of_memory[] = "out of memory\n";
+static const char io_error[] = "I/O error\n";
+
+static const char *const status_message[] = {
+  "success",
+  "invalid input",
+  "input or output is too large",
+  "arithmetic overflow"
+};
+
+/*** Chunks ***/
+
+/* A line that failed, by its index within the chunk: */
+
+struct line_error {
+  size_t line;
+  enum punycode_status status;
+};
+
+struct node;
+
+struct chunk {
+  const char *begin, *end;      /* input, a whole number of lines    */
+  char *output;                 /* converted lines, set once done    */
+  size_t output_length, output_capacity;
+  struct line_error *errors;
+  size_t error_count, error_capacity;
+  size_t lines;
+  const struct node **leaves;   /* by line, for -t and -s (see below) */
+  int done;
+};
+
+/* reserve() makes room for need more bytes of chunk output: */
+
+static void reserve(struct chunk *c, size_t need)
+{
+  size_t capacity;
+  char *output;
+
+  if (c->output_capacity - c->output_length >= need) return;
+  capacity = 2 * c->output_capacity;
+  if (capacity < c->output_length + need) capacity = c->output_length + need;
+  output = realloc(c->output, capacity);
+  if (output == 0) fail(out_of_memory);
+  c->output = output;
+  c->output_capacity = capacity;
+}
+
+static void append(struct chunk *c, const char *s, size_t length)
+{
+  reserve(c, length);
+  memcpy(c->output + c->output_length, s, length);
+  c->output_length += length;
+}
+
+static void record_error(struct chunk *c, enum punycode_status status)
+{
+  struct line_error *errors;
+
+  if (c->error_count == c->error_capacity) {
+    c->error_capacity = c->error_capacity ? 2 * c->error_capacity : 16;
+    errors = realloc(c->errors, c->error_capacity * sizeof *errors);
+    if (errors == 0) fail(out_of_memory);
+    c->errors = errors;
+  }
+
+  c->errors[c->error_count].line = c->lines;
+  c->errors[c->error_count].status = status;
+  ++c->error_count;
+}
+
+/* convert_chunk() converts every line of the chunk.  A converted   */
+/* host name is never more than four times as long as the input,    */
+/* plus room for the ACE prefixes, which bounds the scratch needed. */
+
+static void convert_chunk(struct chunk *c, int to_ascii,
+                          struct punycode_cache *cache)
+{
+  struct punycode_slice labels[max_labels];
+  char *scratch = 0;
+  size_t scratch_capacity = 0, label_count, scratch_length, length;
+  const char *line, *newline;
+  enum punycode_status status;
+
+  c->output_capacity = (size_t) (c->end - c->begin) + 64;
+  c->output = malloc(c->output_capacity);
+  if (c->output == 0) fail(out_of_memory);
+
+  for (line = c->begin;  line < c->end;  line = newline + 1, ++c->lines) {
+    newline = memchr(line, '\n', (size_t) (c->end - line));
+    if (newline == 0) newline = c->end;
+    length = (size_t) (newline - line);
+
+    if (scratch_capacity < 4 * length + 4 * max_labels) {
+      scratch_capacity = 4 * length + 4 * max_labels;
+      free(scratch);
+      scratch = malloc(scratch_capacity);
+      if (scratch == 0) fail(out_of_memory);
+    }
+
+    /* Blank lines stay blank, as they do in the trie: */
+
+    if (length == 0) {
+      label_count = scratch_length = 0;
+      status = punycode_success;
+    }
+    else {
+      label_count = max_labels;
+      scratch_length = scratch_capacity;
+      status = (to_ascii ? punycode_to_ascii_cached
+                         : punycode_to_unicode_cached)(
+                 cache, length, line, &label_count, labels,
+                 &scratch_length, scratch);
+    }
+
+    if (status == punycode_success) {
+      reserve(c, scratch_length + length + 1);
+      length = c->output_capacity - c->output_length;
+      punycode_join_labels(label_count, labels, &length,
+                           c->output + c->output_length);
+      c->output_length += length;
+    }
+    else {
+      record_error(c, status);
+      append(c, line, length);
+    }
+
+    if (newline < c->end) append(c, "\n", 1);
+  }
+
+  free(scratch);
+}
+
+/*** Suffix trie ***/
+
+/* With -t or -s, every host name is a path in a trie from its last */
+/* label to its first, so a node stands for a suffix shared by all  */
+/* the names below it.  The nodes are allocated in blocks, which    */
+/* are also the unit of work when they are converted, and found by  */
+/* a hash table keyed by their parent and label.  The labels are    */
+/* copied into an arena, so that looking them up stays within a few */
+/* blocks instead of wandering all over the input; only those too   */
+/* long ever to convert are left in the input.  A converted label   */
+/* points to the copy if it needed no change, and otherwise into an */
+/* arena of the thread that converted it.                           */
+
+struct node {
+  struct node *parent;          /* the label to the right, or null   */
+  struct node *next;            /* in the same hash bucket           */
+  struct node *child, *sibling; /* the shown nodes, for -s           */
+  const char *label, *converted;
+  size_t length, converted_length;
+  unsigned long hash;
+  enum punycode_status status;
+  int terminal;                 /* a name of the input ends here     */
+};
+
+struct node_block {
+  struct node_block *next;
+  size_t count;
+  struct node nodes[nodes_per_block];
+};
+
+struct arena_block {
+  struct arena_block *next;
+  char data[arena_block_size];
+};
+
+struct arena {
+  struct arena_block *blocks;   /* the newest first                  */
+  size_t used;                  /* chars used in the newest block    */
+};
+
+struct trie {
+  struct node root;             /* the empty suffix                  */
+  struct node **buckets;
+  size_t bucket_count, node_count;
+  unsigned long labels;         /* labels inserted, shared or not    */
+  struct node_block *blocks;    /* the newest first                  */
+  struct arena copies;          /* of the labels of the nodes        */
+  struct node_block *unconverted;
+  struct arena *arenas;         /* one per converting thread         */
+  size_t arena_count;
+  int to_ascii;
+  struct punycode_cache *cache;
+  pthread_mutex_t lock;         /* guards unconverted                */
+};
+
+/* arena_copy() copies a label, which must not be longer than */
+/* arena_block_size, into the arena:                          */
+
+static const char *arena_copy(struct arena *a, const char *s, size_t length)
+{
+  struct arena_block *b;
+
+  if (a->blocks == 0 || arena_block_size - a->used < length) {
+    b = malloc(sizeof *b);
+    if (b == 0) fail(out_of_memory);
+    b->next = a->blocks;
+    a->blocks = b;
+    a->used = 0;
+  }
+
+  memcpy(a->blocks->data + a->used, s, length);
+  a->used += length;
+  return a->blocks->data + a->used - length;
+}
+
+/* split_line() splits a line into labels just as punycode_to_ascii() */
+/* does, returning punycode_bad_input for an empty label other than   */
+/* a final one and punycode_big_output for more than max_labels.      */
+
+static enum punycode_status split_line(size_t length, const char line[],
+                                       size_t *label_count,
+                                       struct punycode_slice labels[])
+{
+  const unsigned char *s = (const unsigned char *) line;
+  size_t begin = 0, j, width, n = 0;
+
+  *label_count = 0;
+  if (length == 0) return punycode_success;
+
+  for (j = 0;  j <= length;  ++j) {
+    if (j == length) width = 0;
+    else if (s[j] == '.') width = 1;
+    else if (s[j] >= 0x80 && j + 2 < length &&
+             ((s[j] == 0xE3 && s[j + 1] == 0x80 && s[j + 2] == 0x82) ||
+              (s[j] == 0xEF && s[j + 1] == 0xBC && s[j + 2] == 0x8E) ||
+              (s[j] == 0xEF && s[j + 1] == 0xBD && s[j + 2] == 0xA1))) {
+      width = 3;
+    }
+    else continue;
+
+    if (j == begin && (width > 0 || n == 0)) return punycode_bad_input;
+    if (n == max_labels) return punycode_big_output;
+    labels[n].data = line + begin;
+    labels[n++].length = j - begin;
+    if (width == 0) break;
+    begin = j + width;
+    j += width - 1;
+  }
+
+  *label_count = n;
+  return punycode_success;
+}
+
+/* hash_label() continues the hash of the parent over the label */
+/* (FNV-1a), and bucket() picks the bucket of a hash:           */
+
+static unsigned long hash_label(unsigned long hash, size_t length,
+                                const char label[])
+{
+  size_t j;
+
+  for (j = 0;  j < length;  ++j) {
+    hash = ((hash ^ (unsigned char) label[j]) * 16777619UL) & 0xFFFFFFFFUL;
+  }
+
+  return hash;
+}
+
+#define bucket(t,hash) (((hash) ^ (hash) >> 16) & ((t)->bucket_count - 1))
+
+static struct node *find(const struct trie *t, const struct node *parent,
+                         size_t length, const char label[])
+{
+  unsigned long hash = hash_label(parent->hash, length, label);
+  struct node *n;
+
+  for (n = t->buckets[bucket(t, hash)];  n != 0;  n = n->next) {
+    if (n->hash == hash && n->parent == parent && n->length == length &&
+        memcmp(n->label, label, length) == 0) break;
+  }
+
+  return n;
+}
+
+/* grow() doubles the buckets once there are more nodes than them: */
+
+static void grow(struct trie *t)
+{
+  struct node_block *b;
+  struct node *n;
+  size_t j;
+
+  free(t->buckets);
+  t->bucket_count *= 2;
+  t->buckets = calloc(t->bucket_count, sizeof *t->buckets);
+  if (t->buckets == 0) fail(out_of_memory);
+
+  for (b = t->blocks;  b != 0;  b = b->next) {
+    for (j = 0;  j < b->count;  ++j) {
+      n = &b->nodes[j];
+      n->next = t->buckets[bucket(t, n->hash)];
+      t->buckets[bucket(t, n->hash)] = n;
+    }
+  }
+}
+
+static struct node *insert(struct trie *t, struct node *parent,
+                           size_t length, const char label[])
+{
+  struct node *n = find(t, parent, length, label), **head;
+  struct node_block *b;
+
+  if (n != 0) return n;
+
+  if (t->blocks == 0 || t->blocks->count == nodes_per_block) {
+    b = malloc(sizeof *b);
+    if (b == 0) fail(out_of_memory);
+    b->next = t->blocks;
+    b->count = 0;
+    t->blocks = b;
+  }
+
+  n = &t->blocks->nodes[t->blocks->count++];
+  memset(n, 0, sizeof *n);
+  n->parent = parent;
+  n->label = length > 4 * punycode_label_max_length ? label
+           : arena_copy(&t->copies, label, length);
+  n->length = length;
+  n->hash = hash_label(parent->hash, length, label);
+  head = &t->buckets[bucket(t, n->hash)];
+  n->next = *head;
+  *head = n;
+  if (++t->node_count > t->bucket_count) grow(t);
+  return n;
+}
+
+/* build_trie() inserts every line of the chunks, setting the leaves */
+/* of each chunk to the nodes of its lines' first labels, or to null */
+/* for the lines that do not split into labels.                      */
+
+static void build_trie(struct trie *t, struct chunk chunks[],
+                       size_t chunk_count, int to_ascii,
+                       struct punycode_cache *cache)
+{
+  struct punycode_slice labels[max_labels];
+  const char *line, *newline;
+  const struct node **leaves;
+  struct chunk *c;
+  struct node *n;
+  size_t label_count, capacity, j, k;
+
+  memset(t, 0, sizeof *t);
+  t->root.hash = 2166136261UL;
+  t->root.status = punycode_success;
+  t->bucket_count = 1 << 16;
+  t->buckets = calloc(t->bucket_count, sizeof *t->buckets);
+  if (t->buckets == 0) fail(out_of_memory);
+  t->to_ascii = to_ascii;
+  t->cache = cache;
+  pthread_mutex_init(&t->lock, 0);
+
+  for (j = 0;  j < chunk_count;  ++j) {
+    c = &chunks[j];
+    capacity = 0;
+
+    for (k = 0, line = c->begin;  line < c->end;  line = newline + 1, ++k) {
+      newline = memchr(line, '\n', (size_t) (c->end - line));
+      if (newline == 0) newline = c->end;
+
+      if (k == capacity) {
+        capacity = capacity ? 2 * capacity : 1024;
+        leaves = realloc(c->leaves, capacity * sizeof *leaves);
+        if (leaves == 0) fail(out_of_memory);
+        c->leaves = leaves;
+      }
+
+      c->leaves[k] = 0;
+      if (split_line((size_t) (newline - line), line, &label_count,
+                     labels) != punycode_success) continue;
+
+      t->labels += label_count;
+      n = &t->root;
+
+      while (label_count > 0) {
+        --label_count;
+        n = insert(t, n, labels[label_count].length,
+                   labels[label_count].data);
+      }
+
+      n->terminal = 1;
+      c->leaves[k] = n;
+    }
+  }
+}
+
+/* convert_node() converts the label of a node on its own.  An empty */
+/* label, which can only be the last of a name, needs no conversion. */
+
+static void convert_node(const struct trie *t, struct node *n,
+                         struct arena *a)
+{
+  struct punycode_slice label;
+  char scratch[4 * punycode_label_max_length];
+  size_t label_count = 1, scratch_length = sizeof scratch;
+
+  n->converted = n->label;
+  n->converted_length = 0;
+  n->status = punycode_success;
+  if (n->length == 0) return;
+
+  n->status = (t->to_ascii ? punycode_to_ascii_cached
+                           : punycode_to_unicode_cached)(
+                t->cache, n->length, n->label, &label_count, &label,
+                &scratch_length, scratch);
+
+  if (n->status != punycode_success) return;
+  n->converted = scratch_length ? arena_copy(a, label.data, label.length)
+                                : label.data;
+  n->converted_length = label.length;
+}
+
+struct converter {
+  struct trie *trie;
+  struct arena *arena;
+};
+
+static void *convert_nodes(void *arg)
+{
+  struct converter *w = arg;
+  struct trie *t = w->trie;
+  struct node_block *b;
+  size_t j;
+
+  for (;;) {
+    pthread_mutex_lock(&t->lock);
+    b = t->unconverted;
+    if (b != 0) t->unconverted = b->next;
+    pthread_mutex_unlock(&t->lock);
+
+    if (b == 0) return 0;
+    for (j = 0;  j < b->count;  ++j) convert_node(t, &b->nodes[j], w->arena);
+  }
+}
+
+/* convert_trie() converts every node, the threads taking one block */
+/* of nodes at a time.                                              */
+
+static void convert_trie(struct trie *t, size_t thread_count)
+{
+  struct converter *workers;
+  pthread_t *threads;
+  struct node_block *b;
+  size_t j, block_count = 0;
+
+  for (b = t->blocks;  b != 0;  b = b->next) ++block_count;
+  if (thread_count > block_count) thread_count = block_count;
+  if (thread_count == 0) return;
+
+  t->unconverted = t->blocks;
+  t->arena_count = thread_count;
+  t->arenas = calloc(thread_count, sizeof *t->arenas);
+  workers = malloc(thread_count * sizeof *workers);
+  threads = malloc(thread_count * sizeof *threads);
+  if (!t->arenas || !workers || !threads) fail(out_of_memory);
+
+  for (j = 0;  j < thread_count;  ++j) {
+    workers[j].trie = t;
+    workers[j].arena = &t->arenas[j];
+    if (pthread_create(&threads[j], 0, convert_nodes, &workers[j]) != 0) {
+      fail("cannot create thread\n");
+    }
+  }
+
+  for (j = 0;  j < thread_count;  ++j) pthread_join(threads[j], 0);
+  free(threads);
+  free(workers);
+}
+
+/* assemble_chunk() is convert_chunk() for a converted trie:  the   */
+/* name of each line is put together from its leaf up to the root,  */
+/* which is its labels from left to right, and fails with the first */
+/* label that failed, as it would without the trie.  Lines that do  */
+/* not split are converted once more on their own, for their exact  */
+/* status.  With compact, only the failures are recorded.           */
+
+static void assemble_chunk(struct chunk *c, const struct trie *t,
+                           int compact)
+{
+  struct punycode_slice labels[max_labels];
+  char *scratch, *output;
+  size_t label_count, scratch_length, length, total;
+  const char *line, *newline;
+  const struct node *leaf, *n;
+  enum punycode_status status, again;
+
+  if (!compact) {
+    c->output_capacity = (size_t) (c->end - c->begin) + 64;
+    c->output = malloc(c->output_capacity);
+    if (c->output == 0) fail(out_of_memory);
+  }
+
+  for (line = c->begin;  line < c->end;  line = newline + 1, ++c->lines) {
+    newline = memchr(line, '\n', (size_t) (c->end - line));
+    if (newline == 0) newline = c->end;
+    length = (size_t) (newline - line);
+
+    leaf = c->leaves[c->lines];
+    status = leaf ? punycode_success : punycode_bad_input;
+    total = 0;
+
+    for (n = leaf;  n != 0 && n != &t->root;  n = n->parent) {
+      if (status == punycode_success) status = n->status;
+      total += n->converted_length + 1;
+    }
+
+    if (leaf == 0) {
+      scratch_length = 4 * length + 4 * max_labels;
+      scratch = malloc(scratch_length);
+      if (scratch == 0) fail(out_of_memory);
+      label_count = max_labels;
+      again = (t->to_ascii ? punycode_to_ascii_cached
+                           : punycode_to_unicode_cached)(
+                t->cache, length, line, &label_count, labels,
+                &scratch_length, scratch);
+      free(scratch);
+      if (again != punycode_success) status = again;
+    }
+
+    if (status != punycode_success) {
+      record_error(c, status);
+      if (!compact) append(c, line, length);
+    }
+    else if (!compact) {
+      reserve(c, total);
+      output = c->output + c->output_length;
+
+      for (n = leaf;  n != &t->root;  n = n->parent) {
+        if (n != leaf) *output++ = '.';
+        memcpy(output, n->converted, n->converted_length);
+        output += n->converted_length;
+      }
+
+      c->output_length = (size_t) (output - c->output);
+    }
+
+    if (newline < c->end && !compact) append(c, "\n", 1);
+  }
+}
+
+/* print_nodes() writes the shown nodes from n on and below, at the */
+/* given depth, as described in usage().  A converted label is as  */
+/* long as its input, which in -u mode need not be a valid label,   */
+/* so it is written straight from the node rather than through a    */
+/* buffer.  A name has at most max_labels labels, so that is as     */
+/* deep as the recursion goes.                                      */
+
+static void print_nodes(const struct node *n, size_t depth)
+{
+  size_t j;
+
+  for (;  n != 0;  n = n->sibling) {
+    for (j = 0;  j < depth;  ++j) {
+      if (putc('\t', stdout) == EOF) fail(io_error);
+    }
+
+    if (fwrite(n->converted, 1, n->converted_length, stdout)
+        != n->converted_length) {
+      fail(io_error);
+    }
+
+    if (n->terminal && putc('.', stdout) == EOF) fail(io_error);
+    if (putc('\n', stdout) == EOF) fail(io_error);
+    print_nodes(n->child, depth + 1);
+  }
+}
+
+/* print_trie() shows the nodes that converted and end a name, or   */
+/* lie on the way to one that does.  Children are always allocated  */
+/* after their parents, so going through the nodes newest first     */
+/* finds all the shown children of a node before the node itself,   */
+/* and linking them in that order leaves them in order of creation. */
+
+static void print_trie(struct trie *t)
+{
+  struct node_block *b;
+  struct node *n;
+  size_t j;
+
+  for (b = t->blocks;  b != 0;  b = b->next) {
+    for (j = b->count;  j > 0;  ) {
+      n = &b->nodes[--j];
+      if (n->status != punycode_success || !(n->terminal || n->child)) {
+        continue;
+      }
+
+      n->sibling = n->parent->child;
+      n->parent->child = n;
+    }
+  }
+
+  print_nodes(t->root.child, 0);
+}
+
+static void free_arena(struct arena *a)
+{
+  struct arena_block *b;
+
+  while ((b = a->blocks) != 0) {
+    a->blocks = b->next;
+    free(b);
+  }
+}
+
+static void free_trie(struct trie *t)
+{
+  struct node_block *b;
+  size_t j;
+
+  while ((b = t->blocks) != 0) {
+    t->blocks = b->next;
+    free(b);
+  }
+
+  for (j = 0;  j < t->arena_count;  ++j) free_arena(&t->arenas[j]);
+  free_arena(&t->copies);
+  free(t->arenas);
+  free(t->buckets);
+  pthread_mutex_destroy(&t->lock);
+}
+
+/*** Thread pool ***/
+
+/* Each worker owns a queue of chunk indices, dealt round-robin so  */
+/* that every queue advances through the input roughly in step.  A  */
+/* worker whose queue is empty, or whose next chunk lies beyond the */
+/* reordering window, steals the lowest chunk from the other queues */
+/* instead, which is always the one holding the output back.  Only  */
+/* when nothing within the window is left does it wait.             */
+
+struct queue {
+  pthread_mutex_t lock;
+  size_t next, step, count;     /* chunks next, next+step, ... < count */
+};
+
+struct pool {
+  struct chunk *chunks;
+  size_t chunk_count;
+  struct queue *queues;
+  size_t thread_count;
+  size_t written;               /* chunks already output              */
+  size_t window;                /* chunks allowed beyond written      */
+  int to_ascii;
+  struct punycode_cache *cache; /* shared by the workers, or null     */
+  const struct trie *trie;      /* converted already, or null         */
+  int compact;                  /* -s:  the trie is output instead    */
+  pthread_mutex_t lock;
+  pthread_cond_t changed;       /* a chunk finished or was written    */
+};
+
+struct worker {
+  struct pool *pool;
+  size_t id;
+};
+
+/* peek() returns the next chunk of a queue, or chunk_count if it */
+/* is empty.  The caller holds the queue's lock.                  */
+
+static size_t peek(const struct pool *pool, const struct queue *q)
+{
+  return q->next < q->count ? q->next : pool->chunk_count;
+}
+
+/* take() returns the lowest chunk below limit, preferring the */
+/* worker's own queue, or chunk_count if there is none.        */
+
+static size_t take(struct pool *pool, size_t self, size_t limit)
+{
+  size_t j, v, best = pool->chunk_count, victim = self, c;
+
+  for (j = 0;  j < pool->thread_count;  ++j) {
+    v = (self + j) % pool->thread_count;
+    pthread_mutex_lock(&pool->queues[v].lock);
+    c = peek(pool, &pool->queues[v]);
+    pthread_mutex_unlock(&pool->queues[v].lock);
+
+    if (c < best) {
+      best = c;
+      victim = v;
+      if (v == self && c < limit) break;
+    }
+  }
+
+  if (best >= limit) return pool->chunk_count;
+
+  /* Another worker may have taken it meanwhile; claim it only */
+  /* if it is still at the front of the queue:                 */
+
+  pthread_mutex_lock(&pool->queues[victim].lock);
+  c = peek(pool, &pool->queues[victim]);
+  if (c == best) pool->queues[victim].next += pool->queues[victim].step;
+  pthread_mutex_unlock(&pool->queues[victim].lock);
+
+  return c == best ? best : take(pool, self, limit);
+}
+
+static void *work(void *arg)
+{
+  struct worker *w = arg;
+  struct pool *pool = w->pool;
+  size_t c, limit;
+
+  for (;;) {
+    pthread_mutex_lock(&pool->lock);
+    limit = pool->written + pool->window;
+    pthread_mutex_unlock(&pool->lock);
+
+    c = take(pool, w->id, limit);
+
+    if (c == pool->chunk_count) {
+      pthread_mutex_lock(&pool->lock);
+
+      /* Nothing is left within the window:  either everything */
+      /* has been taken, or the window must move first.        */
+
+      if (limit >= pool->chunk_count) {
+        pthread_mutex_unlock(&pool->lock);
+        return 0;
+      }
+
+      while (pool->written + pool->window == limit) {
+        pthread_cond_wait(&pool->changed, &pool->lock);
+      }
+
+      pthread_mutex_unlock(&pool->lock);
+      continue;
+    }
+
+    if (pool->trie == 0) {
+      convert_chunk(&pool->chunks[c], pool->to_ascii, pool->cache);
+    }
+    else assemble_chunk(&pool->chunks[c], pool->trie, pool->compact);
+
+    pthread_mutex_lock(&pool->lock);
+    pool->chunks[c].done = 1;
+    pthread_cond_broadcast(&pool->changed);
+    pthread_mutex_unlock(&pool->lock);
+  }
+}
+
+/*** Input ***/
+
+/* map_input() maps the file into memory, falling back to reading */
+/* it when it cannot be mapped (a pipe, for instance).             */
+
+static const char *map_input(int fd, size_t *length, int *mapped)
+{
+  struct stat st;
+  char *data = 0, *grown;
+  size_t capacity = 0;
+  ssize_t r;
+  void *p;
+
+  if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0) {
+    p = mmap(0, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    if (p != MAP_FAILED) {
+      madvise(p, (size_t) st.st_size, MADV_SEQUENTIAL);
+      *length = (size_t) st.st_size;
+      *mapped = 1;
+      return p;
+    }
+  }
+
+  *length = 0;
+  *mapped = 0;
+
+  for (;;) {
+    if (*length == capacity) {
+      capacity = capacity ? 2 * capacity : chunk_size;
+      grown = realloc(data, capacity);
+      if (grown == 0) fail(out_of_memory);
+      data = grown;
+    }
+
+    r = read(fd, data + *length, capacity - *length);
+    if (r == 0) break;
+    if (r < 0 && errno != EINTR) fail(io_error);
+    if (r > 0) *length += (size_t) r;
+  }
+
+  return data;
+}
+
+/* split_input() divides the input into chunks of about chunk_size */
+/* bytes, each ending just after a newline or at the end of input. */
+
+static struct chunk *split_input(const char *input, size_t length,
+                                 size_t *count)
+{
+  struct chunk *chunks;
+  const char *p = input, *end = input + length, *newline;
+  size_t n = 0;
+
+  chunks = calloc(length / chunk_size + 1, sizeof *chunks);
+  if (chunks == 0) fail(out_of_memory);
+
+  while (p < end) {
+    chunks[n].begin = p;
+
+    if ((size_t) (end - p) <= chunk_size) p = end;
+    else {
+      newline = memchr(p + chunk_size, '\n', (size_t) (end - p) - chunk_size);
+      p = newline ? newline + 1 : end;
+    }
+
+    chunks[n++].end = p;
+  }
+
+  *count = n;
+  return chunks;
+}
+
+/*** Main ***/
+
+int main(int argc, char **argv)
+{
+  struct pool pool;
+  struct worker *workers;
+  pthread_t *threads;
+  const char *input;
+  size_t length, j, k, line = 0, errors = 0;
+  long online, megabytes = 0;
+  int fd = 0, mapped, option;
+  struct chunk *c;
+  struct punycode_cache_stats stats;
+  struct trie trie;
+
+  online = sysconf(_SC_NPROCESSORS_ONLN);
+  pool.thread_count = online > 0 ? (size_t) online : 1;
+  pool.to_ascii = -1;
+  pool.cache = 0;
+  pool.trie = 0;
+  pool.compact = 0;
+
+  /* The options may come in any order, but -a and -u, like -t */
+  /* and -s, exclude one another:                              */
+
+  while ((option = getopt(argc, argv, "auj:c:ts")) != -1) {
+    switch (option) {
+    case 'a':
+    case 'u':
+      if (pool.to_ascii == (option == 'u')) usage(argv);
+      pool.to_ascii = option == 'a';
+      break;
+    case 'j':
+      pool.thread_count = (size_t) atol(optarg);
+      if (pool.thread_count < 1 || pool.thread_count > max_threads) {
+        usage(argv);
+      }
+      break;
+    case 'c':
+      megabytes = atol(optarg);
+      if (megabytes < 1) usage(argv);
+      break;
+    case 't':
+    case 's':
+      if (pool.trie && pool.compact != (option == 's')) usage(argv);
+      pool.trie = &trie;
+      pool.compact = option == 's';
+      break;
+    default:
+      usage(argv);
+    }
+  }
+
+  if (pool.to_ascii < 0 || optind + 1 < argc) usage(argv);
+
+  if (megabytes > 0) {
+    pool.cache = punycode_cache_create((size_t) megabytes << 20, 0);
+    if (pool.cache == 0) fail(out_of_memory);
+  }
+
+  if (optind < argc && strcmp(argv[optind], "-") != 0) {
+    fd = open(argv[optind], O_RDONLY);
+    if (fd < 0) {
+      perror(argv[optind]);
+      return EXIT_FAILURE;
+    }
+  }
+
+  input = map_input(fd, &length, &mapped);
+  pool.chunks = split_input(input, length, &pool.chunk_count);
+
+  if (pool.trie) {
+    build_trie(&trie, pool.chunks, pool.chunk_count, pool.to_ascii,
+               pool.cache);
+    convert_trie(&trie, pool.thread_count);
+  }
+
+  if (pool.thread_count > pool.chunk_count) {
+    pool.thread_count = pool.chunk_count ? pool.chunk_count : 1;
+  }
+
+  pool.written = 0;
+  pool.window = chunks_per_thread * pool.thread_count;
+  pthread_mutex_init(&pool.lock, 0);
+  pthread_cond_init(&pool.changed, 0);
+
+  pool.queues = malloc(pool.thread_count * sizeof *pool.queues);
+  workers = malloc(pool.thread_count * sizeof *workers);
+  threads = malloc(pool.thread_count * sizeof *threads);
+  if (!pool.queues || !workers || !threads) fail(out_of_memory);
+
+  for (j = 0;  j < pool.thread_count;  ++j) {
+    pthread_mutex_init(&pool.queues[j].lock, 0);
+    pool.queues[j].next = j;
+    pool.queues[j].step = pool.thread_count;
+    pool.queues[j].count = pool.chunk_count;
+    workers[j].pool = &pool;
+    workers[j].id = j;
+  }
+
+  for (j = 0;  j < pool.thread_count;  ++j) {
+    if (pthread_create(&threads[j], 0, work, &workers[j]) != 0) {
+      fail("cannot create thread\n");
+    }
+  }
+
+  /* Write the chunks in order as they finish, reporting failed */
+  /* lines by their line number in the whole input:             */
+
+  for (j = 0;  j < pool.chunk_count;  ++j) {
+    c = &pool.chunks[j];
+    pthread_mutex_lock(&pool.lock);
+    while (!c->done) pthread_cond_wait(&pool.changed, &pool.lock);
+    pthread_mutex_unlock(&pool.lock);
+
+    if (fwrite(c->output, 1, c->output_length, stdout) != c->output_length) {
+      fail(io_error);
+    }
+
+    for (k = 0;  k < c->error_count;  ++k) {
+      fprintf(stderr, "%s: line %lu: %s\n", argv[0],
+              (unsigned long) (line + 1 + c->errors[k].line),
+              status_message[c->errors[k].status]);
+    }
+
+    errors += c->error_count;
+    line += c->lines;
+    free(c->output);
+    free(c->errors);
+    free(c->leaves);
+
+    pthread_mutex_lock(&pool.lock);
+    pool.written = j + 1;
+    pthread_cond_broadcast(&pool.changed);
+    pthread_mutex_unlock(&pool.lock);
+  }
+
+  for (j = 0;  j < pool.thread_count;  ++j) pthread_join(threads[j], 0);
+  for (j = 0;  j < pool.thread_count;  ++j) {
+    pthread_mutex_destroy(&pool.queues[j].lock);
+  }
+
+  pthread_cond_destroy(&pool.changed);
+  pthread_mutex_destroy(&pool.lock);
+  free(threads);
+  free(workers);
+  free(pool.queues);
+  free(pool.chunks);
+
+  if (pool.trie) {
+    if (pool.compact) print_trie(&trie);
+    fprintf(stderr, "%s: trie: %lu labels, %lu nodes\n",
+            argv[0], trie.labels, (unsigned long) trie.node_count);
+    free_trie(&trie);
+  }
+
+  if (pool.cache) {
+    punycode_cache_stats(pool.cache, &stats);
+    fprintf(stderr, "%s: cache: %lu hits, %lu misses, %lu evictions\n",
+            argv[0], stats.hits, stats.misses, stats.evictions);
+    punycode_cache_free(pool.cache);
+  }
+
+#ifdef PUNYCODE_STATS
+  {
+    struct punycode_stats snapshot;
+    static char text[16384];
+    size_t text_length = sizeof text;
+
+    punycode_stats_snapshot(&snapshot);
+    if (punycode_stats_export(&snapshot, &text_length, text) ==
+        punycode_success) fwrite(text, 1, text_length, stderr);
+  }
+#endif
+
+  if (fflush(stdout) != 0) fail(io_error);
+  if (mapped) munmap((void *) input, length);
+  else free((void *) input);
+
+  return errors ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,327 @@
+/*
+punycode-cache.c
+
+This is C11 code (it uses <stdatomic.h>) implementing the label cache
+declared in punycode-cache.h.
+
+*/
+
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "punycode-cache.h"
+
+/* The cache is split into shards by the top bits of the hash of a */
+/* key, and each shard into sets of ways entries by the low bits.  */
+/* A key can only live in its own set, so a lookup compares at     */
+/* most ways entries, and eviction is CLOCK within the set:  the    */
+/* hand passes over entries found since it last came by, clearing   */
+/* their referenced flag, and replaces the first one not found.     */
+
+enum {
+  ways = 8,
+  entry_words = punycode_cache_max_entry / sizeof (unsigned),
+  default_shards = 16,
+  max_shards = 256,
+  line_size = 64
+};
+
+struct entry {
+  atomic_uint sequence;     /* odd while the entry is being written */
+  atomic_uint check;        /* high half of the hash of the key     */
+  atomic_uint shape;        /* kind | key_length << 8 |             */
+                            /* value_length << 16, or 0 if empty    */
+  atomic_uchar referenced;  /* found since the hand last passed     */
+  atomic_uint data[entry_words];  /* key, then value, in words   */
+};
+
+struct set {
+  struct entry entries[ways];
+};
+
+/* The counters of a shard share a cache line with nothing else, */
+/* so that lookups in different shards do not contend:           */
+
+struct shard {
+  _Alignas(line_size) atomic_ulong hits, misses, insertions, evictions;
+  _Alignas(line_size) atomic_flag writing;
+  struct set *sets;
+  unsigned char *hands;     /* next way to consider, per set */
+};
+
+struct punycode_cache {
+  struct shard *shards;
+  unsigned shard_count;
+  size_t set_mask;
+};
+
+/* The key and value bytes are copied in and out of an entry a */
+/* word at a time with relaxed atomic operations, so that the   */
+/* copies made by lookups racing with a writer are well defined */
+/* even when they are then thrown away.                         */
+
+static void store_words(struct entry *e, const unsigned char *bytes,
+                        size_t length)
+{
+  unsigned word;
+  size_t j;
+
+  for (j = 0;  j * sizeof word < length;  ++j) {
+    memcpy(&word, bytes + j * sizeof word, sizeof word);
+    atomic_store_explicit(&e->data[j], word, memory_order_relaxed);
+  }
+}
+
+static void load_words(struct entry *e, unsigned char *bytes,
+                       size_t length)
+{
+  unsigned word;
+  size_t j;
+
+  for (j = 0;  j * sizeof word < length;  ++j) {
+    word = atomic_load_explicit(&e->data[j], memory_order_relaxed);
+    memcpy(bytes + j * sizeof word, &word, sizeof word);
+  }
+}
+
+/* hash() is 64-bit FNV-1a over the kind and the key: */
+
+static uint_least64_t hash(int kind, size_t length, const void *key)
+{
+  const unsigned char *s = key;
+  uint_least64_t h = 0xCBF29CE484222325u;
+  size_t j;
+
+  h = (h ^ (unsigned char) kind) * 0x100000001B3u;
+  for (j = 0;  j < length;  ++j) h = (h ^ s[j]) * 0x100000001B3u;
+  return h;
+}
+
+static struct shard *shard_of(const struct punycode_cache *cache,
+                              uint_least64_t h)
+{
+  return &cache->shards[(h >> 56) & (cache->shard_count - 1)];
+}
+
+struct punycode_cache *punycode_cache_create(size_t max_bytes,
+                                             unsigned shards)
+{
+  struct punycode_cache *cache;
+  size_t per_shard, sets = 1;
+  unsigned count = 1, j;
+
+  if (shards == 0) shards = default_shards;
+  if (shards > max_shards) shards = max_shards;
+  while (count < shards) count *= 2;
+
+  per_shard = max_bytes / count / (sizeof (struct set) + 1);
+  if (per_shard == 0) return 0;
+  while (2 * sets <= per_shard) sets *= 2;
+
+  cache = malloc(sizeof *cache);
+  if (cache == 0) return 0;
+
+  cache->shard_count = count;
+  cache->set_mask = sets - 1;
+  cache->shards = aligned_alloc(line_size, count * sizeof *cache->shards);
+
+  if (cache->shards == 0) {
+    free(cache);
+    return 0;
+  }
+
+  for (j = 0;  j < count;  ++j) {
+    struct shard *s = &cache->shards[j];
+
+    atomic_init(&s->hits, 0);
+    atomic_init(&s->misses, 0);
+    atomic_init(&s->insertions, 0);
+    atomic_init(&s->evictions, 0);
+    atomic_flag_clear(&s->writing);
+    s->sets = calloc(sets, sizeof *s->sets);
+    s->hands = calloc(sets, 1);
+
+    if (s->sets == 0 || s->hands == 0) {
+      free(s->sets);
+      free(s->hands);
+      cache->shard_count = j;
+      punycode_cache_free(cache);
+      return 0;
+    }
+  }
+
+  return cache;
+}
+
+void punycode_cache_free(struct punycode_cache *cache)
+{
+  unsigned j;
+
+  if (cache == 0) return;
+
+  for (j = 0;  j < cache->shard_count;  ++j) {
+    free(cache->shards[j].sets);
+    free(cache->shards[j].hands);
+  }
+
+  free(cache->shards);
+  free(cache);
+}
+
+/* A lookup reads an entry as a seqlock reader:  it notes the     */
+/* sequence number, copies what it needs, and keeps the copy only */
+/* if the sequence number is still the same and even afterwards.  */
+/* The copy goes to a local buffer, so that the caller's value is */
+/* only written with a value known to be whole.                   */
+
+int punycode_cache_find(
+  struct punycode_cache *cache,
+  int kind,
+  size_t key_length,
+  const void *key,
+  size_t *value_length,
+  void *value )
+{
+  unsigned char copy[entry_words * sizeof (unsigned)];
+  uint_least64_t h;
+  struct shard *s;
+  struct entry *e;
+  unsigned sequence, shape, key_shape, length, w;
+
+  /* An empty key may come with a null pointer, as may an empty */
+  /* value, and memcpy() and memcmp() must not be given those:   */
+
+  if (key_length == 0 || key_length > punycode_cache_max_entry) return 0;
+
+  key_shape = (unsigned) kind | (unsigned) key_length << 8;
+  h = hash(kind, key_length, key);
+  s = shard_of(cache, h);
+  e = s->sets[h & cache->set_mask].entries;
+
+  for (w = 0;  w < ways;  ++w, ++e) {
+    sequence = atomic_load_explicit(&e->sequence, memory_order_acquire);
+    if (sequence & 1) continue;
+    if (atomic_load_explicit(&e->check, memory_order_relaxed) !=
+        (unsigned) (h >> 32)) continue;
+    shape = atomic_load_explicit(&e->shape, memory_order_relaxed);
+    if ((shape & 0xFFFF) != key_shape) continue;
+
+    length = shape >> 16;
+    if (length > *value_length) break;
+    load_words(e, copy, key_length + length);
+
+    atomic_thread_fence(memory_order_acquire);
+    if (atomic_load_explicit(&e->sequence, memory_order_relaxed) !=
+        sequence) break;
+    if (memcmp(copy, key, key_length) != 0) continue;
+
+    if (!atomic_load_explicit(&e->referenced, memory_order_relaxed)) {
+      atomic_store_explicit(&e->referenced, 1, memory_order_relaxed);
+    }
+
+    if (length > 0) memcpy(value, copy + key_length, length);
+    *value_length = length;
+    atomic_fetch_add_explicit(&s->hits, 1, memory_order_relaxed);
+    return 1;
+  }
+
+  atomic_fetch_add_explicit(&s->misses, 1, memory_order_relaxed);
+  return 0;
+}
+
+void punycode_cache_add(
+  struct punycode_cache *cache,
+  int kind,
+  size_t key_length,
+  const void *key,
+  size_t value_length,
+  const void *value )
+{
+  uint_least64_t h;
+  struct shard *s;
+  struct set *set;
+  struct entry *e;
+  unsigned char bytes[entry_words * sizeof (unsigned)];
+  unsigned shape, sequence, w;
+  size_t index;
+
+  if (key_length == 0 || key_length > punycode_cache_max_entry ||
+      value_length > punycode_cache_max_entry - key_length) return;
+
+  h = hash(kind, key_length, key);
+  s = shard_of(cache, h);
+  index = h & cache->set_mask;
+  set = &s->sets[index];
+  shape = (unsigned) kind | (unsigned) key_length << 8 |
+          (unsigned) value_length << 16;
+
+  if (atomic_flag_test_and_set_explicit(&s->writing,
+                                        memory_order_acquire)) return;
+
+  /* Another thread may have added the same key meanwhile.  The */
+  /* writer holds the shard, so what it reads is whole:          */
+
+  for (w = 0;  w < ways;  ++w) {
+    e = &set->entries[w];
+    if (atomic_load_explicit(&e->check, memory_order_relaxed) !=
+        (unsigned) (h >> 32)) continue;
+    if ((atomic_load_explicit(&e->shape, memory_order_relaxed) & 0xFFFF) !=
+        (shape & 0xFFFF)) continue;
+    load_words(e, bytes, key_length);
+    if (memcmp(bytes, key, key_length) == 0) {
+      atomic_flag_clear_explicit(&s->writing, memory_order_release);
+      return;
+    }
+  }
+
+  for (w = s->hands[index];  ;  w = (w + 1) % ways) {
+    e = &set->entries[w];
+    if (atomic_load_explicit(&e->shape, memory_order_relaxed) == 0) break;
+    if (!atomic_exchange_explicit(&e->referenced, 0,
+                                  memory_order_relaxed)) break;
+  }
+
+  s->hands[index] = (unsigned char) ((w + 1) % ways);
+
+  if (atomic_load_explicit(&e->shape, memory_order_relaxed) != 0) {
+    atomic_fetch_add_explicit(&s->evictions, 1, memory_order_relaxed);
+  }
+
+  memcpy(bytes, key, key_length);
+  if (value_length > 0) memcpy(bytes + key_length, value, value_length);
+
+  sequence = atomic_load_explicit(&e->sequence, memory_order_relaxed);
+  atomic_store_explicit(&e->sequence, sequence + 1, memory_order_relaxed);
+  atomic_thread_fence(memory_order_release);
+
+  atomic_store_explicit(&e->check, (unsigned) (h >> 32),
+                        memory_order_relaxed);
+  atomic_store_explicit(&e->shape, shape, memory_order_relaxed);
+  store_words(e, bytes, key_length + value_length);
+
+  atomic_store_explicit(&e->sequence, sequence + 2, memory_order_release);
+  atomic_fetch_add_explicit(&s->insertions, 1, memory_order_relaxed);
+  atomic_flag_clear_explicit(&s->writing, memory_order_release);
+}
+
+void punycode_cache_stats(const struct punycode_cache *cache,
+                          struct punycode_cache_stats *stats)
+{
+  unsigned j;
+  struct shard *s;
+
+  stats->hits = stats->misses = 0;
+  stats->insertions = stats->evictions = 0;
+
+  for (j = 0;  j < cache->shard_count;  ++j) {
+    s = &cache->shards[j];
+    stats->hits += atomic_load_explicit(&s->hits, memory_order_relaxed);
+    stats->misses += atomic_load_explicit(&s->misses, memory_order_relaxed);
+    stats->insertions +=
+      atomic_load_explicit(&s->insertions, memory_order_relaxed);
+    stats->evictions +=
+      atomic_load_explicit(&s->evictions, memory_order_relaxed);
+  }
+}
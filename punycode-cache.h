@@ -0,0 +1,113 @@
+/*
+punycode-cache.h
+
+This is ANSI C code (C89) declaring a cache of converted labels,
+shared by any number of threads, for streams of host names in which
+the same labels come up again and again.  The implementation is in
+punycode-cache.c, which needs a C11 compiler with <stdatomic.h>; the
+cached conversions are declared in punycode-idna.h and
+punycode-batch.h and implemented in punycode-cached.c.
+
+*/
+
+#ifndef PUNYCODE_CACHE_H
+#define PUNYCODE_CACHE_H
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct punycode_cache;
+
+/* What a cached value was converted by, kept with its key so that */
+/* the same bytes converted different ways do not collide.  Other  */
+/* users of the cache may use other kinds from 1 to 255.           */
+
+enum punycode_cache_kind {
+  punycode_cache_to_ascii   = 1,  /* UTF-8 label to "xn--" ACE label */
+  punycode_cache_to_unicode = 2,  /* "xn--" ACE label to UTF-8 label */
+  punycode_cache_encode     = 3,  /* code points to Punycode         */
+  punycode_cache_decode     = 4   /* Punycode to code points         */
+};
+
+enum {
+  punycode_cache_max_entry = 240  /* bytes of key plus value */
+};
+
+struct punycode_cache_stats {
+  unsigned long hits;       /* lookups that found their key           */
+  unsigned long misses;     /* lookups that did not                   */
+  unsigned long insertions; /* values stored                          */
+  unsigned long evictions;  /* values dropped to make room for others */
+};
+
+struct punycode_cache *punycode_cache_create(
+  size_t,                  /* max_bytes */
+  unsigned                 /* shards    */
+);
+
+void punycode_cache_free(struct punycode_cache *);
+
+/*
+    punycode_cache_create() allocates a cache using at most about
+    max_bytes of memory, split into shards independent parts (rounded
+    up to a power of two, at most 256; 0 chooses 16).  It returns a
+    null pointer if max_bytes is too small for eight entries per shard
+    or if memory runs out.  punycode_cache_free() releases it; no
+    thread may be using the cache then.
+*/
+
+int punycode_cache_find(
+  struct punycode_cache *, /* cache        */
+  int,                     /* kind         */
+  size_t,                  /* key_length   */
+  const void *,            /* key          */
+  size_t *,                /* value_length */
+  void *                   /* value        */
+);
+
+void punycode_cache_add(
+  struct punycode_cache *, /* cache        */
+  int,                     /* kind         */
+  size_t,                  /* key_length   */
+  const void *,            /* key          */
+  size_t,                  /* value_length */
+  const void *             /* value        */
+);
+
+/*
+    punycode_cache_find() looks up the key_length bytes at key under
+    the given kind.  If they are cached with a value of at most
+    *value_length bytes, it copies the value to value, sets
+    *value_length to its length, and returns 1; otherwise it returns 0
+    and leaves both alone.  punycode_cache_add() stores a value for a
+    key, evicting a value that has not been found lately if need be.
+    Entries whose key and value together exceed
+    punycode_cache_max_entry bytes, and empty keys, are never stored.
+
+    Both may be called by any number of threads at once.  Lookups take
+    no locks:  each entry carries a sequence number that is odd while
+    the entry is being written, and a lookup that sees it odd or sees
+    it change misses.  Each shard is written by one thread at a time;
+    an addition finding its shard busy is dropped rather than waiting,
+    since the value will be offered again.
+*/
+
+void punycode_cache_stats(
+  const struct punycode_cache *,    /* cache */
+  struct punycode_cache_stats *     /* stats */
+);
+
+/*
+    punycode_cache_stats() adds up the counters of all the shards.
+    While other threads are using the cache they are only a snapshot,
+    and the counters wrap around if they exceed ULONG_MAX.
+*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PUNYCODE_CACHE_H */
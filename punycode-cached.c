@@ -0,0 +1,86 @@
+/*
+punycode-cached.c
+
+This is ANSI C code (C89) implementing the cached conversions declared
+in punycode-batch.h and punycode-idna.h, by handing the functions of
+punycode-cache.c to those of punycode-lookup.h.  It is kept apart from
+punycode-batch.c and punycode-idna.c so that only programs using a
+cache need punycode-cache.c and a C11 compiler.
+
+*/
+
+#include "punycode-cache.h"
+#include "punycode-lookup.h"
+
+/* use_cache() fills in *l for cache, or returns a null */
+/* pointer for none:                                    */
+
+static const struct punycode_lookup *use_cache(
+  struct punycode_lookup *l, struct punycode_cache *cache )
+{
+  if (cache == 0) return 0;
+  l->cache = cache;
+  l->find = punycode_cache_find;
+  l->add = punycode_cache_add;
+  return l;
+}
+
+size_t punycode_encode_batch_cached(
+  struct punycode_cache *cache,
+  size_t count,
+  const struct punycode_label inputs[],
+  struct punycode_arena *arena,
+  size_t offsets[],
+  enum punycode_status status[] )
+{
+  struct punycode_lookup l;
+
+  return punycode_encode_batch_lookup(use_cache(&l, cache), count, inputs,
+                                      arena, offsets, status);
+}
+
+size_t punycode_decode_batch_cached(
+  struct punycode_cache *cache,
+  size_t count,
+  const struct punycode_ace inputs[],
+  struct punycode_arena *arena,
+  size_t offsets[],
+  enum punycode_status status[] )
+{
+  struct punycode_lookup l;
+
+  return punycode_decode_batch_lookup(use_cache(&l, cache), count, inputs,
+                                      arena, offsets, status);
+}
+
+enum punycode_status punycode_to_ascii_cached(
+  struct punycode_cache *cache,
+  size_t input_length,
+  const char input[],
+  size_t *label_count,
+  struct punycode_slice labels[],
+  size_t *scratch_length,
+  char scratch[] )
+{
+  struct punycode_lookup l;
+
+  return punycode_to_ascii_lookup(use_cache(&l, cache), input_length, input,
+                                  label_count, labels, scratch_length,
+                                  scratch);
+}
+
+enum punycode_status punycode_to_unicode_cached(
+  struct punycode_cache *cache,
+  size_t input_length,
+  const char input[],
+  size_t *label_count,
+  struct punycode_slice labels[],
+  size_t *scratch_length,
+  char scratch[] )
+{
+  struct punycode_lookup l;
+
+  return punycode_to_unicode_lookup(use_cache(&l, cache), input_length, input,
+                                    label_count, labels, scratch_length,
+                                    scratch);
+}
@@ -0,0 +1,1790 @@
+/*
+punycode-check.cpp
+
+This is C++20 code checking the other encoders and decoders of this
+package against punycode_encode() and punycode_decode(), which remain
+the reference.
+Engines that have no reference, such as the Base64 and Base85
+parameter sets of bootstring.hpp, are checked to decode what they
+encode.
+
+The inputs are the samples of RFC 3492 section 7.1, whose encodings
+are checked as well, and random labels of every length up to several
+thousand code points, with random case flags.
+Random and damaged Punycode strings must be accepted or rejected
+exactly as punycode_decode() does.
+The Japanese charsets of punycode-jis.h are checked code by code
+against a copy of JCT11280 from ecl_array.js, both ways.
+Each mismatch is reported on stderr, and the exit status is nonzero
+if there are any, so that it can gate a build.
+
+Built with -DPUNYCODE_STATS, for punycode.c and punycode-stats.c as
+well as this file, it also checks what known calls add to the
+counters of punycode-stats.h, and that the export still fits.
+
+Build the C files with a C compiler and link them in, for example:
+
+    cc -O2 -c punycode.c punycode-simd.c punycode-batch.c punycode-idna.c \
+       punycode-frame.c punycode-cached.c punycode-cache.c punycode-binary.c \
+       punycode-jis.c
+    c++ -std=c++20 -O2 -o punycode-check punycode-check.cpp \
+        punycode.o punycode-simd.o punycode-batch.o punycode-idna.o \
+        punycode-frame.o punycode-cached.o punycode-cache.o punycode-binary.o \
+        punycode-jis.o
+
+*/
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "bootstring.hpp"
+#include "punycode.h"
+#include "punycode.hpp"
+#include "punycode-batch.h"
+#include "punycode-binary.h"
+#include "punycode-cache.h"
+#include "punycode-frame.h"
+#include "punycode-idna.h"
+#include "punycode-jis.h"
+#include "punycode-stats.h"
+
+namespace {
+
+void usage(char **argv)
+{
+  std::fprintf(stderr,
+    "\n"
+    "%s [-n labels] [-s seed]\n"
+    "    checks every engine against punycode_encode() and\n"
+    "    punycode_decode() on the RFC 3492 samples and on the given\n"
+    "    number of random labels (default 5000) generated from the\n"
+    "    given seed (default 1), and exits with status 1 on any\n"
+    "    mismatch.\n"
+    "\n", argv[0]);
+  std::exit(EXIT_FAILURE);
+}
+
+/*** Reporting ***/
+
+enum { max_reports = 20 };
+
+unsigned long checks, failures;
+
+/* expect() counts a check, reporting it if it failed: */
+
+void expect(bool ok, const char *engine, const char *what,
+            const std::string &input)
+{
+  ++checks;
+  if (ok) return;
+  if (++failures <= max_reports) {
+    std::fprintf(stderr, "%s: %s, input %.60s%s\n", engine, what,
+                 input.c_str(), input.size() > 60 ? "..." : "");
+  }
+  else if (failures == max_reports + 1) {
+    std::fputs("further mismatches not reported\n", stderr);
+  }
+}
+
+/* describe() shows code points in the form of punycode-test.c: */
+
+std::string describe(const std::vector<punycode_uint> &cp,
+                     const std::vector<unsigned char> &flags)
+{
+  std::string s;
+  char buffer[16];
+  std::size_t j;
+
+  for (j = 0;  j < cp.size() && s.size() < 64;  ++j) {
+    std::snprintf(buffer, sizeof buffer, "%c+%04lX ",
+                  flags.empty() || !flags[j] ? 'u' : 'U',
+                  static_cast<unsigned long>(cp[j]));
+    s += buffer;
+  }
+
+  return s;
+}
+
+/*** Inputs ***/
+
+/* The samples of RFC 3492 section 7.1, in the notation of       */
+/* punycode-test.c, where the case of the u is the case flag:    */
+
+struct sample {
+  const char *code_points;
+  const char *ace;
+};
+
+const sample samples[] = {
+  { "u+0644 u+064A u+0647 u+0645 u+0627 u+0628 u+062A u+0643 u+0644 "
+    "u+0645 u+0648 u+0634 u+0639 u+0631 u+0628 u+064A u+061F",
+    "egbpdaj6bu4bxfgehfvwxn" },
+  { "u+4ED6 u+4EEC u+4E3A u+4EC0 u+4E48 u+4E0D u+8BF4 u+4E2D u+6587",
+    "ihqwcrb4cv8a8dqg056pqjye" },
+  { "u+4ED6 u+5011 u+7232 u+4EC0 u+9EBD u+4E0D u+8AAA u+4E2D u+6587",
+    "ihqwctvzc91f659drss3x8bo0yb" },
+  { "U+0050 u+0072 u+006F u+010D u+0070 u+0072 u+006F u+0073 u+0074 "
+    "u+011B u+006E u+0065 u+006D u+006C u+0075 u+0076 u+00ED u+010D "
+    "u+0065 u+0073 u+006B u+0079",
+    "Proprostnemluvesky-uyb24dma41a" },
+  { "u+05DC u+05DE u+05D4 u+05D4 u+05DD u+05E4 u+05E9 u+05D5 u+05D8 "
+    "u+05DC u+05D0 u+05DE u+05D3 u+05D1 u+05E8 u+05D9 u+05DD u+05E2 "
+    "u+05D1 u+05E8 u+05D9 u+05EA",
+    "4dbcagdahymbxekheh6e0a7fei0b" },
+  { "u+092F u+0939 u+0932 u+094B u+0917 u+0939 u+093F u+0928 u+094D "
+    "u+0926 u+0940 u+0915 u+094D u+092F u+094B u+0902 u+0928 u+0939 "
+    "u+0940 u+0902 u+092C u+094B u+0932 u+0938 u+0915 u+0924 u+0947 "
+    "u+0939 u+0948 u+0902",
+    "i1baa7eci9glrd9b2ae1bj0hfcgg6iyaf8o0a1dig0cd" },
+  { "u+306A u+305C u+307F u+3093 u+306A u+65E5 u+672C u+8A9E u+3092 "
+    "u+8A71 u+3057 u+3066 u+304F u+308C u+306A u+3044 u+306E u+304B",
+    "n8jok5ay5dzabd5bym9f0cm5685rrjetr6pdxa" },
+  { "u+C138 u+ACC4 u+C758 u+BAA8 u+B4E0 u+C0AC u+B78C u+B4E4 u+C774 "
+    "u+D55C u+AD6D u+C5B4 u+B97C u+C774 u+D574 u+D55C u+B2E4 u+BA74 "
+    "u+C5BC u+B9C8 u+B098 u+C88B u+C744 u+AE4C",
+    "989aomsvi5e83db1d2a355cv1e0vak1dwrv93d5xbh15a0dt30a5j"
+    "psd879ccm6fea98c" },
+  { "U+043F u+043E u+0447 u+0435 u+043C u+0443 u+0436 u+0435 u+043E "
+    "u+043D u+0438 u+043D u+0435 u+0433 u+043E u+0432 u+043E u+0440 "
+    "u+044F u+0442 u+043F u+043E u+0440 u+0443 u+0441 u+0441 u+043A "
+    "u+0438",
+    "b1abfaaepdrnnbgefbaDotcwatmq2g4l" },
+  { "U+0050 u+006F u+0072 u+0071 u+0075 u+00E9 u+006E u+006F u+0070 "
+    "u+0075 u+0065 u+0064 u+0065 u+006E u+0073 u+0069 u+006D u+0070 "
+    "u+006C u+0065 u+006D u+0065 u+006E u+0074 u+0065 u+0068 u+0061 "
+    "u+0062 u+006C u+0061 u+0072 u+0065 u+006E U+0045 u+0073 u+0070 "
+    "u+0061 u+00F1 u+006F u+006C",
+    "PorqunopuedensimplementehablarenEspaol-fmd56a" },
+  { "U+0054 u+1EA1 u+0069 u+0073 u+0061 u+006F u+0068 u+1ECD u+006B "
+    "u+0068 u+00F4 u+006E u+0067 u+0074 u+0068 u+1EC3 u+0063 u+0068 "
+    "u+1EC9 u+006E u+00F3 u+0069 u+0074 u+0069 u+1EBF u+006E u+0067 "
+    "U+0056 u+0069 u+1EC7 u+0074",
+    "TisaohkhngthchnitingVit-kjcr8268qyxafd2f1b9g" },
+  { "u+0033 u+5E74 U+0042 u+7D44 u+91D1 u+516B u+5148 u+751F",
+    "3B-ww4c5e180e575a65lsy2b" },
+  { "u+5B89 u+5BA4 u+5948 u+7F8E u+6075 u+002D u+0077 u+0069 u+0074 "
+    "u+0068 u+002D U+0053 U+0055 U+0050 U+0045 U+0052 u+002D U+004D "
+    "U+004F U+004E U+004B U+0045 U+0059 U+0053",
+    "-with-SUPER-MONKEYS-pc58ag80a8qai00g7n9n" },
+  { "U+0048 u+0065 u+006C u+006C u+006F u+002D U+0041 u+006E u+006F "
+    "u+0074 u+0068 u+0065 u+0072 u+002D U+0057 u+0061 u+0079 u+002D "
+    "u+305D u+308C u+305E u+308C u+306E u+5834 u+6240",
+    "Hello-Another-Way--fc4qua05auwb3674vfr0b" },
+  { "u+3072 u+3068 u+3064 u+5C4B u+6839 u+306E u+4E0B u+0032",
+    "2-u9tlzr9756bt3uc0v" },
+  { "U+004D u+0061 u+006A u+0069 u+3067 U+004B u+006F u+0069 u+3059 "
+    "u+308B u+0035 u+79D2 u+524D",
+    "MajiKoi5-783gue6qz075azm5e" },
+  { "u+30D1 u+30D5 u+30A3 u+30FC u+0064 u+0065 u+30EB u+30F3 u+30D0",
+    "de-jg4avhby1noc0d" },
+  { "u+305D u+306E u+30B9 u+30D4 u+30FC u+30C9 u+3067",
+    "d9juau41awczczp" },
+  { "u+002D u+003E u+0020 u+0024 u+0031 u+002E u+0030 u+0030 u+0020 "
+    "u+003C u+002D",
+    "-> $1.00 <--" }
+};
+
+enum { samples_count = sizeof samples / sizeof *samples };
+
+struct label {
+  std::vector<punycode_uint> cp;
+  std::vector<unsigned char> flags;
+};
+
+label parse_sample(const char *s)
+{
+  label l;
+  char *end;
+
+  while (*s != 0) {
+    if (*s == ' ') {
+      ++s;
+      continue;
+    }
+    l.flags.push_back(*s == 'U');
+    l.cp.push_back(static_cast<punycode_uint>(std::strtoul(s + 2, &end,
+                                                           16)));
+    s = end;
+  }
+
+  return l;
+}
+
+std::mt19937 random_engine(1);
+
+unsigned random_below(unsigned n)
+{
+  return static_cast<unsigned>(random_engine() % n);
+}
+
+/* random_label() returns a label of Unicode scalar values from one  */
+/* or two scripts with some ASCII, mostly short, but now and then    */
+/* far longer than any DNS label, to reach the paths of long inputs. */
+
+struct script {
+  punycode_uint first, count;
+};
+
+const script scripts[] = {
+  { 0xC0, 0x180 },        /* Latin with diacritics */
+  { 0x400, 0x100 },       /* Cyrillic              */
+  { 0x3040, 0x100 },      /* kana                  */
+  { 0x4E00, 0x5200 },     /* CJK                   */
+  { 0xAC00, 0x2BA4 },     /* Hangul                */
+  { 0x1F300, 0x300 },     /* emoji                 */
+  { 0x10FF00, 0x100 }     /* the top of the range  */
+};
+
+label random_label()
+{
+  label l;
+  unsigned kind = random_below(100), basic = random_below(101), j;
+  std::size_t length;
+  const script &a = scripts[random_below(sizeof scripts / sizeof *scripts)];
+  const script &b = scripts[random_below(sizeof scripts / sizeof *scripts)];
+
+  length = kind < 70 ? random_below(24) :
+           kind < 98 ? 50 + random_below(100) :
+           500 + random_below(2500);
+
+  for (j = 0;  j < length;  ++j) {
+    const script &s = random_below(2) ? a : b;
+    unsigned r = random_below(100);
+
+    l.cp.push_back(r < basic ? (random_below(8) == 0 ? '-' :
+                                random_below(4) == 0 ? 'A' + random_below(26)
+                                                     : 'a' + random_below(26))
+                             : s.first + random_below(s.count));
+    l.flags.push_back(random_below(2));
+  }
+
+  return l;
+}
+
+/* random_ace() returns a string that is at times Punycode and  */
+/* more often slightly damaged or plain noise:                  */
+
+std::string random_ace(const std::string &valid)
+{
+  static const char chars[] =
+    "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789-";
+  std::string s = valid;
+  unsigned kind = random_below(5), j, n;
+
+  if (kind == 0 || s.empty()) {
+    s.clear();
+    for (n = random_below(40), j = 0;  j < n;  ++j) {
+      s += chars[random_below(sizeof chars - 1)];
+    }
+  }
+  else if (kind == 1) s.resize(random_below(s.size()));
+  else if (kind == 2) {
+    s[random_below(s.size())] = chars[random_below(sizeof chars - 1)];
+  }
+  else if (kind == 3) s.insert(random_below(s.size()), 1, '-');
+  else s += std::string(1 + random_below(8), '9');
+
+  return s;
+}
+
+/*** Encoding to UTF-8 and UTF-16 ***/
+
+std::string to_utf8(const std::vector<punycode_uint> &cp)
+{
+  std::string s;
+
+  for (punycode_uint c : cp) {
+    if (c < 0x80) s += static_cast<char>(c);
+    else if (c < 0x800) {
+      s += static_cast<char>(0xC0 | c >> 6);
+      s += static_cast<char>(0x80 | (c & 0x3F));
+    }
+    else if (c < 0x10000) {
+      s += static_cast<char>(0xE0 | c >> 12);
+      s += static_cast<char>(0x80 | (c >> 6 & 0x3F));
+      s += static_cast<char>(0x80 | (c & 0x3F));
+    }
+    else {
+      s += static_cast<char>(0xF0 | c >> 18);
+      s += static_cast<char>(0x80 | (c >> 12 & 0x3F));
+      s += static_cast<char>(0x80 | (c >> 6 & 0x3F));
+      s += static_cast<char>(0x80 | (c & 0x3F));
+    }
+  }
+
+  return s;
+}
+
+std::vector<punycode_utf16> to_utf16(const std::vector<punycode_uint> &cp)
+{
+  std::vector<punycode_utf16> s;
+
+  for (punycode_uint c : cp) {
+    if (c < 0x10000) s.push_back(static_cast<punycode_utf16>(c));
+    else {
+      s.push_back(static_cast<punycode_utf16>(0xD800 + ((c - 0x10000) >> 10)));
+      s.push_back(static_cast<punycode_utf16>(0xDC00 + (c & 0x3FF)));
+    }
+  }
+
+  return s;
+}
+
+/*** The reference ***/
+
+struct reference {
+  enum punycode_status status;
+  std::vector<punycode_uint> cp;
+  std::vector<unsigned char> flags;
+};
+
+/* Every output buffer is this much larger than needed, and filled */
+/* with it, so that writing past the reported length is caught:    */
+
+enum { slack = 16, fill = 0x5A };
+
+std::string encode_reference(const label &l, bool flags,
+                             enum punycode_status &status)
+{
+  std::vector<char> out(12 * l.cp.size() + slack);
+  std::size_t length = out.size();
+
+  status = punycode_encode(l.cp.size(), l.cp.data(),
+                           flags ? l.flags.data() : 0, &length, out.data());
+  return status == punycode_success ? std::string(out.data(), length)
+                                    : std::string();
+}
+
+reference decode_reference(const std::string &ace)
+{
+  reference r;
+  std::size_t length = ace.size();
+
+  r.cp.resize(length + 1);
+  r.flags.resize(length + 1);
+  r.status = punycode_decode(ace.size(), ace.data(), &length, r.cp.data(),
+                             r.flags.data());
+  if (r.status != punycode_success) length = 0;
+  r.cp.resize(length);
+  r.flags.resize(length);
+  return r;
+}
+
+bool scalars(const std::vector<punycode_uint> &cp)
+{
+  for (punycode_uint c : cp) {
+    if (c > 0x10FFFF || (c >= 0xD800 && c <= 0xDFFF)) return false;
+  }
+  return true;
+}
+
+/*** Encoders ***/
+
+typedef bootstring::codec<bootstring::punycode_params> compiled;
+
+struct untabulated_params : bootstring::punycode_params {
+  static constexpr bool tables = false;
+};
+
+typedef bootstring::codec<untabulated_params> untabulated;
+
+const bootstring::dynamic_codec &dynamic()
+{
+  static const bootstring::dynamic_codec codec(
+    bootstring::parameters::of<bootstring::punycode_params>());
+  return codec;
+}
+
+/* check_encoders() encodes the label with every encoder, with */
+/* and without case flags where an encoder takes them.         */
+
+void check_encoders(const label &l)
+{
+  std::string in = describe(l.cp, l.flags), with, without;
+  std::string s;
+  enum punycode_status with_status, without_status, status;
+  std::vector<char> out(12 * l.cp.size() + slack);
+  std::vector<unsigned char> bits((l.cp.size() + 7) / 8 + 1);
+  std::size_t length, j;
+
+  with = encode_reference(l, true, with_status);
+  without = encode_reference(l, false, without_status);
+
+  /* Flags or not, the length is the same, so is the status: */
+
+  expect(with_status == without_status && with.size() == without.size(),
+         "punycode_encode", "case flags change the length", in);
+
+  length = out.size();
+  status = punycode_encode_sorted(l.cp.size(), l.cp.data(), l.flags.data(),
+                                  &length, out.data());
+  expect(status == with_status && (status != punycode_success ||
+         std::string(out.data(), length) == with),
+         "punycode_encode_sorted", "differs", in);
+
+  for (j = 0;  j < l.flags.size();  ++j) {
+    if (l.flags[j]) bits[j / 8] |= 1 << j % 8;
+  }
+
+  length = out.size();
+  status = punycode_encode_packed(l.cp.size(), l.cp.data(), bits.data(),
+                                  &length, out.data());
+  expect(status == with_status && (status != punycode_success ||
+         std::string(out.data(), length) == with),
+         "punycode_encode_packed", "differs", in);
+
+  length = out.size();
+  status = punycode_encode_wide(l.cp.size(), l.cp.data(), &length,
+                                out.data());
+  expect(status == punycode_success && (without_status != punycode_success ||
+         std::string(out.data(), length) == without),
+         "punycode_encode_wide", "differs", in);
+
+  s = to_utf8(l.cp);
+  length = out.size();
+  status = punycode_encode_utf8(s.size(), s.data(), &length, out.data());
+  expect(status == without_status && (status != punycode_success ||
+         std::string(out.data(), length) == without),
+         "punycode_encode_utf8", "differs", in);
+
+  std::vector<punycode_utf16> u = to_utf16(l.cp);
+  length = out.size();
+  status = punycode_encode_utf16(u.size(), u.data(), &length, out.data());
+  expect(status == without_status && (status != punycode_success ||
+         std::string(out.data(), length) == without),
+         "punycode_encode_utf16", "differs", in);
+
+  /* The length functions: */
+
+  status = punycode_encoded_length(l.cp.size(), l.cp.data(), &length);
+  expect(status == without_status && (status != punycode_success ||
+         length == without.size()),
+         "punycode_encoded_length", "differs", in);
+
+  /* The leading basic code points, copied by the vector kernels: */
+
+  for (j = 0;  j < l.cp.size() && l.cp[j] < 0x80;  ++j) {}
+  std::fill(out.begin(), out.end(), fill);
+  length = punycode_copy_basic(l.cp.size(), l.cp.data(), out.data());
+  expect(length == j && out[j] == fill &&
+         std::equal(l.cp.begin(), l.cp.begin() + j, out.begin()),
+         "punycode_copy_basic", "differs", in);
+
+  /* An output one char too small must fail, and not be overrun: */
+
+  if (with_status == punycode_success && !with.empty()) {
+    std::fill(out.begin(), out.end(), fill);
+    length = with.size() - 1;
+    status = punycode_encode_sorted(l.cp.size(), l.cp.data(),
+                                    l.flags.data(), &length, out.data());
+    expect(status == punycode_big_output && out[with.size() - 1] == fill,
+           "punycode_encode_sorted", "output too small", in);
+  }
+
+  /* bootstring.hpp: */
+
+  length = out.size();
+  status = compiled::encode(l.cp.size(), l.cp.data(), l.flags.data(),
+                            &length, out.data());
+  expect(status == with_status && (status != punycode_success ||
+         std::string(out.data(), length) == with),
+         "bootstring::punycode::encode", "differs", in);
+
+  length = out.size();
+  status = untabulated::encode(l.cp.size(), l.cp.data(), l.flags.data(),
+                               &length, out.data());
+  expect(status == with_status && (status != punycode_success ||
+         std::string(out.data(), length) == with),
+         "bootstring::codec (no tables)", "differs", in);
+
+  length = out.size();
+  status = dynamic().encode(l.cp.size(), l.cp.data(), l.flags.data(),
+                            &length, out.data());
+  expect(status == with_status && (status != punycode_success ||
+         std::string(out.data(), length) == with),
+         "bootstring::dynamic_codec", "differs", in);
+
+  compiled::encoder e;
+  for (j = 0;  j < l.cp.size();  j += 1 + j % 7) {
+    std::size_t n = std::min<std::size_t>(1 + j % 7, l.cp.size() - j);
+    e.feed(n, &l.cp[j], &l.flags[j]);
+  }
+  status = e.finish();
+  expect(status == with_status && (status != punycode_success ||
+         e.output() == with),
+         "bootstring::codec::encoder", "differs", in);
+
+  /* punycode.hpp: */
+
+  std::vector<char32_t> wide(l.cp.begin(), l.cp.end());
+  auto r = punycode::encode(wide, l.flags);
+  expect(r.status == with_status && (!r ||
+         std::string_view(r.value) == with),
+         "punycode::encode", "differs", in);
+
+  auto r8 = punycode::encode_utf8(s);
+  expect(r8.status == without_status && (!r8 ||
+         std::string_view(r8.value) == without),
+         "punycode::encode_utf8", "differs", in);
+}
+
+/*** Decoders ***/
+
+/* check_decoders() decodes the string with every decoder.  Those */
+/* that produce code points must agree with the reference, status */
+/* included; those that produce UTF-8 or UTF-16 must also reject  */
+/* code points that are not Unicode scalar values.                */
+
+void check_decoders(const std::string &ace)
+{
+  reference ref = decode_reference(ace);
+  std::vector<punycode_uint> cp(ace.size() + slack);
+  std::vector<unsigned char> flags(ace.size() + slack);
+  std::vector<unsigned char> bits(ace.size() / 8 + slack);
+  enum punycode_status status, utf_status;
+  std::size_t length, j;
+  bool ok = ref.status == punycode_success;
+  bool utf_ok = ok && scalars(ref.cp);
+
+#define SAME(c) \
+  (status == ref.status && (!ok || (length == ref.cp.size() && \
+     std::equal(ref.cp.begin(), ref.cp.end(), (c)))))
+#define FLAGS(f) \
+  (!ok || std::equal(ref.flags.begin(), ref.flags.end(), (f)))
+
+  length = cp.size();
+  status = punycode_decode_deferred(ace.size(), ace.data(), &length,
+                                    cp.data(), flags.data());
+  expect(SAME(cp.begin()) && FLAGS(flags.begin()),
+         "punycode_decode_deferred", "differs", ace);
+
+  length = cp.size();
+  status = punycode_decode_packed(ace.size(), ace.data(), &length,
+                                  cp.data(), bits.data());
+  for (j = 0;  ok && j < ref.cp.size();  ++j) {
+    flags[j] = bits[j / 8] >> j % 8 & 1;
+  }
+  expect(SAME(cp.begin()) && FLAGS(flags.begin()),
+         "punycode_decode_packed", "differs", ace);
+
+  std::vector<punycode_uint> buffer(ace.size() + slack);
+  std::memcpy(buffer.data(), ace.data(), ace.size());
+  length = buffer.size();
+  status = punycode_decode_in_place(ace.size(), buffer.data(), &length,
+                                    flags.data());
+  expect(SAME(buffer.begin()) && FLAGS(flags.begin()),
+         "punycode_decode_in_place", "differs", ace);
+
+  /* The wider decoder accepts what overflows a punycode_uint: */
+
+  length = cp.size();
+  status = punycode_decode_wide(ace.size(), ace.data(), &length, cp.data());
+  if (ref.status == punycode_overflow) status = punycode_overflow;
+  expect(SAME(cp.begin()), "punycode_decode_wide", "differs", ace);
+
+  status = punycode_decoded_length(ace.size(), ace.data(), &length);
+  expect(status == ref.status && (!ok || length == ref.cp.size()),
+         "punycode_decoded_length", "differs", ace);
+
+  /* The scan of the vector kernels, against its definition:  the */
+  /* basic code points end at the last delimiter, and the digits  */
+  /* follow it, or make up the whole string if there is none.     */
+
+  std::size_t basic = ace.rfind('-'), scanned;
+  if (basic == std::string::npos) basic = 0;
+  for (j = 0;  j < basic && static_cast<unsigned char>(ace[j]) < 0x80;  ++j) {}
+  if (j == basic) {
+    for (j = basic + (basic > 0);
+         j < ace.size() && std::isalnum(static_cast<unsigned char>(ace[j]));
+         ++j) {}
+  }
+  scanned = punycode_scan_ace(ace.size(), ace.data(), &length);
+  expect(length == basic && scanned == j &&
+         (scanned == ace.size() || !ok),
+         "punycode_scan_ace", "differs", ace);
+  expect(punycode_basic_length(ace.size(), ace.data()) == basic,
+         "punycode_basic_length", "differs", ace);
+
+  /* Those producing UTF-8 or UTF-16 succeed exactly when the     */
+  /* reference does with scalar values alone, but they can fail    */
+  /* on a code point that is not one before finding another error, */
+  /* so on failure they need only agree with one another:          */
+
+  std::vector<char> utf8(4 * ace.size() + slack);
+  length = utf8.size();
+  utf_status = punycode_decode_utf8(ace.size(), ace.data(), &length,
+                                    utf8.data());
+  expect((utf_status == punycode_success) == utf_ok &&
+         (!utf_ok || std::string(utf8.data(), length) == to_utf8(ref.cp)),
+         "punycode_decode_utf8", "differs", ace);
+
+  status = punycode_validate(ace.size(), ace.data(), &length);
+  expect(status == utf_status && (!utf_ok || length == ref.cp.size()),
+         "punycode_validate", "differs", ace);
+
+  std::vector<punycode_utf16> utf16(2 * ace.size() + slack);
+  length = utf16.size();
+  status = punycode_decode_utf16(ace.size(), ace.data(), &length,
+                                 utf16.data());
+  expect(status == utf_status && (!utf_ok ||
+         std::vector<punycode_utf16>(utf16.begin(), utf16.begin() + length)
+           == to_utf16(ref.cp)),
+         "punycode_decode_utf16", "differs", ace);
+
+  /* bootstring.hpp: */
+
+  length = cp.size();
+  status = compiled::decode(ace.size(), ace.data(), &length, cp.data(),
+                            flags.data());
+  expect(SAME(cp.begin()) && FLAGS(flags.begin()),
+         "bootstring::punycode::decode", "differs", ace);
+
+  length = cp.size();
+  status = untabulated::decode(ace.size(), ace.data(), &length, cp.data(),
+                               flags.data());
+  expect(SAME(cp.begin()) && FLAGS(flags.begin()),
+         "bootstring::codec (no tables)", "differs", ace);
+
+  length = cp.size();
+  status = dynamic().decode(ace.size(), ace.data(), &length, cp.data(),
+                            flags.data());
+  expect(SAME(cp.begin()) && FLAGS(flags.begin()),
+         "bootstring::dynamic_codec", "differs", ace);
+
+  compiled::decoder d;
+  for (j = 0;  j < ace.size();  j += 1 + j % 5) {
+    d.feed(std::min<std::size_t>(1 + j % 5, ace.size() - j), &ace[j]);
+  }
+  status = d.finish();
+  length = d.output().size();
+  expect(SAME(d.output().begin()) && FLAGS(d.case_flags().begin()),
+         "bootstring::codec::decoder", "differs", ace);
+
+  /* punycode.hpp: */
+
+  punycode::basic_label<unsigned char, punycode::label_capacity> hpp_flags;
+  auto r = punycode::decode(ace, hpp_flags);
+  status = r.status;
+  length = r.value.size();
+  expect(SAME(r.value.data()) && FLAGS(hpp_flags.data()), "punycode::decode",
+         "differs", ace);
+
+  auto r8 = punycode::decode_utf8(ace);
+  expect(r8.status == utf_status && (!utf_ok ||
+         std::string_view(r8.value) == to_utf8(ref.cp)),
+         "punycode::decode_utf8", "differs", ace);
+
+#undef SAME
+#undef FLAGS
+}
+
+/*** Batches ***/
+
+/* check_batches() runs the batch functions over all the labels and */
+/* their encodings at once, against the results one at a time.      */
+
+void check_batches(const std::vector<label> &labels,
+                   const std::vector<std::string> &aces,
+                   struct punycode_cache *cache)
+{
+  const char *name = cache ? "cached" : "uncached";
+  std::size_t count = labels.size(), k, j, total;
+  std::size_t width = 0;
+  std::vector<punycode_label> inputs(count);
+  std::vector<punycode_ace> ace_inputs(aces.size());
+  std::vector<std::size_t> offsets(std::max(count, aces.size()) + 1);
+  std::vector<enum punycode_status> status(offsets.size());
+  std::vector<std::string> expected(count);
+  std::vector<enum punycode_status> expected_status(count);
+  std::vector<reference> refs;
+  struct punycode_arena arena;
+  std::string in;
+  int pass;
+
+  for (k = 0;  k < count;  ++k) {
+    inputs[k].length = labels[k].cp.size();
+    inputs[k].input = labels[k].cp.data();
+    inputs[k].case_flags = k % 2 ? labels[k].flags.data() : 0;
+    expected[k] = encode_reference(labels[k], k % 2, expected_status[k]);
+  }
+
+  /* Twice with a cache, so that the second pass finds the labels: */
+
+  for (pass = 0;  pass < (cache ? 2 : 1);  ++pass) {
+    punycode_arena_init(&arena, 0);
+    if (cache) punycode_encode_batch_cached(cache, count, inputs.data(),
+                                            &arena, offsets.data(),
+                                            status.data());
+    else punycode_encode_batch(count, inputs.data(), &arena, offsets.data(),
+                               status.data());
+
+    for (k = 0;  k < count;  ++k) {
+      in = describe(labels[k].cp, labels[k].flags);
+      expect(status[k] == expected_status[k] &&
+             std::string(static_cast<char *>(arena.data) + offsets[k],
+                         offsets[k + 1] - offsets[k]) == expected[k],
+             "punycode_encode_batch", name, in);
+    }
+
+    /* The arena is grown to exactly the total: */
+
+    expect(arena.capacity == arena.length, "punycode_encode_batch",
+           "arena larger than its outputs", "");
+    punycode_arena_free(&arena);
+  }
+
+  /* A caller-provided arena just large enough: */
+
+  for (total = 0, k = 0;  k < count;  ++k) total += expected[k].size();
+  std::vector<char> space(total + slack, fill);
+  arena.data = space.data();
+  arena.case_flags = 0;
+  arena.length = 0;
+  arena.capacity = total;
+  arena.options = 0;
+  punycode_encode_batch(count, inputs.data(), &arena, offsets.data(),
+                        status.data());
+  expect(arena.length == total && space[total] == fill &&
+         std::equal(status.begin(), status.begin() + count,
+                    expected_status.begin()),
+         "punycode_encode_batch", "caller-provided arena", "");
+
+  /* Decoding: */
+
+  for (k = 0;  k < aces.size();  ++k) {
+    ace_inputs[k].length = aces[k].size();
+    ace_inputs[k].input = aces[k].data();
+    refs.push_back(decode_reference(aces[k]));
+    if (refs[k].status == punycode_success) {
+      width = std::max(width, refs[k].cp.size());
+    }
+  }
+
+  for (pass = 0;  pass < (cache ? 2 : 1);  ++pass) {
+    punycode_arena_init(&arena, cache ? 0 : punycode_arena_case_flags);
+    if (cache) punycode_decode_batch_cached(cache, aces.size(),
+                                            ace_inputs.data(), &arena,
+                                            offsets.data(), status.data());
+    else punycode_decode_batch(aces.size(), ace_inputs.data(), &arena,
+                               offsets.data(), status.data());
+
+    for (k = 0;  k < aces.size();  ++k) {
+      const punycode_uint *out =
+        static_cast<punycode_uint *>(arena.data) + offsets[k];
+      expect(status[k] == refs[k].status &&
+             offsets[k + 1] - offsets[k] == refs[k].cp.size() &&
+             std::equal(refs[k].cp.begin(), refs[k].cp.end(), out) &&
+             (cache || std::equal(refs[k].flags.begin(), refs[k].flags.end(),
+                                  arena.case_flags + offsets[k])),
+             "punycode_decode_batch", name, aces[k]);
+    }
+
+    punycode_arena_free(&arena);
+  }
+
+  if (cache) return;
+
+  /* In lanes, with rows as wide as the longest output, so that  */
+  /* only the labels that fail in punycode_decode() fail:        */
+
+  std::vector<std::size_t> lengths(aces.size());
+  width = std::max<std::size_t>(width, 1);
+  std::vector<punycode_uint> rows(aces.size() * width);
+  punycode_decode_lanes(aces.size(), ace_inputs.data(), width, rows.data(),
+                        lengths.data(), status.data());
+
+  for (k = 0;  k < aces.size();  ++k) {
+    bool fits = refs[k].status != punycode_big_output;
+    expect(!fits || (status[k] == refs[k].status &&
+             lengths[k] == refs[k].cp.size() &&
+             std::equal(refs[k].cp.begin(), refs[k].cp.end(),
+                        rows.begin() + k * width)),
+           "punycode_decode_lanes", "differs", aces[k]);
+  }
+
+  /* In place: */
+
+  for (total = 0, k = 0;  k < aces.size();  ++k) {
+    lengths[k] = aces[k].size();
+    total += lengths[k];
+  }
+
+  std::vector<punycode_uint> buffer(total + 1);
+  std::vector<unsigned char> flags(total + 1);
+  for (j = 0, k = 0;  k < aces.size();  j += lengths[k++]) {
+    std::memcpy(reinterpret_cast<char *>(buffer.data()) + j, aces[k].data(),
+                lengths[k]);
+  }
+
+  punycode_decode_batch_in_place(aces.size(), lengths.data(), buffer.data(),
+                                 flags.data(), offsets.data(), status.data());
+
+  for (k = 0;  k < aces.size();  ++k) {
+    expect(status[k] == refs[k].status &&
+           offsets[k + 1] - offsets[k] == refs[k].cp.size() &&
+           std::equal(refs[k].cp.begin(), refs[k].cp.end(),
+                      buffer.begin() + offsets[k]) &&
+           std::equal(refs[k].flags.begin(), refs[k].flags.end(),
+                      flags.begin() + offsets[k]),
+           "punycode_decode_batch_in_place", "differs", aces[k]);
+  }
+}
+
+/*** Host names ***/
+
+/* check_host_name() converts a name made of the labels to ACE and */
+/* back, expecting either the name itself or punycode_bad_input if */
+/* an encoded label would be longer than a DNS label.              */
+
+void check_host_name(const std::vector<const label *> &parts,
+                     struct punycode_cache *cache)
+{
+  std::string name, ace, back;
+  std::vector<punycode_slice> labels(parts.size() + 1);
+  std::vector<char> scratch, joined;
+  enum punycode_status status, expected = punycode_success, s;
+  std::size_t count, length, j;
+  bool ascii;
+
+  for (j = 0;  j < parts.size();  ++j) {
+    label l = *parts[j];
+    l.flags.assign(l.flags.size(), 0);
+    if (j > 0) name += '.';
+    name += to_utf8(l.cp);
+    ascii = std::all_of(l.cp.begin(), l.cp.end(),
+                        [](punycode_uint c) { return c < 0x80; });
+    ace = encode_reference(l, false, s);
+    if (l.cp.empty() || (!ascii && s != punycode_success) ||
+        (ascii ? l.cp.size() : 4 + ace.size()) > punycode_label_max_length) {
+      expected = punycode_bad_input;
+    }
+  }
+
+  scratch.resize(8 * name.size() + 64);
+  count = labels.size();
+  length = scratch.size();
+  status = (cache ? punycode_to_ascii_cached(cache, name.size(), name.data(),
+                                             &count, labels.data(), &length,
+                                             scratch.data())
+                  : punycode_to_ascii(name.size(), name.data(), &count,
+                                      labels.data(), &length,
+                                      scratch.data()));
+  expect(status == expected, cache ? "punycode_to_ascii_cached"
+                                   : "punycode_to_ascii", "status", name);
+  if (status != punycode_success || expected != punycode_success) return;
+
+  joined.resize(scratch.size());
+  length = joined.size();
+  expect(punycode_join_labels(count, labels.data(), &length, joined.data())
+           == punycode_success, "punycode_join_labels", "failed", name);
+  ace.assign(joined.data(), length);
+
+  /* The constexpr conversion of punycode.hpp joins the labels itself: */
+
+  std::vector<char> literal(joined.size());
+  length = literal.size();
+  status = punycode::detail::to_ascii(name, &length, literal.data());
+  expect(status == punycode_success &&
+         std::string(literal.data(), length) == ace,
+         "punycode::detail::to_ascii", "differs", name);
+
+  count = labels.size();
+  length = scratch.size();
+  status = (cache ? punycode_to_unicode_cached(cache, ace.size(), ace.data(),
+                                               &count, labels.data(), &length,
+                                               scratch.data())
+                  : punycode_to_unicode(ace.size(), ace.data(), &count,
+                                        labels.data(), &length,
+                                        scratch.data()));
+  length = joined.size();
+  expect(status == punycode_success &&
+         punycode_join_labels(count, labels.data(), &length, joined.data())
+           == punycode_success &&
+         std::string(joined.data(), length) == name,
+         cache ? "punycode_to_unicode_cached" : "punycode_to_unicode",
+         "round trip", name);
+}
+
+/* Names that both directions must reject, whichever labels they */
+/* convert or pass through:                                      */
+
+const char *const bad_host_names[] = {
+  "",                           /* no labels                 */
+  ".",                          /* an empty label            */
+  "a..b",
+  "a.b..",
+  "a\xff" "b.com",              /* not UTF-8                 */
+  "\xc3(.com",                  /* a truncated sequence      */
+  "\xc0\xaf.com",               /* an overlong one           */
+  "\xed\xa0\x80.com",           /* a surrogate               */
+  "\xf4\x90\x80\x80.com",       /* beyond U+10FFFF           */
+  "xn--bcher-kva.\xe3\x80"      /* a cut-off U+3002          */
+};
+
+void check_bad_host_names()
+{
+  std::vector<punycode_slice> labels(8);
+  std::vector<char> scratch(256);
+  std::size_t count, length;
+  enum punycode_status status;
+
+  for (const char *name : bad_host_names) {
+    count = labels.size();
+    length = scratch.size();
+    status = punycode_to_ascii(std::strlen(name), name, &count,
+                               labels.data(), &length, scratch.data());
+    expect(status == punycode_bad_input, "punycode_to_ascii",
+           "accepts a bad name", name);
+
+    count = labels.size();
+    length = scratch.size();
+    status = punycode_to_unicode(std::strlen(name), name, &count,
+                                 labels.data(), &length, scratch.data());
+    expect(status == punycode_bad_input, "punycode_to_unicode",
+           "accepts a bad name", name);
+  }
+}
+
+/*** Framed strings ***/
+
+void check_frame(const std::vector<label> &labels)
+{
+  std::vector<punycode_uint> input, output;
+  std::vector<char> framed;
+  struct punycode_frame_block block;
+  std::size_t block_length, length, j, k;
+  enum punycode_status status;
+
+  for (const label &l : labels) input.insert(input.end(), l.cp.begin(),
+                                             l.cp.end());
+
+  for (block_length = 1;  block_length <= 4096;  block_length *= 8) {
+    framed.resize((punycode_frame_header_length + 12) * input.size() + slack);
+    length = framed.size();
+    status = punycode_frame_encode(input.size(), input.data(), block_length,
+                                   &length, framed.data());
+    expect(status == punycode_success, "punycode_frame_encode", "failed", "");
+    if (status != punycode_success) continue;
+    framed.resize(length);
+
+    output.assign(input.size() + slack, 0);
+    length = output.size();
+    status = punycode_frame_decode(framed.size(), framed.data(), &length,
+                                   output.data());
+    expect(status == punycode_success && length == input.size() &&
+           std::equal(input.begin(), input.end(), output.begin()),
+           "punycode_frame_decode", "round trip", "");
+
+    /* A block at a time, going through the headers: */
+
+    output.assign(input.size(), 0);
+    std::memset(&block, 0, sizeof block);
+    while ((status = punycode_frame_next(framed.size(), framed.data(),
+                                         &block)) == punycode_success &&
+           block.count > 0) {
+      status = punycode_frame_decode_block(framed.data(), &block,
+                                           output.data());
+      if (status != punycode_success) break;
+    }
+    expect(status == punycode_success &&
+           std::equal(input.begin(), input.end(), output.begin()),
+           "punycode_frame_next", "round trip", "");
+
+    /* And blocks found by seeking to random code points: */
+
+    for (k = 0;  k < 8 && !input.empty();  ++k) {
+      j = random_below(input.size());
+      status = punycode_frame_seek(framed.size(), framed.data(), j, &block);
+      if (status == punycode_success) {
+        status = punycode_frame_decode_block(framed.data(), &block,
+                                             output.data());
+      }
+      expect(status == punycode_success && block.first <= j &&
+             j < block.first + block.count && output[j] == input[j],
+             "punycode_frame_seek", "wrong block", "");
+    }
+  }
+}
+
+/*** The other parameter sets ***/
+
+template <class P>
+void check_parameter_set(const label &l, const char *name)
+{
+  typedef bootstring::codec<P> codec;
+  std::string in = describe(l.cp, l.flags);
+  std::vector<char> out(12 * l.cp.size() + slack), other(out.size());
+  std::vector<punycode_uint> cp(out.size());
+  std::size_t length, other_length, decoded;
+  enum punycode_status status;
+  const bootstring::dynamic_codec d(bootstring::parameters::of<P>());
+
+  /* Long labels of high code points overflow, as in Punycode: */
+
+  length = out.size();
+  status = codec::encode(l.cp.size(), l.cp.data(), 0, &length, out.data());
+  expect(status == punycode_success || status == punycode_overflow,
+         name, "encode failed", in);
+  if (status != punycode_success) return;
+
+  other_length = other.size();
+  status = d.encode(l.cp.size(), l.cp.data(), 0, &other_length,
+                    other.data());
+  expect(status == punycode_success && other_length == length &&
+         std::equal(out.begin(), out.begin() + length, other.begin()),
+         name, "dynamic_codec differs", in);
+
+  decoded = cp.size();
+  status = codec::decode(length, out.data(), &decoded, cp.data(), 0);
+  expect(status == punycode_success && decoded == l.cp.size() &&
+         std::equal(l.cp.begin(), l.cp.end(), cp.begin()),
+         name, "round trip", in);
+
+  typename codec::decoder dec;
+  dec.feed(length / 2, out.data());
+  dec.feed(length - length / 2, out.data() + length / 2);
+  status = dec.finish();
+  expect(status == punycode_success && dec.output() == l.cp,
+         name, "streaming round trip", in);
+}
+
+/* Some samples as the deployed punycode.js encodes them with */
+/* Base64Params and Base85Params:                             */
+
+struct js_sample {
+  std::size_t sample;
+  const char *base64, *base85;
+};
+
+const js_sample js_samples[] = {
+  { 0, "1WAPADAJqAUosCGEHFVWXN", "BH0F0309gKe#16475LMND" },
+  { 1, "I/EBBl4AxZqEsF54xCz75D", "T)2$0bu=L`2_3?=-0$&)1" },
+  { 6, "GFDOAKfY9AZBDpwGyF0BM/qvRg4CstzMYQ",
+       "mz1E0AVOz0P13f`4y4=0C?!>AW`0*!)7SD" },
+  { 7, "/GLXF1c/8C5rE2wEcxvJsvH5gr+BtatynqrCt3hrEs7L8N1WD4sK4s7EEvY",
+       "~K624*O?&1$%2-*2S$%6&?4zS&<0(M-<T{>0@zP{2&$8-B!J3$|6;~!24>K" }
+};
+
+template <class P>
+void check_js_sample(const label &l, const char *expected, const char *name)
+{
+  typedef bootstring::codec<P> codec;
+  std::vector<char> out(12 * l.cp.size() + slack);
+  std::size_t length = out.size();
+  enum punycode_status status;
+
+  status = codec::encode(l.cp.size(), l.cp.data(), 0, &length, out.data());
+  expect(status == punycode_success &&
+         std::string(out.data(), length) == expected,
+         name, "differs from punycode.js", expected);
+}
+
+/*** Binary encodings ***/
+
+void check_binary()
+{
+  static const char *names[] = { "hex", "base64", "base85", "ascii85" };
+  std::vector<unsigned char> bytes, back;
+  std::vector<char> text;
+  std::size_t n, length, back_length, j;
+  enum punycode_status status;
+  int e;
+
+  for (n = 0;  n < 300;  n += 1 + n / 8) {
+    bytes.resize(n);
+    for (j = 0;  j < n;  ++j) {
+      bytes[j] = random_below(4) ? random_below(256)
+                                 : random_below(2) ? 0 : ' ';
+    }
+
+    for (e = punycode_hex;  e <= punycode_ascii85;  ++e) {
+      text.resize(2 * n + 16);
+      length = text.size();
+      status = punycode_binary_encode(e, n, bytes.data(), &length,
+                                      text.data());
+      expect(status == punycode_success, names[e], "encode failed", "");
+      if (status != punycode_success) continue;
+
+      back.resize(n + slack);
+      back_length = back.size();
+      status = punycode_binary_decode(e, length, text.data(), &back_length,
+                                      back.data());
+      expect(status == punycode_success && back_length == n &&
+             std::equal(bytes.begin(), bytes.end(), back.begin()),
+             names[e], "round trip", std::string(text.data(), length));
+    }
+  }
+}
+
+/*** Japanese charsets ***/
+
+/* jct_compressed[] is JCT11280 as ecl_array.js compresses it, so */
+/* that punycode-jis.c is checked against a copy independent of   */
+/* its tables:                                                    */
+
+const char jct_compressed[] =
+  "zKV33~jZ4zN=~ji36XazM93y!{~k2y!o~k0ZlW6zN?3Wz3W?{EKzK[33[`y|;-~j^YOT"
+  "z$!~kNy|L1$353~jV3zKk3~k-4P4zK_2+~jY4y!xYHR~jlz$_~jk4z$e3X5He<0y!wy|"
+  "X3[:~l|VU[F3VZ056Hy!nz/m1XD61+1XY1E1=1y|bzKiz!H034zKj~mEz#c5ZA3-3X$1"
+  "~mBz$$3~lyz#,4YN5~mEz#{ZKZ3V%7Y}!J3X-YEX_J(3~mAz =V;kE0/y|F3y!}~m>z/"
+  "U~mI~j_2+~mA~jp2;~m@~k32;~m>V}2u~mEX#2x~mBy+x2242(~mBy,;2242(~may->2"
+  "&XkG2;~mIy-_2&NXd2;~mGz,{4<6:.:B*B:XC4>6:.>B*BBXSA+A:X]E&E<~r#z+625z"
+  " s2+zN=`HXI@YMXIAXZYUM8X4K/:Q!Z&33 3YWX[~mB`{zKt4z (zV/z 3zRw2%Wd39]"
+  "S11z$PAXH5Xb;ZQWU1ZgWP%3~o@{Dgl#gd}T){Uo{y5_d{e@}C(} WU9|cB{w}bzvV|)"
+  "[} H|zT}d||0~{]Q|(l{|x{iv{dw}(5}[Z|kuZ }cq{{y|ij}.I{idbof%cu^d}Rj^y|"
+  "-M{ESYGYfYsZslS`?ZdYO__gLYRZ&fvb4oKfhSf^d<Yeasc1f&a=hnYG{QY{D`Bsa|u,"
+  "}Dl|_Q{C%xK|Aq}C>|c#ryW=}eY{L+`)][YF_Ub^h4}[X|?r|u_ex}TL@YR]j{SrXgo*"
+  "|Gv|rK}B#mu{R1}hs|dP{C7|^Qt3|@P{YVV |8&}#D}ef{e/{Rl|>Hni}R1{Z#{D[}CQ"
+  "lQ||E}[s{SG_+i8eplY[=[|ec[$YXn#`hcm}YR|{Ci(_[ql|?8p3]-}^t{wy}4la&pc|"
+  "3e{Rp{LqiJ],] `kc(]@chYnrM`O^,ZLYhZB]ywyfGY~aex!_Qww{a!|)*lHrM{N+n&Y"
+  "Yj~Z b c#e_[hZSon|rOt`}hBXa^i{lh|<0||r{KJ{kni)|x,|0auY{D!^Sce{w;|@S|"
+  "cA}Xn{C1h${E]Z-XgZ*XPbp]^_qbH^e[`YM|a||+=]!Lc}]vdBc=j-YSZD]YmyYLYKZ9"
+  "Z>Xcczc2{Yh}9Fc#Z.l{}(D{G{{mRhC|L3b#|xK[Bepj#ut`H[,{E9Yr}1b{[e]{ZFk7"
+  "[ZYbZ0XL]}Ye[(`d}c!|*y`Dg=b;gR]Hm=hJho}R-[n}9;{N![7k_{UbmN]rf#pTe[x8"
+  "}!Qcs_rs[m`|>N}^V})7{^r|/E}),}HH{OYe2{Skx)e<_.cj.cjoMhc^d}0uYZd!^J_@"
+  "g,[[[?{i@][|3S}Yl3|!1|eZ|5IYw|1D}e7|Cv{OHbnx-`wvb[6[4} =g+k:{C:}ed{S"
+  "]|2M]-}WZ|/q{LF|dYu^}Gs^c{Z=}h>|/i|{W]:|ip{N:|zt|S<{DH[p_tvD{N<[8Axo"
+  "{X4a.^o^X>Yfa59`#ZBYgY~_t^9`jZHZn`>G[oajZ;X,i)Z.^~YJe ZiZF^{][[#Zt^|"
+  "]Fjx]&_5dddW]P0C[-]}]d|y {C_jUql] |OpaA[Z{lp|rz}:Mu#]_Yf6{Ep?f5`$[6^"
+  "D][^u[$[6^.Z8]]ePc2U/=]K^_+^M{q*|9tYuZ,s(dS{i=|bNbB{uG}0jZOa:[-]dYtu"
+  "3]:]<{DJ_SZIqr_`l=Yt`gkTnXb3d@kiq0a`Z{|!B|}e}Ww{Sp,^Z|0>_Z}36|]A|-t}"
+  "lt{R6pi|v8hPu#{C>YOZHYmg/Z4nicK[}hF_Bg|YRZ7c|crkzYZY}_iXcZ.|)U|L5{R~"
+  "qi^Uga@Y[xb}&qdbd6h5|Btw[}c<{Ds53[Y7]?Z<|e0{L[ZK]mXKZ#Z2^tavf0`PE[OS"
+  "OaP`4gi`qjdYMgys/?[nc,}EEb,eL]g[n{E_b/vcvgb.{kcwi`~v%|0:|iK{Jh_vf5lb"
+  "}KL|(oi=LrzhhY_^@`zgf[~g)[J_0fk_V{T)}I_{D&_/d9W/|MU[)f$xW}?$xr4<{Lb{"
+  "y4}&u{XJ|cm{Iu{jQ}CMkD{CX|7A}G~{kt)nB|d5|<-}WJ}@||d@|Iy}Ts|iL|/^|no|"
+  "0;}L6{Pm]7}$zf:|r2}?C_k{R(}-w|`G{Gy[g]bVje=_0|PT{^Y^yjtT[[[l!Ye_`ZN]"
+  "@[n_)j3nEgMa]YtYpZy].d-Y_cjb~Y~[nc~sCi3|zg}B0}do{O^{|$`_|D{}U&|0+{J3"
+  "|8*]iayx{a{xJ_9|,c{Ee]QXlYb]$[%YMc*]w[aafe]aVYi[fZEii[xq2YQZHg]Y~h#|"
+  "Y:thre^@^|_F^CbTbG_1^qf7{L-`VFx Zr|@EZ;gkZ@slgko`[e}T:{Cu^pddZ_`yav^"
+  "Ea+[#ZBbSbO`elQfLui}.F|txYcbQ`XehcGe~fc^RlV{D_0ZAej[l&jShxG[ipB_=u:e"
+  "U}3e8[=j|{D(}dO{Do[BYUZ0/]AYE]ALYhZcYlYP/^-^{Yt_1_-;YT`P4BZG=IOZ&]H["
+  "e]YYd[9^F[1YdZxZ?Z{Z<]Ba2[5Yb[0Z4l?]d_;_)a?YGEYiYv`_XmZs4ZjY^Zb]6gqG"
+  "aX^9Y}dXZr[g|]Y}K aFZp^k^F]M`^{O1Ys]ZCgCv4|E>}8eb7}l`{L5[Z_faQ|c2}Fj"
+  "}hw^#|Ng|B||w2|Sh{v+[G}aB|MY}A{|8o}X~{E8paZ:]i^Njq]new)`-Z>haounWhN}"
+  "c#{DfZ|fK]KqGZ=:u|fqoqcv}2ssm}.r{]{nIfV{JW)[K|,Z{Uxc|]l_KdCb%]cfobya"
+  "3`p}G^|LZiSC]U|(X|kBlVg[kNo({O:g:|-N|qT}9?{MBiL}Sq{`P|3a|u.{Uaq:{_o|"
+  "^S}jX{Fob0`;|#y_@[V[K|cw[<_ }KU|0F}d3|et{Q7{LuZttsmf^kYZ`Af`}$x}U`|W"
+  "w}d]| >}K,r&|XI|*e{C/a-bmr1fId4[;b>tQ_:]hk{b-pMge]gfpo.|(w[jgV{EC1Z,"
+  "YhaY^q,_G[c_g[J0YX]`[h^hYK^_Yib,` {i6vf@YM^hdOKZZn(jgZ>bzSDc^Z%[[o9["
+  "2=/YHZ(_/Gu_`*|8z{DUZxYt^vuvZjhi^lc&gUd4|<UiA`z]$b/Z?l}YI^jaHxe|;F}l"
+  "${sQ}5g}hA|e4}?o{ih}Uz{C)jPe4]H^J[Eg[|AMZMlc}:,{iz}#*|gc{Iq|/:|zK{l&"
+  "}#u|myd{{M&v~nV};L|(g|I]ogddb0xsd7^V})$uQ{HzazsgxtsO^l}F>ZB]r|{7{j@c"
+  "U^{{CbiYoHlng]f+nQ[bkTn/}<-d9q {KXadZYo+n|l[|lc}V2{[a{S4Zam~Za^`{HH{"
+  "xx_SvF|ak=c^[v^7_rYT`ld@]:_ub%[$[m](Shu}G2{E.ZU_L_R{tz`vj(f?^}hswz}G"
+  "dZ}{S:h`aD|?W|`dgG|if{a8|J1{N,}-Ao3{H#{mfsP|[ bzn+}_Q{MT{u4kHcj_q`eZ"
+  "j[8o0jy{p7}C|[}l){MuYY{|Ff!Ykn3{rT|m,^R|,R}$~Ykgx{P!]>iXh6[l[/}Jgcg{"
+  "JYZ.^qYfYIZl[gZ#Xj[Pc7YyZD^+Yt;4;`e8YyZVbQ7YzZxXja.7SYl[s]2^/Ha$[6ZG"
+  "Yrb%XiYdf2]H]kZkZ*ZQ[ZYS^HZXcCc%Z|[(bVZ]]:OJQ_DZCg<[,]%Zaa [g{C00HY["
+  "c%[ChyZ,Z_`PbXa+eh`^&jPi0a[ggvhlekL]w{Yp^v}[e{~;k%a&k^|nR_z_Qng}[E}*"
+  "Wq:{k^{FJZpXRhmh3^p>de^=_7`|ZbaAZtdhZ?n4ZL]u`9ZNc3g%[6b=e.ZVfC[ZZ^^^"
+  "hD{E(9c(kyZ=bb|Sq{k`|vmr>izlH[u|e`}49}Y%}FT{[z{Rk}Bz{TCc/lMiAqkf(m$h"
+  "Dc;qooi[}^o:c^|Qm}a_{mrZ(pA`,}<2sY| adf_%|}`}Y5U;}/4|D>|$X{jw{C<|F.h"
+  "K|*A{MRZ8Zsm?imZm_?brYWZrYx`yVZc3a@f?aK^ojEd {bN}/3ZH]/$YZhm^&j 9|(S"
+  "|b]mF}UI{q&aM]LcrZ5^.|[j`T_V_Gak}9J[ ZCZD|^h{N9{~&[6Zd{}B}2O|cv]K}3s"
+  "}Uy|l,fihW{EG`j_QOp~Z$F^zexS`dcISfhZBXP|.vn|_HYQ|)9|cr]<`&Z6]m_(ZhPc"
+  "Sg>`Z]5`~1`0Xcb4k1{O!bz|CN_T{LR|a/gFcD|j<{Z._[f)mPc:1`WtIaT1cgYkZOaV"
+  "ZOYFrEe[}T$}Ch}mk{K-^@]fH{Hdi`c*Z&|Kt{if[C{Q;{xYB`dYIX:ZB[}]*[{{p9|4"
+  "GYRh2ao{DS|V+[zd$`F[ZXKadb*A] Ys]Maif~a/Z2bmclb8{Jro_rz|x9cHojbZ{GzZ"
+  "x_)]:{wAayeDlx}<=`g{H1{l#}9i|)=|lP{Qq}.({La|!Y{i2EZfp=c*}Cc{EDvVB|;g"
+  "}2t{W4av^Bn=]ri,|y?|3+}T*ckZ*{Ffr5e%|sB{lx^0]eZb]9[SgAjS_D|uHZx]dive"
+  "[c.YPkcq/}db{EQh&hQ|eg}G!ljil|BO]X{Qr_GkGl~YiYWu=c3eb}29v3|D|}4i||.{"
+  "Mv})V{SP1{FX}CZW6{cm|vO{pS|e#}A~|1i}81|Mw}es|5[}3w{C`h9aL]o{}p[G`>i%"
+  "a1Z@`Ln2bD[$_h`}ZOjhdTrH{[j_:k~kv[Sdu]CtL}41{I |[[{]Zp$]XjxjHt_eThoa"
+  "#h>sSt8|gK|TVi[Y{t=}Bs|b7Zpr%{gt|Yo{CS[/{iteva|cf^hgn}($_c^wmb^Wm+|5"
+  "5jrbF|{9^ q6{C&c+ZKdJkq_xOYqZYSYXYl`8]-cxZAq/b%b*_Vsa[/Ybjac/OaGZ4fz"
+  "a|a)gY{P?| I|Y |,pi1n7}9bm9ad|=d{aV|2@[(}B`d&|Uz}B}{`q|/H|!JkM{FU|CB"
+  "|.{}Az}#P|lk}K{|2rk7{^8^?`/|k>|Ka{Sq}Gz}io{DxZh[yK_#}9<{TRdgc]`~Z>JY"
+  "mYJ]|`!ZKZ]gUcx|^E[rZCd`f9oQ[NcD_$ZlZ;Zr}mX|=!|$6ZPZYtIo%fj}CpcN|B,{"
+  "VDw~gb}@hZg`Q{LcmA[(bo`<|@$|o1|Ss}9Z_}tC|G`{F/|9nd}i=}V-{L8aaeST]daR"
+  "bujh^xlpq8|}zs4bj[S`J|]?G{P#{rD{]I`OlH{Hm]VYuSYUbRc*6[j`8]pZ[bt_/^Jc"
+  "*[<Z?YE|Xb|?_Z^Vcas]h{t9|Uwd)_(=0^6Zb{Nc} E[qZAeX[a]P^|_J>e8`W^j_Y}R"
+  "{{Jp__]Ee#e:iWb9q_wKbujrbR}CY`,{mJ}gz{Q^{t~N|? gSga`V_||:#mi}3t|/I`X"
+  "{N*|ct|2g{km}gi|{={jC}F;|E}{ZZjYf*frmu}8Tdroi{T[|+~}HG{cJ}DM{Lp{Ctd&"
+  "}$hi3|FZ| m}Kr|38}^c|m_|Tr{Qv|36}?Up>|;S{DV{k_as}BK{P}}9p|t`jR{sAm4{"
+  "D=b4pWa[}Xi{EjwEkI}3S|E?u=X0{jf} S|NM|JC{qo^3cm]-|JUx/{Cj{s>{Crt[UXu"
+  "v|D~|j|d{YXZR}Aq}0r}(_{pJfi_z}0b|-vi)Z mFe,{f4|q`b{}^Z{HM{rbeHZ|^x_o"
+  "|XM|L%|uFXm}@C_{{Hhp%a7|0p[Xp+^K}9U{bP}: tT}B|}+$|b2|[^|~h{FAby[`{}x"
+  "gygrt~h1[li`c4vz|,7p~b(|mviN}^pg[{N/|g3|^0c,gE|f%|7N{q[|tc|TKA{LU}I@"
+  "|AZp(}G-sz{F |qZ{}F|f-}RGn6{Z]_5})B}UJ{FFb2]4ZI@v=k,]t_Dg5Bj]Z-]L]vr"
+  "pdvdGlk|gF}G]|IW}Y0[G| /bo|Te^,_B}#n^^{QHYI[?hxg{[`]D^IYRYTb&kJ[cri["
+  "g_9]Ud~^_]<p@_e_XdNm-^/|5)|h_{J;{kacVopf!q;asqd}n)|.m|bf{QW|U)}b+{tL"
+  "|w``N|to{t ZO|T]jF}CB|0Q{e5Zw|k |We}5:{HO{tPwf_uajjBfX}-V_C_{{r~gg|U"
+  "de;s+}KNXH}! `K}eW{Upwbk%ogaW}9EYN}YY|&v|SL{C3[5s.]Y]I]u{M6{pYZ`^,`Z"
+  "bCYR[1mNg>rsk0Ym[jrE]RYiZTr*YJ{Ge|%-lf|y(`=[t}E6{k!|3)}Zk} ][G{E~cF{"
+  "u3U.rJ|a9p#o#ZE|?|{sYc#vv{E=|LC}cu{N8`/`3`9rt[4|He{cq|iSYxY`}V |(Q|t"
+  "4{C?]k_Vlvk)BZ^r<{CL}#h}R+[<|i=}X|{KAo]|W<`K{NW|Zx}#;|fe{IMr<|K~tJ_x"
+  "}AyLZ?{GvbLnRgN}X&{H7|x~}Jm{]-| GpNu0}.ok>|c4{PYisrDZ|fwh9|hfo@{H~XS"
+  "bO]Odv]%`N]b1Y]]|eIZ}_-ZA]aj,>eFn+j[aQ_+]h[J_m_g]%_wf.`%k1e#Z?{CvYu_"
+  "B^|gk`Xfh^M3`afGZ-Z|[m{L}|k3cp[it ^>YUi~d>{T*}YJ{Q5{Jxa$hg|%4`}|LAgv"
+  "b }G}{P=|<;Ux{_skR{cV|-*|s-{Mp|XP|$G|_J}c6cM{_=_D|*9^$ec{V;|4S{qO|w_"
+  "|.7}d0|/D}e}|0G{Dq]Kdp{}dfDi>}B%{Gd|nl}lf{C-{y}|ANZr}#={T~|-(}c&{pI|"
+  "ft{lsVP}){|@u}!W|bcmB{d?|iW|:dxj{PSkO|Hl]Li:}VYk@|2={fnWt{M3`cZ6|)}|"
+  "Xj}BYa?vo{e4|L7|B7{L7|1W|lvYO}W8nJ|$Vih|{T{d*_1|:-n2dblk``fT{Ky|-%}m"
+  "!|Xy|-a{Pz}[l{kFjz|iH}9N{WE{x,|jz}R {P|{D)c=nX|Kq|si}Ge{sh|[X{RF{t`|"
+  "jsr*fYf,rK|/9}$}}Nf{y!1|<Std}4Wez{W${Fd_/^O[ooqaw_z[L`Nbv[;l7V[ii3_P"
+  "eM}.h^viqYjZ*j1}+3{bt{DR[;UG}3Og,rS{JO{qw{d<_zbAh<R[1_r`iZTbv^^a}c{i"
+  "EgQZ<exZFg.^Rb+`Uj{a+{z<[~r!]`[[|rZYR|?F|qppp]L|-d|}K}YZUM|=Y|ktm*}F"
+  "]{D;g{uI|7kg^}%?Z%ca{N[_<q4xC]i|PqZC]n}.bDrnh0Wq{tr|OMn6tM|!6|T`{O`|"
+  ">!]ji+]_bTeU}Tq|ds}n|{Gm{z,f)}&s{DPYJ`%{CGd5v4tvb*hUh~bf]z`jajiFqAii"
+  "]bfy^U{Or|m+{I)cS|.9k:e3`^|xN}@Dnlis`B|Qo{`W|>||kA}Y}{ERYuYx`%[exd`]"
+  "|OyiHtb}HofUYbFo![5|+]gD{NIZR|Go}.T{rh^4]S|C9_}xO^i`vfQ}C)bK{TL}cQ|7"
+  "9iu}9a];sj{P.o!f[Y]pM``Jda^Wc9ZarteBZClxtM{LW}l9|a.mU}KX}4@{I+f1}37|"
+  "8u}9c|v${xGlz}jP{Dd1}e:}31}%3X$|22i<v+r@~mf{sN{C67G97855F4YL5}8f{DT|"
+  "xy{sO{DXB334@55J1)4.G9A#JDYtXTYM4, YQD9;XbXm9SX]IB^4UN=Xn<5(;(F3YW@X"
+  "kH-X_VM[DYM:5XP!T&Y`6|,^{IS-*D.H>:LXjYQ0I3XhAF:9:(==.F*3F1189K/7163D"
+  ",:@|e2{LS36D4hq{Lw/84443@4.933:0307::6D7}&l{Mx657;89;,K5678H&93D(H<&"
+  "<>0B90X^I;}Ag1{P%3A+>><975}[S{PZE453?4|T2{Q+5187;>447:81{C=hL6{Me^:="
+  "7ii{R=.=F<81;48?|h8}Uh{SE|,VxL{ST,7?9Y_5Xk3A#:$%YSYdXeKXOD8+TXh7(@>("
+  "YdXYHXl9J6X_5IXaL0N?3YK7Xh!1?XgYz9YEXhXaYPXhC3X`-YLY_XfVf[EGXZ5L8BXL"
+  "9YHX]SYTXjLXdJ: YcXbQXg1PX]Yx4|Jr{Ys4.8YU+XIY`0N,<H%-H;:0@,74/:8546I"
+  "=9177154870UC]d<C3HXl7ALYzXFXWP<<?E!88E5@03YYXJ?YJ@6YxX-YdXhYG|9o{`i"
+  "XjY_>YVXe>AYFX[/(I@0841?):-B=14337:8=|14{c&93788|di{cW-0>0<097/A;N{F"
+  "qYpugAFT%X/Yo3Yn,#=XlCYHYNX[Xk3YN:YRT4?)-YH%A5XlYF3C1=NWyY}>:74-C673"
+  "<69545v {iT85YED=64=.F4..9878/D4378?48B3:7:7/1VX[f4{D,{l<5E75{dAbRB-"
+  "8-@+;DBF/$ZfW8S<4YhXA.(5@*11YV8./S95C/0R-A4AXQYI7?68167B95HA1*<M3?1/"
+  "@;/=54XbYP36}lc{qzSS38:19?,/39193574/66878Yw1X-87E6=;964X`T734:>86>1"
+  "/=0;(I-1::7ALYGXhF+Xk[@W%TYbX7)KXdYEXi,H-XhYMRXfYK?XgXj.9HX_SX]YL1Xm"
+  "YJ>Y}WwIXiI-3-GXcYyXUYJ$X`Vs[7;XnYEZ;XF! 3;%8;PXX(N3Y[)Xi1YE&/ :;74Y"
+  "Q6X`33C;-(>Xm0(TYF/!YGXg8 9L5P01YPXO-5%C|qd{{/K/E6,=0144:361:955;644"
+  "3@?B7*7:F89&F35YaX-CYf,XiFYRXE_e{}sF 0*7XRYPYfXa5YXXY8Xf8Y~XmA[9VjYj"
+  "*#YMXIYOXk,HHX40YxYMXU8OXe;YFXLYuPXP?EB[QV0CXfY{:9XV[FWE0D6X^YVP*$4%"
+  "OXiYQ(|xp|%c3{}V`1>Y`XH00:8/M6XhQ1:;3414|TE|&o@1*=81G8<3}6<|(f6>>>5-"
+  "5:8;093B^3U*+*^*UT30XgYU&7*O1953)5@E78--F7YF*B&0:%P68W9Zn5974J9::3}V"
+  "k|-,C)=)1AJ4+<3YGXfY[XQXmT1M-XcYTYZXCYZXEYXXMYN,17>XIG*SaS|/eYJXbI?X"
+  "dNZ+WRYP<F:R PXf;0Xg`$|1GX9YdXjLYxWX!ZIXGYaXNYm6X9YMX?9EXmZ&XZ#XQ>Ye"
+  "XRXfAY[4 ;0X!Zz0XdN$XhYL XIY^XGNXUYS/1YFXhYk.TXn4DXjB{jg|4DEX]:XcZMW"
+  "=A.+QYL<LKXc[vV$+&PX*Z3XMYIXUQ:ZvW< YSXFZ,XBYeXMM)?Xa XiZ4/EXcP3%}&-"
+  "|6~:1(-+YT$@XIYRBC<}&,|7aJ6}bp|8)K1|Xg|8C}[T|8Q.89;-964I38361<=/;883"
+  "651467<7:>?1:.}le|:Z=39;1Y^)?:J=?XfLXbXi=Q0YVYOXaXiLXmJXO5?.SFXiCYW}"
+  "-;|=u&D-X`N0X^,YzYRXO(QX_YW9`I|>hZ:N&X)DQXP@YH#XmNXi$YWX^=!G6YbYdX>X"
+  "jY|XlX^XdYkX>YnXUXPYF)FXT[EVTMYmYJXmYSXmNXi#GXmT3X8HOX[ZiXN]IU2>8YdX"
+  "1YbX<YfWuZ8XSXcZU%0;1XnXkZ_WTG,XZYX5YSX Yp 05G?XcYW(IXg6K/XlYP4XnI @"
+  "XnO1W4Zp-9C@%QDYX+OYeX9>--YSXkD.YR%Q/Yo YUX].Xi<HYEZ2WdCE6YMXa7F)=,D"
+  ">-@9/8@5=?7164;35387?N<618=6>7D+C50<6B03J0{Hj|N9$D,9I-,.KB3}m |NzE0:"
+  ":/81YqXjMXl7YG; [.W=Z0X4XQY]:MXiR,XgM?9$9>:?E;YE77VS[Y564760391?1494"
+  "1:0=:8B:;/1DXjFA-564=0B3XlH1+D85:0Q!B#:-6&N/:9<-R3/7Xn<*3J4.H:+334B."
+  "=>30H.;3833/76464665755:/83H6633:=;.>5645}&E|Y)?1/YG-,93&N3AE@5 <L1-"
+  "G/8A0D858/30>8<549=@B8] V0[uVQYlXeD(P#ID&7T&7;Xi0;7T-$YE)E=1:E1GR):-"
+  "-0YI7=E<}n9|aT6783A>D7&4YG7=391W;Zx<5+>F#J39}o/|cc;6=A050EQXg8A1-}D-"
+  "|d^5548083563695D?-.YOXd37I$@LYLWeYlX<Yd+YR A$;3-4YQ-9XmA0!9/XLY_YT("
+  "=5XdDI>YJ5XP1ZAW{9>X_6R(XhYO65&J%DA)C-!B:97#A9;@?F;&;(9=11/=657/H,<8"
+  "}bz|j^5446>.L+&Y^8Xb6?(CYOXb*YF(8X`FYR(XPYVXmPQ%&DD(XmZXW??YOXZXfCYJ"
+  "79,O)XnYF7K0!QXmXi4IYFRXS,6<%-:YO(+:-3Q!1E1:W,Zo}Am|n~;3580534*?3Zc4"
+  "=9334361693:30C<6/717:<1/;>59&:4}6!|rS36=1?75<8}[B|s809983579I.A.>84"
+  "758=108564741H*9E{L{|u%YQ<%6XfH.YUXe4YL@,>N}Tv|ve*G0X)Z;/)3@A74(4P&A"
+  "1X:YVH97;,754*A66:1 D739E3553545558E4?-?K17/770843XAYf838A7K%N!YW4.$"
+  "T19Z`WJ*0XdYJXTYOXNZ 1XaN1A+I&Xi.Xk3Z3GB&5%WhZ1+5#Y[X<4YMXhQYoQXVXbY"
+  "Q8XSYUX4YXBXWDMG0WxZA[8V+Z8X;D],Va$%YeX?FXfX[XeYf<X:Z[WsYz8X_Y]%XmQ("
+  "!7BXIZFX]&YE3F$(1XgYgYE& +[+W!<YMYFXc;+PXCYI9YrWxGXY9DY[!GXiI7::)OC;"
+  "*$.>N*HA@{C|}&k=:<TB83X`3YL+G4XiK]i}(fYK<=5$.FYE%4*5*H*6XkCYL=*6Xi6!"
+  "Yi1KXR4YHXbC8Xj,B9ZbWx/XbYON#5B}Ue}+QKXnF1&YV5XmYQ0!*3IXBYb71?1B75Xm"
+  "F;0B976;H/RXU:YZX;BG-NXj;XjI>A#D3B636N;,*%<D:0;YRXY973H5)-4FXOYf0:0;"
+  "/7759774;7;:/855:543L43<?6=E,.A4:C=L)%4YV!1(YE/4YF+ F3%;S;&JC:%/?YEX"
+  "J4GXf/YS-EXEYW,9;E}X$}547EXiK=51-?71C%?57;5>463553Zg90;6447?<>4:9.75"
+  "38XgN{|!}9K/E&3-:D+YE1)YE/3;37/:05}n<}:UX8Yj4Yt864@JYK..G=.(A Q3%6K>"
+  "3(P3#AYE$-6H/456*C=.XHY[#S.<780191;057C)=6HXj?955B:K1 E>-B/9,;5.!L?:"
+  "0>/.@//:;7833YZ56<4:YE=/:7Z_WGC%3I6>XkC*&NA16X=Yz2$X:Y^&J48<99k8}CyB"
+  "-61<18K946YO4{|N}E)YIB9K0L>4=46<1K0+R;6-=1883:478;4,S+3YJX`GJXh.Yp+X"
+  "m6MXcYpX(>7Yo,/:X=Z;Xi0YTYHXjYmXiXj;*;I-8S6N#XgY}.3XfYGO3C/$XjL$*NYX"
+  ",1 6;YH&<XkK9C#I74.>}Hd`A748X[T450[n75<4439:18A107>|ET}Rf<1;14876/Yb"
+  "983E<5.YNXd4149>,S=/4E/<306443G/06}0&}UkYSXFYF=44=-5095=88;63844,9E6"
+  "644{PL}WA8:>)7+>763>>0/B3A545CCnT}Xm|dv}Xq1L/YNXk/H8;;.R63351YY747@1"
+  "5YE4J8;46;.38.>4A369.=-83,;Ye3?:3@YE.4-+N353;/;@(X[YYD>@/05-I*@.:551"
+  "741Yf5>6A443<3535;.58/86=D4753442$635D1>0359NQ @73:3:>><Xn?;43C14 ?Y"
+  "|X611YG1&<+,4<*,YLXl<1/AIXjF*N89A4Z576K1XbJ5YF.ZOWN.YGXO/YQ01:4G38Xl"
+  "1;KI0YFXB=R<7;D/,/4>;$I,YGXm94@O35Yz66695385.>:6A#5}W7n^4336:4157597"
+  "434433<3|XA}m`>=D>:4A.337370?-6Q96{`E|4A}C`|Qs{Mk|J+~r>|o,wHv>Vw}!c{"
+  "H!|Gb|*Ca5}J||,U{t+{CN[!M65YXOY_*B,Y[Z9XaX[QYJYLXPYuZ%XcZ8LY[SYPYKZM"
+  "<LMYG9OYqSQYM~[e{UJXmQYyZM_)>YjN1~[f3{aXFY|Yk:48YdH^NZ0|T){jVFYTZNFY"
+  "^YTYN~[h{nPYMYn3I]`EYUYsYIZEYJ7Yw)YnXPQYH+Z.ZAZY]^Z1Y`YSZFZyGYHXLYG "
+  "8Yd#4~[i|+)YH9D?Y^F~Y7|-eYxZ^WHYdYfZQ~[j|3>~[k|3oYmYqY^XYYO=Z*4[]Z/O"
+  "YLXhZ1YLZIXgYIHYEYK,<Y`YEXIGZI[3YOYcB4SZ!YHZ*&Y{Xi3~[l|JSY`Zz?Z,~[m|"
+  "O=Yi>??XnYWXmYS617YVYIHZ(Z4[~L4/=~[n|Yu{P)|];YOHHZ}~[o33|a>~[r|aE]DH"
+  "~[s|e$Zz~[t|kZFY~XhYXZB[`Y}~[u|{SZ&OYkYQYuZ2Zf8D~[v}% ~[w3},Q[X]+YGY"
+  "eYPIS~[y}4aZ!YN^!6PZ*~[z}?E~[{3}CnZ=~[}}EdDZz/9A3(3S<,YR8.D=*XgYPYcX"
+  "N3Z5 4)~[~}JW=$Yu.XX~] }KDX`PXdZ4XfYpTJLY[F5]X~[2Yp}U+DZJ::<446[m@~]"
+  "#3}]1~]%}^LZwZQ5Z`/OT<Yh^ -~]&}jx[ ~m<z!%2+~ly4VY-~o>}p62yz!%2+Xf2+~"
+  "ly4VY-zQ`z (=] 2z~o2";
+
+/* jct_digit() is the value of a character of jct_compressed[], */
+/* which has no ' or \:                                          */
+
+long jct_digit(char ch)
+{
+  if (ch == ' ' || ch == '!') return ch - ' ';
+  return ch - '#' + 2 - (ch > '\'') - (ch > '\\');
+}
+
+/* jct11280() decompresses JCT11280 as ecl_array.js does: */
+
+std::vector<punycode_uint> jct11280()
+{
+  std::vector<punycode_uint> s;
+  const char *a = jct_compressed;
+  long c, p = 0;
+
+  while (*a != 0) {
+    c = jct_digit(*a++);
+
+    if (c == 16) {
+      c = jct_digit(*a++);
+      if (c < 87) {
+        if (c == 86) c = 1879;
+        while (c--) s.push_back(++p);
+      }
+      else {
+        std::vector<punycode_uint> run(s.begin() + 8272, s.begin() + 8632);
+        s.insert(s.end(), run.begin(), run.end());
+      }
+    }
+    else if (c < 86) {
+      p += c < 51 ? c - 16 : (c - 55) * 92 + jct_digit(*a++);
+      s.push_back(p);
+    }
+    else {
+      c = (c - 86) * 92 + jct_digit(*a++);
+      c = c * 92 + jct_digit(*a++);
+      if (c < 49152) s.push_back(p = c < 40960 ? c : c | 57344);
+      else {
+        s.insert(s.end(), c & 511, 0x30FB);
+        p = 0x30FB;
+      }
+    }
+  }
+
+  return s;
+}
+
+enum { sjis_codes = 11280, jis_codes = 8836, nec_first = 8272,
+       middle_dot = 5 };
+
+/* jis_bytes() is the code of an index as ecl_array.js writes it, */
+/* shifting in and out of JIS X 0208 in ISO-2022-JP:              */
+
+std::string jis_bytes(int charset, long index)
+{
+  std::string s;
+  long m = index / 188, n = index % 188;
+
+  switch (charset) {
+    case punycode_sjis:
+      s += (char) (m < 31 ? m + 129 : m + 193);
+      s += (char) (n + (n < 63 ? 64 : 65));
+      return s;
+
+    case punycode_euc_jp:
+      s += (char) (index / 94 + 161);
+      s += (char) (index % 94 + 161);
+      return s;
+
+    default:
+      s = "\x1b$B";
+      s += (char) (index / 94 + 33);
+      s += (char) (index % 94 + 33);
+      return s + "\x1b(B";
+  }
+}
+
+std::string jis_decoded(int charset, const std::string &input,
+                        enum punycode_status &status)
+{
+  std::vector<punycode_uint> out(input.size() + slack);
+  std::size_t length = out.size();
+  std::string s;
+  char buffer[16];
+
+  status = punycode_jis_decode(charset, input.size(), input.data(), &length,
+                               out.data());
+  if (status != punycode_success) return s;
+
+  for (std::size_t j = 0;  j < length;  ++j) {
+    std::snprintf(buffer, sizeof buffer, "U+%04lX ", (unsigned long) out[j]);
+    s += buffer;
+  }
+  return s;
+}
+
+std::string jis_encoded(int charset, const std::vector<punycode_uint> &input,
+                        enum punycode_status &status)
+{
+  std::vector<char> out(8 * input.size() + 3);
+  std::size_t length = out.size();
+
+  status = punycode_jis_encode(charset, input.size(), input.data(), &length,
+                               out.data());
+  return status == punycode_success ? std::string(out.data(), length) : "";
+}
+
+/* check_jis() checks every index of each charset both ways, with  */
+/* the index ecl_array.js chooses for each code point:  its first  */
+/* in Shift_JIS unless that is in the NEC selection, where the IBM */
+/* extension is chosen, and its first in JCT8836 otherwise, with   */
+/* U+30FB for the code points a charset lacks.                     */
+
+void check_jis()
+{
+  static const char *names[] = { "jis sjis", "jis euc_jp", "jis jis7",
+                                 "jis jis8" };
+  const std::vector<punycode_uint> jct = jct11280();
+  std::vector<long> first(0x10000, -1), last(0x10000, -1);
+  enum punycode_status status;
+  std::string s;
+  char buffer[16];
+  long index, codes, chosen;
+  int charset;
+
+  expect(jct.size() == sjis_codes && jct[middle_dot] == 0x30FB, "jis",
+         "JCT11280 copy", "");
+  if (jct.size() != sjis_codes) return;
+
+  for (index = sjis_codes - 1;  index >= 0;  --index) {
+    first[jct[index]] = index;
+  }
+  for (index = 0;  index < sjis_codes;  ++index) last[jct[index]] = index;
+
+  for (charset = punycode_sjis;  charset <= punycode_jis8;  ++charset) {
+    codes = charset == punycode_sjis ? sjis_codes : jis_codes;
+
+    for (index = 0;  index < codes;  ++index) {
+      s = jis_bytes(charset, index);
+      std::snprintf(buffer, sizeof buffer, "U+%04lX ",
+                    (unsigned long) jct[index]);
+      expect(jis_decoded(charset, s, status) == buffer, names[charset],
+             "decodes an index differently", s);
+    }
+
+    for (index = 0;  index < sjis_codes;  ++index) {
+      chosen = first[jct[index]];
+      if (charset == punycode_sjis && chosen >= nec_first) {
+        chosen = last[jct[index]];
+      }
+      if (chosen >= codes) chosen = middle_dot;
+      s = jis_encoded(charset, { jct[index] }, status);
+      expect(status == punycode_success && s == jis_bytes(charset, chosen),
+             names[charset], "encodes a code point differently",
+             jis_decoded(punycode_sjis, jis_bytes(punycode_sjis, index),
+                         status));
+    }
+  }
+
+  /* Twins in the NEC selection give way to the IBM extensions in */
+  /* Shift_JIS, and NEC special characters do not:                */
+
+  static const struct { punycode_uint c; const char *sjis, *euc_jp; }
+  twins[] = {
+    { 0x2170, "\xFA\x40", "\xFC\xF1" },   /* small roman numeral one */
+    { 0x7E8A, "\xFA\x5C", "\xF9\xA1" },
+    { 0x2160, "\x87\x54", "\xAD\xB5" },   /* roman numeral one       */
+    { 0x2235, "\x81\xE6", "\xA2\xE8" }    /* because                 */
+  };
+
+  for (const auto &t : twins) {
+    expect(jis_encoded(punycode_sjis, { t.c }, status) == t.sjis,
+           names[punycode_sjis], "twin", t.sjis);
+    expect(jis_encoded(punycode_euc_jp, { t.c }, status) == t.euc_jp,
+           names[punycode_euc_jp], "twin", t.euc_jp);
+  }
+
+  /* Code points a charset lacks are U+30FB, and so are the codes */
+  /* that are unassigned:                                         */
+
+  for (punycode_uint c : { 0xC0, 0xFFFD, 0x1F600 }) {
+    expect(jis_encoded(punycode_sjis, { c }, status) == "\x81\x45",
+           names[punycode_sjis], "unmappable", "");
+    expect(jis_encoded(punycode_euc_jp, { c }, status) == "\xA1\xA6",
+           names[punycode_euc_jp], "unmappable", "");
+    expect(jis_encoded(punycode_jis7, { c }, status) == "\x1b$B!&\x1b(B",
+           names[punycode_jis7], "unmappable", "");
+  }
+
+  expect(jis_decoded(punycode_sjis, "\x85\x40", status) == "U+30FB ",
+         names[punycode_sjis], "unassigned", "\x85\x40");
+  expect(jis_decoded(punycode_euc_jp, "\xA9\xA1", status) == "U+30FB ",
+         names[punycode_euc_jp], "unassigned", "\xA9\xA1");
+
+  /* ISO-2022-JP shifts into half-width katakana with ESC ( I, where */
+  /* JIS X 0201 8-bit codes need none, and back to ASCII at the end: */
+
+  static const struct { int charset; const char *bytes, *decoded; }
+  shifts[] = {
+    { punycode_jis7, "A\x1b(I1\x1b$B$\"\x1b(BB",
+      "U+0041 U+FF71 U+3042 U+0042 " },
+    { punycode_jis7, "\x1b(I1\x1b(B", "U+FF71 " },
+    { punycode_jis7, "\x1b$B$\"\x1b(I1\x1b(B", "U+3042 U+FF71 " },
+    { punycode_jis8, "\xB1\x1b$B$\"\x1b(B", "U+FF71 U+3042 " },
+    { punycode_euc_jp, "\x8E\xB1\xA4\xA2", "U+FF71 U+3042 " },
+    { punycode_sjis, "\xB1\x82\xA0", "U+FF71 U+3042 " }
+  };
+
+  for (const auto &t : shifts) {
+    std::vector<punycode_uint> cp;
+    unsigned long c;
+    int n;
+
+    for (const char *d = t.decoded;
+         std::sscanf(d, "U+%lX %n", &c, &n) == 1;  d += n) {
+      cp.push_back(c);
+    }
+
+    expect(jis_decoded(t.charset, t.bytes, status) == t.decoded,
+           names[t.charset], "decodes differently", t.bytes);
+    expect(jis_encoded(t.charset, cp, status) == t.bytes,
+           names[t.charset], "encodes differently", t.decoded);
+  }
+
+  /* The other escape sequences are accepted too, but only those: */
+
+  expect(jis_decoded(punycode_jis7, "\x1b$@$\"\x1b(JA", status) ==
+         "U+3042 U+0041 ", names[punycode_jis7], "ESC $ @ and ESC ( J", "");
+
+  for (const char *bad : { "\x1b(Z", "\x1b(", "\x1b$B$", "\x1b(I\x60" }) {
+    jis_decoded(punycode_jis7, bad, status);
+    expect(status == punycode_bad_input, names[punycode_jis7],
+           "accepts a bad escape", bad);
+  }
+
+  /* The final shift to ASCII must fit as well: */
+
+  std::vector<punycode_uint> a = { 0x3042 };
+  std::vector<char> out(8);
+  std::size_t length = 7;
+
+  status = punycode_jis_encode(punycode_jis7, 1, a.data(), &length,
+                               out.data());
+  expect(status == punycode_big_output, names[punycode_jis7],
+         "writes past the output", "");
+}
+
+/*** Instrumentation ***/
+
+#ifdef PUNYCODE_STATS
+
+/* counted() checks that the call between two snapshots was counted */
+/* once, under its operation and status, with the given units and   */
+/* in the given length bucket, and that no other operation moved:   */
+
+void counted(const punycode_stats &before, const punycode_stats &after,
+             int op, enum punycode_status status, unsigned long input_units,
+             unsigned long output_units, unsigned bucket, const char *name)
+{
+  const punycode_stats_counters &b = before.operation[op];
+  const punycode_stats_counters &a = after.operation[op];
+  unsigned long calls = 0;
+  int j;
+
+  for (j = 0;  j < punycode_stats_operations;  ++j) {
+    calls += after.operation[j].calls - before.operation[j].calls;
+  }
+
+  expect(calls == 1 && a.calls - b.calls == 1 &&
+         a.status[status] - b.status[status] == 1 &&
+         a.input_units - b.input_units == input_units &&
+         a.output_units - b.output_units == output_units &&
+         a.lengths[bucket] - b.lengths[bucket] == 1,
+         name, "counters", "");
+}
+
+void check_stats()
+{
+  static const punycode_uint chinese[] = {
+    0x4ED6, 0x4EEC, 0x4E3A, 0x4EC0, 0x4E48, 0x4E0D, 0x8BF4, 0x4E2D, 0x6587
+  };
+  static const char ace[] = "ihqwcrb4cv8a8dqg056pqjye";
+  static const char bucher[] = "b\xc3\xbc" "cher";
+  std::vector<punycode_utf16> u(std::begin(chinese), std::end(chinese));
+  punycode_utf16 lone = 0xD800;
+  punycode_stats before, after;
+  punycode_uint cp[32];
+  punycode_utf16 units[32];
+  char out[64];
+  std::size_t length;
+  enum punycode_status status;
+
+#define CALL(c) \
+  (punycode_stats_snapshot(&before), status = (c), \
+   punycode_stats_snapshot(&after), status)
+
+  length = sizeof out;
+  CALL(punycode_encode(9, chinese, 0, &length, out));
+  counted(before, after, punycode_stats_encode, status, 9, 24, 4,
+          "punycode_encode");
+
+  length = 32;
+  CALL(punycode_decode(24, ace, &length, cp, 0));
+  counted(before, after, punycode_stats_decode, status, 24, 9, 5,
+          "punycode_decode");
+
+  length = 32;
+  CALL(punycode_decode(5, "abc-!", &length, cp, 0));
+  counted(before, after, punycode_stats_decode, punycode_bad_input, 5, 0, 3,
+          "punycode_decode");
+
+  length = sizeof out;
+  CALL(punycode_encode_utf8(7, bucher, &length, out));
+  counted(before, after, punycode_stats_encode_utf8, status, 7, 9, 3,
+          "punycode_encode_utf8");
+
+  length = 3;
+  CALL(punycode_decode_utf8(9, "bcher-kva", &length, out));
+  counted(before, after, punycode_stats_decode_utf8, punycode_big_output,
+          9, 0, 4, "punycode_decode_utf8");
+
+  length = sizeof out;
+  CALL(punycode_encode_utf16(u.size(), u.data(), &length, out));
+  counted(before, after, punycode_stats_encode_utf16, status, 9, 24, 4,
+          "punycode_encode_utf16");
+
+  length = sizeof out;
+  CALL(punycode_encode_utf16(1, &lone, &length, out));
+  counted(before, after, punycode_stats_encode_utf16, punycode_bad_input,
+          1, 0, 1, "punycode_encode_utf16");
+
+  length = 32;
+  CALL(punycode_decode_utf16(24, ace, &length, units));
+  counted(before, after, punycode_stats_decode_utf16, status, 24, 9, 5,
+          "punycode_decode_utf16");
+
+#undef CALL
+
+  /* The export names every operation, and fits in 16384 chars */
+  /* even when every counter is as long as it gets:            */
+
+  std::vector<char> text(16384);
+  length = text.size();
+  status = punycode_stats_export(&after, &length, text.data());
+  expect(status == punycode_success &&
+         std::string(text.data(), length).find(
+           "punycode_calls_total{operation=\"decode_utf16\"}")
+           != std::string::npos,
+         "punycode_stats_export", "differs", "");
+
+  std::memset(&after, 0xFF, sizeof after);
+  length = text.size();
+  status = punycode_stats_export(&after, &length, text.data());
+  expect(status == punycode_success, "punycode_stats_export",
+         "16384 chars too small", "");
+}
+
+#endif /* PUNYCODE_STATS */
+
+/* A literal converted by the compiler: */
+
+using namespace punycode::literals;
+
+static_assert("b\xc3\xbc" "cher.example"_ace.view() ==
+              "xn--bcher-kva.example");
+static_assert(punycode::ace<"example.com">.view() == "example.com");
+
+} /* namespace */
+
+int main(int argc, char **argv)
+{
+  unsigned long count = 5000, k, j;
+  std::vector<label> labels;
+  std::vector<std::string> aces;
+  enum punycode_status status;
+  struct punycode_cache *cache;
+  int argi;
+
+  for (argi = 1;  argi + 1 < argc && argv[argi][0] == '-';  argi += 2) {
+    if (std::strcmp(argv[argi], "-n") == 0) {
+      count = std::strtoul(argv[argi + 1], 0, 10);
+    }
+    else if (std::strcmp(argv[argi], "-s") == 0) {
+      random_engine.seed(std::strtoul(argv[argi + 1], 0, 10));
+    }
+    else usage(argv);
+  }
+
+  if (argi < argc) usage(argv);
+
+  /* The samples must encode as RFC 3492 says: */
+
+  for (const sample &s : samples) {
+    label l = parse_sample(s.code_points);
+    std::string ace = encode_reference(l, true, status);
+    expect(status == punycode_success && ace == s.ace, "punycode_encode",
+           "RFC 3492 sample", s.ace);
+    reference r = decode_reference(s.ace);
+    expect(r.status == punycode_success && r.cp == l.cp && r.flags == l.flags,
+           "punycode_decode", "RFC 3492 sample", s.ace);
+    labels.push_back(l);
+  }
+
+  for (const js_sample &s : js_samples) {
+    check_js_sample<bootstring::base64_params>(labels[s.sample], s.base64,
+                                               "bootstring::base64");
+    check_js_sample<bootstring::base85_params>(labels[s.sample], s.base85,
+                                               "bootstring::base85");
+  }
+
+  for (k = 0;  k < count;  ++k) labels.push_back(random_label());
+
+  for (const label &l : labels) {
+    std::string ace;
+
+    check_encoders(l);
+    ace = encode_reference(l, true, status);
+    if (status == punycode_success) {
+      check_decoders(ace);
+      aces.push_back(ace);
+    }
+    ace = random_ace(ace);
+    check_decoders(ace);
+    aces.push_back(ace);
+
+    check_parameter_set<bootstring::base64_params>(l, "bootstring::base64");
+    check_parameter_set<bootstring::base85_params>(l, "bootstring::base85");
+  }
+
+  /* Batches of a few hundred labels at a time: */
+
+  cache = punycode_cache_create(1 << 20, 0);
+  if (cache == 0) {
+    std::fputs("cannot create a cache\n", stderr);
+    return EXIT_FAILURE;
+  }
+
+  for (k = 0;  k < labels.size();  k += 500) {
+    std::size_t end = std::min<std::size_t>(k + 500, labels.size());
+    std::vector<label> some(labels.begin() + k, labels.begin() + end);
+    std::vector<std::string> some_aces(
+      aces.begin() + std::min(aces.size(), 2 * k),
+      aces.begin() + std::min(aces.size(), 2 * end));
+    check_batches(some, some_aces, 0);
+    check_batches(some, some_aces, cache);
+    check_frame(some);
+  }
+
+  /* Host names of one to four of the random labels, which have */
+  /* no separators, unlike some of the samples:                  */
+
+  for (k = samples_count;  k < labels.size();  ++k) {
+    std::vector<const label *> parts;
+    for (j = 1 + random_below(4);  j > 0;  ) {
+      const label &l = labels[samples_count +
+                              random_below(labels.size() - samples_count)];
+      if (!l.cp.empty()) parts.push_back(&l), --j;
+    }
+    check_host_name(parts, 0);
+    check_host_name(parts, cache);
+  }
+
+  check_bad_host_names();
+  punycode_cache_free(cache);
+  check_binary();
+  check_jis();
+#ifdef PUNYCODE_STATS
+  check_stats();
+#endif
+
+  std::printf("%lu checks, %lu failed\n", checks, failures);
+  return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,180 @@
+/*
+punycode-frame.c
+
+This is ANSI C code (C89) implementing the framed format declared in
+punycode-frame.h on top of punycode_encode_wide() and
+punycode_decode_wide().
+
+*/
+
+#include "punycode-frame.h"
+
+enum { field_digits = 8 };
+
+/* max_field is the largest value a header field can hold: */
+static const unsigned long max_field = 0xFFFFFFFFUL;
+
+/* put_field() writes value as field_digits hexadecimal digits: */
+
+static void put_field(unsigned long value, char output[])
+{
+  int j;
+
+  for (j = field_digits - 1;  j >= 0;  --j) {
+    output[j] = "0123456789abcdef"[value & 0xF];
+    value >>= 4;
+  }
+}
+
+/* get_field() reads field_digits lowercase hexadecimal digits, */
+/* returning 0 if they are not.                                 */
+
+static int get_field(const char input[], size_t *value)
+{
+  int j;
+  unsigned c;
+
+  for (*value = 0, j = 0;  j < field_digits;  ++j) {
+    c = (unsigned char) input[j];
+    if (c - 48 < 10) c -= 48;
+    else if (c - 97 < 6) c -= 87;
+    else return 0;
+    *value = *value << 4 | c;
+  }
+
+  return 1;
+}
+
+enum punycode_status punycode_frame_encode(
+  size_t input_length,
+  const punycode_uint input[],
+  size_t block_length,
+  size_t *output_length,
+  char output[] )
+{
+  size_t first, count, out, max_out, payload;
+  enum punycode_status status;
+
+  if (block_length == 0) block_length = punycode_frame_block_length;
+  if (block_length > max_field) return punycode_overflow;
+
+  out = 0;
+  max_out = *output_length;
+
+  for (first = 0;  first < input_length;  first += count) {
+    count = input_length - first;
+    if (count > block_length) count = block_length;
+
+    if (max_out - out < punycode_frame_header_length) {
+      return punycode_big_output;
+    }
+
+    payload = max_out - out - punycode_frame_header_length;
+    status = punycode_encode_wide(count, input + first, &payload,
+               output + out + punycode_frame_header_length);
+    if (status != punycode_success) return status;
+    if (payload > max_field) return punycode_overflow;
+
+    put_field((unsigned long) payload, output + out);
+    put_field((unsigned long) count, output + out + field_digits);
+    out += punycode_frame_header_length + payload;
+  }
+
+  *output_length = out;
+  return punycode_success;
+}
+
+enum punycode_status punycode_frame_next(
+  size_t input_length,
+  const char input[],
+  struct punycode_frame_block *block )
+{
+  size_t at = block->offset + block->length, length, count;
+
+  block->first += block->count;
+  block->count = 0;
+
+  if (at == input_length) {
+    block->offset = at;
+    block->length = 0;
+    return punycode_success;
+  }
+
+  if (input_length - at < punycode_frame_header_length ||
+      !get_field(input + at, &length) ||
+      !get_field(input + at + field_digits, &count) ||
+      count == 0 ||
+      length > input_length - at - punycode_frame_header_length) {
+    return punycode_bad_input;
+  }
+
+  block->offset = at + punycode_frame_header_length;
+  block->length = length;
+  block->count = count;
+  return punycode_success;
+}
+
+enum punycode_status punycode_frame_seek(
+  size_t input_length,
+  const char input[],
+  size_t code_point,
+  struct punycode_frame_block *block )
+{
+  enum punycode_status status;
+
+  block->offset = block->length = block->first = block->count = 0;
+
+  do {
+    status = punycode_frame_next(input_length, input, block);
+    if (status != punycode_success) return status;
+    if (block->count == 0) return punycode_bad_input;
+  } while (code_point - block->first >= block->count);
+
+  return punycode_success;
+}
+
+enum punycode_status punycode_frame_decode_block(
+  const char input[],
+  const struct punycode_frame_block *block,
+  punycode_uint output[] )
+{
+  size_t count = block->count;
+  enum punycode_status status;
+
+  status = punycode_decode_wide(block->length, input + block->offset,
+                                &count, output + block->first);
+
+  /* A payload decoding to more code points fails for lack of */
+  /* room, which is the header's fault rather than the output's: */
+
+  if (status == punycode_big_output) return punycode_bad_input;
+  if (status != punycode_success) return status;
+  return count == block->count ? punycode_success : punycode_bad_input;
+}
+
+enum punycode_status punycode_frame_decode(
+  size_t input_length,
+  const char input[],
+  size_t *output_length,
+  punycode_uint output[] )
+{
+  struct punycode_frame_block block;
+  enum punycode_status status;
+
+  block.offset = block.length = block.first = block.count = 0;
+
+  for (;;) {
+    status = punycode_frame_next(input_length, input, &block);
+    if (status != punycode_success) return status;
+    if (block.count == 0) break;
+    if (block.count > *output_length - block.first) {
+      return punycode_big_output;
+    }
+
+    status = punycode_frame_decode_block(input, &block, output);
+    if (status != punycode_success) return status;
+  }
+
+  *output_length = block.first;
+  return punycode_success;
+}
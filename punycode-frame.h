@@ -0,0 +1,123 @@
+/*
+punycode-frame.h
+
+This is ANSI C code (C89) for a framed format that splits a long
+sequence of code points into blocks, each encoded independently with
+punycode_encode_wide() behind a fixed-size header.  Encoding then
+takes time linear in the input, however long it is, blocks can be
+decoded in parallel, and a reader can skip to the block holding a
+given code point by reading the headers alone.  The implementation is
+in punycode-frame.c.
+
+A framed string is a sequence of blocks, each made of:
+
+    the payload length in chars, as 8 lowercase hexadecimal digits,
+    the number of code points in the block, likewise,
+    the payload, which is the Punycode encoding of those code points.
+
+An empty input has no blocks.  Blocks are never empty.
+
+*/
+
+#ifndef PUNYCODE_FRAME_H
+#define PUNYCODE_FRAME_H
+
+#include "punycode.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum {
+  punycode_frame_header_length = 16,   /* chars before each payload     */
+  punycode_frame_block_length = 1024   /* code points per block, unless */
+                                       /* the caller asks otherwise     */
+};
+
+/* A block found by punycode_frame_next() or punycode_frame_seek(): */
+
+struct punycode_frame_block {
+  size_t offset;  /* index of the payload in the framed string   */
+  size_t length;  /* length of the payload in chars              */
+  size_t first;   /* index of its first code point in the output */
+  size_t count;   /* number of code points in the block          */
+};
+
+enum punycode_status punycode_frame_encode(
+  size_t,                 /* input_length  */
+  const punycode_uint [], /* input         */
+  size_t,                 /* block_length  */
+  size_t *,               /* output_length */
+  char []                 /* output        */
+);
+
+/*
+    punycode_frame_encode() splits the input into blocks of
+    block_length code points (the last may be shorter), or of
+    punycode_frame_block_length if block_length is zero, and writes the
+    framed string to the output.  *output_length is as for
+    punycode_encode().  Returns punycode_overflow if block_length or a
+    payload does not fit in 8 hexadecimal digits, punycode_big_output
+    if the output is too small.
+*/
+
+enum punycode_status punycode_frame_decode(
+  size_t,           /* input_length  */
+  const char [],    /* input         */
+  size_t *,         /* output_length */
+  punycode_uint []  /* output        */
+);
+
+/*
+    punycode_frame_decode() decodes a whole framed string, with
+    *output_length as for punycode_decode().  Returns
+    punycode_bad_input if a header is malformed or a payload does not
+    decode to the number of code points its header gives, and
+    punycode_big_output if the output is too small for the total.
+*/
+
+enum punycode_status punycode_frame_next(
+  size_t,                         /* input_length */
+  const char [],                  /* input        */
+  struct punycode_frame_block *   /* block        */
+);
+
+enum punycode_status punycode_frame_seek(
+  size_t,                         /* input_length */
+  const char [],                  /* input        */
+  size_t,                         /* code_point   */
+  struct punycode_frame_block *   /* block        */
+);
+
+enum punycode_status punycode_frame_decode_block(
+  const char [],                         /* input  */
+  const struct punycode_frame_block *,   /* block  */
+  punycode_uint []                       /* output */
+);
+
+/*
+    These give access to single blocks without decoding the others.
+
+    punycode_frame_next() reads the header of the block following
+    *block and overwrites *block with it.  To find the first block,
+    *block is zeroed.  At the end of the input it returns
+    punycode_success with block->count zero.
+
+    punycode_frame_seek() reads the headers from the start, stopping
+    at the block that holds the given code point index, and returns
+    punycode_bad_input if there is none.
+
+    punycode_frame_decode_block() decodes one block found by either
+    function into output[block->first] through
+    output[block->first + block->count - 1], so different blocks can
+    be decoded by different threads into one output array.
+
+    All three return punycode_bad_input for a malformed header or
+    block.
+*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PUNYCODE_FRAME_H */
@@ -0,0 +1,345 @@
+/*
+punycode-idna.c
+
+This is ANSI C code (C89) implementing the host name conversions
+declared in punycode-idna.h on top of punycode.c.  The cached versions
+are in punycode-cached.c, which passes the cache in through
+punycode-lookup.h.
+
+*/
+
+#include <string.h>
+
+#include "punycode-cache.h"
+#include "punycode-lookup.h"
+
+enum {
+  ace_prefix_length = 4,
+  max_code_points = punycode_label_max_length - ace_prefix_length
+};
+
+/* An encoded label is at least as long as the code points it */
+/* encodes, so a label of more than max_code_points code      */
+/* points, or four times as many UTF-8 bytes, can never fit.  */
+
+/* ace_prefix(s,n) tests whether the n chars at s begin with */
+/* the ACE prefix "xn--" in any case:                        */
+
+#define ace_prefix(s,n) ((n) >= ace_prefix_length && \
+  ((s)[0] | 0x20) == 'x' && ((s)[1] | 0x20) == 'n' && \
+  (s)[2] == '-' && (s)[3] == '-')
+
+/* lower(c) forces an ASCII letter to lowercase: */
+
+#define lower(c) ((unsigned char) (c) - 65u < 26 ? (c) | 0x20 : (c))
+
+/*** Splitting ***/
+
+/* split() finds the label beginning at input[begin] and returns its */
+/* end, setting *next to the beginning of the following label, or to */
+/* input_length+1 if there is none, and *ascii to whether the label  */
+/* is all ASCII.  The separators U+3002, U+FF0E and U+FF61 are three */
+/* bytes long in UTF-8.                                              */
+
+static size_t split(size_t input_length, const char input[],
+                    size_t begin, size_t *next, int *ascii)
+{
+  const unsigned char *s = (const unsigned char *) input;
+  size_t j;
+
+  *ascii = 1;
+
+  for (j = begin;  j < input_length;  ++j) {
+    if (s[j] == '.') {
+      *next = j + 1;
+      return j;
+    }
+
+    if (s[j] >= 0x80) {
+      if (j + 2 < input_length &&
+          ((s[j] == 0xE3 && s[j + 1] == 0x80 && s[j + 2] == 0x82) ||
+           (s[j] == 0xEF && s[j + 1] == 0xBC && s[j + 2] == 0x8E) ||
+           (s[j] == 0xEF && s[j + 1] == 0xBD && s[j + 2] == 0xA1))) {
+        *next = j + 3;
+        return j;
+      }
+
+      *ascii = 0;
+    }
+  }
+
+  *next = input_length + 1;
+  return input_length;
+}
+
+/* valid_utf8() tests whether the n bytes at s are well-formed  */
+/* UTF-8, by the rules of punycode_encode_utf8():  every code    */
+/* point in its shortest form and a Unicode scalar value.        */
+
+static int valid_utf8(size_t n, const char s[])
+{
+  static const unsigned long min[5] = { 0, 0, 0x80, 0x800, 0x10000 };
+  const unsigned char *u = (const unsigned char *) s;
+  size_t j, k, length;
+  unsigned long cp;
+
+  for (j = 0;  j < n;  j += length) {
+    if (u[j] < 0x80) {
+      length = 1;
+      continue;
+    }
+
+    if (u[j] < 0xC2 || u[j] > 0xF4) return 0;
+    length = u[j] < 0xE0 ? 2 : u[j] < 0xF0 ? 3 : 4;
+    if (n - j < length) return 0;
+    cp = u[j] & (0x7F >> length);
+
+    for (k = 1;  k < length;  ++k) {
+      if ((u[j + k] & 0xC0) != 0x80) return 0;
+      cp = cp << 6 | (u[j + k] & 0x3F);
+    }
+
+    if (cp < min[length] || cp > 0x10FFFF) return 0;
+    if (cp >= 0xD800 && cp <= 0xDFFF) return 0;
+  }
+
+  return 1;
+}
+
+/*** Label conversions ***/
+
+static enum punycode_status label_to_ascii(
+  size_t length, const char label[], struct punycode_slice *slice,
+  size_t max_scratch, size_t *scratch_used, char scratch[] )
+{
+  size_t room, output_length;
+  char *output;
+  enum punycode_status status;
+
+  if (ace_prefix(label, length)) return punycode_bad_input;
+  if (length > 4 * max_code_points) return punycode_bad_input;
+
+  room = max_scratch - *scratch_used;
+  if (room < ace_prefix_length) return punycode_big_output;
+  room -= ace_prefix_length;
+  output = scratch + *scratch_used;
+  output_length = room < max_code_points ? room : max_code_points;
+
+  status = punycode_encode_utf8(length, label, &output_length,
+                                output + ace_prefix_length);
+
+  if (status == punycode_big_output && room >= max_code_points) {
+    return punycode_bad_input;
+  }
+
+  if (status != punycode_success) return status;
+
+  memcpy(output, "xn--", ace_prefix_length);
+  slice->data = output;
+  slice->length = ace_prefix_length + output_length;
+  *scratch_used += slice->length;
+  return punycode_success;
+}
+
+static enum punycode_status label_to_unicode(
+  size_t length, const char label[], struct punycode_slice *slice,
+  size_t max_scratch, size_t *scratch_used, char scratch[] )
+{
+  char ace[max_code_points], *output = scratch + *scratch_used;
+  size_t output_length = max_scratch - *scratch_used;
+  size_t ace_length = max_code_points, j;
+  enum punycode_status status;
+
+  status = punycode_decode_utf8(length - ace_prefix_length,
+                                label + ace_prefix_length,
+                                &output_length, output);
+  if (status != punycode_success) return status;
+
+  /* The label must decode to something other than all ASCII, whose */
+  /* encoding gives back the label (apart from letter case).        */
+
+  for (j = 0;  j < output_length;  ++j) {
+    if ((unsigned char) output[j] >= 0x80) break;
+  }
+
+  if (j == output_length) return punycode_bad_input;
+
+  status = punycode_encode_utf8(output_length, output, &ace_length, ace);
+  if (status != punycode_success) return punycode_bad_input;
+  if (ace_length != length - ace_prefix_length) return punycode_bad_input;
+
+  for (j = 0;  j < ace_length;  ++j) {
+    if (lower(ace[j]) != lower(label[ace_prefix_length + j])) {
+      return punycode_bad_input;
+    }
+  }
+
+  slice->data = output;
+  slice->length = output_length;
+  *scratch_used += output_length;
+  return punycode_success;
+}
+
+/* convert_label() converts a label with label_to_ascii() (if     */
+/* encode) or label_to_unicode(), first looking for the result    */
+/* through lookup, if not null, and adding it there afterwards.   */
+/* Only successes are cached, so failures come out just as they   */
+/* would without the cache.                                       */
+
+static enum punycode_status convert_label(
+  const struct punycode_lookup *lookup, int encode,
+  size_t length, const char label[], struct punycode_slice *slice,
+  size_t max_scratch, size_t *scratch_used, char scratch[] )
+{
+  int kind = encode ? punycode_cache_to_ascii : punycode_cache_to_unicode;
+  size_t found = max_scratch - *scratch_used;
+  enum punycode_status status;
+
+  if (lookup != 0 && lookup->find(lookup->cache, kind, length, label,
+                                   &found, scratch + *scratch_used)) {
+    slice->data = scratch + *scratch_used;
+    slice->length = found;
+    *scratch_used += found;
+    return punycode_success;
+  }
+
+  status = (encode ? label_to_ascii : label_to_unicode)(
+             length, label, slice, max_scratch, scratch_used, scratch);
+
+  if (lookup != 0 && status == punycode_success) {
+    lookup->add(lookup->cache, kind, length, label,
+                slice->length, slice->data);
+  }
+
+  return status;
+}
+
+/*** Host name conversions ***/
+
+/* convert() does the splitting shared by both directions and calls */
+/* encode (for punycode_to_ascii()) or decode on the labels that    */
+/* need converting, through lookup if it is not null.               */
+
+static enum punycode_status convert(
+  const struct punycode_lookup *lookup,
+  int encode,
+  size_t input_length,
+  const char input[],
+  size_t *label_count,
+  struct punycode_slice labels[],
+  size_t *scratch_length,
+  char scratch[] )
+{
+  size_t begin, end, next, count = 0, used = 0;
+  int ascii;
+  enum punycode_status status;
+
+  if (input_length == 0) return punycode_bad_input;
+
+  for (begin = 0;  begin <= input_length;  begin = next) {
+    end = split(input_length, input, begin, &next, &ascii);
+
+    if (end == begin && (next <= input_length || count == 0)) {
+      return punycode_bad_input;
+    }
+
+    if (count == *label_count) return punycode_big_output;
+
+    if (ascii && end - begin > punycode_label_max_length) {
+      return punycode_bad_input;
+    }
+
+    if (encode ? !ascii : ascii && ace_prefix(input + begin, end - begin)) {
+      status = convert_label(lookup, encode, end - begin, input + begin,
+                             &labels[count], *scratch_length, &used,
+                             scratch);
+      if (status != punycode_success) return status;
+    }
+    else if (!ascii && !valid_utf8(end - begin, input + begin)) {
+      return punycode_bad_input;
+    }
+    else {
+      labels[count].data = input + begin;
+      labels[count].length = end - begin;
+    }
+
+    ++count;
+  }
+
+  *label_count = count;
+  *scratch_length = used;
+  return punycode_success;
+}
+
+enum punycode_status punycode_to_ascii(
+  size_t input_length,
+  const char input[],
+  size_t *label_count,
+  struct punycode_slice labels[],
+  size_t *scratch_length,
+  char scratch[] )
+{
+  return convert(0, 1, input_length, input, label_count, labels,
+                 scratch_length, scratch);
+}
+
+enum punycode_status punycode_to_unicode(
+  size_t input_length,
+  const char input[],
+  size_t *label_count,
+  struct punycode_slice labels[],
+  size_t *scratch_length,
+  char scratch[] )
+{
+  return convert(0, 0, input_length, input, label_count, labels,
+                 scratch_length, scratch);
+}
+
+enum punycode_status punycode_to_ascii_lookup(
+  const struct punycode_lookup *lookup,
+  size_t input_length,
+  const char input[],
+  size_t *label_count,
+  struct punycode_slice labels[],
+  size_t *scratch_length,
+  char scratch[] )
+{
+  return convert(lookup, 1, input_length, input, label_count, labels,
+                 scratch_length, scratch);
+}
+
+enum punycode_status punycode_to_unicode_lookup(
+  const struct punycode_lookup *lookup,
+  size_t input_length,
+  const char input[],
+  size_t *label_count,
+  struct punycode_slice labels[],
+  size_t *scratch_length,
+  char scratch[] )
+{
+  return convert(lookup, 0, input_length, input, label_count, labels,
+                 scratch_length, scratch);
+}
+
+enum punycode_status punycode_join_labels(
+  size_t label_count,
+  const struct punycode_slice labels[],
+  size_t *output_length,
+  char output[] )
+{
+  size_t j, out = 0, max_out = *output_length;
+
+  for (j = 0;  j < label_count;  ++j) {
+    if (j > 0) {
+      if (out == max_out) return punycode_big_output;
+      output[out++] = '.';
+    }
+
+    if (labels[j].length > max_out - out) return punycode_big_output;
+    memcpy(output + out, labels[j].data, labels[j].length);
+    out += labels[j].length;
+  }
+
+  *output_length = out;
+  return punycode_success;
+}
@@ -0,0 +1,149 @@
+/*
+punycode-idna.h
+
+This is ANSI C code (C89) converting whole host names between UTF-8
+and their ASCII-compatible encoding (ACE), the Punycode part of the
+IDNA ToASCII and ToUnicode operations of RFC 3490.  Nameprep and other
+mappings are not applied; callers needing them should apply them
+first.  The implementation is in punycode-idna.c.
+
+*/
+
+#ifndef PUNYCODE_IDNA_H
+#define PUNYCODE_IDNA_H
+
+#include "punycode.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* A label of a converted host name, pointing either into the */
+/* input (for a label that needed no change) or into scratch: */
+
+struct punycode_slice {
+  const char *data;
+  size_t length;
+};
+
+enum {
+  punycode_label_max_length = 63  /* octets, excluding separators */
+};
+
+enum punycode_status punycode_to_ascii(
+  size_t,                  /* input_length   */
+  const char [],           /* input          */
+  size_t *,                /* label_count    */
+  struct punycode_slice [],/* labels         */
+  size_t *,                /* scratch_length */
+  char []                  /* scratch        */
+);
+
+enum punycode_status punycode_to_unicode(
+  size_t,                  /* input_length   */
+  const char [],           /* input          */
+  size_t *,                /* label_count    */
+  struct punycode_slice [],/* labels         */
+  size_t *,                /* scratch_length */
+  char []                  /* scratch        */
+);
+
+/*
+    punycode_to_ascii() splits a UTF-8 host name into labels and
+    converts every label containing non-ASCII characters to "xn--"
+    followed by its Punycode encoding.  punycode_to_unicode() converts
+    every label beginning with "xn--" (in any case) back to UTF-8.
+
+    Input arguments:
+
+        input_length, input
+            The host name.  Labels are separated by full stops, which
+            may be U+002E, U+3002, U+FF0E or U+FF61.  A single trailing
+            separator is allowed; other empty labels are invalid.
+
+    Output arguments:
+
+        labels
+            The labels of the converted host name, without separators.
+            A label that needs no conversion points into the input,
+            so it is not copied; the others point into scratch.  A
+            trailing separator produces a final empty label.
+
+    Input/output arguments:
+
+        label_count
+            The caller passes in the number of elements of labels, and
+            on successful return it contains the number used.
+
+        scratch_length, scratch
+            The caller passes in space for the converted labels, and on
+            successful return *scratch_length contains the number of
+            chars used.  It is zero if no label needed conversion, in
+            which case the joined labels equal the input unless it
+            contains separators other than U+002E.
+
+    Return value:
+
+        punycode_bad_input if the input is empty or not valid UTF-8,
+        including in labels that need no conversion, if a label is
+        empty or longer than punycode_label_max_length octets once
+        converted, if a label to be encoded already begins with "xn--",
+        or if a label to be decoded is not the canonical encoding of a
+        sequence of Unicode scalar values.  punycode_big_output if
+        labels or scratch is too small.  If not punycode_success, the
+        outputs might contain garbage.
+*/
+
+struct punycode_cache;
+
+enum punycode_status punycode_to_ascii_cached(
+  struct punycode_cache *, /* cache          */
+  size_t,                  /* input_length   */
+  const char [],           /* input          */
+  size_t *,                /* label_count    */
+  struct punycode_slice [],/* labels         */
+  size_t *,                /* scratch_length */
+  char []                  /* scratch        */
+);
+
+enum punycode_status punycode_to_unicode_cached(
+  struct punycode_cache *, /* cache          */
+  size_t,                  /* input_length   */
+  const char [],           /* input          */
+  size_t *,                /* label_count    */
+  struct punycode_slice [],/* labels         */
+  size_t *,                /* scratch_length */
+  char []                  /* scratch        */
+);
+
+/*
+    punycode_to_ascii_cached() and punycode_to_unicode_cached() are
+    punycode_to_ascii() and punycode_to_unicode() looking up each label
+    that needs converting in a cache created by punycode_cache_create()
+    (see punycode-cache.h) and adding the ones they convert.  Their
+    outputs are exactly those of the uncached functions.  A cache may
+    be shared by any number of threads, and a null cache is allowed.
+    They are in punycode-cached.c and need punycode-cache.c, which the
+    uncached functions do not.
+*/
+
+enum punycode_status punycode_join_labels(
+  size_t,                        /* label_count   */
+  const struct punycode_slice [],/* labels        */
+  size_t *,                      /* output_length */
+  char []                        /* output        */
+);
+
+/*
+    punycode_join_labels() copies the labels to the output separated
+    by U+002E, for callers that need the host name in one piece.  The
+    caller passes in the size of the output in *output_length, which
+    receives the number of chars used.  Returns punycode_big_output if
+    the output is too small.
+*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PUNYCODE_IDNA_H */
@@ -0,0 +1,159 @@
+/*
+punycode-jis-tables.js
+
+This is JavaScript for Node.js generating the tables of punycode-jis.c
+from JCT11280 in ecl_array.js.  It loads ecl_array.js, derives every
+table from JCT11280 as EscapeSJIS() and EscapeEUCJP() search it, and
+writes the whole "Tables" section of punycode-jis.c, from its heading
+to the end of nec_index[], on stdout.  To regenerate the tables,
+replace that section with the output:
+
+    node punycode-jis-tables.js [ecl_array.js] > tables.c
+
+*/
+
+"use strict";
+var fs = require("fs");
+var path = require("path");
+var vm = require("vm");
+
+var file = process.argv[2] || path.join(__dirname, "ecl_array.js");
+vm.runInThisContext(fs.readFileSync(file, "utf8"), {filename: file});
+
+var JCT11280 = ECL.JCT11280, JCT8836 = ECL.JCT8836;
+var sjis_codes = JCT11280.length, jis_codes = JCT8836.length;
+var middle_dot = JCT11280.indexOf("・");
+var nec_first = 8272;   /* row 89, where the NEC selection begins */
+
+/* The index EscapeSJIS() writes for a character:  its first one, */
+/* unless that is in the NEC selection, which gives way to the    */
+/* IBM extensions.                                                */
+
+var sjis_index = function(s) {
+	var c = JCT11280.indexOf(s);
+	return c < nec_first ? c : JCT11280.lastIndexOf(s);
+};
+
+/* nec_twin() is the index EscapeEUCJP() writes for the IBM       */
+/* extension at index j, if that is in the NEC selection, since   */
+/* only then does Shift_JIS use the IBM code; otherwise it is -1. */
+
+var nec_twin = function(j) {
+	var c = JCT8836.indexOf(JCT11280.charAt(j));
+	return c >= nec_first ? c : -1;
+};
+
+var ibm_first = -1, ibm_last = -1, j;
+for (j = jis_codes;  j < sjis_codes;  j++) {
+	if (nec_twin(j) >= 0) {
+		if (ibm_first < 0) {ibm_first = j;}
+		ibm_last = j;
+	}
+}
+
+/* index_of[] has a page of 256 code points for each high byte */
+/* that has any, and page 0 for all the others:                */
+
+var pages = [[]], index_page = [], page, c, hi;
+for (j = 0;  j < 256;  j++) {index_page.push(0);}
+for (j = 0;  j < 256;  j++) {pages[0].push(0);}
+
+for (hi = 0;  hi < 256;  hi++) {
+	page = [];
+	for (j = 0;  j < 256;  j++) {
+		c = String.fromCharCode(hi << 8 | j);
+		page.push(JCT11280.indexOf(c) < 0 ? 0 : sjis_index(c) + 1);
+	}
+	if (page.some(function(x) {return x !== 0;})) {
+		index_page[hi] = pages.length;
+		pages.push(page);
+	}
+}
+
+var nec_index = [];
+for (j = ibm_first;  j <= ibm_last;  j++) {
+	nec_index.push(nec_twin(j) + 1);
+}
+
+/* rows() lays out numbers as punycode-jis.c does: */
+
+var rows = function(values, per_row, indent, format, separator) {
+	var lines = [], k;
+	for (k = 0;  k < values.length;  k += per_row) {
+		lines.push(indent + values.slice(k, k + per_row).map(format)
+		                          .join(separator));
+	}
+	return lines.join(separator.replace(/ +$/, "") + "\n");
+};
+
+var pad = function(width) {
+	return function(x) {
+		var s = String(x);
+		while (s.length < width) {s = " " + s;}
+		return s;
+	};
+};
+
+var hex = function(x) {
+	var s = x.toString(16).toUpperCase();
+	while (s.length < 4) {s = "0" + s;}
+	return "0x" + s;
+};
+
+var codes = [];
+for (j = 0;  j < sjis_codes;  j++) {codes.push(JCT11280.charCodeAt(j));}
+
+var out = [];
+out.push(
+"/*** Tables ***/",
+"",
+"/* The tables are generated by punycode-jis-tables.js from JCT11280 */",
+"/* in ecl_array.js.  A double-byte code has an index, as in         */",
+"/* ecl_array.js:  188 * lead + trail in Shift_JIS, with both bytes  */",
+"/* counted from the first valid one, and 94 * row + cell in JIS X   */",
+"/* 0208, which amounts to the same for the first 8836 indices.      */",
+"/* jct[] holds the code point of each index, U+30FB where the code  */",
+"/* is unassigned.                                                   */",
+"",
+"enum {",
+"  sjis_codes = " + sjis_codes + ",       /* indices of Shift_JIS codes            */",
+"  jis_codes = " + jis_codes + ",         /* indices of JIS X 0208 and EUC-JP ones */",
+"  ibm_first = " + ibm_first + ",        /* the IBM extensions with an NEC twin   */",
+"  ibm_codes = " + (ibm_last - ibm_first + 1) + ",",
+"  middle_dot = " + middle_dot + "            /* the index of U+30FB                   */",
+"};",
+"",
+"static const unsigned short jct[sjis_codes] = {",
+rows(codes, 8, "  ", hex, ", "),
+"};",
+"",
+"/* index_of[index_page[c >> 8]][c & 0xFF] is one more than the index */",
+"/* Shift_JIS uses for code point c, or zero if c has none.  Where    */",
+"/* it is an IBM extension from ibm_first on, one more than the       */",
+"/* index of its twin among JIS X 0208 codes (in the NEC selection of */",
+"/* the extensions) is nec_index[index - ibm_first], if there is one. */",
+"",
+"static const unsigned char index_page[256] = {",
+rows(index_page, 16, "  ", pad(3), ","),
+"};",
+"",
+"static const unsigned short index_of[" + pages.length + "][256] = {"
+);
+
+pages.forEach(function(p, k) {
+	var hi = index_page.indexOf(k);
+	out.push("  { /* " + (k === 0 ? "none" :
+	         "U+" + hex(hi).substring(4) + "xx") + " */",
+	         rows(p, 8, "    ", pad(5), ","),
+	         k + 1 < pages.length ? "  }," : "  }");
+});
+
+out.push(
+"};",
+"",
+"static const unsigned short nec_index[ibm_codes] = {",
+rows(nec_index, 8, "  ", pad(5), ","),
+"};"
+);
+
+process.stdout.write(out.join("\n") + "\n");
@@ -0,0 +1,5530 @@
+/*
+punycode-jis.c
+
+This is ANSI C code (C89) implementing the conversions declared in
+punycode-jis.h, on top of punycode-idna.c for punycode_jis_to_ascii().
+
+*/
+
+#include <string.h>
+
+#include "punycode-jis.h"
+
+/*** Tables ***/
+
+/* The tables are generated by punycode-jis-tables.js from JCT11280 */
+/* in ecl_array.js.  A double-byte code has an index, as in         */
+/* ecl_array.js:  188 * lead + trail in Shift_JIS, with both bytes  */
+/* counted from the first valid one, and 94 * row + cell in JIS X   */
+/* 0208, which amounts to the same for the first 8836 indices.      */
+/* jct[] holds the code point of each index, U+30FB where the code  */
+/* is unassigned.                                                   */
+
+enum {
+  sjis_codes = 11280,       /* indices of Shift_JIS codes            */
+  jis_codes = 8836,         /* indices of JIS X 0208 and EUC-JP ones */
+  ibm_first = 10716,        /* the IBM extensions with an NEC twin   */
+  ibm_codes = 388,
+  middle_dot = 5            /* the index of U+30FB                   */
+};
+
+static const unsigned short jct[sjis_codes] = {
+  0x3000, 0x3001, 0x3002, 0xFF0C, 0xFF0E, 0x30FB, 0xFF1A, 0xFF1B,
+  0xFF1F, 0xFF01, 0x309B, 0x309C, 0x00B4, 0xFF40, 0x00A8, 0xFF3E,
+  0xFFE3, 0xFF3F, 0x30FD, 0x30FE, 0x309D, 0x309E, 0x3003, 0x4EDD,
+  0x3005, 0x3006, 0x3007, 0x30FC, 0x2015, 0x2010, 0xFF0F, 0xFF3C,
+  0xFF5E, 0x2225, 0xFF5C, 0x2026, 0x2025, 0x2018, 0x2019, 0x201C,
+  0x201D, 0xFF08, 0xFF09, 0x3014, 0x3015, 0xFF3B, 0xFF3D, 0xFF5B,
+  0xFF5D, 0x3008, 0x3009, 0x300A, 0x300B, 0x300C, 0x300D, 0x300E,
+  0x300F, 0x3010, 0x3011, 0xFF0B, 0xFF0D, 0x00B1, 0x00D7, 0x00F7,
+  0xFF1D, 0x2260, 0xFF1C, 0xFF1E, 0x2266, 0x2267, 0x221E, 0x2234,
+  0x2642, 0x2640, 0x00B0, 0x2032, 0x2033, 0x2103, 0xFFE5, 0xFF04,
+  0xFFE0, 0xFFE1, 0xFF05, 0xFF03, 0xFF06, 0xFF0A, 0xFF20, 0x00A7,
+  0x2606, 0x2605, 0x25CB, 0x25CF, 0x25CE, 0x25C7, 0x25C6, 0x25A1,
+  0x25A0, 0x25B3, 0x25B2, 0x25BD, 0x25BC, 0x203B, 0x3012, 0x2192,
+  0x2190, 0x2191, 0x2193, 0x3013, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x2208,
+  0x220B, 0x2286, 0x2287, 0x2282, 0x2283, 0x222A, 0x2229, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x2227,
+  0x2228, 0xFFE2, 0x21D2, 0x21D4, 0x2200, 0x2203, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x2220, 0x22A5, 0x2312, 0x2202, 0x2207, 0x2261, 0x2252,
+  0x226A, 0x226B, 0x221A, 0x223D, 0x221D, 0x2235, 0x222B, 0x222C,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x212B,
+  0x2030, 0x266F, 0x266D, 0x266A, 0x2020, 0x2021, 0x00B6, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x25EF, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0xFF10, 0xFF11, 0xFF12, 0xFF13, 0xFF14,
+  0xFF15, 0xFF16, 0xFF17, 0xFF18, 0xFF19, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0xFF21, 0xFF22, 0xFF23, 0xFF24,
+  0xFF25, 0xFF26, 0xFF27, 0xFF28, 0xFF29, 0xFF2A, 0xFF2B, 0xFF2C,
+  0xFF2D, 0xFF2E, 0xFF2F, 0xFF30, 0xFF31, 0xFF32, 0xFF33, 0xFF34,
+  0xFF35, 0xFF36, 0xFF37, 0xFF38, 0xFF39, 0xFF3A, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0xFF41, 0xFF42, 0xFF43, 0xFF44,
+  0xFF45, 0xFF46, 0xFF47, 0xFF48, 0xFF49, 0xFF4A, 0xFF4B, 0xFF4C,
+  0xFF4D, 0xFF4E, 0xFF4F, 0xFF50, 0xFF51, 0xFF52, 0xFF53, 0xFF54,
+  0xFF55, 0xFF56, 0xFF57, 0xFF58, 0xFF59, 0xFF5A, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x3041, 0x3042, 0x3043, 0x3044, 0x3045, 0x3046,
+  0x3047, 0x3048, 0x3049, 0x304A, 0x304B, 0x304C, 0x304D, 0x304E,
+  0x304F, 0x3050, 0x3051, 0x3052, 0x3053, 0x3054, 0x3055, 0x3056,
+  0x3057, 0x3058, 0x3059, 0x305A, 0x305B, 0x305C, 0x305D, 0x305E,
+  0x305F, 0x3060, 0x3061, 0x3062, 0x3063, 0x3064, 0x3065, 0x3066,
+  0x3067, 0x3068, 0x3069, 0x306A, 0x306B, 0x306C, 0x306D, 0x306E,
+  0x306F, 0x3070, 0x3071, 0x3072, 0x3073, 0x3074, 0x3075, 0x3076,
+  0x3077, 0x3078, 0x3079, 0x307A, 0x307B, 0x307C, 0x307D, 0x307E,
+  0x307F, 0x3080, 0x3081, 0x3082, 0x3083, 0x3084, 0x3085, 0x3086,
+  0x3087, 0x3088, 0x3089, 0x308A, 0x308B, 0x308C, 0x308D, 0x308E,
+  0x308F, 0x3090, 0x3091, 0x3092, 0x3093, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30A1, 0x30A2, 0x30A3, 0x30A4, 0x30A5, 0x30A6, 0x30A7, 0x30A8,
+  0x30A9, 0x30AA, 0x30AB, 0x30AC, 0x30AD, 0x30AE, 0x30AF, 0x30B0,
+  0x30B1, 0x30B2, 0x30B3, 0x30B4, 0x30B5, 0x30B6, 0x30B7, 0x30B8,
+  0x30B9, 0x30BA, 0x30BB, 0x30BC, 0x30BD, 0x30BE, 0x30BF, 0x30C0,
+  0x30C1, 0x30C2, 0x30C3, 0x30C4, 0x30C5, 0x30C6, 0x30C7, 0x30C8,
+  0x30C9, 0x30CA, 0x30CB, 0x30CC, 0x30CD, 0x30CE, 0x30CF, 0x30D0,
+  0x30D1, 0x30D2, 0x30D3, 0x30D4, 0x30D5, 0x30D6, 0x30D7, 0x30D8,
+  0x30D9, 0x30DA, 0x30DB, 0x30DC, 0x30DD, 0x30DE, 0x30DF, 0x30E0,
+  0x30E1, 0x30E2, 0x30E3, 0x30E4, 0x30E5, 0x30E6, 0x30E7, 0x30E8,
+  0x30E9, 0x30EA, 0x30EB, 0x30EC, 0x30ED, 0x30EE, 0x30EF, 0x30F0,
+  0x30F1, 0x30F2, 0x30F3, 0x30F4, 0x30F5, 0x30F6, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x0391, 0x0392,
+  0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x0398, 0x0399, 0x039A,
+  0x039B, 0x039C, 0x039D, 0x039E, 0x039F, 0x03A0, 0x03A1, 0x03A3,
+  0x03A4, 0x03A5, 0x03A6, 0x03A7, 0x03A8, 0x03A9, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x03B1, 0x03B2,
+  0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7, 0x03B8, 0x03B9, 0x03BA,
+  0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF, 0x03C0, 0x03C1, 0x03C3,
+  0x03C4, 0x03C5, 0x03C6, 0x03C7, 0x03C8, 0x03C9, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x0410, 0x0411, 0x0412, 0x0413,
+  0x0414, 0x0415, 0x0401, 0x0416, 0x0417, 0x0418, 0x0419, 0x041A,
+  0x041B, 0x041C, 0x041D, 0x041E, 0x041F, 0x0420, 0x0421, 0x0422,
+  0x0423, 0x0424, 0x0425, 0x0426, 0x0427, 0x0428, 0x0429, 0x042A,
+  0x042B, 0x042C, 0x042D, 0x042E, 0x042F, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x0430, 0x0431, 0x0432, 0x0433,
+  0x0434, 0x0435, 0x0451, 0x0436, 0x0437, 0x0438, 0x0439, 0x043A,
+  0x043B, 0x043C, 0x043D, 0x043E, 0x043F, 0x0440, 0x0441, 0x0442,
+  0x0443, 0x0444, 0x0445, 0x0446, 0x0447, 0x0448, 0x0449, 0x044A,
+  0x044B, 0x044C, 0x044D, 0x044E, 0x044F, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x2500, 0x2502, 0x250C, 0x2510, 0x2518, 0x2514,
+  0x251C, 0x252C, 0x2524, 0x2534, 0x253C, 0x2501, 0x2503, 0x250F,
+  0x2513, 0x251B, 0x2517, 0x2523, 0x2533, 0x252B, 0x253B, 0x254B,
+  0x2520, 0x252F, 0x2528, 0x2537, 0x253F, 0x251D, 0x2530, 0x2525,
+  0x2538, 0x2542, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x2460, 0x2461, 0x2462, 0x2463, 0x2464, 0x2465, 0x2466, 0x2467,
+  0x2468, 0x2469, 0x246A, 0x246B, 0x246C, 0x246D, 0x246E, 0x246F,
+  0x2470, 0x2471, 0x2472, 0x2473, 0x2160, 0x2161, 0x2162, 0x2163,
+  0x2164, 0x2165, 0x2166, 0x2167, 0x2168, 0x2169, 0x30FB, 0x3349,
+  0x3314, 0x3322, 0x334D, 0x3318, 0x3327, 0x3303, 0x3336, 0x3351,
+  0x3357, 0x330D, 0x3326, 0x3323, 0x332B, 0x334A, 0x333B, 0x339C,
+  0x339D, 0x339E, 0x338E, 0x338F, 0x33C4, 0x33A1, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x337B, 0x301D,
+  0x301F, 0x2116, 0x33CD, 0x2121, 0x32A4, 0x32A5, 0x32A6, 0x32A7,
+  0x32A8, 0x3231, 0x3232, 0x3239, 0x337E, 0x337D, 0x337C, 0x2252,
+  0x2261, 0x222B, 0x222E, 0x2211, 0x221A, 0x22A5, 0x2220, 0x221F,
+  0x22BF, 0x2235, 0x2229, 0x222A, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x4E9C, 0x5516, 0x5A03, 0x963F, 0x54C0, 0x611B,
+  0x6328, 0x59F6, 0x9022, 0x8475, 0x831C, 0x7A50, 0x60AA, 0x63E1,
+  0x6E25, 0x65ED, 0x8466, 0x82A6, 0x9BF5, 0x6893, 0x5727, 0x65A1,
+  0x6271, 0x5B9B, 0x59D0, 0x867B, 0x98F4, 0x7D62, 0x7DBE, 0x9B8E,
+  0x6216, 0x7C9F, 0x88B7, 0x5B89, 0x5EB5, 0x6309, 0x6697, 0x6848,
+  0x95C7, 0x978D, 0x674F, 0x4EE5, 0x4F0A, 0x4F4D, 0x4F9D, 0x5049,
+  0x56F2, 0x5937, 0x59D4, 0x5A01, 0x5C09, 0x60DF, 0x610F, 0x6170,
+  0x6613, 0x6905, 0x70BA, 0x754F, 0x7570, 0x79FB, 0x7DAD, 0x7DEF,
+  0x80C3, 0x840E, 0x8863, 0x8B02, 0x9055, 0x907A, 0x533B, 0x4E95,
+  0x4EA5, 0x57DF, 0x80B2, 0x90C1, 0x78EF, 0x4E00, 0x58F1, 0x6EA2,
+  0x9038, 0x7A32, 0x8328, 0x828B, 0x9C2F, 0x5141, 0x5370, 0x54BD,
+  0x54E1, 0x56E0, 0x59FB, 0x5F15, 0x98F2, 0x6DEB, 0x80E4, 0x852D,
+  0x9662, 0x9670, 0x96A0, 0x97FB, 0x540B, 0x53F3, 0x5B87, 0x70CF,
+  0x7FBD, 0x8FC2, 0x96E8, 0x536F, 0x9D5C, 0x7ABA, 0x4E11, 0x7893,
+  0x81FC, 0x6E26, 0x5618, 0x5504, 0x6B1D, 0x851A, 0x9C3B, 0x59E5,
+  0x53A9, 0x6D66, 0x74DC, 0x958F, 0x5642, 0x4E91, 0x904B, 0x96F2,
+  0x834F, 0x990C, 0x53E1, 0x55B6, 0x5B30, 0x5F71, 0x6620, 0x66F3,
+  0x6804, 0x6C38, 0x6CF3, 0x6D29, 0x745B, 0x76C8, 0x7A4E, 0x9834,
+  0x82F1, 0x885B, 0x8A60, 0x92ED, 0x6DB2, 0x75AB, 0x76CA, 0x99C5,
+  0x60A6, 0x8B01, 0x8D8A, 0x95B2, 0x698E, 0x53AD, 0x5186, 0x5712,
+  0x5830, 0x5944, 0x5BB4, 0x5EF6, 0x6028, 0x63A9, 0x63F4, 0x6CBF,
+  0x6F14, 0x708E, 0x7114, 0x7159, 0x71D5, 0x733F, 0x7E01, 0x8276,
+  0x82D1, 0x8597, 0x9060, 0x925B, 0x9D1B, 0x5869, 0x65BC, 0x6C5A,
+  0x7525, 0x51F9, 0x592E, 0x5965, 0x5F80, 0x5FDC, 0x62BC, 0x65FA,
+  0x6A2A, 0x6B27, 0x6BB4, 0x738B, 0x7FC1, 0x8956, 0x9D2C, 0x9D0E,
+  0x9EC4, 0x5CA1, 0x6C96, 0x837B, 0x5104, 0x5C4B, 0x61B6, 0x81C6,
+  0x6876, 0x7261, 0x4E59, 0x4FFA, 0x5378, 0x6069, 0x6E29, 0x7A4F,
+  0x97F3, 0x4E0B, 0x5316, 0x4EEE, 0x4F55, 0x4F3D, 0x4FA1, 0x4F73,
+  0x52A0, 0x53EF, 0x5609, 0x590F, 0x5AC1, 0x5BB6, 0x5BE1, 0x79D1,
+  0x6687, 0x679C, 0x67B6, 0x6B4C, 0x6CB3, 0x706B, 0x73C2, 0x798D,
+  0x79BE, 0x7A3C, 0x7B87, 0x82B1, 0x82DB, 0x8304, 0x8377, 0x83EF,
+  0x83D3, 0x8766, 0x8AB2, 0x5629, 0x8CA8, 0x8FE6, 0x904E, 0x971E,
+  0x868A, 0x4FC4, 0x5CE8, 0x6211, 0x7259, 0x753B, 0x81E5, 0x82BD,
+  0x86FE, 0x8CC0, 0x96C5, 0x9913, 0x99D5, 0x4ECB, 0x4F1A, 0x89E3,
+  0x56DE, 0x584A, 0x58CA, 0x5EFB, 0x5FEB, 0x602A, 0x6094, 0x6062,
+  0x61D0, 0x6212, 0x62D0, 0x6539, 0x9B41, 0x6666, 0x68B0, 0x6D77,
+  0x7070, 0x754C, 0x7686, 0x7D75, 0x82A5, 0x87F9, 0x958B, 0x968E,
+  0x8C9D, 0x51F1, 0x52BE, 0x5916, 0x54B3, 0x5BB3, 0x5D16, 0x6168,
+  0x6982, 0x6DAF, 0x788D, 0x84CB, 0x8857, 0x8A72, 0x93A7, 0x9AB8,
+  0x6D6C, 0x99A8, 0x86D9, 0x57A3, 0x67FF, 0x86CE, 0x920E, 0x5283,
+  0x5687, 0x5404, 0x5ED3, 0x62E1, 0x64B9, 0x683C, 0x6838, 0x6BBB,
+  0x7372, 0x78BA, 0x7A6B, 0x899A, 0x89D2, 0x8D6B, 0x8F03, 0x90ED,
+  0x95A3, 0x9694, 0x9769, 0x5B66, 0x5CB3, 0x697D, 0x984D, 0x984E,
+  0x639B, 0x7B20, 0x6A2B, 0x6A7F, 0x68B6, 0x9C0D, 0x6F5F, 0x5272,
+  0x559D, 0x6070, 0x62EC, 0x6D3B, 0x6E07, 0x6ED1, 0x845B, 0x8910,
+  0x8F44, 0x4E14, 0x9C39, 0x53F6, 0x691B, 0x6A3A, 0x9784, 0x682A,
+  0x515C, 0x7AC3, 0x84B2, 0x91DC, 0x938C, 0x565B, 0x9D28, 0x6822,
+  0x8305, 0x8431, 0x7CA5, 0x5208, 0x82C5, 0x74E6, 0x4E7E, 0x4F83,
+  0x51A0, 0x5BD2, 0x520A, 0x52D8, 0x52E7, 0x5DFB, 0x559A, 0x582A,
+  0x59E6, 0x5B8C, 0x5B98, 0x5BDB, 0x5E72, 0x5E79, 0x60A3, 0x611F,
+  0x6163, 0x61BE, 0x63DB, 0x6562, 0x67D1, 0x6853, 0x68FA, 0x6B3E,
+  0x6B53, 0x6C57, 0x6F22, 0x6F97, 0x6F45, 0x74B0, 0x7518, 0x76E3,
+  0x770B, 0x7AFF, 0x7BA1, 0x7C21, 0x7DE9, 0x7F36, 0x7FF0, 0x809D,
+  0x8266, 0x839E, 0x89B3, 0x8ACC, 0x8CAB, 0x9084, 0x9451, 0x9593,
+  0x9591, 0x95A2, 0x9665, 0x97D3, 0x9928, 0x8218, 0x4E38, 0x542B,
+  0x5CB8, 0x5DCC, 0x73A9, 0x764C, 0x773C, 0x5CA9, 0x7FEB, 0x8D0B,
+  0x96C1, 0x9811, 0x9854, 0x9858, 0x4F01, 0x4F0E, 0x5371, 0x559C,
+  0x5668, 0x57FA, 0x5947, 0x5B09, 0x5BC4, 0x5C90, 0x5E0C, 0x5E7E,
+  0x5FCC, 0x63EE, 0x673A, 0x65D7, 0x65E2, 0x671F, 0x68CB, 0x68C4,
+  0x6A5F, 0x5E30, 0x6BC5, 0x6C17, 0x6C7D, 0x757F, 0x7948, 0x5B63,
+  0x7A00, 0x7D00, 0x5FBD, 0x898F, 0x8A18, 0x8CB4, 0x8D77, 0x8ECC,
+  0x8F1D, 0x98E2, 0x9A0E, 0x9B3C, 0x4E80, 0x507D, 0x5100, 0x5993,
+  0x5B9C, 0x622F, 0x6280, 0x64EC, 0x6B3A, 0x72A0, 0x7591, 0x7947,
+  0x7FA9, 0x87FB, 0x8ABC, 0x8B70, 0x63AC, 0x83CA, 0x97A0, 0x5409,
+  0x5403, 0x55AB, 0x6854, 0x6A58, 0x8A70, 0x7827, 0x6775, 0x9ECD,
+  0x5374, 0x5BA2, 0x811A, 0x8650, 0x9006, 0x4E18, 0x4E45, 0x4EC7,
+  0x4F11, 0x53CA, 0x5438, 0x5BAE, 0x5F13, 0x6025, 0x6551, 0x673D,
+  0x6C42, 0x6C72, 0x6CE3, 0x7078, 0x7403, 0x7A76, 0x7AAE, 0x7B08,
+  0x7D1A, 0x7CFE, 0x7D66, 0x65E7, 0x725B, 0x53BB, 0x5C45, 0x5DE8,
+  0x62D2, 0x62E0, 0x6319, 0x6E20, 0x865A, 0x8A31, 0x8DDD, 0x92F8,
+  0x6F01, 0x79A6, 0x9B5A, 0x4EA8, 0x4EAB, 0x4EAC, 0x4F9B, 0x4FA0,
+  0x50D1, 0x5147, 0x7AF6, 0x5171, 0x51F6, 0x5354, 0x5321, 0x537F,
+  0x53EB, 0x55AC, 0x5883, 0x5CE1, 0x5F37, 0x5F4A, 0x602F, 0x6050,
+  0x606D, 0x631F, 0x6559, 0x6A4B, 0x6CC1, 0x72C2, 0x72ED, 0x77EF,
+  0x80F8, 0x8105, 0x8208, 0x854E, 0x90F7, 0x93E1, 0x97FF, 0x9957,
+  0x9A5A, 0x4EF0, 0x51DD, 0x5C2D, 0x6681, 0x696D, 0x5C40, 0x66F2,
+  0x6975, 0x7389, 0x6850, 0x7C81, 0x50C5, 0x52E4, 0x5747, 0x5DFE,
+  0x9326, 0x65A4, 0x6B23, 0x6B3D, 0x7434, 0x7981, 0x79BD, 0x7B4B,
+  0x7DCA, 0x82B9, 0x83CC, 0x887F, 0x895F, 0x8B39, 0x8FD1, 0x91D1,
+  0x541F, 0x9280, 0x4E5D, 0x5036, 0x53E5, 0x533A, 0x72D7, 0x7396,
+  0x77E9, 0x82E6, 0x8EAF, 0x99C6, 0x99C8, 0x99D2, 0x5177, 0x611A,
+  0x865E, 0x55B0, 0x7A7A, 0x5076, 0x5BD3, 0x9047, 0x9685, 0x4E32,
+  0x6ADB, 0x91E7, 0x5C51, 0x5C48, 0x6398, 0x7A9F, 0x6C93, 0x9774,
+  0x8F61, 0x7AAA, 0x718A, 0x9688, 0x7C82, 0x6817, 0x7E70, 0x6851,
+  0x936C, 0x52F2, 0x541B, 0x85AB, 0x8A13, 0x7FA4, 0x8ECD, 0x90E1,
+  0x5366, 0x8888, 0x7941, 0x4FC2, 0x50BE, 0x5211, 0x5144, 0x5553,
+  0x572D, 0x73EA, 0x578B, 0x5951, 0x5F62, 0x5F84, 0x6075, 0x6176,
+  0x6167, 0x61A9, 0x63B2, 0x643A, 0x656C, 0x666F, 0x6842, 0x6E13,
+  0x7566, 0x7A3D, 0x7CFB, 0x7D4C, 0x7D99, 0x7E4B, 0x7F6B, 0x830E,
+  0x834A, 0x86CD, 0x8A08, 0x8A63, 0x8B66, 0x8EFD, 0x981A, 0x9D8F,
+  0x82B8, 0x8FCE, 0x9BE8, 0x5287, 0x621F, 0x6483, 0x6FC0, 0x9699,
+  0x6841, 0x5091, 0x6B20, 0x6C7A, 0x6F54, 0x7A74, 0x7D50, 0x8840,
+  0x8A23, 0x6708, 0x4EF6, 0x5039, 0x5026, 0x5065, 0x517C, 0x5238,
+  0x5263, 0x55A7, 0x570F, 0x5805, 0x5ACC, 0x5EFA, 0x61B2, 0x61F8,
+  0x62F3, 0x6372, 0x691C, 0x6A29, 0x727D, 0x72AC, 0x732E, 0x7814,
+  0x786F, 0x7D79, 0x770C, 0x80A9, 0x898B, 0x8B19, 0x8CE2, 0x8ED2,
+  0x9063, 0x9375, 0x967A, 0x9855, 0x9A13, 0x9E78, 0x5143, 0x539F,
+  0x53B3, 0x5E7B, 0x5F26, 0x6E1B, 0x6E90, 0x7384, 0x73FE, 0x7D43,
+  0x8237, 0x8A00, 0x8AFA, 0x9650, 0x4E4E, 0x500B, 0x53E4, 0x547C,
+  0x56FA, 0x59D1, 0x5B64, 0x5DF1, 0x5EAB, 0x5F27, 0x6238, 0x6545,
+  0x67AF, 0x6E56, 0x72D0, 0x7CCA, 0x88B4, 0x80A1, 0x80E1, 0x83F0,
+  0x864E, 0x8A87, 0x8DE8, 0x9237, 0x96C7, 0x9867, 0x9F13, 0x4E94,
+  0x4E92, 0x4F0D, 0x5348, 0x5449, 0x543E, 0x5A2F, 0x5F8C, 0x5FA1,
+  0x609F, 0x68A7, 0x6A8E, 0x745A, 0x7881, 0x8A9E, 0x8AA4, 0x8B77,
+  0x9190, 0x4E5E, 0x9BC9, 0x4EA4, 0x4F7C, 0x4FAF, 0x5019, 0x5016,
+  0x5149, 0x516C, 0x529F, 0x52B9, 0x52FE, 0x539A, 0x53E3, 0x5411,
+  0x540E, 0x5589, 0x5751, 0x57A2, 0x597D, 0x5B54, 0x5B5D, 0x5B8F,
+  0x5DE5, 0x5DE7, 0x5DF7, 0x5E78, 0x5E83, 0x5E9A, 0x5EB7, 0x5F18,
+  0x6052, 0x614C, 0x6297, 0x62D8, 0x63A7, 0x653B, 0x6602, 0x6643,
+  0x66F4, 0x676D, 0x6821, 0x6897, 0x69CB, 0x6C5F, 0x6D2A, 0x6D69,
+  0x6E2F, 0x6E9D, 0x7532, 0x7687, 0x786C, 0x7A3F, 0x7CE0, 0x7D05,
+  0x7D18, 0x7D5E, 0x7DB1, 0x8015, 0x8003, 0x80AF, 0x80B1, 0x8154,
+  0x818F, 0x822A, 0x8352, 0x884C, 0x8861, 0x8B1B, 0x8CA2, 0x8CFC,
+  0x90CA, 0x9175, 0x9271, 0x783F, 0x92FC, 0x95A4, 0x964D, 0x9805,
+  0x9999, 0x9AD8, 0x9D3B, 0x525B, 0x52AB, 0x53F7, 0x5408, 0x58D5,
+  0x62F7, 0x6FE0, 0x8C6A, 0x8F5F, 0x9EB9, 0x514B, 0x523B, 0x544A,
+  0x56FD, 0x7A40, 0x9177, 0x9D60, 0x9ED2, 0x7344, 0x6F09, 0x8170,
+  0x7511, 0x5FFD, 0x60DA, 0x9AA8, 0x72DB, 0x8FBC, 0x6B64, 0x9803,
+  0x4ECA, 0x56F0, 0x5764, 0x58BE, 0x5A5A, 0x6068, 0x61C7, 0x660F,
+  0x6606, 0x6839, 0x68B1, 0x6DF7, 0x75D5, 0x7D3A, 0x826E, 0x9B42,
+  0x4E9B, 0x4F50, 0x53C9, 0x5506, 0x5D6F, 0x5DE6, 0x5DEE, 0x67FB,
+  0x6C99, 0x7473, 0x7802, 0x8A50, 0x9396, 0x88DF, 0x5750, 0x5EA7,
+  0x632B, 0x50B5, 0x50AC, 0x518D, 0x6700, 0x54C9, 0x585E, 0x59BB,
+  0x5BB0, 0x5F69, 0x624D, 0x63A1, 0x683D, 0x6B73, 0x6E08, 0x707D,
+  0x91C7, 0x7280, 0x7815, 0x7826, 0x796D, 0x658E, 0x7D30, 0x83DC,
+  0x88C1, 0x8F09, 0x969B, 0x5264, 0x5728, 0x6750, 0x7F6A, 0x8CA1,
+  0x51B4, 0x5742, 0x962A, 0x583A, 0x698A, 0x80B4, 0x54B2, 0x5D0E,
+  0x57FC, 0x7895, 0x9DFA, 0x4F5C, 0x524A, 0x548B, 0x643E, 0x6628,
+  0x6714, 0x67F5, 0x7A84, 0x7B56, 0x7D22, 0x932F, 0x685C, 0x9BAD,
+  0x7B39, 0x5319, 0x518A, 0x5237, 0x5BDF, 0x62F6, 0x64AE, 0x64E6,
+  0x672D, 0x6BBA, 0x85A9, 0x96D1, 0x7690, 0x9BD6, 0x634C, 0x9306,
+  0x9BAB, 0x76BF, 0x6652, 0x4E09, 0x5098, 0x53C2, 0x5C71, 0x60E8,
+  0x6492, 0x6563, 0x685F, 0x71E6, 0x73CA, 0x7523, 0x7B97, 0x7E82,
+  0x8695, 0x8B83, 0x8CDB, 0x9178, 0x9910, 0x65AC, 0x66AB, 0x6B8B,
+  0x4ED5, 0x4ED4, 0x4F3A, 0x4F7F, 0x523A, 0x53F8, 0x53F2, 0x55E3,
+  0x56DB, 0x58EB, 0x59CB, 0x59C9, 0x59FF, 0x5B50, 0x5C4D, 0x5E02,
+  0x5E2B, 0x5FD7, 0x601D, 0x6307, 0x652F, 0x5B5C, 0x65AF, 0x65BD,
+  0x65E8, 0x679D, 0x6B62, 0x6B7B, 0x6C0F, 0x7345, 0x7949, 0x79C1,
+  0x7CF8, 0x7D19, 0x7D2B, 0x80A2, 0x8102, 0x81F3, 0x8996, 0x8A5E,
+  0x8A69, 0x8A66, 0x8A8C, 0x8AEE, 0x8CC7, 0x8CDC, 0x96CC, 0x98FC,
+  0x6B6F, 0x4E8B, 0x4F3C, 0x4F8D, 0x5150, 0x5B57, 0x5BFA, 0x6148,
+  0x6301, 0x6642, 0x6B21, 0x6ECB, 0x6CBB, 0x723E, 0x74BD, 0x75D4,
+  0x78C1, 0x793A, 0x800C, 0x8033, 0x81EA, 0x8494, 0x8F9E, 0x6C50,
+  0x9E7F, 0x5F0F, 0x8B58, 0x9D2B, 0x7AFA, 0x8EF8, 0x5B8D, 0x96EB,
+  0x4E03, 0x53F1, 0x57F7, 0x5931, 0x5AC9, 0x5BA4, 0x6089, 0x6E7F,
+  0x6F06, 0x75BE, 0x8CEA, 0x5B9F, 0x8500, 0x7BE0, 0x5072, 0x67F4,
+  0x829D, 0x5C61, 0x854A, 0x7E1E, 0x820E, 0x5199, 0x5C04, 0x6368,
+  0x8D66, 0x659C, 0x716E, 0x793E, 0x7D17, 0x8005, 0x8B1D, 0x8ECA,
+  0x906E, 0x86C7, 0x90AA, 0x501F, 0x52FA, 0x5C3A, 0x6753, 0x707C,
+  0x7235, 0x914C, 0x91C8, 0x932B, 0x82E5, 0x5BC2, 0x5F31, 0x60F9,
+  0x4E3B, 0x53D6, 0x5B88, 0x624B, 0x6731, 0x6B8A, 0x72E9, 0x73E0,
+  0x7A2E, 0x816B, 0x8DA3, 0x9152, 0x9996, 0x5112, 0x53D7, 0x546A,
+  0x5BFF, 0x6388, 0x6A39, 0x7DAC, 0x9700, 0x56DA, 0x53CE, 0x5468,
+  0x5B97, 0x5C31, 0x5DDE, 0x4FEE, 0x6101, 0x62FE, 0x6D32, 0x79C0,
+  0x79CB, 0x7D42, 0x7E4D, 0x7FD2, 0x81ED, 0x821F, 0x8490, 0x8846,
+  0x8972, 0x8B90, 0x8E74, 0x8F2F, 0x9031, 0x914B, 0x916C, 0x96C6,
+  0x919C, 0x4EC0, 0x4F4F, 0x5145, 0x5341, 0x5F93, 0x620E, 0x67D4,
+  0x6C41, 0x6E0B, 0x7363, 0x7E26, 0x91CD, 0x9283, 0x53D4, 0x5919,
+  0x5BBF, 0x6DD1, 0x795D, 0x7E2E, 0x7C9B, 0x587E, 0x719F, 0x51FA,
+  0x8853, 0x8FF0, 0x4FCA, 0x5CFB, 0x6625, 0x77AC, 0x7AE3, 0x821C,
+  0x99FF, 0x51C6, 0x5FAA, 0x65EC, 0x696F, 0x6B89, 0x6DF3, 0x6E96,
+  0x6F64, 0x76FE, 0x7D14, 0x5DE1, 0x9075, 0x9187, 0x9806, 0x51E6,
+  0x521D, 0x6240, 0x6691, 0x66D9, 0x6E1A, 0x5EB6, 0x7DD2, 0x7F72,
+  0x66F8, 0x85AF, 0x85F7, 0x8AF8, 0x52A9, 0x53D9, 0x5973, 0x5E8F,
+  0x5F90, 0x6055, 0x92E4, 0x9664, 0x50B7, 0x511F, 0x52DD, 0x5320,
+  0x5347, 0x53EC, 0x54E8, 0x5546, 0x5531, 0x5617, 0x5968, 0x59BE,
+  0x5A3C, 0x5BB5, 0x5C06, 0x5C0F, 0x5C11, 0x5C1A, 0x5E84, 0x5E8A,
+  0x5EE0, 0x5F70, 0x627F, 0x6284, 0x62DB, 0x638C, 0x6377, 0x6607,
+  0x660C, 0x662D, 0x6676, 0x677E, 0x68A2, 0x6A1F, 0x6A35, 0x6CBC,
+  0x6D88, 0x6E09, 0x6E58, 0x713C, 0x7126, 0x7167, 0x75C7, 0x7701,
+  0x785D, 0x7901, 0x7965, 0x79F0, 0x7AE0, 0x7B11, 0x7CA7, 0x7D39,
+  0x8096, 0x83D6, 0x848B, 0x8549, 0x885D, 0x88F3, 0x8A1F, 0x8A3C,
+  0x8A54, 0x8A73, 0x8C61, 0x8CDE, 0x91A4, 0x9266, 0x937E, 0x9418,
+  0x969C, 0x9798, 0x4E0A, 0x4E08, 0x4E1E, 0x4E57, 0x5197, 0x5270,
+  0x57CE, 0x5834, 0x58CC, 0x5B22, 0x5E38, 0x60C5, 0x64FE, 0x6761,
+  0x6756, 0x6D44, 0x72B6, 0x7573, 0x7A63, 0x84B8, 0x8B72, 0x91B8,
+  0x9320, 0x5631, 0x57F4, 0x98FE, 0x62ED, 0x690D, 0x6B96, 0x71ED,
+  0x7E54, 0x8077, 0x8272, 0x89E6, 0x98DF, 0x8755, 0x8FB1, 0x5C3B,
+  0x4F38, 0x4FE1, 0x4FB5, 0x5507, 0x5A20, 0x5BDD, 0x5BE9, 0x5FC3,
+  0x614E, 0x632F, 0x65B0, 0x664B, 0x68EE, 0x699B, 0x6D78, 0x6DF1,
+  0x7533, 0x75B9, 0x771F, 0x795E, 0x79E6, 0x7D33, 0x81E3, 0x82AF,
+  0x85AA, 0x89AA, 0x8A3A, 0x8EAB, 0x8F9B, 0x9032, 0x91DD, 0x9707,
+  0x4EBA, 0x4EC1, 0x5203, 0x5875, 0x58EC, 0x5C0B, 0x751A, 0x5C3D,
+  0x814E, 0x8A0A, 0x8FC5, 0x9663, 0x976D, 0x7B25, 0x8ACF, 0x9808,
+  0x9162, 0x56F3, 0x53A8, 0x9017, 0x5439, 0x5782, 0x5E25, 0x63A8,
+  0x6C34, 0x708A, 0x7761, 0x7C8B, 0x7FE0, 0x8870, 0x9042, 0x9154,
+  0x9310, 0x9318, 0x968F, 0x745E, 0x9AC4, 0x5D07, 0x5D69, 0x6570,
+  0x67A2, 0x8DA8, 0x96DB, 0x636E, 0x6749, 0x6919, 0x83C5, 0x9817,
+  0x96C0, 0x88FE, 0x6F84, 0x647A, 0x5BF8, 0x4E16, 0x702C, 0x755D,
+  0x662F, 0x51C4, 0x5236, 0x52E2, 0x59D3, 0x5F81, 0x6027, 0x6210,
+  0x653F, 0x6574, 0x661F, 0x6674, 0x68F2, 0x6816, 0x6B63, 0x6E05,
+  0x7272, 0x751F, 0x76DB, 0x7CBE, 0x8056, 0x58F0, 0x88FD, 0x897F,
+  0x8AA0, 0x8A93, 0x8ACB, 0x901D, 0x9192, 0x9752, 0x9759, 0x6589,
+  0x7A0E, 0x8106, 0x96BB, 0x5E2D, 0x60DC, 0x621A, 0x65A5, 0x6614,
+  0x6790, 0x77F3, 0x7A4D, 0x7C4D, 0x7E3E, 0x810A, 0x8CAC, 0x8D64,
+  0x8DE1, 0x8E5F, 0x78A9, 0x5207, 0x62D9, 0x63A5, 0x6442, 0x6298,
+  0x8A2D, 0x7A83, 0x7BC0, 0x8AAC, 0x96EA, 0x7D76, 0x820C, 0x8749,
+  0x4ED9, 0x5148, 0x5343, 0x5360, 0x5BA3, 0x5C02, 0x5C16, 0x5DDD,
+  0x6226, 0x6247, 0x64B0, 0x6813, 0x6834, 0x6CC9, 0x6D45, 0x6D17,
+  0x67D3, 0x6F5C, 0x714E, 0x717D, 0x65CB, 0x7A7F, 0x7BAD, 0x7DDA,
+  0x7E4A, 0x7FA8, 0x817A, 0x821B, 0x8239, 0x85A6, 0x8A6E, 0x8CCE,
+  0x8DF5, 0x9078, 0x9077, 0x92AD, 0x9291, 0x9583, 0x9BAE, 0x524D,
+  0x5584, 0x6F38, 0x7136, 0x5168, 0x7985, 0x7E55, 0x81B3, 0x7CCE,
+  0x564C, 0x5851, 0x5CA8, 0x63AA, 0x66FE, 0x66FD, 0x695A, 0x72D9,
+  0x758F, 0x758E, 0x790E, 0x7956, 0x79DF, 0x7C97, 0x7D20, 0x7D44,
+  0x8607, 0x8A34, 0x963B, 0x9061, 0x9F20, 0x50E7, 0x5275, 0x53CC,
+  0x53E2, 0x5009, 0x55AA, 0x58EE, 0x594F, 0x723D, 0x5B8B, 0x5C64,
+  0x531D, 0x60E3, 0x60F3, 0x635C, 0x6383, 0x633F, 0x63BB, 0x64CD,
+  0x65E9, 0x66F9, 0x5DE3, 0x69CD, 0x69FD, 0x6F15, 0x71E5, 0x4E89,
+  0x75E9, 0x76F8, 0x7A93, 0x7CDF, 0x7DCF, 0x7D9C, 0x8061, 0x8349,
+  0x8358, 0x846C, 0x84BC, 0x85FB, 0x88C5, 0x8D70, 0x9001, 0x906D,
+  0x9397, 0x971C, 0x9A12, 0x50CF, 0x5897, 0x618E, 0x81D3, 0x8535,
+  0x8D08, 0x9020, 0x4FC3, 0x5074, 0x5247, 0x5373, 0x606F, 0x6349,
+  0x675F, 0x6E2C, 0x8DB3, 0x901F, 0x4FD7, 0x5C5E, 0x8CCA, 0x65CF,
+  0x7D9A, 0x5352, 0x8896, 0x5176, 0x63C3, 0x5B58, 0x5B6B, 0x5C0A,
+  0x640D, 0x6751, 0x905C, 0x4ED6, 0x591A, 0x592A, 0x6C70, 0x8A51,
+  0x553E, 0x5815, 0x59A5, 0x60F0, 0x6253, 0x67C1, 0x8235, 0x6955,
+  0x9640, 0x99C4, 0x9A28, 0x4F53, 0x5806, 0x5BFE, 0x8010, 0x5CB1,
+  0x5E2F, 0x5F85, 0x6020, 0x614B, 0x6234, 0x66FF, 0x6CF0, 0x6EDE,
+  0x80CE, 0x817F, 0x82D4, 0x888B, 0x8CB8, 0x9000, 0x902E, 0x968A,
+  0x9EDB, 0x9BDB, 0x4EE3, 0x53F0, 0x5927, 0x7B2C, 0x918D, 0x984C,
+  0x9DF9, 0x6EDD, 0x7027, 0x5353, 0x5544, 0x5B85, 0x6258, 0x629E,
+  0x62D3, 0x6CA2, 0x6FEF, 0x7422, 0x8A17, 0x9438, 0x6FC1, 0x8AFE,
+  0x8338, 0x51E7, 0x86F8, 0x53EA, 0x53E9, 0x4F46, 0x9054, 0x8FB0,
+  0x596A, 0x8131, 0x5DFD, 0x7AEA, 0x8FBF, 0x68DA, 0x8C37, 0x72F8,
+  0x9C48, 0x6A3D, 0x8AB0, 0x4E39, 0x5358, 0x5606, 0x5766, 0x62C5,
+  0x63A2, 0x65E6, 0x6B4E, 0x6DE1, 0x6E5B, 0x70AD, 0x77ED, 0x7AEF,
+  0x7BAA, 0x7DBB, 0x803D, 0x80C6, 0x86CB, 0x8A95, 0x935B, 0x56E3,
+  0x58C7, 0x5F3E, 0x65AD, 0x6696, 0x6A80, 0x6BB5, 0x7537, 0x8AC7,
+  0x5024, 0x77E5, 0x5730, 0x5F1B, 0x6065, 0x667A, 0x6C60, 0x75F4,
+  0x7A1A, 0x7F6E, 0x81F4, 0x8718, 0x9045, 0x99B3, 0x7BC9, 0x755C,
+  0x7AF9, 0x7B51, 0x84C4, 0x9010, 0x79E9, 0x7A92, 0x8336, 0x5AE1,
+  0x7740, 0x4E2D, 0x4EF2, 0x5B99, 0x5FE0, 0x62BD, 0x663C, 0x67F1,
+  0x6CE8, 0x866B, 0x8877, 0x8A3B, 0x914E, 0x92F3, 0x99D0, 0x6A17,
+  0x7026, 0x732A, 0x82E7, 0x8457, 0x8CAF, 0x4E01, 0x5146, 0x51CB,
+  0x558B, 0x5BF5, 0x5E16, 0x5E33, 0x5E81, 0x5F14, 0x5F35, 0x5F6B,
+  0x5FB4, 0x61F2, 0x6311, 0x66A2, 0x671D, 0x6F6E, 0x7252, 0x753A,
+  0x773A, 0x8074, 0x8139, 0x8178, 0x8776, 0x8ABF, 0x8ADC, 0x8D85,
+  0x8DF3, 0x929A, 0x9577, 0x9802, 0x9CE5, 0x52C5, 0x6357, 0x76F4,
+  0x6715, 0x6C88, 0x73CD, 0x8CC3, 0x93AE, 0x9673, 0x6D25, 0x589C,
+  0x690E, 0x69CC, 0x8FFD, 0x939A, 0x75DB, 0x901A, 0x585A, 0x6802,
+  0x63B4, 0x69FB, 0x4F43, 0x6F2C, 0x67D8, 0x8FBB, 0x8526, 0x7DB4,
+  0x9354, 0x693F, 0x6F70, 0x576A, 0x58F7, 0x5B2C, 0x7D2C, 0x722A,
+  0x540A, 0x91E3, 0x9DB4, 0x4EAD, 0x4F4E, 0x505C, 0x5075, 0x5243,
+  0x8C9E, 0x5448, 0x5824, 0x5B9A, 0x5E1D, 0x5E95, 0x5EAD, 0x5EF7,
+  0x5F1F, 0x608C, 0x62B5, 0x633A, 0x63D0, 0x68AF, 0x6C40, 0x7887,
+  0x798E, 0x7A0B, 0x7DE0, 0x8247, 0x8A02, 0x8AE6, 0x8E44, 0x9013,
+  0x90B8, 0x912D, 0x91D8, 0x9F0E, 0x6CE5, 0x6458, 0x64E2, 0x6575,
+  0x6EF4, 0x7684, 0x7B1B, 0x9069, 0x93D1, 0x6EBA, 0x54F2, 0x5FB9,
+  0x64A4, 0x8F4D, 0x8FED, 0x9244, 0x5178, 0x586B, 0x5929, 0x5C55,
+  0x5E97, 0x6DFB, 0x7E8F, 0x751C, 0x8CBC, 0x8EE2, 0x985B, 0x70B9,
+  0x4F1D, 0x6BBF, 0x6FB1, 0x7530, 0x96FB, 0x514E, 0x5410, 0x5835,
+  0x5857, 0x59AC, 0x5C60, 0x5F92, 0x6597, 0x675C, 0x6E21, 0x767B,
+  0x83DF, 0x8CED, 0x9014, 0x90FD, 0x934D, 0x7825, 0x783A, 0x52AA,
+  0x5EA6, 0x571F, 0x5974, 0x6012, 0x5012, 0x515A, 0x51AC, 0x51CD,
+  0x5200, 0x5510, 0x5854, 0x5858, 0x5957, 0x5B95, 0x5CF6, 0x5D8B,
+  0x60BC, 0x6295, 0x642D, 0x6771, 0x6843, 0x68BC, 0x68DF, 0x76D7,
+  0x6DD8, 0x6E6F, 0x6D9B, 0x706F, 0x71C8, 0x5F53, 0x75D8, 0x7977,
+  0x7B49, 0x7B54, 0x7B52, 0x7CD6, 0x7D71, 0x5230, 0x8463, 0x8569,
+  0x85E4, 0x8A0E, 0x8B04, 0x8C46, 0x8E0F, 0x9003, 0x900F, 0x9419,
+  0x9676, 0x982D, 0x9A30, 0x95D8, 0x50CD, 0x52D5, 0x540C, 0x5802,
+  0x5C0E, 0x61A7, 0x649E, 0x6D1E, 0x77B3, 0x7AE5, 0x80F4, 0x8404,
+  0x9053, 0x9285, 0x5CE0, 0x9D07, 0x533F, 0x5F97, 0x5FB3, 0x6D9C,
+  0x7279, 0x7763, 0x79BF, 0x7BE4, 0x6BD2, 0x72EC, 0x8AAD, 0x6803,
+  0x6A61, 0x51F8, 0x7A81, 0x6934, 0x5C4A, 0x9CF6, 0x82EB, 0x5BC5,
+  0x9149, 0x701E, 0x5678, 0x5C6F, 0x60C7, 0x6566, 0x6C8C, 0x8C5A,
+  0x9041, 0x9813, 0x5451, 0x66C7, 0x920D, 0x5948, 0x90A3, 0x5185,
+  0x4E4D, 0x51EA, 0x8599, 0x8B0E, 0x7058, 0x637A, 0x934B, 0x6962,
+  0x99B4, 0x7E04, 0x7577, 0x5357, 0x6960, 0x8EDF, 0x96E3, 0x6C5D,
+  0x4E8C, 0x5C3C, 0x5F10, 0x8FE9, 0x5302, 0x8CD1, 0x8089, 0x8679,
+  0x5EFF, 0x65E5, 0x4E73, 0x5165, 0x5982, 0x5C3F, 0x97EE, 0x4EFB,
+  0x598A, 0x5FCD, 0x8A8D, 0x6FE1, 0x79B0, 0x7962, 0x5BE7, 0x8471,
+  0x732B, 0x71B1, 0x5E74, 0x5FF5, 0x637B, 0x649A, 0x71C3, 0x7C98,
+  0x4E43, 0x5EFC, 0x4E4B, 0x57DC, 0x56A2, 0x60A9, 0x6FC3, 0x7D0D,
+  0x80FD, 0x8133, 0x81BF, 0x8FB2, 0x8997, 0x86A4, 0x5DF4, 0x628A,
+  0x64AD, 0x8987, 0x6777, 0x6CE2, 0x6D3E, 0x7436, 0x7834, 0x5A46,
+  0x7F75, 0x82AD, 0x99AC, 0x4FF3, 0x5EC3, 0x62DD, 0x6392, 0x6557,
+  0x676F, 0x76C3, 0x724C, 0x80CC, 0x80BA, 0x8F29, 0x914D, 0x500D,
+  0x57F9, 0x5A92, 0x6885, 0x6973, 0x7164, 0x72FD, 0x8CB7, 0x58F2,
+  0x8CE0, 0x966A, 0x9019, 0x877F, 0x79E4, 0x77E7, 0x8429, 0x4F2F,
+  0x5265, 0x535A, 0x62CD, 0x67CF, 0x6CCA, 0x767D, 0x7B94, 0x7C95,
+  0x8236, 0x8584, 0x8FEB, 0x66DD, 0x6F20, 0x7206, 0x7E1B, 0x83AB,
+  0x99C1, 0x9EA6, 0x51FD, 0x7BB1, 0x7872, 0x7BB8, 0x8087, 0x7B48,
+  0x6AE8, 0x5E61, 0x808C, 0x7551, 0x7560, 0x516B, 0x9262, 0x6E8C,
+  0x767A, 0x9197, 0x9AEA, 0x4F10, 0x7F70, 0x629C, 0x7B4F, 0x95A5,
+  0x9CE9, 0x567A, 0x5859, 0x86E4, 0x96BC, 0x4F34, 0x5224, 0x534A,
+  0x53CD, 0x53DB, 0x5E06, 0x642C, 0x6591, 0x677F, 0x6C3E, 0x6C4E,
+  0x7248, 0x72AF, 0x73ED, 0x7554, 0x7E41, 0x822C, 0x85E9, 0x8CA9,
+  0x7BC4, 0x91C6, 0x7169, 0x9812, 0x98EF, 0x633D, 0x6669, 0x756A,
+  0x76E4, 0x78D0, 0x8543, 0x86EE, 0x532A, 0x5351, 0x5426, 0x5983,
+  0x5E87, 0x5F7C, 0x60B2, 0x6249, 0x6279, 0x62AB, 0x6590, 0x6BD4,
+  0x6CCC, 0x75B2, 0x76AE, 0x7891, 0x79D8, 0x7DCB, 0x7F77, 0x80A5,
+  0x88AB, 0x8AB9, 0x8CBB, 0x907F, 0x975E, 0x98DB, 0x6A0B, 0x7C38,
+  0x5099, 0x5C3E, 0x5FAE, 0x6787, 0x6BD8, 0x7435, 0x7709, 0x7F8E,
+  0x9F3B, 0x67CA, 0x7A17, 0x5339, 0x758B, 0x9AED, 0x5F66, 0x819D,
+  0x83F1, 0x8098, 0x5F3C, 0x5FC5, 0x7562, 0x7B46, 0x903C, 0x6867,
+  0x59EB, 0x5A9B, 0x7D10, 0x767E, 0x8B2C, 0x4FF5, 0x5F6A, 0x6A19,
+  0x6C37, 0x6F02, 0x74E2, 0x7968, 0x8868, 0x8A55, 0x8C79, 0x5EDF,
+  0x63CF, 0x75C5, 0x79D2, 0x82D7, 0x9328, 0x92F2, 0x849C, 0x86ED,
+  0x9C2D, 0x54C1, 0x5F6C, 0x658C, 0x6D5C, 0x7015, 0x8CA7, 0x8CD3,
+  0x983B, 0x654F, 0x74F6, 0x4E0D, 0x4ED8, 0x57E0, 0x592B, 0x5A66,
+  0x5BCC, 0x51A8, 0x5E03, 0x5E9C, 0x6016, 0x6276, 0x6577, 0x65A7,
+  0x666E, 0x6D6E, 0x7236, 0x7B26, 0x8150, 0x819A, 0x8299, 0x8B5C,
+  0x8CA0, 0x8CE6, 0x8D74, 0x961C, 0x9644, 0x4FAE, 0x64AB, 0x6B66,
+  0x821E, 0x8461, 0x856A, 0x90E8, 0x5C01, 0x6953, 0x98A8, 0x847A,
+  0x8557, 0x4F0F, 0x526F, 0x5FA9, 0x5E45, 0x670D, 0x798F, 0x8179,
+  0x8907, 0x8986, 0x6DF5, 0x5F17, 0x6255, 0x6CB8, 0x4ECF, 0x7269,
+  0x9B92, 0x5206, 0x543B, 0x5674, 0x58B3, 0x61A4, 0x626E, 0x711A,
+  0x596E, 0x7C89, 0x7CDE, 0x7D1B, 0x96F0, 0x6587, 0x805E, 0x4E19,
+  0x4F75, 0x5175, 0x5840, 0x5E63, 0x5E73, 0x5F0A, 0x67C4, 0x4E26,
+  0x853D, 0x9589, 0x965B, 0x7C73, 0x9801, 0x50FB, 0x58C1, 0x7656,
+  0x78A7, 0x5225, 0x77A5, 0x8511, 0x7B86, 0x504F, 0x5909, 0x7247,
+  0x7BC7, 0x7DE8, 0x8FBA, 0x8FD4, 0x904D, 0x4FBF, 0x52C9, 0x5A29,
+  0x5F01, 0x97AD, 0x4FDD, 0x8217, 0x92EA, 0x5703, 0x6355, 0x6B69,
+  0x752B, 0x88DC, 0x8F14, 0x7A42, 0x52DF, 0x5893, 0x6155, 0x620A,
+  0x66AE, 0x6BCD, 0x7C3F, 0x83E9, 0x5023, 0x4FF8, 0x5305, 0x5446,
+  0x5831, 0x5949, 0x5B9D, 0x5CF0, 0x5CEF, 0x5D29, 0x5E96, 0x62B1,
+  0x6367, 0x653E, 0x65B9, 0x670B, 0x6CD5, 0x6CE1, 0x70F9, 0x7832,
+  0x7E2B, 0x80DE, 0x82B3, 0x840C, 0x84EC, 0x8702, 0x8912, 0x8A2A,
+  0x8C4A, 0x90A6, 0x92D2, 0x98FD, 0x9CF3, 0x9D6C, 0x4E4F, 0x4EA1,
+  0x508D, 0x5256, 0x574A, 0x59A8, 0x5E3D, 0x5FD8, 0x5FD9, 0x623F,
+  0x66B4, 0x671B, 0x67D0, 0x68D2, 0x5192, 0x7D21, 0x80AA, 0x81A8,
+  0x8B00, 0x8C8C, 0x8CBF, 0x927E, 0x9632, 0x5420, 0x982C, 0x5317,
+  0x50D5, 0x535C, 0x58A8, 0x64B2, 0x6734, 0x7267, 0x7766, 0x7A46,
+  0x91E6, 0x52C3, 0x6CA1, 0x6B86, 0x5800, 0x5E4C, 0x5954, 0x672C,
+  0x7FFB, 0x51E1, 0x76C6, 0x6469, 0x78E8, 0x9B54, 0x9EBB, 0x57CB,
+  0x59B9, 0x6627, 0x679A, 0x6BCE, 0x54E9, 0x69D9, 0x5E55, 0x819C,
+  0x6795, 0x9BAA, 0x67FE, 0x9C52, 0x685D, 0x4EA6, 0x4FE3, 0x53C8,
+  0x62B9, 0x672B, 0x6CAB, 0x8FC4, 0x4FAD, 0x7E6D, 0x9EBF, 0x4E07,
+  0x6162, 0x6E80, 0x6F2B, 0x8513, 0x5473, 0x672A, 0x9B45, 0x5DF3,
+  0x7B95, 0x5CAC, 0x5BC6, 0x871C, 0x6E4A, 0x84D1, 0x7A14, 0x8108,
+  0x5999, 0x7C8D, 0x6C11, 0x7720, 0x52D9, 0x5922, 0x7121, 0x725F,
+  0x77DB, 0x9727, 0x9D61, 0x690B, 0x5A7F, 0x5A18, 0x51A5, 0x540D,
+  0x547D, 0x660E, 0x76DF, 0x8FF7, 0x9298, 0x9CF4, 0x59EA, 0x725D,
+  0x6EC5, 0x514D, 0x68C9, 0x7DBF, 0x7DEC, 0x9762, 0x9EBA, 0x6478,
+  0x6A21, 0x8302, 0x5984, 0x5B5F, 0x6BDB, 0x731B, 0x76F2, 0x7DB2,
+  0x8017, 0x8499, 0x5132, 0x6728, 0x9ED9, 0x76EE, 0x6762, 0x52FF,
+  0x9905, 0x5C24, 0x623B, 0x7C7E, 0x8CB0, 0x554F, 0x60B6, 0x7D0B,
+  0x9580, 0x5301, 0x4E5F, 0x51B6, 0x591C, 0x723A, 0x8036, 0x91CE,
+  0x5F25, 0x77E2, 0x5384, 0x5F79, 0x7D04, 0x85AC, 0x8A33, 0x8E8D,
+  0x9756, 0x67F3, 0x85AE, 0x9453, 0x6109, 0x6108, 0x6CB9, 0x7652,
+  0x8AED, 0x8F38, 0x552F, 0x4F51, 0x512A, 0x52C7, 0x53CB, 0x5BA5,
+  0x5E7D, 0x60A0, 0x6182, 0x63D6, 0x6709, 0x67DA, 0x6E67, 0x6D8C,
+  0x7336, 0x7337, 0x7531, 0x7950, 0x88D5, 0x8A98, 0x904A, 0x9091,
+  0x90F5, 0x96C4, 0x878D, 0x5915, 0x4E88, 0x4F59, 0x4E0E, 0x8A89,
+  0x8F3F, 0x9810, 0x50AD, 0x5E7C, 0x5996, 0x5BB9, 0x5EB8, 0x63DA,
+  0x63FA, 0x64C1, 0x66DC, 0x694A, 0x69D8, 0x6D0B, 0x6EB6, 0x7194,
+  0x7528, 0x7AAF, 0x7F8A, 0x8000, 0x8449, 0x84C9, 0x8981, 0x8B21,
+  0x8E0A, 0x9065, 0x967D, 0x990A, 0x617E, 0x6291, 0x6B32, 0x6C83,
+  0x6D74, 0x7FCC, 0x7FFC, 0x6DC0, 0x7F85, 0x87BA, 0x88F8, 0x6765,
+  0x83B1, 0x983C, 0x96F7, 0x6D1B, 0x7D61, 0x843D, 0x916A, 0x4E71,
+  0x5375, 0x5D50, 0x6B04, 0x6FEB, 0x85CD, 0x862D, 0x89A7, 0x5229,
+  0x540F, 0x5C65, 0x674E, 0x68A8, 0x7406, 0x7483, 0x75E2, 0x88CF,
+  0x88E1, 0x91CC, 0x96E2, 0x9678, 0x5F8B, 0x7387, 0x7ACB, 0x844E,
+  0x63A0, 0x7565, 0x5289, 0x6D41, 0x6E9C, 0x7409, 0x7559, 0x786B,
+  0x7C92, 0x9686, 0x7ADC, 0x9F8D, 0x4FB6, 0x616E, 0x65C5, 0x865C,
+  0x4E86, 0x4EAE, 0x50DA, 0x4E21, 0x51CC, 0x5BEE, 0x6599, 0x6881,
+  0x6DBC, 0x731F, 0x7642, 0x77AD, 0x7A1C, 0x7CE7, 0x826F, 0x8AD2,
+  0x907C, 0x91CF, 0x9675, 0x9818, 0x529B, 0x7DD1, 0x502B, 0x5398,
+  0x6797, 0x6DCB, 0x71D0, 0x7433, 0x81E8, 0x8F2A, 0x96A3, 0x9C57,
+  0x9E9F, 0x7460, 0x5841, 0x6D99, 0x7D2F, 0x985E, 0x4EE4, 0x4F36,
+  0x4F8B, 0x51B7, 0x52B1, 0x5DBA, 0x601C, 0x73B2, 0x793C, 0x82D3,
+  0x9234, 0x96B7, 0x96F6, 0x970A, 0x9E97, 0x9F62, 0x66A6, 0x6B74,
+  0x5217, 0x52A3, 0x70C8, 0x88C2, 0x5EC9, 0x604B, 0x6190, 0x6F23,
+  0x7149, 0x7C3E, 0x7DF4, 0x806F, 0x84EE, 0x9023, 0x932C, 0x5442,
+  0x9B6F, 0x6AD3, 0x7089, 0x8CC2, 0x8DEF, 0x9732, 0x52B4, 0x5A41,
+  0x5ECA, 0x5F04, 0x6717, 0x697C, 0x6994, 0x6D6A, 0x6F0F, 0x7262,
+  0x72FC, 0x7BED, 0x8001, 0x807E, 0x874B, 0x90CE, 0x516D, 0x9E93,
+  0x7984, 0x808B, 0x9332, 0x8AD6, 0x502D, 0x548C, 0x8A71, 0x6B6A,
+  0x8CC4, 0x8107, 0x60D1, 0x67A0, 0x9DF2, 0x4E99, 0x4E98, 0x9C10,
+  0x8A6B, 0x85C1, 0x8568, 0x6900, 0x6E7E, 0x7897, 0x8155, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x5F0C, 0x4E10, 0x4E15, 0x4E2A, 0x4E31, 0x4E36,
+  0x4E3C, 0x4E3F, 0x4E42, 0x4E56, 0x4E58, 0x4E82, 0x4E85, 0x8C6B,
+  0x4E8A, 0x8212, 0x5F0D, 0x4E8E, 0x4E9E, 0x4E9F, 0x4EA0, 0x4EA2,
+  0x4EB0, 0x4EB3, 0x4EB6, 0x4ECE, 0x4ECD, 0x4EC4, 0x4EC6, 0x4EC2,
+  0x4ED7, 0x4EDE, 0x4EED, 0x4EDF, 0x4EF7, 0x4F09, 0x4F5A, 0x4F30,
+  0x4F5B, 0x4F5D, 0x4F57, 0x4F47, 0x4F76, 0x4F88, 0x4F8F, 0x4F98,
+  0x4F7B, 0x4F69, 0x4F70, 0x4F91, 0x4F6F, 0x4F86, 0x4F96, 0x5118,
+  0x4FD4, 0x4FDF, 0x4FCE, 0x4FD8, 0x4FDB, 0x4FD1, 0x4FDA, 0x4FD0,
+  0x4FE4, 0x4FE5, 0x501A, 0x5028, 0x5014, 0x502A, 0x5025, 0x5005,
+  0x4F1C, 0x4FF6, 0x5021, 0x5029, 0x502C, 0x4FFE, 0x4FEF, 0x5011,
+  0x5006, 0x5043, 0x5047, 0x6703, 0x5055, 0x5050, 0x5048, 0x505A,
+  0x5056, 0x506C, 0x5078, 0x5080, 0x509A, 0x5085, 0x50B4, 0x50B2,
+  0x50C9, 0x50CA, 0x50B3, 0x50C2, 0x50D6, 0x50DE, 0x50E5, 0x50ED,
+  0x50E3, 0x50EE, 0x50F9, 0x50F5, 0x5109, 0x5101, 0x5102, 0x5116,
+  0x5115, 0x5114, 0x511A, 0x5121, 0x513A, 0x5137, 0x513C, 0x513B,
+  0x513F, 0x5140, 0x5152, 0x514C, 0x5154, 0x5162, 0x7AF8, 0x5169,
+  0x516A, 0x516E, 0x5180, 0x5182, 0x56D8, 0x518C, 0x5189, 0x518F,
+  0x5191, 0x5193, 0x5195, 0x5196, 0x51A4, 0x51A6, 0x51A2, 0x51A9,
+  0x51AA, 0x51AB, 0x51B3, 0x51B1, 0x51B2, 0x51B0, 0x51B5, 0x51BD,
+  0x51C5, 0x51C9, 0x51DB, 0x51E0, 0x8655, 0x51E9, 0x51ED, 0x51F0,
+  0x51F5, 0x51FE, 0x5204, 0x520B, 0x5214, 0x520E, 0x5227, 0x522A,
+  0x522E, 0x5233, 0x5239, 0x524F, 0x5244, 0x524B, 0x524C, 0x525E,
+  0x5254, 0x526A, 0x5274, 0x5269, 0x5273, 0x527F, 0x527D, 0x528D,
+  0x5294, 0x5292, 0x5271, 0x5288, 0x5291, 0x8FA8, 0x8FA7, 0x52AC,
+  0x52AD, 0x52BC, 0x52B5, 0x52C1, 0x52CD, 0x52D7, 0x52DE, 0x52E3,
+  0x52E6, 0x98ED, 0x52E0, 0x52F3, 0x52F5, 0x52F8, 0x52F9, 0x5306,
+  0x5308, 0x7538, 0x530D, 0x5310, 0x530F, 0x5315, 0x531A, 0x5323,
+  0x532F, 0x5331, 0x5333, 0x5338, 0x5340, 0x5346, 0x5345, 0x4E17,
+  0x5349, 0x534D, 0x51D6, 0x535E, 0x5369, 0x536E, 0x5918, 0x537B,
+  0x5377, 0x5382, 0x5396, 0x53A0, 0x53A6, 0x53A5, 0x53AE, 0x53B0,
+  0x53B6, 0x53C3, 0x7C12, 0x96D9, 0x53DF, 0x66FC, 0x71EE, 0x53EE,
+  0x53E8, 0x53ED, 0x53FA, 0x5401, 0x543D, 0x5440, 0x542C, 0x542D,
+  0x543C, 0x542E, 0x5436, 0x5429, 0x541D, 0x544E, 0x548F, 0x5475,
+  0x548E, 0x545F, 0x5471, 0x5477, 0x5470, 0x5492, 0x547B, 0x5480,
+  0x5476, 0x5484, 0x5490, 0x5486, 0x54C7, 0x54A2, 0x54B8, 0x54A5,
+  0x54AC, 0x54C4, 0x54C8, 0x54A8, 0x54AB, 0x54C2, 0x54A4, 0x54BE,
+  0x54BC, 0x54D8, 0x54E5, 0x54E6, 0x550F, 0x5514, 0x54FD, 0x54EE,
+  0x54ED, 0x54FA, 0x54E2, 0x5539, 0x5540, 0x5563, 0x554C, 0x552E,
+  0x555C, 0x5545, 0x5556, 0x5557, 0x5538, 0x5533, 0x555D, 0x5599,
+  0x5580, 0x54AF, 0x558A, 0x559F, 0x557B, 0x557E, 0x5598, 0x559E,
+  0x55AE, 0x557C, 0x5583, 0x55A9, 0x5587, 0x55A8, 0x55DA, 0x55C5,
+  0x55DF, 0x55C4, 0x55DC, 0x55E4, 0x55D4, 0x5614, 0x55F7, 0x5616,
+  0x55FE, 0x55FD, 0x561B, 0x55F9, 0x564E, 0x5650, 0x71DF, 0x5634,
+  0x5636, 0x5632, 0x5638, 0x566B, 0x5664, 0x562F, 0x566C, 0x566A,
+  0x5686, 0x5680, 0x568A, 0x56A0, 0x5694, 0x568F, 0x56A5, 0x56AE,
+  0x56B6, 0x56B4, 0x56C2, 0x56BC, 0x56C1, 0x56C3, 0x56C0, 0x56C8,
+  0x56CE, 0x56D1, 0x56D3, 0x56D7, 0x56EE, 0x56F9, 0x5700, 0x56FF,
+  0x5704, 0x5709, 0x5708, 0x570B, 0x570D, 0x5713, 0x5718, 0x5716,
+  0x55C7, 0x571C, 0x5726, 0x5737, 0x5738, 0x574E, 0x573B, 0x5740,
+  0x574F, 0x5769, 0x57C0, 0x5788, 0x5761, 0x577F, 0x5789, 0x5793,
+  0x57A0, 0x57B3, 0x57A4, 0x57AA, 0x57B0, 0x57C3, 0x57C6, 0x57D4,
+  0x57D2, 0x57D3, 0x580A, 0x57D6, 0x57E3, 0x580B, 0x5819, 0x581D,
+  0x5872, 0x5821, 0x5862, 0x584B, 0x5870, 0x6BC0, 0x5852, 0x583D,
+  0x5879, 0x5885, 0x58B9, 0x589F, 0x58AB, 0x58BA, 0x58DE, 0x58BB,
+  0x58B8, 0x58AE, 0x58C5, 0x58D3, 0x58D1, 0x58D7, 0x58D9, 0x58D8,
+  0x58E5, 0x58DC, 0x58E4, 0x58DF, 0x58EF, 0x58FA, 0x58F9, 0x58FB,
+  0x58FC, 0x58FD, 0x5902, 0x590A, 0x5910, 0x591B, 0x68A6, 0x5925,
+  0x592C, 0x592D, 0x5932, 0x5938, 0x593E, 0x7AD2, 0x5955, 0x5950,
+  0x594E, 0x595A, 0x5958, 0x5962, 0x5960, 0x5967, 0x596C, 0x5969,
+  0x5978, 0x5981, 0x599D, 0x4F5E, 0x4FAB, 0x59A3, 0x59B2, 0x59C6,
+  0x59E8, 0x59DC, 0x598D, 0x59D9, 0x59DA, 0x5A25, 0x5A1F, 0x5A11,
+  0x5A1C, 0x5A09, 0x5A1A, 0x5A40, 0x5A6C, 0x5A49, 0x5A35, 0x5A36,
+  0x5A62, 0x5A6A, 0x5A9A, 0x5ABC, 0x5ABE, 0x5ACB, 0x5AC2, 0x5ABD,
+  0x5AE3, 0x5AD7, 0x5AE6, 0x5AE9, 0x5AD6, 0x5AFA, 0x5AFB, 0x5B0C,
+  0x5B0B, 0x5B16, 0x5B32, 0x5AD0, 0x5B2A, 0x5B36, 0x5B3E, 0x5B43,
+  0x5B45, 0x5B40, 0x5B51, 0x5B55, 0x5B5A, 0x5B5B, 0x5B65, 0x5B69,
+  0x5B70, 0x5B73, 0x5B75, 0x5B78, 0x6588, 0x5B7A, 0x5B80, 0x5B83,
+  0x5BA6, 0x5BB8, 0x5BC3, 0x5BC7, 0x5BC9, 0x5BD4, 0x5BD0, 0x5BE4,
+  0x5BE6, 0x5BE2, 0x5BDE, 0x5BE5, 0x5BEB, 0x5BF0, 0x5BF6, 0x5BF3,
+  0x5C05, 0x5C07, 0x5C08, 0x5C0D, 0x5C13, 0x5C20, 0x5C22, 0x5C28,
+  0x5C38, 0x5C39, 0x5C41, 0x5C46, 0x5C4E, 0x5C53, 0x5C50, 0x5C4F,
+  0x5B71, 0x5C6C, 0x5C6E, 0x4E62, 0x5C76, 0x5C79, 0x5C8C, 0x5C91,
+  0x5C94, 0x599B, 0x5CAB, 0x5CBB, 0x5CB6, 0x5CBC, 0x5CB7, 0x5CC5,
+  0x5CBE, 0x5CC7, 0x5CD9, 0x5CE9, 0x5CFD, 0x5CFA, 0x5CED, 0x5D8C,
+  0x5CEA, 0x5D0B, 0x5D15, 0x5D17, 0x5D5C, 0x5D1F, 0x5D1B, 0x5D11,
+  0x5D14, 0x5D22, 0x5D1A, 0x5D19, 0x5D18, 0x5D4C, 0x5D52, 0x5D4E,
+  0x5D4B, 0x5D6C, 0x5D73, 0x5D76, 0x5D87, 0x5D84, 0x5D82, 0x5DA2,
+  0x5D9D, 0x5DAC, 0x5DAE, 0x5DBD, 0x5D90, 0x5DB7, 0x5DBC, 0x5DC9,
+  0x5DCD, 0x5DD3, 0x5DD2, 0x5DD6, 0x5DDB, 0x5DEB, 0x5DF2, 0x5DF5,
+  0x5E0B, 0x5E1A, 0x5E19, 0x5E11, 0x5E1B, 0x5E36, 0x5E37, 0x5E44,
+  0x5E43, 0x5E40, 0x5E4E, 0x5E57, 0x5E54, 0x5E5F, 0x5E62, 0x5E64,
+  0x5E47, 0x5E75, 0x5E76, 0x5E7A, 0x9EBC, 0x5E7F, 0x5EA0, 0x5EC1,
+  0x5EC2, 0x5EC8, 0x5ED0, 0x5ECF, 0x5ED6, 0x5EE3, 0x5EDD, 0x5EDA,
+  0x5EDB, 0x5EE2, 0x5EE1, 0x5EE8, 0x5EE9, 0x5EEC, 0x5EF1, 0x5EF3,
+  0x5EF0, 0x5EF4, 0x5EF8, 0x5EFE, 0x5F03, 0x5F09, 0x5F5D, 0x5F5C,
+  0x5F0B, 0x5F11, 0x5F16, 0x5F29, 0x5F2D, 0x5F38, 0x5F41, 0x5F48,
+  0x5F4C, 0x5F4E, 0x5F2F, 0x5F51, 0x5F56, 0x5F57, 0x5F59, 0x5F61,
+  0x5F6D, 0x5F73, 0x5F77, 0x5F83, 0x5F82, 0x5F7F, 0x5F8A, 0x5F88,
+  0x5F91, 0x5F87, 0x5F9E, 0x5F99, 0x5F98, 0x5FA0, 0x5FA8, 0x5FAD,
+  0x5FBC, 0x5FD6, 0x5FFB, 0x5FE4, 0x5FF8, 0x5FF1, 0x5FDD, 0x60B3,
+  0x5FFF, 0x6021, 0x6060, 0x6019, 0x6010, 0x6029, 0x600E, 0x6031,
+  0x601B, 0x6015, 0x602B, 0x6026, 0x600F, 0x603A, 0x605A, 0x6041,
+  0x606A, 0x6077, 0x605F, 0x604A, 0x6046, 0x604D, 0x6063, 0x6043,
+  0x6064, 0x6042, 0x606C, 0x606B, 0x6059, 0x6081, 0x608D, 0x60E7,
+  0x6083, 0x609A, 0x6084, 0x609B, 0x6096, 0x6097, 0x6092, 0x60A7,
+  0x608B, 0x60E1, 0x60B8, 0x60E0, 0x60D3, 0x60B4, 0x5FF0, 0x60BD,
+  0x60C6, 0x60B5, 0x60D8, 0x614D, 0x6115, 0x6106, 0x60F6, 0x60F7,
+  0x6100, 0x60F4, 0x60FA, 0x6103, 0x6121, 0x60FB, 0x60F1, 0x610D,
+  0x610E, 0x6147, 0x613E, 0x6128, 0x6127, 0x614A, 0x613F, 0x613C,
+  0x612C, 0x6134, 0x613D, 0x6142, 0x6144, 0x6173, 0x6177, 0x6158,
+  0x6159, 0x615A, 0x616B, 0x6174, 0x616F, 0x6165, 0x6171, 0x615F,
+  0x615D, 0x6153, 0x6175, 0x6199, 0x6196, 0x6187, 0x61AC, 0x6194,
+  0x619A, 0x618A, 0x6191, 0x61AB, 0x61AE, 0x61CC, 0x61CA, 0x61C9,
+  0x61F7, 0x61C8, 0x61C3, 0x61C6, 0x61BA, 0x61CB, 0x7F79, 0x61CD,
+  0x61E6, 0x61E3, 0x61F6, 0x61FA, 0x61F4, 0x61FF, 0x61FD, 0x61FC,
+  0x61FE, 0x6200, 0x6208, 0x6209, 0x620D, 0x620C, 0x6214, 0x621B,
+  0x621E, 0x6221, 0x622A, 0x622E, 0x6230, 0x6232, 0x6233, 0x6241,
+  0x624E, 0x625E, 0x6263, 0x625B, 0x6260, 0x6268, 0x627C, 0x6282,
+  0x6289, 0x627E, 0x6292, 0x6293, 0x6296, 0x62D4, 0x6283, 0x6294,
+  0x62D7, 0x62D1, 0x62BB, 0x62CF, 0x62FF, 0x62C6, 0x64D4, 0x62C8,
+  0x62DC, 0x62CC, 0x62CA, 0x62C2, 0x62C7, 0x629B, 0x62C9, 0x630C,
+  0x62EE, 0x62F1, 0x6327, 0x6302, 0x6308, 0x62EF, 0x62F5, 0x6350,
+  0x633E, 0x634D, 0x641C, 0x634F, 0x6396, 0x638E, 0x6380, 0x63AB,
+  0x6376, 0x63A3, 0x638F, 0x6389, 0x639F, 0x63B5, 0x636B, 0x6369,
+  0x63BE, 0x63E9, 0x63C0, 0x63C6, 0x63E3, 0x63C9, 0x63D2, 0x63F6,
+  0x63C4, 0x6416, 0x6434, 0x6406, 0x6413, 0x6426, 0x6436, 0x651D,
+  0x6417, 0x6428, 0x640F, 0x6467, 0x646F, 0x6476, 0x644E, 0x652A,
+  0x6495, 0x6493, 0x64A5, 0x64A9, 0x6488, 0x64BC, 0x64DA, 0x64D2,
+  0x64C5, 0x64C7, 0x64BB, 0x64D8, 0x64C2, 0x64F1, 0x64E7, 0x8209,
+  0x64E0, 0x64E1, 0x62AC, 0x64E3, 0x64EF, 0x652C, 0x64F6, 0x64F4,
+  0x64F2, 0x64FA, 0x6500, 0x64FD, 0x6518, 0x651C, 0x6505, 0x6524,
+  0x6523, 0x652B, 0x6534, 0x6535, 0x6537, 0x6536, 0x6538, 0x754B,
+  0x6548, 0x6556, 0x6555, 0x654D, 0x6558, 0x655E, 0x655D, 0x6572,
+  0x6578, 0x6582, 0x6583, 0x8B8A, 0x659B, 0x659F, 0x65AB, 0x65B7,
+  0x65C3, 0x65C6, 0x65C1, 0x65C4, 0x65CC, 0x65D2, 0x65DB, 0x65D9,
+  0x65E0, 0x65E1, 0x65F1, 0x6772, 0x660A, 0x6603, 0x65FB, 0x6773,
+  0x6635, 0x6636, 0x6634, 0x661C, 0x664F, 0x6644, 0x6649, 0x6641,
+  0x665E, 0x665D, 0x6664, 0x6667, 0x6668, 0x665F, 0x6662, 0x6670,
+  0x6683, 0x6688, 0x668E, 0x6689, 0x6684, 0x6698, 0x669D, 0x66C1,
+  0x66B9, 0x66C9, 0x66BE, 0x66BC, 0x66C4, 0x66B8, 0x66D6, 0x66DA,
+  0x66E0, 0x663F, 0x66E6, 0x66E9, 0x66F0, 0x66F5, 0x66F7, 0x670F,
+  0x6716, 0x671E, 0x6726, 0x6727, 0x9738, 0x672E, 0x673F, 0x6736,
+  0x6741, 0x6738, 0x6737, 0x6746, 0x675E, 0x6760, 0x6759, 0x6763,
+  0x6764, 0x6789, 0x6770, 0x67A9, 0x677C, 0x676A, 0x678C, 0x678B,
+  0x67A6, 0x67A1, 0x6785, 0x67B7, 0x67EF, 0x67B4, 0x67EC, 0x67B3,
+  0x67E9, 0x67B8, 0x67E4, 0x67DE, 0x67DD, 0x67E2, 0x67EE, 0x67B9,
+  0x67CE, 0x67C6, 0x67E7, 0x6A9C, 0x681E, 0x6846, 0x6829, 0x6840,
+  0x684D, 0x6832, 0x684E, 0x68B3, 0x682B, 0x6859, 0x6863, 0x6877,
+  0x687F, 0x689F, 0x688F, 0x68AD, 0x6894, 0x689D, 0x689B, 0x6883,
+  0x6AAE, 0x68B9, 0x6874, 0x68B5, 0x68A0, 0x68BA, 0x690F, 0x688D,
+  0x687E, 0x6901, 0x68CA, 0x6908, 0x68D8, 0x6922, 0x6926, 0x68E1,
+  0x690C, 0x68CD, 0x68D4, 0x68E7, 0x68D5, 0x6936, 0x6912, 0x6904,
+  0x68D7, 0x68E3, 0x6925, 0x68F9, 0x68E0, 0x68EF, 0x6928, 0x692A,
+  0x691A, 0x6923, 0x6921, 0x68C6, 0x6979, 0x6977, 0x695C, 0x6978,
+  0x696B, 0x6954, 0x697E, 0x696E, 0x6939, 0x6974, 0x693D, 0x6959,
+  0x6930, 0x6961, 0x695E, 0x695D, 0x6981, 0x696A, 0x69B2, 0x69AE,
+  0x69D0, 0x69BF, 0x69C1, 0x69D3, 0x69BE, 0x69CE, 0x5BE8, 0x69CA,
+  0x69DD, 0x69BB, 0x69C3, 0x69A7, 0x6A2E, 0x6991, 0x69A0, 0x699C,
+  0x6995, 0x69B4, 0x69DE, 0x69E8, 0x6A02, 0x6A1B, 0x69FF, 0x6B0A,
+  0x69F9, 0x69F2, 0x69E7, 0x6A05, 0x69B1, 0x6A1E, 0x69ED, 0x6A14,
+  0x69EB, 0x6A0A, 0x6A12, 0x6AC1, 0x6A23, 0x6A13, 0x6A44, 0x6A0C,
+  0x6A72, 0x6A36, 0x6A78, 0x6A47, 0x6A62, 0x6A59, 0x6A66, 0x6A48,
+  0x6A38, 0x6A22, 0x6A90, 0x6A8D, 0x6AA0, 0x6A84, 0x6AA2, 0x6AA3,
+  0x6A97, 0x8617, 0x6ABB, 0x6AC3, 0x6AC2, 0x6AB8, 0x6AB3, 0x6AAC,
+  0x6ADE, 0x6AD1, 0x6ADF, 0x6AAA, 0x6ADA, 0x6AEA, 0x6AFB, 0x6B05,
+  0x8616, 0x6AFA, 0x6B12, 0x6B16, 0x9B31, 0x6B1F, 0x6B38, 0x6B37,
+  0x76DC, 0x6B39, 0x98EE, 0x6B47, 0x6B43, 0x6B49, 0x6B50, 0x6B59,
+  0x6B54, 0x6B5B, 0x6B5F, 0x6B61, 0x6B78, 0x6B79, 0x6B7F, 0x6B80,
+  0x6B84, 0x6B83, 0x6B8D, 0x6B98, 0x6B95, 0x6B9E, 0x6BA4, 0x6BAA,
+  0x6BAB, 0x6BAF, 0x6BB2, 0x6BB1, 0x6BB3, 0x6BB7, 0x6BBC, 0x6BC6,
+  0x6BCB, 0x6BD3, 0x6BDF, 0x6BEC, 0x6BEB, 0x6BF3, 0x6BEF, 0x9EBE,
+  0x6C08, 0x6C13, 0x6C14, 0x6C1B, 0x6C24, 0x6C23, 0x6C5E, 0x6C55,
+  0x6C62, 0x6C6A, 0x6C82, 0x6C8D, 0x6C9A, 0x6C81, 0x6C9B, 0x6C7E,
+  0x6C68, 0x6C73, 0x6C92, 0x6C90, 0x6CC4, 0x6CF1, 0x6CD3, 0x6CBD,
+  0x6CD7, 0x6CC5, 0x6CDD, 0x6CAE, 0x6CB1, 0x6CBE, 0x6CBA, 0x6CDB,
+  0x6CEF, 0x6CD9, 0x6CEA, 0x6D1F, 0x884D, 0x6D36, 0x6D2B, 0x6D3D,
+  0x6D38, 0x6D19, 0x6D35, 0x6D33, 0x6D12, 0x6D0C, 0x6D63, 0x6D93,
+  0x6D64, 0x6D5A, 0x6D79, 0x6D59, 0x6D8E, 0x6D95, 0x6FE4, 0x6D85,
+  0x6DF9, 0x6E15, 0x6E0A, 0x6DB5, 0x6DC7, 0x6DE6, 0x6DB8, 0x6DC6,
+  0x6DEC, 0x6DDE, 0x6DCC, 0x6DE8, 0x6DD2, 0x6DC5, 0x6DFA, 0x6DD9,
+  0x6DE4, 0x6DD5, 0x6DEA, 0x6DEE, 0x6E2D, 0x6E6E, 0x6E2E, 0x6E19,
+  0x6E72, 0x6E5F, 0x6E3E, 0x6E23, 0x6E6B, 0x6E2B, 0x6E76, 0x6E4D,
+  0x6E1F, 0x6E43, 0x6E3A, 0x6E4E, 0x6E24, 0x6EFF, 0x6E1D, 0x6E38,
+  0x6E82, 0x6EAA, 0x6E98, 0x6EC9, 0x6EB7, 0x6ED3, 0x6EBD, 0x6EAF,
+  0x6EC4, 0x6EB2, 0x6ED4, 0x6ED5, 0x6E8F, 0x6EA5, 0x6EC2, 0x6E9F,
+  0x6F41, 0x6F11, 0x704C, 0x6EEC, 0x6EF8, 0x6EFE, 0x6F3F, 0x6EF2,
+  0x6F31, 0x6EEF, 0x6F32, 0x6ECC, 0x6F3E, 0x6F13, 0x6EF7, 0x6F86,
+  0x6F7A, 0x6F78, 0x6F81, 0x6F80, 0x6F6F, 0x6F5B, 0x6FF3, 0x6F6D,
+  0x6F82, 0x6F7C, 0x6F58, 0x6F8E, 0x6F91, 0x6FC2, 0x6F66, 0x6FB3,
+  0x6FA3, 0x6FA1, 0x6FA4, 0x6FB9, 0x6FC6, 0x6FAA, 0x6FDF, 0x6FD5,
+  0x6FEC, 0x6FD4, 0x6FD8, 0x6FF1, 0x6FEE, 0x6FDB, 0x7009, 0x700B,
+  0x6FFA, 0x7011, 0x7001, 0x700F, 0x6FFE, 0x701B, 0x701A, 0x6F74,
+  0x701D, 0x7018, 0x701F, 0x7030, 0x703E, 0x7032, 0x7051, 0x7063,
+  0x7099, 0x7092, 0x70AF, 0x70F1, 0x70AC, 0x70B8, 0x70B3, 0x70AE,
+  0x70DF, 0x70CB, 0x70DD, 0x70D9, 0x7109, 0x70FD, 0x711C, 0x7119,
+  0x7165, 0x7155, 0x7188, 0x7166, 0x7162, 0x714C, 0x7156, 0x716C,
+  0x718F, 0x71FB, 0x7184, 0x7195, 0x71A8, 0x71AC, 0x71D7, 0x71B9,
+  0x71BE, 0x71D2, 0x71C9, 0x71D4, 0x71CE, 0x71E0, 0x71EC, 0x71E7,
+  0x71F5, 0x71FC, 0x71F9, 0x71FF, 0x720D, 0x7210, 0x721B, 0x7228,
+  0x722D, 0x722C, 0x7230, 0x7232, 0x723B, 0x723C, 0x723F, 0x7240,
+  0x7246, 0x724B, 0x7258, 0x7274, 0x727E, 0x7282, 0x7281, 0x7287,
+  0x7292, 0x7296, 0x72A2, 0x72A7, 0x72B9, 0x72B2, 0x72C3, 0x72C6,
+  0x72C4, 0x72CE, 0x72D2, 0x72E2, 0x72E0, 0x72E1, 0x72F9, 0x72F7,
+  0x500F, 0x7317, 0x730A, 0x731C, 0x7316, 0x731D, 0x7334, 0x732F,
+  0x7329, 0x7325, 0x733E, 0x734E, 0x734F, 0x9ED8, 0x7357, 0x736A,
+  0x7368, 0x7370, 0x7378, 0x7375, 0x737B, 0x737A, 0x73C8, 0x73B3,
+  0x73CE, 0x73BB, 0x73C0, 0x73E5, 0x73EE, 0x73DE, 0x74A2, 0x7405,
+  0x746F, 0x7425, 0x73F8, 0x7432, 0x743A, 0x7455, 0x743F, 0x745F,
+  0x7459, 0x7441, 0x745C, 0x7469, 0x7470, 0x7463, 0x746A, 0x7476,
+  0x747E, 0x748B, 0x749E, 0x74A7, 0x74CA, 0x74CF, 0x74D4, 0x73F1,
+  0x74E0, 0x74E3, 0x74E7, 0x74E9, 0x74EE, 0x74F2, 0x74F0, 0x74F1,
+  0x74F8, 0x74F7, 0x7504, 0x7503, 0x7505, 0x750C, 0x750E, 0x750D,
+  0x7515, 0x7513, 0x751E, 0x7526, 0x752C, 0x753C, 0x7544, 0x754D,
+  0x754A, 0x7549, 0x755B, 0x7546, 0x755A, 0x7569, 0x7564, 0x7567,
+  0x756B, 0x756D, 0x7578, 0x7576, 0x7586, 0x7587, 0x7574, 0x758A,
+  0x7589, 0x7582, 0x7594, 0x759A, 0x759D, 0x75A5, 0x75A3, 0x75C2,
+  0x75B3, 0x75C3, 0x75B5, 0x75BD, 0x75B8, 0x75BC, 0x75B1, 0x75CD,
+  0x75CA, 0x75D2, 0x75D9, 0x75E3, 0x75DE, 0x75FE, 0x75FF, 0x75FC,
+  0x7601, 0x75F0, 0x75FA, 0x75F2, 0x75F3, 0x760B, 0x760D, 0x7609,
+  0x761F, 0x7627, 0x7620, 0x7621, 0x7622, 0x7624, 0x7634, 0x7630,
+  0x763B, 0x7647, 0x7648, 0x7646, 0x765C, 0x7658, 0x7661, 0x7662,
+  0x7668, 0x7669, 0x766A, 0x7667, 0x766C, 0x7670, 0x7672, 0x7676,
+  0x7678, 0x767C, 0x7680, 0x7683, 0x7688, 0x768B, 0x768E, 0x7696,
+  0x7693, 0x7699, 0x769A, 0x76B0, 0x76B4, 0x76B8, 0x76B9, 0x76BA,
+  0x76C2, 0x76CD, 0x76D6, 0x76D2, 0x76DE, 0x76E1, 0x76E5, 0x76E7,
+  0x76EA, 0x862F, 0x76FB, 0x7708, 0x7707, 0x7704, 0x7729, 0x7724,
+  0x771E, 0x7725, 0x7726, 0x771B, 0x7737, 0x7738, 0x7747, 0x775A,
+  0x7768, 0x776B, 0x775B, 0x7765, 0x777F, 0x777E, 0x7779, 0x778E,
+  0x778B, 0x7791, 0x77A0, 0x779E, 0x77B0, 0x77B6, 0x77B9, 0x77BF,
+  0x77BC, 0x77BD, 0x77BB, 0x77C7, 0x77CD, 0x77D7, 0x77DA, 0x77DC,
+  0x77E3, 0x77EE, 0x77FC, 0x780C, 0x7812, 0x7926, 0x7820, 0x792A,
+  0x7845, 0x788E, 0x7874, 0x7886, 0x787C, 0x789A, 0x788C, 0x78A3,
+  0x78B5, 0x78AA, 0x78AF, 0x78D1, 0x78C6, 0x78CB, 0x78D4, 0x78BE,
+  0x78BC, 0x78C5, 0x78CA, 0x78EC, 0x78E7, 0x78DA, 0x78FD, 0x78F4,
+  0x7907, 0x7912, 0x7911, 0x7919, 0x792C, 0x792B, 0x7940, 0x7960,
+  0x7957, 0x795F, 0x795A, 0x7955, 0x7953, 0x797A, 0x797F, 0x798A,
+  0x799D, 0x79A7, 0x9F4B, 0x79AA, 0x79AE, 0x79B3, 0x79B9, 0x79BA,
+  0x79C9, 0x79D5, 0x79E7, 0x79EC, 0x79E1, 0x79E3, 0x7A08, 0x7A0D,
+  0x7A18, 0x7A19, 0x7A20, 0x7A1F, 0x7980, 0x7A31, 0x7A3B, 0x7A3E,
+  0x7A37, 0x7A43, 0x7A57, 0x7A49, 0x7A61, 0x7A62, 0x7A69, 0x9F9D,
+  0x7A70, 0x7A79, 0x7A7D, 0x7A88, 0x7A97, 0x7A95, 0x7A98, 0x7A96,
+  0x7AA9, 0x7AC8, 0x7AB0, 0x7AB6, 0x7AC5, 0x7AC4, 0x7ABF, 0x9083,
+  0x7AC7, 0x7ACA, 0x7ACD, 0x7ACF, 0x7AD5, 0x7AD3, 0x7AD9, 0x7ADA,
+  0x7ADD, 0x7AE1, 0x7AE2, 0x7AE6, 0x7AED, 0x7AF0, 0x7B02, 0x7B0F,
+  0x7B0A, 0x7B06, 0x7B33, 0x7B18, 0x7B19, 0x7B1E, 0x7B35, 0x7B28,
+  0x7B36, 0x7B50, 0x7B7A, 0x7B04, 0x7B4D, 0x7B0B, 0x7B4C, 0x7B45,
+  0x7B75, 0x7B65, 0x7B74, 0x7B67, 0x7B70, 0x7B71, 0x7B6C, 0x7B6E,
+  0x7B9D, 0x7B98, 0x7B9F, 0x7B8D, 0x7B9C, 0x7B9A, 0x7B8B, 0x7B92,
+  0x7B8F, 0x7B5D, 0x7B99, 0x7BCB, 0x7BC1, 0x7BCC, 0x7BCF, 0x7BB4,
+  0x7BC6, 0x7BDD, 0x7BE9, 0x7C11, 0x7C14, 0x7BE6, 0x7BE5, 0x7C60,
+  0x7C00, 0x7C07, 0x7C13, 0x7BF3, 0x7BF7, 0x7C17, 0x7C0D, 0x7BF6,
+  0x7C23, 0x7C27, 0x7C2A, 0x7C1F, 0x7C37, 0x7C2B, 0x7C3D, 0x7C4C,
+  0x7C43, 0x7C54, 0x7C4F, 0x7C40, 0x7C50, 0x7C58, 0x7C5F, 0x7C64,
+  0x7C56, 0x7C65, 0x7C6C, 0x7C75, 0x7C83, 0x7C90, 0x7CA4, 0x7CAD,
+  0x7CA2, 0x7CAB, 0x7CA1, 0x7CA8, 0x7CB3, 0x7CB2, 0x7CB1, 0x7CAE,
+  0x7CB9, 0x7CBD, 0x7CC0, 0x7CC5, 0x7CC2, 0x7CD8, 0x7CD2, 0x7CDC,
+  0x7CE2, 0x9B3B, 0x7CEF, 0x7CF2, 0x7CF4, 0x7CF6, 0x7CFA, 0x7D06,
+  0x7D02, 0x7D1C, 0x7D15, 0x7D0A, 0x7D45, 0x7D4B, 0x7D2E, 0x7D32,
+  0x7D3F, 0x7D35, 0x7D46, 0x7D73, 0x7D56, 0x7D4E, 0x7D72, 0x7D68,
+  0x7D6E, 0x7D4F, 0x7D63, 0x7D93, 0x7D89, 0x7D5B, 0x7D8F, 0x7D7D,
+  0x7D9B, 0x7DBA, 0x7DAE, 0x7DA3, 0x7DB5, 0x7DC7, 0x7DBD, 0x7DAB,
+  0x7E3D, 0x7DA2, 0x7DAF, 0x7DDC, 0x7DB8, 0x7D9F, 0x7DB0, 0x7DD8,
+  0x7DDD, 0x7DE4, 0x7DDE, 0x7DFB, 0x7DF2, 0x7DE1, 0x7E05, 0x7E0A,
+  0x7E23, 0x7E21, 0x7E12, 0x7E31, 0x7E1F, 0x7E09, 0x7E0B, 0x7E22,
+  0x7E46, 0x7E66, 0x7E3B, 0x7E35, 0x7E39, 0x7E43, 0x7E37, 0x7E32,
+  0x7E3A, 0x7E67, 0x7E5D, 0x7E56, 0x7E5E, 0x7E59, 0x7E5A, 0x7E79,
+  0x7E6A, 0x7E69, 0x7E7C, 0x7E7B, 0x7E83, 0x7DD5, 0x7E7D, 0x8FAE,
+  0x7E7F, 0x7E88, 0x7E89, 0x7E8C, 0x7E92, 0x7E90, 0x7E93, 0x7E94,
+  0x7E96, 0x7E8E, 0x7E9B, 0x7E9C, 0x7F38, 0x7F3A, 0x7F45, 0x7F4C,
+  0x7F4D, 0x7F4E, 0x7F50, 0x7F51, 0x7F55, 0x7F54, 0x7F58, 0x7F5F,
+  0x7F60, 0x7F68, 0x7F69, 0x7F67, 0x7F78, 0x7F82, 0x7F86, 0x7F83,
+  0x7F88, 0x7F87, 0x7F8C, 0x7F94, 0x7F9E, 0x7F9D, 0x7F9A, 0x7FA3,
+  0x7FAF, 0x7FB2, 0x7FB9, 0x7FAE, 0x7FB6, 0x7FB8, 0x8B71, 0x7FC5,
+  0x7FC6, 0x7FCA, 0x7FD5, 0x7FD4, 0x7FE1, 0x7FE6, 0x7FE9, 0x7FF3,
+  0x7FF9, 0x98DC, 0x8006, 0x8004, 0x800B, 0x8012, 0x8018, 0x8019,
+  0x801C, 0x8021, 0x8028, 0x803F, 0x803B, 0x804A, 0x8046, 0x8052,
+  0x8058, 0x805A, 0x805F, 0x8062, 0x8068, 0x8073, 0x8072, 0x8070,
+  0x8076, 0x8079, 0x807D, 0x807F, 0x8084, 0x8086, 0x8085, 0x809B,
+  0x8093, 0x809A, 0x80AD, 0x5190, 0x80AC, 0x80DB, 0x80E5, 0x80D9,
+  0x80DD, 0x80C4, 0x80DA, 0x80D6, 0x8109, 0x80EF, 0x80F1, 0x811B,
+  0x8129, 0x8123, 0x812F, 0x814B, 0x968B, 0x8146, 0x813E, 0x8153,
+  0x8151, 0x80FC, 0x8171, 0x816E, 0x8165, 0x8166, 0x8174, 0x8183,
+  0x8188, 0x818A, 0x8180, 0x8182, 0x81A0, 0x8195, 0x81A4, 0x81A3,
+  0x815F, 0x8193, 0x81A9, 0x81B0, 0x81B5, 0x81BE, 0x81B8, 0x81BD,
+  0x81C0, 0x81C2, 0x81BA, 0x81C9, 0x81CD, 0x81D1, 0x81D9, 0x81D8,
+  0x81C8, 0x81DA, 0x81DF, 0x81E0, 0x81E7, 0x81FA, 0x81FB, 0x81FE,
+  0x8201, 0x8202, 0x8205, 0x8207, 0x820A, 0x820D, 0x8210, 0x8216,
+  0x8229, 0x822B, 0x8238, 0x8233, 0x8240, 0x8259, 0x8258, 0x825D,
+  0x825A, 0x825F, 0x8264, 0x8262, 0x8268, 0x826A, 0x826B, 0x822E,
+  0x8271, 0x8277, 0x8278, 0x827E, 0x828D, 0x8292, 0x82AB, 0x829F,
+  0x82BB, 0x82AC, 0x82E1, 0x82E3, 0x82DF, 0x82D2, 0x82F4, 0x82F3,
+  0x82FA, 0x8393, 0x8303, 0x82FB, 0x82F9, 0x82DE, 0x8306, 0x82DC,
+  0x8309, 0x82D9, 0x8335, 0x8334, 0x8316, 0x8332, 0x8331, 0x8340,
+  0x8339, 0x8350, 0x8345, 0x832F, 0x832B, 0x8317, 0x8318, 0x8385,
+  0x839A, 0x83AA, 0x839F, 0x83A2, 0x8396, 0x8323, 0x838E, 0x8387,
+  0x838A, 0x837C, 0x83B5, 0x8373, 0x8375, 0x83A0, 0x8389, 0x83A8,
+  0x83F4, 0x8413, 0x83EB, 0x83CE, 0x83FD, 0x8403, 0x83D8, 0x840B,
+  0x83C1, 0x83F7, 0x8407, 0x83E0, 0x83F2, 0x840D, 0x8422, 0x8420,
+  0x83BD, 0x8438, 0x8506, 0x83FB, 0x846D, 0x842A, 0x843C, 0x855A,
+  0x8484, 0x8477, 0x846B, 0x84AD, 0x846E, 0x8482, 0x8469, 0x8446,
+  0x842C, 0x846F, 0x8479, 0x8435, 0x84CA, 0x8462, 0x84B9, 0x84BF,
+  0x849F, 0x84D9, 0x84CD, 0x84BB, 0x84DA, 0x84D0, 0x84C1, 0x84C6,
+  0x84D6, 0x84A1, 0x8521, 0x84FF, 0x84F4, 0x8517, 0x8518, 0x852C,
+  0x851F, 0x8515, 0x8514, 0x84FC, 0x8540, 0x8563, 0x8558, 0x8548,
+  0x8541, 0x8602, 0x854B, 0x8555, 0x8580, 0x85A4, 0x8588, 0x8591,
+  0x858A, 0x85A8, 0x856D, 0x8594, 0x859B, 0x85EA, 0x8587, 0x859C,
+  0x8577, 0x857E, 0x8590, 0x85C9, 0x85BA, 0x85CF, 0x85B9, 0x85D0,
+  0x85D5, 0x85DD, 0x85E5, 0x85DC, 0x85F9, 0x860A, 0x8613, 0x860B,
+  0x85FE, 0x85FA, 0x8606, 0x8622, 0x861A, 0x8630, 0x863F, 0x864D,
+  0x4E55, 0x8654, 0x865F, 0x8667, 0x8671, 0x8693, 0x86A3, 0x86A9,
+  0x86AA, 0x868B, 0x868C, 0x86B6, 0x86AF, 0x86C4, 0x86C6, 0x86B0,
+  0x86C9, 0x8823, 0x86AB, 0x86D4, 0x86DE, 0x86E9, 0x86EC, 0x86DF,
+  0x86DB, 0x86EF, 0x8712, 0x8706, 0x8708, 0x8700, 0x8703, 0x86FB,
+  0x8711, 0x8709, 0x870D, 0x86F9, 0x870A, 0x8734, 0x873F, 0x8737,
+  0x873B, 0x8725, 0x8729, 0x871A, 0x8760, 0x875F, 0x8778, 0x874C,
+  0x874E, 0x8774, 0x8757, 0x8768, 0x876E, 0x8759, 0x8753, 0x8763,
+  0x876A, 0x8805, 0x87A2, 0x879F, 0x8782, 0x87AF, 0x87CB, 0x87BD,
+  0x87C0, 0x87D0, 0x96D6, 0x87AB, 0x87C4, 0x87B3, 0x87C7, 0x87C6,
+  0x87BB, 0x87EF, 0x87F2, 0x87E0, 0x880F, 0x880D, 0x87FE, 0x87F6,
+  0x87F7, 0x880E, 0x87D2, 0x8811, 0x8816, 0x8815, 0x8822, 0x8821,
+  0x8831, 0x8836, 0x8839, 0x8827, 0x883B, 0x8844, 0x8842, 0x8852,
+  0x8859, 0x885E, 0x8862, 0x886B, 0x8881, 0x887E, 0x889E, 0x8875,
+  0x887D, 0x88B5, 0x8872, 0x8882, 0x8897, 0x8892, 0x88AE, 0x8899,
+  0x88A2, 0x888D, 0x88A4, 0x88B0, 0x88BF, 0x88B1, 0x88C3, 0x88C4,
+  0x88D4, 0x88D8, 0x88D9, 0x88DD, 0x88F9, 0x8902, 0x88FC, 0x88F4,
+  0x88E8, 0x88F2, 0x8904, 0x890C, 0x890A, 0x8913, 0x8943, 0x891E,
+  0x8925, 0x892A, 0x892B, 0x8941, 0x8944, 0x893B, 0x8936, 0x8938,
+  0x894C, 0x891D, 0x8960, 0x895E, 0x8966, 0x8964, 0x896D, 0x896A,
+  0x896F, 0x8974, 0x8977, 0x897E, 0x8983, 0x8988, 0x898A, 0x8993,
+  0x8998, 0x89A1, 0x89A9, 0x89A6, 0x89AC, 0x89AF, 0x89B2, 0x89BA,
+  0x89BD, 0x89BF, 0x89C0, 0x89DA, 0x89DC, 0x89DD, 0x89E7, 0x89F4,
+  0x89F8, 0x8A03, 0x8A16, 0x8A10, 0x8A0C, 0x8A1B, 0x8A1D, 0x8A25,
+  0x8A36, 0x8A41, 0x8A5B, 0x8A52, 0x8A46, 0x8A48, 0x8A7C, 0x8A6D,
+  0x8A6C, 0x8A62, 0x8A85, 0x8A82, 0x8A84, 0x8AA8, 0x8AA1, 0x8A91,
+  0x8AA5, 0x8AA6, 0x8A9A, 0x8AA3, 0x8AC4, 0x8ACD, 0x8AC2, 0x8ADA,
+  0x8AEB, 0x8AF3, 0x8AE7, 0x8AE4, 0x8AF1, 0x8B14, 0x8AE0, 0x8AE2,
+  0x8AF7, 0x8ADE, 0x8ADB, 0x8B0C, 0x8B07, 0x8B1A, 0x8AE1, 0x8B16,
+  0x8B10, 0x8B17, 0x8B20, 0x8B33, 0x97AB, 0x8B26, 0x8B2B, 0x8B3E,
+  0x8B28, 0x8B41, 0x8B4C, 0x8B4F, 0x8B4E, 0x8B49, 0x8B56, 0x8B5B,
+  0x8B5A, 0x8B6B, 0x8B5F, 0x8B6C, 0x8B6F, 0x8B74, 0x8B7D, 0x8B80,
+  0x8B8C, 0x8B8E, 0x8B92, 0x8B93, 0x8B96, 0x8B99, 0x8B9A, 0x8C3A,
+  0x8C41, 0x8C3F, 0x8C48, 0x8C4C, 0x8C4E, 0x8C50, 0x8C55, 0x8C62,
+  0x8C6C, 0x8C78, 0x8C7A, 0x8C82, 0x8C89, 0x8C85, 0x8C8A, 0x8C8D,
+  0x8C8E, 0x8C94, 0x8C7C, 0x8C98, 0x621D, 0x8CAD, 0x8CAA, 0x8CBD,
+  0x8CB2, 0x8CB3, 0x8CAE, 0x8CB6, 0x8CC8, 0x8CC1, 0x8CE4, 0x8CE3,
+  0x8CDA, 0x8CFD, 0x8CFA, 0x8CFB, 0x8D04, 0x8D05, 0x8D0A, 0x8D07,
+  0x8D0F, 0x8D0D, 0x8D10, 0x9F4E, 0x8D13, 0x8CCD, 0x8D14, 0x8D16,
+  0x8D67, 0x8D6D, 0x8D71, 0x8D73, 0x8D81, 0x8D99, 0x8DC2, 0x8DBE,
+  0x8DBA, 0x8DCF, 0x8DDA, 0x8DD6, 0x8DCC, 0x8DDB, 0x8DCB, 0x8DEA,
+  0x8DEB, 0x8DDF, 0x8DE3, 0x8DFC, 0x8E08, 0x8E09, 0x8DFF, 0x8E1D,
+  0x8E1E, 0x8E10, 0x8E1F, 0x8E42, 0x8E35, 0x8E30, 0x8E34, 0x8E4A,
+  0x8E47, 0x8E49, 0x8E4C, 0x8E50, 0x8E48, 0x8E59, 0x8E64, 0x8E60,
+  0x8E2A, 0x8E63, 0x8E55, 0x8E76, 0x8E72, 0x8E7C, 0x8E81, 0x8E87,
+  0x8E85, 0x8E84, 0x8E8B, 0x8E8A, 0x8E93, 0x8E91, 0x8E94, 0x8E99,
+  0x8EAA, 0x8EA1, 0x8EAC, 0x8EB0, 0x8EC6, 0x8EB1, 0x8EBE, 0x8EC5,
+  0x8EC8, 0x8ECB, 0x8EDB, 0x8EE3, 0x8EFC, 0x8EFB, 0x8EEB, 0x8EFE,
+  0x8F0A, 0x8F05, 0x8F15, 0x8F12, 0x8F19, 0x8F13, 0x8F1C, 0x8F1F,
+  0x8F1B, 0x8F0C, 0x8F26, 0x8F33, 0x8F3B, 0x8F39, 0x8F45, 0x8F42,
+  0x8F3E, 0x8F4C, 0x8F49, 0x8F46, 0x8F4E, 0x8F57, 0x8F5C, 0x8F62,
+  0x8F63, 0x8F64, 0x8F9C, 0x8F9F, 0x8FA3, 0x8FAD, 0x8FAF, 0x8FB7,
+  0x8FDA, 0x8FE5, 0x8FE2, 0x8FEA, 0x8FEF, 0x9087, 0x8FF4, 0x9005,
+  0x8FF9, 0x8FFA, 0x9011, 0x9015, 0x9021, 0x900D, 0x901E, 0x9016,
+  0x900B, 0x9027, 0x9036, 0x9035, 0x9039, 0x8FF8, 0x904F, 0x9050,
+  0x9051, 0x9052, 0x900E, 0x9049, 0x903E, 0x9056, 0x9058, 0x905E,
+  0x9068, 0x906F, 0x9076, 0x96A8, 0x9072, 0x9082, 0x907D, 0x9081,
+  0x9080, 0x908A, 0x9089, 0x908F, 0x90A8, 0x90AF, 0x90B1, 0x90B5,
+  0x90E2, 0x90E4, 0x6248, 0x90DB, 0x9102, 0x9112, 0x9119, 0x9132,
+  0x9130, 0x914A, 0x9156, 0x9158, 0x9163, 0x9165, 0x9169, 0x9173,
+  0x9172, 0x918B, 0x9189, 0x9182, 0x91A2, 0x91AB, 0x91AF, 0x91AA,
+  0x91B5, 0x91B4, 0x91BA, 0x91C0, 0x91C1, 0x91C9, 0x91CB, 0x91D0,
+  0x91D6, 0x91DF, 0x91E1, 0x91DB, 0x91FC, 0x91F5, 0x91F6, 0x921E,
+  0x91FF, 0x9214, 0x922C, 0x9215, 0x9211, 0x925E, 0x9257, 0x9245,
+  0x9249, 0x9264, 0x9248, 0x9295, 0x923F, 0x924B, 0x9250, 0x929C,
+  0x9296, 0x9293, 0x929B, 0x925A, 0x92CF, 0x92B9, 0x92B7, 0x92E9,
+  0x930F, 0x92FA, 0x9344, 0x932E, 0x9319, 0x9322, 0x931A, 0x9323,
+  0x933A, 0x9335, 0x933B, 0x935C, 0x9360, 0x937C, 0x936E, 0x9356,
+  0x93B0, 0x93AC, 0x93AD, 0x9394, 0x93B9, 0x93D6, 0x93D7, 0x93E8,
+  0x93E5, 0x93D8, 0x93C3, 0x93DD, 0x93D0, 0x93C8, 0x93E4, 0x941A,
+  0x9414, 0x9413, 0x9403, 0x9407, 0x9410, 0x9436, 0x942B, 0x9435,
+  0x9421, 0x943A, 0x9441, 0x9452, 0x9444, 0x945B, 0x9460, 0x9462,
+  0x945E, 0x946A, 0x9229, 0x9470, 0x9475, 0x9477, 0x947D, 0x945A,
+  0x947C, 0x947E, 0x9481, 0x947F, 0x9582, 0x9587, 0x958A, 0x9594,
+  0x9596, 0x9598, 0x9599, 0x95A0, 0x95A8, 0x95A7, 0x95AD, 0x95BC,
+  0x95BB, 0x95B9, 0x95BE, 0x95CA, 0x6FF6, 0x95C3, 0x95CD, 0x95CC,
+  0x95D5, 0x95D4, 0x95D6, 0x95DC, 0x95E1, 0x95E5, 0x95E2, 0x9621,
+  0x9628, 0x962E, 0x962F, 0x9642, 0x964C, 0x964F, 0x964B, 0x9677,
+  0x965C, 0x965E, 0x965D, 0x965F, 0x9666, 0x9672, 0x966C, 0x968D,
+  0x9698, 0x9695, 0x9697, 0x96AA, 0x96A7, 0x96B1, 0x96B2, 0x96B0,
+  0x96B4, 0x96B6, 0x96B8, 0x96B9, 0x96CE, 0x96CB, 0x96C9, 0x96CD,
+  0x894D, 0x96DC, 0x970D, 0x96D5, 0x96F9, 0x9704, 0x9706, 0x9708,
+  0x9713, 0x970E, 0x9711, 0x970F, 0x9716, 0x9719, 0x9724, 0x972A,
+  0x9730, 0x9739, 0x973D, 0x973E, 0x9744, 0x9746, 0x9748, 0x9742,
+  0x9749, 0x975C, 0x9760, 0x9764, 0x9766, 0x9768, 0x52D2, 0x976B,
+  0x9771, 0x9779, 0x9785, 0x977C, 0x9781, 0x977A, 0x9786, 0x978B,
+  0x978F, 0x9790, 0x979C, 0x97A8, 0x97A6, 0x97A3, 0x97B3, 0x97B4,
+  0x97C3, 0x97C6, 0x97C8, 0x97CB, 0x97DC, 0x97ED, 0x9F4F, 0x97F2,
+  0x7ADF, 0x97F6, 0x97F5, 0x980F, 0x980C, 0x9838, 0x9824, 0x9821,
+  0x9837, 0x983D, 0x9846, 0x984F, 0x984B, 0x986B, 0x986F, 0x9870,
+  0x9871, 0x9874, 0x9873, 0x98AA, 0x98AF, 0x98B1, 0x98B6, 0x98C4,
+  0x98C3, 0x98C6, 0x98E9, 0x98EB, 0x9903, 0x9909, 0x9912, 0x9914,
+  0x9918, 0x9921, 0x991D, 0x991E, 0x9924, 0x9920, 0x992C, 0x992E,
+  0x993D, 0x993E, 0x9942, 0x9949, 0x9945, 0x9950, 0x994B, 0x9951,
+  0x9952, 0x994C, 0x9955, 0x9997, 0x9998, 0x99A5, 0x99AD, 0x99AE,
+  0x99BC, 0x99DF, 0x99DB, 0x99DD, 0x99D8, 0x99D1, 0x99ED, 0x99EE,
+  0x99F1, 0x99F2, 0x99FB, 0x99F8, 0x9A01, 0x9A0F, 0x9A05, 0x99E2,
+  0x9A19, 0x9A2B, 0x9A37, 0x9A45, 0x9A42, 0x9A40, 0x9A43, 0x9A3E,
+  0x9A55, 0x9A4D, 0x9A5B, 0x9A57, 0x9A5F, 0x9A62, 0x9A65, 0x9A64,
+  0x9A69, 0x9A6B, 0x9A6A, 0x9AAD, 0x9AB0, 0x9ABC, 0x9AC0, 0x9ACF,
+  0x9AD1, 0x9AD3, 0x9AD4, 0x9ADE, 0x9ADF, 0x9AE2, 0x9AE3, 0x9AE6,
+  0x9AEF, 0x9AEB, 0x9AEE, 0x9AF4, 0x9AF1, 0x9AF7, 0x9AFB, 0x9B06,
+  0x9B18, 0x9B1A, 0x9B1F, 0x9B22, 0x9B23, 0x9B25, 0x9B27, 0x9B28,
+  0x9B29, 0x9B2A, 0x9B2E, 0x9B2F, 0x9B32, 0x9B44, 0x9B43, 0x9B4F,
+  0x9B4D, 0x9B4E, 0x9B51, 0x9B58, 0x9B74, 0x9B93, 0x9B83, 0x9B91,
+  0x9B96, 0x9B97, 0x9B9F, 0x9BA0, 0x9BA8, 0x9BB4, 0x9BC0, 0x9BCA,
+  0x9BB9, 0x9BC6, 0x9BCF, 0x9BD1, 0x9BD2, 0x9BE3, 0x9BE2, 0x9BE4,
+  0x9BD4, 0x9BE1, 0x9C3A, 0x9BF2, 0x9BF1, 0x9BF0, 0x9C15, 0x9C14,
+  0x9C09, 0x9C13, 0x9C0C, 0x9C06, 0x9C08, 0x9C12, 0x9C0A, 0x9C04,
+  0x9C2E, 0x9C1B, 0x9C25, 0x9C24, 0x9C21, 0x9C30, 0x9C47, 0x9C32,
+  0x9C46, 0x9C3E, 0x9C5A, 0x9C60, 0x9C67, 0x9C76, 0x9C78, 0x9CE7,
+  0x9CEC, 0x9CF0, 0x9D09, 0x9D08, 0x9CEB, 0x9D03, 0x9D06, 0x9D2A,
+  0x9D26, 0x9DAF, 0x9D23, 0x9D1F, 0x9D44, 0x9D15, 0x9D12, 0x9D41,
+  0x9D3F, 0x9D3E, 0x9D46, 0x9D48, 0x9D5D, 0x9D5E, 0x9D64, 0x9D51,
+  0x9D50, 0x9D59, 0x9D72, 0x9D89, 0x9D87, 0x9DAB, 0x9D6F, 0x9D7A,
+  0x9D9A, 0x9DA4, 0x9DA9, 0x9DB2, 0x9DC4, 0x9DC1, 0x9DBB, 0x9DB8,
+  0x9DBA, 0x9DC6, 0x9DCF, 0x9DC2, 0x9DD9, 0x9DD3, 0x9DF8, 0x9DE6,
+  0x9DED, 0x9DEF, 0x9DFD, 0x9E1A, 0x9E1B, 0x9E1E, 0x9E75, 0x9E79,
+  0x9E7D, 0x9E81, 0x9E88, 0x9E8B, 0x9E8C, 0x9E92, 0x9E95, 0x9E91,
+  0x9E9D, 0x9EA5, 0x9EA9, 0x9EB8, 0x9EAA, 0x9EAD, 0x9761, 0x9ECC,
+  0x9ECE, 0x9ECF, 0x9ED0, 0x9ED4, 0x9EDC, 0x9EDE, 0x9EDD, 0x9EE0,
+  0x9EE5, 0x9EE8, 0x9EEF, 0x9EF4, 0x9EF6, 0x9EF7, 0x9EF9, 0x9EFB,
+  0x9EFC, 0x9EFD, 0x9F07, 0x9F08, 0x76B7, 0x9F15, 0x9F21, 0x9F2C,
+  0x9F3E, 0x9F4A, 0x9F52, 0x9F54, 0x9F63, 0x9F5F, 0x9F60, 0x9F61,
+  0x9F66, 0x9F67, 0x9F6C, 0x9F6A, 0x9F77, 0x9F72, 0x9F76, 0x9F95,
+  0x9F9C, 0x9FA0, 0x582F, 0x69C7, 0x9059, 0x7464, 0x51DC, 0x7199,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x7E8A, 0x891C, 0x9348, 0x9288, 0x84DC, 0x4FC9, 0x70BB, 0x6631,
+  0x68C8, 0x92F9, 0x66FB, 0x5F45, 0x4E28, 0x4EE1, 0x4EFC, 0x4F00,
+  0x4F03, 0x4F39, 0x4F56, 0x4F92, 0x4F8A, 0x4F9A, 0x4F94, 0x4FCD,
+  0x5040, 0x5022, 0x4FFF, 0x501E, 0x5046, 0x5070, 0x5042, 0x5094,
+  0x50F4, 0x50D8, 0x514A, 0x5164, 0x519D, 0x51BE, 0x51EC, 0x5215,
+  0x529C, 0x52A6, 0x52C0, 0x52DB, 0x5300, 0x5307, 0x5324, 0x5372,
+  0x5393, 0x53B2, 0x53DD, 0xFA0E, 0x549C, 0x548A, 0x54A9, 0x54FF,
+  0x5586, 0x5759, 0x5765, 0x57AC, 0x57C8, 0x57C7, 0xFA0F, 0xFA10,
+  0x589E, 0x58B2, 0x590B, 0x5953, 0x595B, 0x595D, 0x5963, 0x59A4,
+  0x59BA, 0x5B56, 0x5BC0, 0x752F, 0x5BD8, 0x5BEC, 0x5C1E, 0x5CA6,
+  0x5CBA, 0x5CF5, 0x5D27, 0x5D53, 0xFA11, 0x5D42, 0x5D6D, 0x5DB8,
+  0x5DB9, 0x5DD0, 0x5F21, 0x5F34, 0x5F67, 0x5FB7, 0x5FDE, 0x605D,
+  0x6085, 0x608A, 0x60DE, 0x60D5, 0x6120, 0x60F2, 0x6111, 0x6137,
+  0x6130, 0x6198, 0x6213, 0x62A6, 0x63F5, 0x6460, 0x649D, 0x64CE,
+  0x654E, 0x6600, 0x6615, 0x663B, 0x6609, 0x662E, 0x661E, 0x6624,
+  0x6665, 0x6657, 0x6659, 0xFA12, 0x6673, 0x6699, 0x66A0, 0x66B2,
+  0x66BF, 0x66FA, 0x670E, 0xF929, 0x6766, 0x67BB, 0x6852, 0x67C0,
+  0x6801, 0x6844, 0x68CF, 0xFA13, 0x6968, 0xFA14, 0x6998, 0x69E2,
+  0x6A30, 0x6A6B, 0x6A46, 0x6A73, 0x6A7E, 0x6AE2, 0x6AE4, 0x6BD6,
+  0x6C3F, 0x6C5C, 0x6C86, 0x6C6F, 0x6CDA, 0x6D04, 0x6D87, 0x6D6F,
+  0x6D96, 0x6DAC, 0x6DCF, 0x6DF8, 0x6DF2, 0x6DFC, 0x6E39, 0x6E5C,
+  0x6E27, 0x6E3C, 0x6EBF, 0x6F88, 0x6FB5, 0x6FF5, 0x7005, 0x7007,
+  0x7028, 0x7085, 0x70AB, 0x710F, 0x7104, 0x715C, 0x7146, 0x7147,
+  0xFA15, 0x71C1, 0x71FE, 0x72B1, 0x72BE, 0x7324, 0xFA16, 0x7377,
+  0x73BD, 0x73C9, 0x73D6, 0x73E3, 0x73D2, 0x7407, 0x73F5, 0x7426,
+  0x742A, 0x7429, 0x742E, 0x7462, 0x7489, 0x749F, 0x7501, 0x756F,
+  0x7682, 0x769C, 0x769E, 0x769B, 0x76A6, 0xFA17, 0x7746, 0x52AF,
+  0x7821, 0x784E, 0x7864, 0x787A, 0x7930, 0xFA18, 0xFA19, 0xFA1A,
+  0x7994, 0xFA1B, 0x799B, 0x7AD1, 0x7AE7, 0xFA1C, 0x7AEB, 0x7B9E,
+  0xFA1D, 0x7D48, 0x7D5C, 0x7DB7, 0x7DA0, 0x7DD6, 0x7E52, 0x7F47,
+  0x7FA1, 0xFA1E, 0x8301, 0x8362, 0x837F, 0x83C7, 0x83F6, 0x8448,
+  0x84B4, 0x8553, 0x8559, 0x856B, 0xFA1F, 0x85B0, 0xFA20, 0xFA21,
+  0x8807, 0x88F5, 0x8A12, 0x8A37, 0x8A79, 0x8AA7, 0x8ABE, 0x8ADF,
+  0xFA22, 0x8AF6, 0x8B53, 0x8B7F, 0x8CF0, 0x8CF4, 0x8D12, 0x8D76,
+  0xFA23, 0x8ECF, 0xFA24, 0xFA25, 0x9067, 0x90DE, 0xFA26, 0x9115,
+  0x9127, 0x91DA, 0x91D7, 0x91DE, 0x91ED, 0x91EE, 0x91E4, 0x91E5,
+  0x9206, 0x9210, 0x920A, 0x923A, 0x9240, 0x923C, 0x924E, 0x9259,
+  0x9251, 0x9239, 0x9267, 0x92A7, 0x9277, 0x9278, 0x92E7, 0x92D7,
+  0x92D9, 0x92D0, 0xFA27, 0x92D5, 0x92E0, 0x92D3, 0x9325, 0x9321,
+  0x92FB, 0xFA28, 0x931E, 0x92FF, 0x931D, 0x9302, 0x9370, 0x9357,
+  0x93A4, 0x93C6, 0x93DE, 0x93F8, 0x9431, 0x9445, 0x9448, 0x9592,
+  0xF9DC, 0xFA29, 0x969D, 0x96AF, 0x9733, 0x973B, 0x9743, 0x974D,
+  0x974F, 0x9751, 0x9755, 0x9857, 0x9865, 0xFA2A, 0xFA2B, 0x9927,
+  0xFA2C, 0x999E, 0x9A4E, 0x9AD9, 0x9ADC, 0x9B75, 0x9B72, 0x9B8F,
+  0x9BB1, 0x9BBB, 0x9C00, 0x9D70, 0x9D6B, 0xFA2D, 0x9E19, 0x9ED1,
+  0x30FB, 0x30FB, 0x2170, 0x2171, 0x2172, 0x2173, 0x2174, 0x2175,
+  0x2176, 0x2177, 0x2178, 0x2179, 0xFFE2, 0xFFE4, 0xFF07, 0xFF02,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0xE000, 0xE001, 0xE002, 0xE003,
+  0xE004, 0xE005, 0xE006, 0xE007, 0xE008, 0xE009, 0xE00A, 0xE00B,
+  0xE00C, 0xE00D, 0xE00E, 0xE00F, 0xE010, 0xE011, 0xE012, 0xE013,
+  0xE014, 0xE015, 0xE016, 0xE017, 0xE018, 0xE019, 0xE01A, 0xE01B,
+  0xE01C, 0xE01D, 0xE01E, 0xE01F, 0xE020, 0xE021, 0xE022, 0xE023,
+  0xE024, 0xE025, 0xE026, 0xE027, 0xE028, 0xE029, 0xE02A, 0xE02B,
+  0xE02C, 0xE02D, 0xE02E, 0xE02F, 0xE030, 0xE031, 0xE032, 0xE033,
+  0xE034, 0xE035, 0xE036, 0xE037, 0xE038, 0xE039, 0xE03A, 0xE03B,
+  0xE03C, 0xE03D, 0xE03E, 0xE03F, 0xE040, 0xE041, 0xE042, 0xE043,
+  0xE044, 0xE045, 0xE046, 0xE047, 0xE048, 0xE049, 0xE04A, 0xE04B,
+  0xE04C, 0xE04D, 0xE04E, 0xE04F, 0xE050, 0xE051, 0xE052, 0xE053,
+  0xE054, 0xE055, 0xE056, 0xE057, 0xE058, 0xE059, 0xE05A, 0xE05B,
+  0xE05C, 0xE05D, 0xE05E, 0xE05F, 0xE060, 0xE061, 0xE062, 0xE063,
+  0xE064, 0xE065, 0xE066, 0xE067, 0xE068, 0xE069, 0xE06A, 0xE06B,
+  0xE06C, 0xE06D, 0xE06E, 0xE06F, 0xE070, 0xE071, 0xE072, 0xE073,
+  0xE074, 0xE075, 0xE076, 0xE077, 0xE078, 0xE079, 0xE07A, 0xE07B,
+  0xE07C, 0xE07D, 0xE07E, 0xE07F, 0xE080, 0xE081, 0xE082, 0xE083,
+  0xE084, 0xE085, 0xE086, 0xE087, 0xE088, 0xE089, 0xE08A, 0xE08B,
+  0xE08C, 0xE08D, 0xE08E, 0xE08F, 0xE090, 0xE091, 0xE092, 0xE093,
+  0xE094, 0xE095, 0xE096, 0xE097, 0xE098, 0xE099, 0xE09A, 0xE09B,
+  0xE09C, 0xE09D, 0xE09E, 0xE09F, 0xE0A0, 0xE0A1, 0xE0A2, 0xE0A3,
+  0xE0A4, 0xE0A5, 0xE0A6, 0xE0A7, 0xE0A8, 0xE0A9, 0xE0AA, 0xE0AB,
+  0xE0AC, 0xE0AD, 0xE0AE, 0xE0AF, 0xE0B0, 0xE0B1, 0xE0B2, 0xE0B3,
+  0xE0B4, 0xE0B5, 0xE0B6, 0xE0B7, 0xE0B8, 0xE0B9, 0xE0BA, 0xE0BB,
+  0xE0BC, 0xE0BD, 0xE0BE, 0xE0BF, 0xE0C0, 0xE0C1, 0xE0C2, 0xE0C3,
+  0xE0C4, 0xE0C5, 0xE0C6, 0xE0C7, 0xE0C8, 0xE0C9, 0xE0CA, 0xE0CB,
+  0xE0CC, 0xE0CD, 0xE0CE, 0xE0CF, 0xE0D0, 0xE0D1, 0xE0D2, 0xE0D3,
+  0xE0D4, 0xE0D5, 0xE0D6, 0xE0D7, 0xE0D8, 0xE0D9, 0xE0DA, 0xE0DB,
+  0xE0DC, 0xE0DD, 0xE0DE, 0xE0DF, 0xE0E0, 0xE0E1, 0xE0E2, 0xE0E3,
+  0xE0E4, 0xE0E5, 0xE0E6, 0xE0E7, 0xE0E8, 0xE0E9, 0xE0EA, 0xE0EB,
+  0xE0EC, 0xE0ED, 0xE0EE, 0xE0EF, 0xE0F0, 0xE0F1, 0xE0F2, 0xE0F3,
+  0xE0F4, 0xE0F5, 0xE0F6, 0xE0F7, 0xE0F8, 0xE0F9, 0xE0FA, 0xE0FB,
+  0xE0FC, 0xE0FD, 0xE0FE, 0xE0FF, 0xE100, 0xE101, 0xE102, 0xE103,
+  0xE104, 0xE105, 0xE106, 0xE107, 0xE108, 0xE109, 0xE10A, 0xE10B,
+  0xE10C, 0xE10D, 0xE10E, 0xE10F, 0xE110, 0xE111, 0xE112, 0xE113,
+  0xE114, 0xE115, 0xE116, 0xE117, 0xE118, 0xE119, 0xE11A, 0xE11B,
+  0xE11C, 0xE11D, 0xE11E, 0xE11F, 0xE120, 0xE121, 0xE122, 0xE123,
+  0xE124, 0xE125, 0xE126, 0xE127, 0xE128, 0xE129, 0xE12A, 0xE12B,
+  0xE12C, 0xE12D, 0xE12E, 0xE12F, 0xE130, 0xE131, 0xE132, 0xE133,
+  0xE134, 0xE135, 0xE136, 0xE137, 0xE138, 0xE139, 0xE13A, 0xE13B,
+  0xE13C, 0xE13D, 0xE13E, 0xE13F, 0xE140, 0xE141, 0xE142, 0xE143,
+  0xE144, 0xE145, 0xE146, 0xE147, 0xE148, 0xE149, 0xE14A, 0xE14B,
+  0xE14C, 0xE14D, 0xE14E, 0xE14F, 0xE150, 0xE151, 0xE152, 0xE153,
+  0xE154, 0xE155, 0xE156, 0xE157, 0xE158, 0xE159, 0xE15A, 0xE15B,
+  0xE15C, 0xE15D, 0xE15E, 0xE15F, 0xE160, 0xE161, 0xE162, 0xE163,
+  0xE164, 0xE165, 0xE166, 0xE167, 0xE168, 0xE169, 0xE16A, 0xE16B,
+  0xE16C, 0xE16D, 0xE16E, 0xE16F, 0xE170, 0xE171, 0xE172, 0xE173,
+  0xE174, 0xE175, 0xE176, 0xE177, 0xE178, 0xE179, 0xE17A, 0xE17B,
+  0xE17C, 0xE17D, 0xE17E, 0xE17F, 0xE180, 0xE181, 0xE182, 0xE183,
+  0xE184, 0xE185, 0xE186, 0xE187, 0xE188, 0xE189, 0xE18A, 0xE18B,
+  0xE18C, 0xE18D, 0xE18E, 0xE18F, 0xE190, 0xE191, 0xE192, 0xE193,
+  0xE194, 0xE195, 0xE196, 0xE197, 0xE198, 0xE199, 0xE19A, 0xE19B,
+  0xE19C, 0xE19D, 0xE19E, 0xE19F, 0xE1A0, 0xE1A1, 0xE1A2, 0xE1A3,
+  0xE1A4, 0xE1A5, 0xE1A6, 0xE1A7, 0xE1A8, 0xE1A9, 0xE1AA, 0xE1AB,
+  0xE1AC, 0xE1AD, 0xE1AE, 0xE1AF, 0xE1B0, 0xE1B1, 0xE1B2, 0xE1B3,
+  0xE1B4, 0xE1B5, 0xE1B6, 0xE1B7, 0xE1B8, 0xE1B9, 0xE1BA, 0xE1BB,
+  0xE1BC, 0xE1BD, 0xE1BE, 0xE1BF, 0xE1C0, 0xE1C1, 0xE1C2, 0xE1C3,
+  0xE1C4, 0xE1C5, 0xE1C6, 0xE1C7, 0xE1C8, 0xE1C9, 0xE1CA, 0xE1CB,
+  0xE1CC, 0xE1CD, 0xE1CE, 0xE1CF, 0xE1D0, 0xE1D1, 0xE1D2, 0xE1D3,
+  0xE1D4, 0xE1D5, 0xE1D6, 0xE1D7, 0xE1D8, 0xE1D9, 0xE1DA, 0xE1DB,
+  0xE1DC, 0xE1DD, 0xE1DE, 0xE1DF, 0xE1E0, 0xE1E1, 0xE1E2, 0xE1E3,
+  0xE1E4, 0xE1E5, 0xE1E6, 0xE1E7, 0xE1E8, 0xE1E9, 0xE1EA, 0xE1EB,
+  0xE1EC, 0xE1ED, 0xE1EE, 0xE1EF, 0xE1F0, 0xE1F1, 0xE1F2, 0xE1F3,
+  0xE1F4, 0xE1F5, 0xE1F6, 0xE1F7, 0xE1F8, 0xE1F9, 0xE1FA, 0xE1FB,
+  0xE1FC, 0xE1FD, 0xE1FE, 0xE1FF, 0xE200, 0xE201, 0xE202, 0xE203,
+  0xE204, 0xE205, 0xE206, 0xE207, 0xE208, 0xE209, 0xE20A, 0xE20B,
+  0xE20C, 0xE20D, 0xE20E, 0xE20F, 0xE210, 0xE211, 0xE212, 0xE213,
+  0xE214, 0xE215, 0xE216, 0xE217, 0xE218, 0xE219, 0xE21A, 0xE21B,
+  0xE21C, 0xE21D, 0xE21E, 0xE21F, 0xE220, 0xE221, 0xE222, 0xE223,
+  0xE224, 0xE225, 0xE226, 0xE227, 0xE228, 0xE229, 0xE22A, 0xE22B,
+  0xE22C, 0xE22D, 0xE22E, 0xE22F, 0xE230, 0xE231, 0xE232, 0xE233,
+  0xE234, 0xE235, 0xE236, 0xE237, 0xE238, 0xE239, 0xE23A, 0xE23B,
+  0xE23C, 0xE23D, 0xE23E, 0xE23F, 0xE240, 0xE241, 0xE242, 0xE243,
+  0xE244, 0xE245, 0xE246, 0xE247, 0xE248, 0xE249, 0xE24A, 0xE24B,
+  0xE24C, 0xE24D, 0xE24E, 0xE24F, 0xE250, 0xE251, 0xE252, 0xE253,
+  0xE254, 0xE255, 0xE256, 0xE257, 0xE258, 0xE259, 0xE25A, 0xE25B,
+  0xE25C, 0xE25D, 0xE25E, 0xE25F, 0xE260, 0xE261, 0xE262, 0xE263,
+  0xE264, 0xE265, 0xE266, 0xE267, 0xE268, 0xE269, 0xE26A, 0xE26B,
+  0xE26C, 0xE26D, 0xE26E, 0xE26F, 0xE270, 0xE271, 0xE272, 0xE273,
+  0xE274, 0xE275, 0xE276, 0xE277, 0xE278, 0xE279, 0xE27A, 0xE27B,
+  0xE27C, 0xE27D, 0xE27E, 0xE27F, 0xE280, 0xE281, 0xE282, 0xE283,
+  0xE284, 0xE285, 0xE286, 0xE287, 0xE288, 0xE289, 0xE28A, 0xE28B,
+  0xE28C, 0xE28D, 0xE28E, 0xE28F, 0xE290, 0xE291, 0xE292, 0xE293,
+  0xE294, 0xE295, 0xE296, 0xE297, 0xE298, 0xE299, 0xE29A, 0xE29B,
+  0xE29C, 0xE29D, 0xE29E, 0xE29F, 0xE2A0, 0xE2A1, 0xE2A2, 0xE2A3,
+  0xE2A4, 0xE2A5, 0xE2A6, 0xE2A7, 0xE2A8, 0xE2A9, 0xE2AA, 0xE2AB,
+  0xE2AC, 0xE2AD, 0xE2AE, 0xE2AF, 0xE2B0, 0xE2B1, 0xE2B2, 0xE2B3,
+  0xE2B4, 0xE2B5, 0xE2B6, 0xE2B7, 0xE2B8, 0xE2B9, 0xE2BA, 0xE2BB,
+  0xE2BC, 0xE2BD, 0xE2BE, 0xE2BF, 0xE2C0, 0xE2C1, 0xE2C2, 0xE2C3,
+  0xE2C4, 0xE2C5, 0xE2C6, 0xE2C7, 0xE2C8, 0xE2C9, 0xE2CA, 0xE2CB,
+  0xE2CC, 0xE2CD, 0xE2CE, 0xE2CF, 0xE2D0, 0xE2D1, 0xE2D2, 0xE2D3,
+  0xE2D4, 0xE2D5, 0xE2D6, 0xE2D7, 0xE2D8, 0xE2D9, 0xE2DA, 0xE2DB,
+  0xE2DC, 0xE2DD, 0xE2DE, 0xE2DF, 0xE2E0, 0xE2E1, 0xE2E2, 0xE2E3,
+  0xE2E4, 0xE2E5, 0xE2E6, 0xE2E7, 0xE2E8, 0xE2E9, 0xE2EA, 0xE2EB,
+  0xE2EC, 0xE2ED, 0xE2EE, 0xE2EF, 0xE2F0, 0xE2F1, 0xE2F2, 0xE2F3,
+  0xE2F4, 0xE2F5, 0xE2F6, 0xE2F7, 0xE2F8, 0xE2F9, 0xE2FA, 0xE2FB,
+  0xE2FC, 0xE2FD, 0xE2FE, 0xE2FF, 0xE300, 0xE301, 0xE302, 0xE303,
+  0xE304, 0xE305, 0xE306, 0xE307, 0xE308, 0xE309, 0xE30A, 0xE30B,
+  0xE30C, 0xE30D, 0xE30E, 0xE30F, 0xE310, 0xE311, 0xE312, 0xE313,
+  0xE314, 0xE315, 0xE316, 0xE317, 0xE318, 0xE319, 0xE31A, 0xE31B,
+  0xE31C, 0xE31D, 0xE31E, 0xE31F, 0xE320, 0xE321, 0xE322, 0xE323,
+  0xE324, 0xE325, 0xE326, 0xE327, 0xE328, 0xE329, 0xE32A, 0xE32B,
+  0xE32C, 0xE32D, 0xE32E, 0xE32F, 0xE330, 0xE331, 0xE332, 0xE333,
+  0xE334, 0xE335, 0xE336, 0xE337, 0xE338, 0xE339, 0xE33A, 0xE33B,
+  0xE33C, 0xE33D, 0xE33E, 0xE33F, 0xE340, 0xE341, 0xE342, 0xE343,
+  0xE344, 0xE345, 0xE346, 0xE347, 0xE348, 0xE349, 0xE34A, 0xE34B,
+  0xE34C, 0xE34D, 0xE34E, 0xE34F, 0xE350, 0xE351, 0xE352, 0xE353,
+  0xE354, 0xE355, 0xE356, 0xE357, 0xE358, 0xE359, 0xE35A, 0xE35B,
+  0xE35C, 0xE35D, 0xE35E, 0xE35F, 0xE360, 0xE361, 0xE362, 0xE363,
+  0xE364, 0xE365, 0xE366, 0xE367, 0xE368, 0xE369, 0xE36A, 0xE36B,
+  0xE36C, 0xE36D, 0xE36E, 0xE36F, 0xE370, 0xE371, 0xE372, 0xE373,
+  0xE374, 0xE375, 0xE376, 0xE377, 0xE378, 0xE379, 0xE37A, 0xE37B,
+  0xE37C, 0xE37D, 0xE37E, 0xE37F, 0xE380, 0xE381, 0xE382, 0xE383,
+  0xE384, 0xE385, 0xE386, 0xE387, 0xE388, 0xE389, 0xE38A, 0xE38B,
+  0xE38C, 0xE38D, 0xE38E, 0xE38F, 0xE390, 0xE391, 0xE392, 0xE393,
+  0xE394, 0xE395, 0xE396, 0xE397, 0xE398, 0xE399, 0xE39A, 0xE39B,
+  0xE39C, 0xE39D, 0xE39E, 0xE39F, 0xE3A0, 0xE3A1, 0xE3A2, 0xE3A3,
+  0xE3A4, 0xE3A5, 0xE3A6, 0xE3A7, 0xE3A8, 0xE3A9, 0xE3AA, 0xE3AB,
+  0xE3AC, 0xE3AD, 0xE3AE, 0xE3AF, 0xE3B0, 0xE3B1, 0xE3B2, 0xE3B3,
+  0xE3B4, 0xE3B5, 0xE3B6, 0xE3B7, 0xE3B8, 0xE3B9, 0xE3BA, 0xE3BB,
+  0xE3BC, 0xE3BD, 0xE3BE, 0xE3BF, 0xE3C0, 0xE3C1, 0xE3C2, 0xE3C3,
+  0xE3C4, 0xE3C5, 0xE3C6, 0xE3C7, 0xE3C8, 0xE3C9, 0xE3CA, 0xE3CB,
+  0xE3CC, 0xE3CD, 0xE3CE, 0xE3CF, 0xE3D0, 0xE3D1, 0xE3D2, 0xE3D3,
+  0xE3D4, 0xE3D5, 0xE3D6, 0xE3D7, 0xE3D8, 0xE3D9, 0xE3DA, 0xE3DB,
+  0xE3DC, 0xE3DD, 0xE3DE, 0xE3DF, 0xE3E0, 0xE3E1, 0xE3E2, 0xE3E3,
+  0xE3E4, 0xE3E5, 0xE3E6, 0xE3E7, 0xE3E8, 0xE3E9, 0xE3EA, 0xE3EB,
+  0xE3EC, 0xE3ED, 0xE3EE, 0xE3EF, 0xE3F0, 0xE3F1, 0xE3F2, 0xE3F3,
+  0xE3F4, 0xE3F5, 0xE3F6, 0xE3F7, 0xE3F8, 0xE3F9, 0xE3FA, 0xE3FB,
+  0xE3FC, 0xE3FD, 0xE3FE, 0xE3FF, 0xE400, 0xE401, 0xE402, 0xE403,
+  0xE404, 0xE405, 0xE406, 0xE407, 0xE408, 0xE409, 0xE40A, 0xE40B,
+  0xE40C, 0xE40D, 0xE40E, 0xE40F, 0xE410, 0xE411, 0xE412, 0xE413,
+  0xE414, 0xE415, 0xE416, 0xE417, 0xE418, 0xE419, 0xE41A, 0xE41B,
+  0xE41C, 0xE41D, 0xE41E, 0xE41F, 0xE420, 0xE421, 0xE422, 0xE423,
+  0xE424, 0xE425, 0xE426, 0xE427, 0xE428, 0xE429, 0xE42A, 0xE42B,
+  0xE42C, 0xE42D, 0xE42E, 0xE42F, 0xE430, 0xE431, 0xE432, 0xE433,
+  0xE434, 0xE435, 0xE436, 0xE437, 0xE438, 0xE439, 0xE43A, 0xE43B,
+  0xE43C, 0xE43D, 0xE43E, 0xE43F, 0xE440, 0xE441, 0xE442, 0xE443,
+  0xE444, 0xE445, 0xE446, 0xE447, 0xE448, 0xE449, 0xE44A, 0xE44B,
+  0xE44C, 0xE44D, 0xE44E, 0xE44F, 0xE450, 0xE451, 0xE452, 0xE453,
+  0xE454, 0xE455, 0xE456, 0xE457, 0xE458, 0xE459, 0xE45A, 0xE45B,
+  0xE45C, 0xE45D, 0xE45E, 0xE45F, 0xE460, 0xE461, 0xE462, 0xE463,
+  0xE464, 0xE465, 0xE466, 0xE467, 0xE468, 0xE469, 0xE46A, 0xE46B,
+  0xE46C, 0xE46D, 0xE46E, 0xE46F, 0xE470, 0xE471, 0xE472, 0xE473,
+  0xE474, 0xE475, 0xE476, 0xE477, 0xE478, 0xE479, 0xE47A, 0xE47B,
+  0xE47C, 0xE47D, 0xE47E, 0xE47F, 0xE480, 0xE481, 0xE482, 0xE483,
+  0xE484, 0xE485, 0xE486, 0xE487, 0xE488, 0xE489, 0xE48A, 0xE48B,
+  0xE48C, 0xE48D, 0xE48E, 0xE48F, 0xE490, 0xE491, 0xE492, 0xE493,
+  0xE494, 0xE495, 0xE496, 0xE497, 0xE498, 0xE499, 0xE49A, 0xE49B,
+  0xE49C, 0xE49D, 0xE49E, 0xE49F, 0xE4A0, 0xE4A1, 0xE4A2, 0xE4A3,
+  0xE4A4, 0xE4A5, 0xE4A6, 0xE4A7, 0xE4A8, 0xE4A9, 0xE4AA, 0xE4AB,
+  0xE4AC, 0xE4AD, 0xE4AE, 0xE4AF, 0xE4B0, 0xE4B1, 0xE4B2, 0xE4B3,
+  0xE4B4, 0xE4B5, 0xE4B6, 0xE4B7, 0xE4B8, 0xE4B9, 0xE4BA, 0xE4BB,
+  0xE4BC, 0xE4BD, 0xE4BE, 0xE4BF, 0xE4C0, 0xE4C1, 0xE4C2, 0xE4C3,
+  0xE4C4, 0xE4C5, 0xE4C6, 0xE4C7, 0xE4C8, 0xE4C9, 0xE4CA, 0xE4CB,
+  0xE4CC, 0xE4CD, 0xE4CE, 0xE4CF, 0xE4D0, 0xE4D1, 0xE4D2, 0xE4D3,
+  0xE4D4, 0xE4D5, 0xE4D6, 0xE4D7, 0xE4D8, 0xE4D9, 0xE4DA, 0xE4DB,
+  0xE4DC, 0xE4DD, 0xE4DE, 0xE4DF, 0xE4E0, 0xE4E1, 0xE4E2, 0xE4E3,
+  0xE4E4, 0xE4E5, 0xE4E6, 0xE4E7, 0xE4E8, 0xE4E9, 0xE4EA, 0xE4EB,
+  0xE4EC, 0xE4ED, 0xE4EE, 0xE4EF, 0xE4F0, 0xE4F1, 0xE4F2, 0xE4F3,
+  0xE4F4, 0xE4F5, 0xE4F6, 0xE4F7, 0xE4F8, 0xE4F9, 0xE4FA, 0xE4FB,
+  0xE4FC, 0xE4FD, 0xE4FE, 0xE4FF, 0xE500, 0xE501, 0xE502, 0xE503,
+  0xE504, 0xE505, 0xE506, 0xE507, 0xE508, 0xE509, 0xE50A, 0xE50B,
+  0xE50C, 0xE50D, 0xE50E, 0xE50F, 0xE510, 0xE511, 0xE512, 0xE513,
+  0xE514, 0xE515, 0xE516, 0xE517, 0xE518, 0xE519, 0xE51A, 0xE51B,
+  0xE51C, 0xE51D, 0xE51E, 0xE51F, 0xE520, 0xE521, 0xE522, 0xE523,
+  0xE524, 0xE525, 0xE526, 0xE527, 0xE528, 0xE529, 0xE52A, 0xE52B,
+  0xE52C, 0xE52D, 0xE52E, 0xE52F, 0xE530, 0xE531, 0xE532, 0xE533,
+  0xE534, 0xE535, 0xE536, 0xE537, 0xE538, 0xE539, 0xE53A, 0xE53B,
+  0xE53C, 0xE53D, 0xE53E, 0xE53F, 0xE540, 0xE541, 0xE542, 0xE543,
+  0xE544, 0xE545, 0xE546, 0xE547, 0xE548, 0xE549, 0xE54A, 0xE54B,
+  0xE54C, 0xE54D, 0xE54E, 0xE54F, 0xE550, 0xE551, 0xE552, 0xE553,
+  0xE554, 0xE555, 0xE556, 0xE557, 0xE558, 0xE559, 0xE55A, 0xE55B,
+  0xE55C, 0xE55D, 0xE55E, 0xE55F, 0xE560, 0xE561, 0xE562, 0xE563,
+  0xE564, 0xE565, 0xE566, 0xE567, 0xE568, 0xE569, 0xE56A, 0xE56B,
+  0xE56C, 0xE56D, 0xE56E, 0xE56F, 0xE570, 0xE571, 0xE572, 0xE573,
+  0xE574, 0xE575, 0xE576, 0xE577, 0xE578, 0xE579, 0xE57A, 0xE57B,
+  0xE57C, 0xE57D, 0xE57E, 0xE57F, 0xE580, 0xE581, 0xE582, 0xE583,
+  0xE584, 0xE585, 0xE586, 0xE587, 0xE588, 0xE589, 0xE58A, 0xE58B,
+  0xE58C, 0xE58D, 0xE58E, 0xE58F, 0xE590, 0xE591, 0xE592, 0xE593,
+  0xE594, 0xE595, 0xE596, 0xE597, 0xE598, 0xE599, 0xE59A, 0xE59B,
+  0xE59C, 0xE59D, 0xE59E, 0xE59F, 0xE5A0, 0xE5A1, 0xE5A2, 0xE5A3,
+  0xE5A4, 0xE5A5, 0xE5A6, 0xE5A7, 0xE5A8, 0xE5A9, 0xE5AA, 0xE5AB,
+  0xE5AC, 0xE5AD, 0xE5AE, 0xE5AF, 0xE5B0, 0xE5B1, 0xE5B2, 0xE5B3,
+  0xE5B4, 0xE5B5, 0xE5B6, 0xE5B7, 0xE5B8, 0xE5B9, 0xE5BA, 0xE5BB,
+  0xE5BC, 0xE5BD, 0xE5BE, 0xE5BF, 0xE5C0, 0xE5C1, 0xE5C2, 0xE5C3,
+  0xE5C4, 0xE5C5, 0xE5C6, 0xE5C7, 0xE5C8, 0xE5C9, 0xE5CA, 0xE5CB,
+  0xE5CC, 0xE5CD, 0xE5CE, 0xE5CF, 0xE5D0, 0xE5D1, 0xE5D2, 0xE5D3,
+  0xE5D4, 0xE5D5, 0xE5D6, 0xE5D7, 0xE5D8, 0xE5D9, 0xE5DA, 0xE5DB,
+  0xE5DC, 0xE5DD, 0xE5DE, 0xE5DF, 0xE5E0, 0xE5E1, 0xE5E2, 0xE5E3,
+  0xE5E4, 0xE5E5, 0xE5E6, 0xE5E7, 0xE5E8, 0xE5E9, 0xE5EA, 0xE5EB,
+  0xE5EC, 0xE5ED, 0xE5EE, 0xE5EF, 0xE5F0, 0xE5F1, 0xE5F2, 0xE5F3,
+  0xE5F4, 0xE5F5, 0xE5F6, 0xE5F7, 0xE5F8, 0xE5F9, 0xE5FA, 0xE5FB,
+  0xE5FC, 0xE5FD, 0xE5FE, 0xE5FF, 0xE600, 0xE601, 0xE602, 0xE603,
+  0xE604, 0xE605, 0xE606, 0xE607, 0xE608, 0xE609, 0xE60A, 0xE60B,
+  0xE60C, 0xE60D, 0xE60E, 0xE60F, 0xE610, 0xE611, 0xE612, 0xE613,
+  0xE614, 0xE615, 0xE616, 0xE617, 0xE618, 0xE619, 0xE61A, 0xE61B,
+  0xE61C, 0xE61D, 0xE61E, 0xE61F, 0xE620, 0xE621, 0xE622, 0xE623,
+  0xE624, 0xE625, 0xE626, 0xE627, 0xE628, 0xE629, 0xE62A, 0xE62B,
+  0xE62C, 0xE62D, 0xE62E, 0xE62F, 0xE630, 0xE631, 0xE632, 0xE633,
+  0xE634, 0xE635, 0xE636, 0xE637, 0xE638, 0xE639, 0xE63A, 0xE63B,
+  0xE63C, 0xE63D, 0xE63E, 0xE63F, 0xE640, 0xE641, 0xE642, 0xE643,
+  0xE644, 0xE645, 0xE646, 0xE647, 0xE648, 0xE649, 0xE64A, 0xE64B,
+  0xE64C, 0xE64D, 0xE64E, 0xE64F, 0xE650, 0xE651, 0xE652, 0xE653,
+  0xE654, 0xE655, 0xE656, 0xE657, 0xE658, 0xE659, 0xE65A, 0xE65B,
+  0xE65C, 0xE65D, 0xE65E, 0xE65F, 0xE660, 0xE661, 0xE662, 0xE663,
+  0xE664, 0xE665, 0xE666, 0xE667, 0xE668, 0xE669, 0xE66A, 0xE66B,
+  0xE66C, 0xE66D, 0xE66E, 0xE66F, 0xE670, 0xE671, 0xE672, 0xE673,
+  0xE674, 0xE675, 0xE676, 0xE677, 0xE678, 0xE679, 0xE67A, 0xE67B,
+  0xE67C, 0xE67D, 0xE67E, 0xE67F, 0xE680, 0xE681, 0xE682, 0xE683,
+  0xE684, 0xE685, 0xE686, 0xE687, 0xE688, 0xE689, 0xE68A, 0xE68B,
+  0xE68C, 0xE68D, 0xE68E, 0xE68F, 0xE690, 0xE691, 0xE692, 0xE693,
+  0xE694, 0xE695, 0xE696, 0xE697, 0xE698, 0xE699, 0xE69A, 0xE69B,
+  0xE69C, 0xE69D, 0xE69E, 0xE69F, 0xE6A0, 0xE6A1, 0xE6A2, 0xE6A3,
+  0xE6A4, 0xE6A5, 0xE6A6, 0xE6A7, 0xE6A8, 0xE6A9, 0xE6AA, 0xE6AB,
+  0xE6AC, 0xE6AD, 0xE6AE, 0xE6AF, 0xE6B0, 0xE6B1, 0xE6B2, 0xE6B3,
+  0xE6B4, 0xE6B5, 0xE6B6, 0xE6B7, 0xE6B8, 0xE6B9, 0xE6BA, 0xE6BB,
+  0xE6BC, 0xE6BD, 0xE6BE, 0xE6BF, 0xE6C0, 0xE6C1, 0xE6C2, 0xE6C3,
+  0xE6C4, 0xE6C5, 0xE6C6, 0xE6C7, 0xE6C8, 0xE6C9, 0xE6CA, 0xE6CB,
+  0xE6CC, 0xE6CD, 0xE6CE, 0xE6CF, 0xE6D0, 0xE6D1, 0xE6D2, 0xE6D3,
+  0xE6D4, 0xE6D5, 0xE6D6, 0xE6D7, 0xE6D8, 0xE6D9, 0xE6DA, 0xE6DB,
+  0xE6DC, 0xE6DD, 0xE6DE, 0xE6DF, 0xE6E0, 0xE6E1, 0xE6E2, 0xE6E3,
+  0xE6E4, 0xE6E5, 0xE6E6, 0xE6E7, 0xE6E8, 0xE6E9, 0xE6EA, 0xE6EB,
+  0xE6EC, 0xE6ED, 0xE6EE, 0xE6EF, 0xE6F0, 0xE6F1, 0xE6F2, 0xE6F3,
+  0xE6F4, 0xE6F5, 0xE6F6, 0xE6F7, 0xE6F8, 0xE6F9, 0xE6FA, 0xE6FB,
+  0xE6FC, 0xE6FD, 0xE6FE, 0xE6FF, 0xE700, 0xE701, 0xE702, 0xE703,
+  0xE704, 0xE705, 0xE706, 0xE707, 0xE708, 0xE709, 0xE70A, 0xE70B,
+  0xE70C, 0xE70D, 0xE70E, 0xE70F, 0xE710, 0xE711, 0xE712, 0xE713,
+  0xE714, 0xE715, 0xE716, 0xE717, 0xE718, 0xE719, 0xE71A, 0xE71B,
+  0xE71C, 0xE71D, 0xE71E, 0xE71F, 0xE720, 0xE721, 0xE722, 0xE723,
+  0xE724, 0xE725, 0xE726, 0xE727, 0xE728, 0xE729, 0xE72A, 0xE72B,
+  0xE72C, 0xE72D, 0xE72E, 0xE72F, 0xE730, 0xE731, 0xE732, 0xE733,
+  0xE734, 0xE735, 0xE736, 0xE737, 0xE738, 0xE739, 0xE73A, 0xE73B,
+  0xE73C, 0xE73D, 0xE73E, 0xE73F, 0xE740, 0xE741, 0xE742, 0xE743,
+  0xE744, 0xE745, 0xE746, 0xE747, 0xE748, 0xE749, 0xE74A, 0xE74B,
+  0xE74C, 0xE74D, 0xE74E, 0xE74F, 0xE750, 0xE751, 0xE752, 0xE753,
+  0xE754, 0xE755, 0xE756, 0xE757, 0x2170, 0x2171, 0x2172, 0x2173,
+  0x2174, 0x2175, 0x2176, 0x2177, 0x2178, 0x2179, 0x2160, 0x2161,
+  0x2162, 0x2163, 0x2164, 0x2165, 0x2166, 0x2167, 0x2168, 0x2169,
+  0xFFE2, 0xFFE4, 0xFF07, 0xFF02, 0x3231, 0x2116, 0x2121, 0x2235,
+  0x7E8A, 0x891C, 0x9348, 0x9288, 0x84DC, 0x4FC9, 0x70BB, 0x6631,
+  0x68C8, 0x92F9, 0x66FB, 0x5F45, 0x4E28, 0x4EE1, 0x4EFC, 0x4F00,
+  0x4F03, 0x4F39, 0x4F56, 0x4F92, 0x4F8A, 0x4F9A, 0x4F94, 0x4FCD,
+  0x5040, 0x5022, 0x4FFF, 0x501E, 0x5046, 0x5070, 0x5042, 0x5094,
+  0x50F4, 0x50D8, 0x514A, 0x5164, 0x519D, 0x51BE, 0x51EC, 0x5215,
+  0x529C, 0x52A6, 0x52C0, 0x52DB, 0x5300, 0x5307, 0x5324, 0x5372,
+  0x5393, 0x53B2, 0x53DD, 0xFA0E, 0x549C, 0x548A, 0x54A9, 0x54FF,
+  0x5586, 0x5759, 0x5765, 0x57AC, 0x57C8, 0x57C7, 0xFA0F, 0xFA10,
+  0x589E, 0x58B2, 0x590B, 0x5953, 0x595B, 0x595D, 0x5963, 0x59A4,
+  0x59BA, 0x5B56, 0x5BC0, 0x752F, 0x5BD8, 0x5BEC, 0x5C1E, 0x5CA6,
+  0x5CBA, 0x5CF5, 0x5D27, 0x5D53, 0xFA11, 0x5D42, 0x5D6D, 0x5DB8,
+  0x5DB9, 0x5DD0, 0x5F21, 0x5F34, 0x5F67, 0x5FB7, 0x5FDE, 0x605D,
+  0x6085, 0x608A, 0x60DE, 0x60D5, 0x6120, 0x60F2, 0x6111, 0x6137,
+  0x6130, 0x6198, 0x6213, 0x62A6, 0x63F5, 0x6460, 0x649D, 0x64CE,
+  0x654E, 0x6600, 0x6615, 0x663B, 0x6609, 0x662E, 0x661E, 0x6624,
+  0x6665, 0x6657, 0x6659, 0xFA12, 0x6673, 0x6699, 0x66A0, 0x66B2,
+  0x66BF, 0x66FA, 0x670E, 0xF929, 0x6766, 0x67BB, 0x6852, 0x67C0,
+  0x6801, 0x6844, 0x68CF, 0xFA13, 0x6968, 0xFA14, 0x6998, 0x69E2,
+  0x6A30, 0x6A6B, 0x6A46, 0x6A73, 0x6A7E, 0x6AE2, 0x6AE4, 0x6BD6,
+  0x6C3F, 0x6C5C, 0x6C86, 0x6C6F, 0x6CDA, 0x6D04, 0x6D87, 0x6D6F,
+  0x6D96, 0x6DAC, 0x6DCF, 0x6DF8, 0x6DF2, 0x6DFC, 0x6E39, 0x6E5C,
+  0x6E27, 0x6E3C, 0x6EBF, 0x6F88, 0x6FB5, 0x6FF5, 0x7005, 0x7007,
+  0x7028, 0x7085, 0x70AB, 0x710F, 0x7104, 0x715C, 0x7146, 0x7147,
+  0xFA15, 0x71C1, 0x71FE, 0x72B1, 0x72BE, 0x7324, 0xFA16, 0x7377,
+  0x73BD, 0x73C9, 0x73D6, 0x73E3, 0x73D2, 0x7407, 0x73F5, 0x7426,
+  0x742A, 0x7429, 0x742E, 0x7462, 0x7489, 0x749F, 0x7501, 0x756F,
+  0x7682, 0x769C, 0x769E, 0x769B, 0x76A6, 0xFA17, 0x7746, 0x52AF,
+  0x7821, 0x784E, 0x7864, 0x787A, 0x7930, 0xFA18, 0xFA19, 0xFA1A,
+  0x7994, 0xFA1B, 0x799B, 0x7AD1, 0x7AE7, 0xFA1C, 0x7AEB, 0x7B9E,
+  0xFA1D, 0x7D48, 0x7D5C, 0x7DB7, 0x7DA0, 0x7DD6, 0x7E52, 0x7F47,
+  0x7FA1, 0xFA1E, 0x8301, 0x8362, 0x837F, 0x83C7, 0x83F6, 0x8448,
+  0x84B4, 0x8553, 0x8559, 0x856B, 0xFA1F, 0x85B0, 0xFA20, 0xFA21,
+  0x8807, 0x88F5, 0x8A12, 0x8A37, 0x8A79, 0x8AA7, 0x8ABE, 0x8ADF,
+  0xFA22, 0x8AF6, 0x8B53, 0x8B7F, 0x8CF0, 0x8CF4, 0x8D12, 0x8D76,
+  0xFA23, 0x8ECF, 0xFA24, 0xFA25, 0x9067, 0x90DE, 0xFA26, 0x9115,
+  0x9127, 0x91DA, 0x91D7, 0x91DE, 0x91ED, 0x91EE, 0x91E4, 0x91E5,
+  0x9206, 0x9210, 0x920A, 0x923A, 0x9240, 0x923C, 0x924E, 0x9259,
+  0x9251, 0x9239, 0x9267, 0x92A7, 0x9277, 0x9278, 0x92E7, 0x92D7,
+  0x92D9, 0x92D0, 0xFA27, 0x92D5, 0x92E0, 0x92D3, 0x9325, 0x9321,
+  0x92FB, 0xFA28, 0x931E, 0x92FF, 0x931D, 0x9302, 0x9370, 0x9357,
+  0x93A4, 0x93C6, 0x93DE, 0x93F8, 0x9431, 0x9445, 0x9448, 0x9592,
+  0xF9DC, 0xFA29, 0x969D, 0x96AF, 0x9733, 0x973B, 0x9743, 0x974D,
+  0x974F, 0x9751, 0x9755, 0x9857, 0x9865, 0xFA2A, 0xFA2B, 0x9927,
+  0xFA2C, 0x999E, 0x9A4E, 0x9AD9, 0x9ADC, 0x9B75, 0x9B72, 0x9B8F,
+  0x9BB1, 0x9BBB, 0x9C00, 0x9D70, 0x9D6B, 0xFA2D, 0x9E19, 0x9ED1,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB,
+  0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB, 0x30FB
+};
+
+/* index_of[index_page[c >> 8]][c & 0xFF] is one more than the index */
+/* Shift_JIS uses for code point c, or zero if c has none.  Where    */
+/* it is an IBM extension from ibm_first on, one more than the       */
+/* index of its twin among JIS X 0208 codes (in the NEC selection of */
+/* the extensions) is nec_index[index - ibm_first], if there is one. */
+
+static const unsigned char index_page[256] = {
+    1,  0,  0,  2,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    4,  5,  6,  7,  8,  9, 10,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   11,  0, 12, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14, 15,
+   16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+   32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+   48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+   64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+   80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+   96, 97, 98, 99,100,101,102,103,  0,  0,  0,  0,  0,  0,  0,  0,
+    0,  0,  0,  0,  0,  0,  0,  0,  0,104,105,  0,  0,  0,  0,106
+};
+
+static const unsigned short index_of[107][256] = {
+  { /* none */
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0
+  },
+  { /* U+00xx */
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   88,
+       15,    0,    0,    0,    0,    0,    0,    0,
+       75,   62,    0,    0,   13,    0,  183,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   63,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   64,
+        0,    0,    0,    0,    0,    0,    0,    0
+  },
+  { /* U+03xx */
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,  471,  472,  473,  474,  475,  476,  477,
+      478,  479,  480,  481,  482,  483,  484,  485,
+      486,  487,    0,  488,  489,  490,  491,  492,
+      493,  494,    0,    0,    0,    0,    0,    0,
+        0,  503,  504,  505,  506,  507,  508,  509,
+      510,  511,  512,  513,  514,  515,  516,  517,
+      518,  519,    0,  520,  521,  522,  523,  524,
+      525,  526,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0
+  },
+  { /* U+04xx */
+        0,  571,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+      565,  566,  567,  568,  569,  570,  572,  573,
+      574,  575,  576,  577,  578,  579,  580,  581,
+      582,  583,  584,  585,  586,  587,  588,  589,
+      590,  591,  592,  593,  594,  595,  596,  597,
+      613,  614,  615,  616,  617,  618,  620,  621,
+      622,  623,  624,  625,  626,  627,  628,  629,
+      630,  631,  632,  633,  634,  635,  636,  637,
+      638,  639,  640,  641,  642,  643,  644,  645,
+        0,  619,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0
+  },
+  { /* U+20xx */
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+       30,    0,    0,    0,    0,   29,    0,    0,
+       38,   39,    0,    0,   40,   41,    0,    0,
+      181,  182,    0,    0,    0,   37,   36,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+      177,    0,   76,   77,    0,    0,    0,    0,
+        0,    0,    0,  102,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0
+  },
+  { /* U+21xx */
+        0,    0,    0,   78,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0, 1194,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0, 1196,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  176,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+     1149, 1150, 1151, 1152, 1153, 1154, 1155, 1156,
+     1157, 1158,    0,    0,    0,    0,    0,    0,
+    10717,10718,10719,10720,10721,10722,10723,10724,
+    10725,10726,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+      105,  106,  104,  107,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  139,    0,  140,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0
+  },
+  { /* U+22xx */
+      141,    0,  157,  142,    0,    0,    0,  158,
+      120,    0,    0,  121,    0,    0,    0,    0,
+        0, 1212,    0,    0,    0,    0,    0,    0,
+        0,    0,  163,    0,    0,  165,   71, 1216,
+      154,    0,    0,    0,    0,   34,    0,  136,
+      137,  127,  126,  167,  168,    0, 1211,    0,
+        0,    0,    0,    0,   72,  166,    0,    0,
+        0,    0,    0,    0,    0,  164,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  160,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+       66,  159,    0,    0,    0,    0,   69,   70,
+        0,    0,  161,  162,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  124,  125,    0,    0,  122,  123,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  155,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0, 1217,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0
+  },
+  { /* U+23xx */
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  156,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0
+  },
+  { /* U+24xx */
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+     1129, 1130, 1131, 1132, 1133, 1134, 1135, 1136,
+     1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144,
+     1145, 1146, 1147, 1148,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0
+  },
+  { /* U+25xx */
+      659,  670,  660,  671,    0,    0,    0,    0,
+        0,    0,    0,    0,  661,    0,    0,  672,
+      662,    0,    0,  673,  664,    0,    0,  675,
+      663,    0,    0,  674,  665,  686,    0,    0,
+      681,    0,    0,  676,  667,  688,    0,    0,
+      683,    0,    0,  678,  666,    0,    0,  682,
+      687,    0,    0,  677,  668,    0,    0,  684,
+      689,    0,    0,  679,  669,    0,    0,  685,
+        0,    0,  690,    0,    0,    0,    0,    0,
+        0,    0,    0,  680,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+       97,   96,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   99,   98,    0,    0,    0,    0,
+        0,    0,    0,    0,  101,  100,    0,    0,
+        0,    0,    0,    0,    0,    0,   95,   94,
+        0,    0,    0,   91,    0,    0,   93,   92,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  188,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0
+  },
+  { /* U+26xx */
+        0,    0,    0,    0,    0,   90,   89,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+       74,    0,   73,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  180,    0,    0,  179,    0,  178,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0
+  },
+  { /* U+30xx */
+        1,    2,    3,   23,    0,   25,   26,   27,
+       50,   51,   52,   53,   54,   55,   56,   57,
+       58,   59,  103,  108,   44,   45,    0,    0,
+        0,    0,    0,    0,    0, 1192,    0, 1193,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,  283,  284,  285,  286,  287,  288,  289,
+      290,  291,  292,  293,  294,  295,  296,  297,
+      298,  299,  300,  301,  302,  303,  304,  305,
+      306,  307,  308,  309,  310,  311,  312,  313,
+      314,  315,  316,  317,  318,  319,  320,  321,
+      322,  323,  324,  325,  326,  327,  328,  329,
+      330,  331,  332,  333,  334,  335,  336,  337,
+      338,  339,  340,  341,  342,  343,  344,  345,
+      346,  347,  348,  349,  350,  351,  352,  353,
+      354,  355,  356,  357,  358,  359,  360,  361,
+      362,  363,  364,  365,    0,    0,    0,    0,
+        0,    0,    0,   11,   12,   21,   22,    0,
+        0,  377,  378,  379,  380,  381,  382,  383,
+      384,  385,  386,  387,  388,  389,  390,  391,
+      392,  393,  394,  395,  396,  397,  398,  399,
+      400,  401,  402,  403,  404,  405,  406,  407,
+      408,  409,  410,  411,  412,  413,  414,  415,
+      416,  417,  418,  419,  420,  421,  422,  423,
+      424,  425,  426,  427,  428,  429,  430,  431,
+      432,  433,  434,  435,  436,  437,  438,  439,
+      440,  441,  442,  443,  444,  445,  446,  447,
+      448,  449,  450,  451,  452,  453,  454,  455,
+      456,  457,  458,  459,  460,  461,  462,    0,
+        0,    0,    0,    6,   28,   19,   20,    0
+  },
+  { /* U+32xx */
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0, 1202, 1203,    0,    0,    0,    0,    0,
+        0, 1204,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0, 1197, 1198, 1199, 1200,
+     1201,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0
+  },
+  { /* U+33xx */
+        0,    0,    0, 1166,    0,    0,    0,    0,
+        0,    0,    0,    0,    0, 1170,    0,    0,
+        0,    0,    0,    0, 1161,    0,    0,    0,
+     1164,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 1162, 1172,    0,    0, 1171, 1165,
+        0,    0,    0, 1173,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0, 1167,    0,
+        0,    0,    0, 1175,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0, 1160, 1174,    0,    0, 1163,    0,    0,
+        0, 1168,    0,    0,    0,    0,    0, 1169,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0, 1191, 1207, 1206, 1205,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0, 1179, 1180,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0, 1176, 1177, 1178,    0,
+        0, 1182,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0, 1181,    0,    0,    0,
+        0,    0,    0,    0,    0, 1195,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0
+  },
+  { /* U+4Exx */
+     1486, 3286,    0, 2561,    0,    0,    0, 4040,
+     2796, 2460, 2795, 1626,    0, 3812, 4167,    0,
+     4420, 1519,    0,    0, 1770, 4421, 2918, 4640,
+     1934, 3880,    0,    0,    0,    0, 2797,    0,
+        0, 4260,    0,    0,    0,    0, 3888,    0,
+    10757,    0, 4422,    0,    0, 3266,    0,    0,
+        0, 4423, 2064,    0,    0,    0, 4424,    0,
+     1847, 3212,    0, 2609, 4425,    0,    0, 4426,
+        0,    0, 4427, 3593,    0, 1935,    0,    0,
+        0,    0,    0, 3595,    0, 3545, 2197, 3967,
+        0,    0,    0,    0,    0, 6809, 4428, 2798,
+     4429, 1619,    0,    0,    0, 2043, 2242, 4115,
+        0,    0, 4988,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0, 4216,    0, 3571,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0, 1791,    0,
+     1901,    0, 4430,    0,    0, 4431, 4257,    0,
+     4165, 3080, 4433, 2530, 3561,    0, 4436,    0,
+        0, 1534, 2225,    0, 2224, 1480,    0,    0,
+     4367, 4366,    0, 2369, 1411,    0, 4437, 4438,
+     4439, 3968, 4440,    0, 2244, 1481, 4030,    0,
+     1972,    0,    0, 1973, 1974, 3356, 4258,    0,
+     4441,    0,    0, 4442,    0,    0, 4443,    0,
+        0,    0, 2865,    0,    0,    0,    0,    0,
+     2658, 2866, 4448,    0, 4446,    0, 4447, 1936,
+        0,    0, 2353, 1678,    0, 4445, 4444, 3863,
+        0,    0,    0,    0, 2482, 2481, 3132, 4449,
+     3813, 2985,    0,    0,    0,   24, 4450, 4452,
+        0,10758,    0, 3171, 4295, 1452,    0,    0,
+        0,    0,    0,    0,    0, 4451, 1628,    0,
+     2010,    0, 3267,    0,    0,    0, 2147, 4453,
+        0,    0,    0, 3576,10759,    0,    0,    0
+  },
+  { /* U+4Fxx */
+    10760, 1861,    0,10761,    0,    0,    0,    0,
+        0, 4454, 1453,    0,    0, 2226, 1862, 3850,
+     3684, 1937,    0,    0,    0,    0,    0,    0,
+        0,    0, 1679,    0, 4489, 3417,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0, 3648,
+     4456,    0,    0,    0, 3694,    0, 4296,    0,
+     2833,10762, 2483,    0, 2531, 1630,    0,    0,
+        0,    0,    0, 3339,    0,    0, 3198, 4460,
+        0,    0,    0,    0,    0, 1454, 3357, 2659,
+     2370, 4140,    0, 3148,    0, 1629,10763, 4459,
+        0, 4166, 4455, 4457, 2428, 4458, 4892,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0, 4466,    0,    0,    0,    0,    0, 4469,
+     4467,    0,    0, 1632,    0, 3881, 4461,    0,
+        0,    0,    0, 4465, 2245,    0,    0, 2484,
+        0,    0,    0, 1792,    0,    0, 4470,    0,
+     4462,    0,10765, 4297,    0, 2532,    0, 4463,
+        0, 4468,10764,    0,10767,    0, 4471,    0,
+     4464,    0,10766, 1975,    0, 1455,    0,    0,
+     1976, 1631,    0,    0,    0,    0,    0,    0,
+        0,    0,    0, 4893,    0, 4037, 3838, 2246,
+        0,    0,    0,    0,    0, 2835, 4253,    0,
+        0,    0,    0,    0,    0,    0,    0, 3910,
+        0,    0, 2092, 3107, 1666,    0,    0,    0,
+        0,10750, 2683,    0,    0,10768, 4475,    0,
+     4480, 4478,    0,    0, 4473,    0,    0, 3117,
+     4476,    0, 4479, 4477,    0, 3915,    0, 4474,
+        0, 2834,    0, 4031, 4481, 4482,    0,    0,
+        0,    0,    0,    0,    0,    0, 2636, 4495,
+        0,    0,    0, 3620,    0, 3782, 4490,    0,
+     3934,    0, 1620,    0,    0,    0, 4494,10771
+  },
+  { /* U+50xx */
+        0,    0,    0,    0,    0, 4488, 4497,    0,
+        0, 3058,    0, 2198,    0, 3632,    0, 5961,
+        0, 4496, 3445,    0, 4485,    0, 2248,    0,
+        0, 2247, 4483,    0,    0,    0,10772, 2596,
+        0, 4491,10770, 3933, 3241, 4487, 2149,    0,
+     4484, 4492, 4486, 4279, 4493, 4357,    0,    0,
+        0,    0,    0,    0,    0,    0, 2044,    0,
+        0, 2148,    0,    0,    0,    0,    0,    0,
+    10769,    0,10775, 4498,    0,    0,10773, 4499,
+     4503, 1456,    0,    0,    0,    0,    0, 3902,
+     4502,    0,    0,    0,    0, 4501, 4505,    0,
+        0,    0, 4504,    0, 3358,    0,    0,    0,
+        0,    0,    0,    0,    0, 2150,    0,    0,
+        0,    0,    0,    0, 4506,    0,    0,    0,
+    10774,    0, 2575,    0, 3108, 3359, 2060,    0,
+     4507,    0,    0,    0,    0, 1902,    0,    0,
+     4508,    0,    0,    0,    0, 4510,    0,    0,
+        0,    0,    0,    0,    0, 3969,    0,    0,
+        0, 2138,    0,    0,10776,    0,    0,    0,
+     2461, 3753, 4509,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0, 2387, 4171,    0,    0,
+        0,    0, 4512, 4515, 4511, 2386,    0, 2725,
+        0,    0,    0,    0,    0,    0, 2093,    0,
+        0,    0, 4516,    0,    0, 2021,    0,    0,
+        0, 4513, 4514,    0,    0, 3493,    0, 3100,
+        0, 1977,    0,    0,    0, 3993, 4517,    0,
+    10778,    0, 4259,    0,    0,    0, 4518,    0,
+        0,    0,    0, 4521,    0, 4519,    0, 3054,
+        0,    0,    0,    0,    0, 4520, 4522,    0,
+        0,    0,    0,    0,10777, 4524,    0,    0,
+        0, 4523,    0, 3894,    0,    0,    0,    0
+  },
+  { /* U+51xx */
+     1903, 4526, 4527,    0, 1613,    0,    0,    0,
+        0, 4525,    0,    0,    0,    0,    0,    0,
+        0,    0, 2622,    0, 4530, 4529, 4528,    0,
+     4472,    0, 4531,    0,    0,    0,    0, 2726,
+        0, 4532,    0,    0,    0,    0,    0,    0,
+        0,    0, 4141,    0,    0,    0,    0,    0,
+        0,    0, 4099,    0,    0,    0,    0, 4534,
+        0,    0, 4533, 4536, 4535,    0,    0, 4537,
+     4538, 1494,    0, 2183, 2095, 2660, 3287, 1978,
+     2986, 2249,10779, 2334, 4540, 4082, 3422,    0,
+     2533,    0, 4539,    0, 4541,    0,    0,    0,
+        0,    0, 3446,    0, 1777,    0,    0,    0,
+        0,    0, 4542,    0,10780, 3572,    0,    0,
+     3028, 4544, 4545, 3678, 2250, 4351, 4546,    0,
+        0, 1980,    0,    0,    0, 3882, 3124, 2055,
+     3405,    0,    0,    0, 2151,    0,    0,    0,
+     4547,    0, 4548,    0,    0, 3544, 1567,    0,
+        0, 4551, 2443,    0, 4550, 2388,    0, 4552,
+     6564, 4553, 3981, 4554,    0, 4555, 4556, 2799,
+        0, 2582,    0,    0,    0,10781,    0,    0,
+     1793,    0, 4559,    0, 4557, 4071, 4558,    0,
+     3818, 4560, 4561, 4562, 3447,    0,    0,    0,
+     4566, 4564, 4565, 4563, 2417, 4567, 4116, 4298,
+        0,    0,    0,    0,    0, 4568,10782,    0,
+        0,    0,    0,    0, 2922, 4569, 2690,    0,
+        0, 4570,    0, 3288, 4261, 3448,    0,    0,
+        0,    0,    0,    0,    0,    0, 4643,    0,
+        0,    0,    0, 4571, 7807, 2011,    0,    0,
+     4572, 4010,    0,    0,    0,    0, 2704, 3194,
+        0, 4574, 3546,    0,10783, 4575,    0,    0,
+     4576, 1706,    0,    0,    0, 4577, 1981,    0,
+     3522, 1594, 2680,    0,    0, 3667, 4578,    0
+  },
+  { /* U+52xx */
+     3449,    0,    0, 2867, 4579,    0, 3866, 2972,
+     1788,    0, 1795, 4580,    0,    0, 4582,    0,
+        0, 2094,    0,    0, 4581,10784,    0, 4313,
+        0,    0,    0,    0,    0, 2705,    0,    0,
+        0,    0,    0,    0, 3695, 3898,    0, 4583,
+        0, 4224, 4584,    0,    0,    0, 4585,    0,
+     3478,    0,    0, 4586,    0,    0, 2923, 2444,
+     2152, 4587, 2485, 2335,    0,    0,    0,    0,
+        0,    0,    0, 3360, 4589,    0,    0, 3109,
+        0,    0, 2429, 4590, 4591, 3024,    0, 4588,
+        0,    0,    0,    0, 4593,    0, 3970,    0,
+        0,    0,    0, 2324,    0,    0, 4592,    0,
+        0,    0,    0, 2153, 2412, 3649,    0,    0,
+        0, 4596, 4594,    0,    0,    0,    0, 3851,
+     2800, 4603, 1760, 4597, 4595, 3055,    0,    0,
+        0,    0,    0,    0,    0, 4599,    0, 4598,
+        0,    0,    0, 1728,    0,    0,    0, 2132,
+     4604, 4243,    0,    0,    0, 4600,    0,    0,
+        0, 4605, 4602,    0, 4601,    0,    0,    0,
+        0,    0,    0, 4277,10785,    0,    0, 2251,
+     1633,    0,    0, 4314,    0,    0,10786,    0,
+        0, 2717, 3440, 2325, 4608, 4609,    0,10960,
+        0, 4299,    0,    0, 4335, 4611,    0,    0,
+        0, 2252,    0,    0, 4610,    0, 1707,    0,
+    10787, 4612,    0, 4002,    0, 3318,    0, 4142,
+        0, 3911,    0,    0,    0, 4613,    0,    0,
+        0,    0, 7479,    0,    0, 3494,    0, 4614,
+     1796, 4061,    0,10788,    0, 2727, 4615, 3925,
+     4619,    0, 2924, 4616, 2022,    0, 4617, 1797,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 2082, 4620,    0, 4621,    0,    0,
+     4622, 4623, 2597,    0,    0,    0, 2253, 4104
+  },
+  { /* U+53xx */
+    10789, 4114, 3565,    0,    0, 3935, 4624,10790,
+     4625,    0,    0,    0,    0, 4627,    0, 4629,
+     4628,    0,    0,    0,    0, 4630, 1627, 3992,
+        0, 2442, 4631,    0,    0, 3065,    0,    0,
+     2728, 1983,    0, 4632,10791,    0,    0,    0,
+        0,    0, 3725,    0,    0,    0,    0, 4633,
+        0, 4634,    0, 4635,    0,    0,    0,    0,
+     4636, 3764, 2046, 1479,    0,    0,    0, 3509,
+     4637, 2661,    0, 2987,    0, 4639, 4638, 2729,
+     2227, 4641, 3696,    0,    0, 4642,    0,    0,
+        0, 3726, 3122, 3180, 1982,    0,    0, 3556,
+     3213,    0, 3650,    0, 3994,    0, 4644,    0,
+     2988,    0,    0,    0,    0,    0, 2089,    0,
+        0, 4645,    0,    0,    0,    0, 4646, 1516,
+     1495, 1863,10792, 3110, 1929, 4217,    0, 4649,
+     1621,    0,    0, 4648,    0,    0,    0, 1984,
+        0,    0, 4650,    0, 4123,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,10793,    0,    0, 4651,    0,
+     4280,    0, 2254,    0,    0,    0,    0, 2184,
+     4652,    0,    0,    0,    0, 4654, 4653,    0,
+     2883, 1529,    0,    0,    0, 1566, 4655,    0,
+     4656,    0,10794, 2185,    0,    0, 4657,    0,
+        0,    0,    0, 1958,    0,    0,    0,    0,
+        0,    0, 2462, 4658,    0,    0,    0,    0,
+     4032, 2371, 1938, 4143, 3056, 3697, 2631,    0,
+        0,    0,    0,    0, 2671,    0, 2610, 2623,
+        0, 2718,    0, 3698,    0,10795,    0, 4661,
+        0, 1539, 3057, 2255, 2199, 2045,    0,    0,
+     4665, 3197, 3196, 1985, 2730, 4666, 4664, 1634,
+     3172, 2562, 2487, 1510,    0,    0, 1772, 2326,
+     2486,    0, 4667,    0,    0,    0,    0,    0
+  },
+  { /* U+54xx */
+        0, 4668,    0, 1921, 1730,    0,    0,    0,
+     2327, 1920, 3353, 1509, 3495, 4072, 2257, 4225,
+     3423, 2256,    0,    0,    0,    0,    0,    0,
+        0,    0,    0, 2083,    0, 4677,    0, 2041,
+     3990,    0,    0,    0,    0,    0, 3727,    0,
+        0, 4676,    0, 1848, 4671, 4672, 4674,    0,
+        0,    0,    0,    0,    0,    0, 4675,    0,
+     1939, 2885,    0, 3867, 4673, 4669, 2229,    0,
+     4670,    0, 4328,    0,    0,    0, 3936,    0,
+     3362, 2228, 2336,    0,    0,    0, 4678,    0,
+        0, 3539,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0, 4682,
+        0,    0,    0,    0,    0,    0,    0,    0,
+     2632,    0, 2624,    0,    0,    0,    0,    0,
+     4685, 4683,    0, 4045,    0, 4680, 4689, 4684,
+        0,    0,    0, 4687, 2200, 4073,    0,    0,
+     4688,    0,    0,    0, 4690,    0, 4692,    0,
+        0,    0,10798, 2430, 4358,    0, 4681, 4679,
+     4691,    0, 4686,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,10797,    0,    0,    0,
+        0,    0, 4694,    0, 4703, 4696,    0,    0,
+     4700,10799,    0, 4701, 4697,    0,    0, 4730,
+        0,    0, 2423, 1709,    0,    0,    0,    0,
+     4695,    0,    0,    0, 4705, 1496, 4704,    0,
+     1415, 3802, 4702,    0, 4698,    0,    0, 4693,
+     4699, 2390,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+     4706,    0,    0,    0,    0,    0,    0,    0,
+        0, 1497, 4715,    0,    0, 4707, 4708,    0,
+     2731, 4021,    0,    0,    0, 4713, 4712,    0,
+        0,    0, 3399,    0,    0,    0,    0,    0,
+        0,    0, 4714,    0,    0, 4711,    0,10800
+  },
+  { /* U+55xx */
+        0,    0,    0,    0, 1524,    0, 2372, 2836,
+        0,    0,    0,    0,    0,    0,    0, 4709,
+     3450,    0,    0,    0, 4710,    0, 1412,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0, 4720, 4139,
+        0, 2733,    0, 4726,    0,    0,    0,    0,
+     4725, 4716,    0,    0,    0,    0, 3137,    0,
+     4717,    0,    0,    0, 3181, 4722, 2732,    0,
+        0,    0,    0,    0, 4719,    0,    0, 4110,
+        0,    0,    0, 2096,    0,    0, 4723, 4724,
+        0,    0,    0,    0, 4721, 4727,    0,    0,
+        0,    0,    0, 4718,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0, 4733, 4738,    0, 4734,    0,
+     4729,    0,    0, 4739, 3025,    0,10801, 4741,
+        0, 2258, 4731, 3289,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+     4735, 4728, 1799,    0, 1864, 1761, 4736, 4732,
+        0,    0,    0,    0,    0,    0,    0, 2154,
+     4742, 4740, 3059, 1922, 1986,    0, 4737,    0,
+     2058,    0,    0,    0,    0,    0, 1540,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0, 4746, 4744,    0, 4801,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0, 4749,    0,    0,    0,
+        0,    0, 4743,    0, 4747,    0,    0, 4745,
+        0,    0,    0, 2488, 4748,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0, 4751,
+        0, 4756,    0,    0,    0, 4754, 4753,    0
+  },
+  { /* U+56xx */
+        0,    0,    0,    0,    0,    0, 3214,    0,
+        0, 1635,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0, 4750,    0, 4752, 2734,
+     1523,    0,    0, 4755,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0, 1660,    0,    0,    0,    0,    0, 4766,
+        0, 2818, 4762,    0, 4760,    0, 4761,    0,
+     4763,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 1533,    0,    0,    0,    0,    0,
+        0,    0,    0,    0, 3033,    0, 4757,    0,
+     4758,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0, 1782,    0,    0,    0,    0,
+        0,    0,    0,    0, 4765,    0,    0,    0,
+     1865,    0, 4768, 4764, 4767,    0,    0,    0,
+        0,    0,    0,    0, 3868,    0,    0,    0,
+     3531,    0, 3690,    0,    0,    0,    0,    0,
+     4770,    0,    0,    0,    0,    0, 4769, 1729,
+        0,    0, 4771,    0,    0,    0,    0, 4774,
+        0,    0,    0,    0, 4773,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+     4772,    0, 3597,    0,    0, 4775,    0,    0,
+        0,    0,    0,    0,    0,    0, 4776,    0,
+        0,    0,    0,    0, 4778,    0, 4777,    0,
+        0,    0,    0,    0, 4780,    0,    0,    0,
+     4783, 4781, 4779, 4782,    0,    0,    0,    0,
+     4784,    0,    0,    0,    0,    0, 4785,    0,
+        0, 4786,    0, 4787,    0,    0,    0, 4788,
+     4549,    0, 2630, 2489,    0,    0, 1681,    0,
+     1498,    0,    0, 3232,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0, 4789,    0,
+     2354,    0, 1457, 2882,    0,    0,    0,    0,
+        0, 4790, 2201,    0,    0, 2337,    0, 4792
+  },
+  { /* U+57xx */
+     4791,    0,    0, 3918, 4793,    0,    0,    0,
+     4795, 4794,    0, 4796,    0, 4797,    0, 2155,
+        0,    0, 1568, 4798,    0,    0, 4800,    0,
+     4799,    0,    0,    0, 4802,    0,    0, 3442,
+        0,    0,    0,    0,    0,    0, 4803, 1431,
+     2413,    0,    0,    0,    0, 2097,    0,    0,
+     3243,    0,    0,    0,    0,    0,    0, 4804,
+     4805,    0,    0, 4807,    0,    0,    0,    0,
+     4808,    0, 2418,    0,    0,    0,    0, 2023,
+        0,    0, 3971,    0,    0,    0, 4806, 4809,
+     2383, 2259,    0,    0,    0,    0,    0,    0,
+        0,10802,    0,    0,    0,    0,    0,    0,
+        0, 4813,    0,    0, 2355,10803, 3215,    0,
+        0, 4810, 3348,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0, 4814,
+        0,    0, 2886,    0,    0,    0,    0,    0,
+     4812, 4815,    0, 2099,    0,    0,    0,    0,
+        0,    0,    0, 4816,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+     4817,    0, 2260, 1724, 4819,    0,    0,    0,
+        0,    0, 4820,    0,10804,    0,    0,    0,
+     4821,    0,    0, 4818,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+     4811,    0,    0, 4822,    0,    0, 4823,10806,
+    10805,    0,    0, 4016,    0,    0, 2801,    0,
+        0,    0, 4825, 4826, 4824,    0, 4828,    0,
+        0,    0,    0,    0, 3596,    0,    0, 1482,
+     3814,    0,    0, 4829,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0, 2819,    0,    0, 2563,
+        0, 3633, 1866,    0, 2425,    0,    0,    0
+  },
+  { /* U+58xx */
+     4005,    0, 3496,    0,    0, 2156, 3149,    0,
+        0,    0, 4827, 4830,    0,    0,    0,    0,
+        0,    0,    0,    0,    0, 3138,    0,    0,
+        0, 4831,    0,    0,    0, 4832,    0,    0,
+        0, 4834,    0,    0, 3363,    0,    0,    0,
+        0,    0, 1800,    0,    0,    0,    0, 7803,
+     1569, 3937,    0,    0, 2802, 3424,    0,    0,
+        0,    0, 2420,    0,    0, 4840,    0,    0,
+     3883, 4291,    0,    0,    0,    0,    0,    0,
+        0,    0, 1682, 4836,    0,    0,    0,    0,
+        0, 3034, 4839,    0, 3451,    0,    0, 3425,
+     3452, 3691, 3335,    0,    0,    0, 2391,    0,
+        0,    0, 4835,    0,    0,    0,    0,    0,
+        0, 1590,    0, 3406,    0,    0,    0,    0,
+     4837,    0, 4833,    0,    0, 2868,    0,    0,
+        0, 4841,    0,    0,    0,    0, 2678,    0,
+        0,    0,    0, 1987,    0, 4842,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0, 3926,    0,    0,    0, 3101,
+        0,    0,    0,    0, 3328,    0,10809, 4844,
+        0,    0,    0,    0,    0,    0,    0,    0,
+     3995,    0,    0, 4845,    0,    0, 4850,    0,
+        0,    0,10810, 3869,    0,    0,    0,    0,
+     4849, 4843, 4846, 4848,    0,    0, 2356,    0,
+        0, 3895,    0,    0,    0, 4851,    0, 3233,
+        0,    0, 1683,    0, 2803,    0,    0,    0,
+        0, 4853,    0, 4852,    0, 2328,    0, 4854,
+     4856, 4855,    0,    0, 4858,    0, 4847, 4860,
+        0,    0,    0,    0, 4859, 4857,    0,    0,
+        0,    0,    0, 2490, 2869,    0, 3060, 4861,
+     2942, 1487, 3640,    0,    0,    0,    0, 3349,
+        0, 4863, 4862, 4864, 4865, 4866,    0,    0
+  },
+  { /* U+59xx */
+        0,    0, 4867,    0,    0,    0,    0,    0,
+        0, 3903, 4868,10811,    0,    0,    0, 1636,
+     4869,    0,    0,    0,    0, 4164, 1708,    0,
+     4647, 2672, 3133, 4870, 4117,    0,    0,    0,
+        0,    0, 4062,    0,    0, 4872,    0, 3173,
+        0, 3407, 3134, 3815, 4873, 4874, 1595,    0,
+        0, 2564, 4875,    0,    0,    0,    0, 1458,
+     4876,    0,    0,    0,    0,    0, 4877,    0,
+        0,    0,    0,    0, 1570,    0,    0, 1867,
+     3542, 3938,    0,    0,    0,    0, 4881, 3061,
+     4880, 2100,    0,10812, 4007, 4879,    0, 3453,
+     4883,    0, 4882,10813,    0,10814,    0,    0,
+     4885,    0, 4884,10815,    0, 1596,    0, 4886,
+     2735, 4888, 3201,    0, 4887,    0, 3873,    0,
+        0,    0,    0, 2719, 3443,    0,    0,    0,
+     4889,    0,    0,    0,    0, 2261,    0,    0,
+        0, 4890, 3573, 3728, 4091,    0,    0,    0,
+        0,    0, 3577,    0,    0, 4899,    0,    0,
+        0,    0,    0, 1904,    0,    0, 4173,    0,
+        0, 4057,    0, 4994,    0, 4891,    0,    0,
+        0,    0,    0, 4894,10816, 3139,    0,    0,
+     3972,    0,    0,    0, 3426,    0,    0,    0,
+        0,    0, 4895,    0,    0,    0,    0,    0,
+        0, 4017,10817, 2392,    0,    0, 2736,    0,
+        0,    0,    0,    0,    0,    0, 4896,    0,
+        0, 2492,    0, 2491,    0,    0,    0,    0,
+     1435, 2202,    0, 2925, 1459,    0,    0,    0,
+        0, 4900, 4901,    0, 4898,    0,    0,    0,
+        0,    0,    0,    0,    0, 1528, 1801,    0,
+     4897,    0, 4079, 3777,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0, 1418,    0,
+        0,    0,    0, 1499,    0,    0,    0, 2493
+  },
+  { /* U+5Axx */
+        0, 1460,    0, 1413,    0,    0,    0,    0,
+        0, 4906,    0,    0,    0,    0,    0,    0,
+        0, 4904,    0,    0,    0,    0,    0,    0,
+     4070,    0, 4907,    0, 4905,    0,    0, 4903,
+     2837,    0,    0,    0,    0, 4902,    0,    0,
+        0, 3912,    0,    0,    0,    0,    0, 2230,
+        0,    0,    0,    0,    0, 4911, 4912,    0,
+        0,    0,    0,    0, 2737,    0,    0,    0,
+     4908, 4336,    0,    0,    0,    0, 3616,    0,
+        0, 4910,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 2357,    0,    0,    0,    0,    0,
+        0,    0, 4913,    0,    0,    0, 3816,    0,
+        0,    0, 4914,    0, 4909,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0, 4069,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 3634,    0,    0,    0,    0,    0,
+        0,    0, 4915, 3778,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0, 4916, 4920, 4917,    0,
+        0, 1637, 4919,    0,    0,    0,    0,    0,
+        0, 2565,    0, 4918, 2157,    0,    0,    0,
+     4932,    0,    0,    0,    0,    0, 4925, 4922,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0, 3264,    0, 4921,    0,    0, 4923,    0,
+        0, 4924,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 4926, 4927,    0,    0,    0,    0
+  },
+  { /* U+5Bxx */
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0, 1868,    0, 4929, 4928,    0,    0,    0,
+        0,    0,    0,    0,    0,    0, 4930,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 2804,    0,    0,    0,    0,    0,
+        0,    0, 4933,    0, 3350,    0,    0,    0,
+     1541,    0, 4931,    0,    0,    0, 4934,    0,
+        0,    0,    0,    0,    0,    0, 4935,    0,
+     4938,    0,    0, 4936,    0, 4937,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+     2494, 4939,    0,    0, 2262, 4940,10818, 2534,
+     3126,    0, 4941, 4942, 2502, 2263,    0, 4092,
+        0,    0,    0, 1888, 2203, 4943, 1748,    0,
+        0, 4944,    0, 3127,    0,    0,    0,    0,
+     4945, 4985,    0, 4946,    0, 4947,    0,    0,
+     4948,    0, 4950,    0,    0,    0,    0,    0,
+     4951,    0,    0, 4952,    0, 3182,    0, 1511,
+     2611, 1444,    0, 3063, 1802, 2559,    0, 2264,
+        0,    0,    0,    0,    0, 3454,    0, 2633,
+     1803, 3268, 3364, 1434, 1905, 3939,    0, 2572,
+        0,    0, 1930, 2989, 2566, 4144, 4953,    0,
+        0,    0,    0,    0,    0,    0, 1940,    0,
+     2393,    0,    0, 1710, 1571, 2738, 1638,    0,
+     4954, 4174,    0,    0,    0,    0,    0, 2673,
+    10819,    0, 2606, 4955, 1869, 3528, 4051, 4956,
+        0, 4957,    0,    0, 3817,    0,    0,    0,
+     4959,    0, 1794, 2061, 4958,    0,    0,    0,
+    10821,    0,    0, 1804,    0, 2838, 4963, 2445,
+        0, 1639, 4962,    0, 4960, 4964, 4961, 3583,
+     5591, 2839,    0, 4965,10822,    0, 4262,    0,
+     4966,    0,    0, 4968,    0, 3290, 4967,    0,
+     2917,    0, 2535,    0,    0,    0, 3150, 2625
+  },
+  { /* U+5Cxx */
+        0, 3845, 2990,    0, 2583, 4969, 2739, 4970,
+     4971, 1461, 3128, 2870,    0, 4972, 3497, 2740,
+        0, 2741,    0, 4973,    0,    0, 2991,    0,
+        0,    0, 2742,    0,    0,    0,10823,    0,
+     4974,    0, 4975,    0, 4106,    0,    0,    0,
+     4976,    0,    0,    0,    0, 2012,    0,    0,
+        0, 2634,    0,    0,    0,    0,    0,    0,
+     4977, 4978, 2598, 2832, 3562, 2872, 3754, 3574,
+     2015, 4979,    0,    0,    0, 1959, 4980,    0,
+     2068,    0, 3525, 1614,    0, 2495, 4981, 4984,
+     4983, 2067,    0, 4982,    0, 3408,    0,    0,
+        0,    0,    0,    0,    0,    0, 3118,    0,
+     3427, 2578,    0,    0, 3064, 4226,    0,    0,
+        0,    0,    0,    0, 4986,    0, 4987, 3532,
+        0, 2463,    0,    0,    0,    0, 4989,    0,
+        0, 4990,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0, 4991,    0,    0,    0,
+     1870, 4992,    0,    0, 4993,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0, 1610,    0,    0,    0,    0,10824,    0,
+     3035, 1854,    0, 4995, 4050,    0,    0,    0,
+        0, 3152,    0, 1749,    0,    0, 4997, 4999,
+     1849,    0,10825, 4996, 4998,    0, 5001,    0,
+        0,    0,    0,    0,    0, 5000,    0, 5002,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0, 5003,    0,    0,    0,    0,    0,    0,
+     3507, 1988,    0,    0,    0,    0,    0,    0,
+     1667, 5004, 5009,    0,    0, 5007,    0, 3941,
+     3940,    0,    0,    0,    0,10826, 3455,    0,
+        0,    0, 5006, 2684,    0, 5005,    0,    0
+  },
+  { /* U+5Dxx */
+        0,    0,    0,    0,    0,    0,    0, 2902,
+        0,    0,    0, 5010,    0,    0, 2424,    0,
+        0, 5016,    0,    0, 5017, 5011, 1711, 5012,
+     5021, 5020, 5019, 5015,    0,    0,    0, 5014,
+        0,    0, 5018,    0,    0,    0,    0,10827,
+        0, 3942,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,10830,    0,    0,    0,    0,    0,
+        0,    0,    0, 5025, 5022,    0, 5024,    0,
+     4218,    0, 5023,10828,    0,    0,    0,    0,
+        0,    0,    0,    0, 5013,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0, 2903,    0,    0, 5026,10831,    0, 2373,
+        0,    0,    0, 5027,    0,    0, 5028,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 5031,    0, 5030,    0,    0, 5029,
+        0,    0,    0, 3456, 5008,    0,    0,    0,
+     5037,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0, 5033,    0,    0,
+        0,    0, 5032,    0,    0,    0,    0,    0,
+        0,    0,    0,    0, 5034,    0, 5035,    0,
+        0,    0,    0,    0,    0,    0,    0, 5038,
+    10832,10833, 4300,    0, 5039, 5036,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0, 5040,    0,    0, 1850, 5041,    0,    0,
+    10834,    0, 5043, 5042,    0,    0, 5044,    0,
+        0,    0,    0, 5045,    0, 2992, 2635,    0,
+        0, 2700,    0, 3075,    0, 2265, 2374, 2266,
+     1960,    0,    0, 5046,    0,    0, 2375,    0,
+        0, 2204, 5047, 4048, 3607, 5048,    0, 2267,
+        0,    0,    0, 1798,    0, 3203, 2024,    0
+  },
+  { /* U+5Exx */
+        0,    0, 2496, 3819,    0,    0, 3699,    0,
+        0,    0,    0, 5049, 1871,    0,    0,    0,
+        0, 5052,    0,    0,    0,    0, 3291,    0,
+        0, 5051, 5050, 5053,    0, 3365,    0,    0,
+        0,    0,    0,    0,    0, 2887,    0,    0,
+        0,    0,    0, 2497,    0, 2956,    0, 3153,
+     1882,    0,    0, 3292,    0,    0, 5054, 5055,
+     2805,    0,    0,    0,    0, 3973,    0,    0,
+     5058,    0,    0, 5057, 5056, 3853,    0, 5065,
+        0,    0,    0,    0, 4006,    0, 5059,    0,
+        0,    0,    0,    0, 5061, 4023,    0, 5060,
+        0,    0,    0,    0,    0,    0,    0, 5062,
+        0, 3674, 5063, 3884, 5064,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 1805, 3885, 3587, 5066, 5067,    0,
+     2268, 1806, 5068, 2186, 4172, 4145, 1872, 5070,
+        0, 3293,    0, 2269, 2743,    0,    0, 3729,
+        0,    0, 2744,    0,    0,    0,    0, 2720,
+        0,    0,    0,    0,    0, 3366, 3943, 3409,
+        0,    0, 2270,    0, 3820,    0,    0,    0,
+     5071,    0,    0,    0,    0,    0, 3441, 2384,
+        0,    0,    0, 2205,    0, 3367,    0,    0,
+        0,    0,    0,    0,    0, 1445, 2710, 2271,
+     4175,    0,    0,    0,    0,    0,    0,    0,
+        0, 5072, 5073, 3621,    0,    0,    0,    0,
+     5074, 4317, 4337,    0,    0,    0,    0, 5076,
+     5075,    0,    0, 1731,    0,    0, 5077,    0,
+        0,    0, 5080, 5081,    0, 5079,    0, 3792,
+     2745, 5083, 5082, 5078,    0,    0,    0,    0,
+     5084, 5085,    0,    0, 5086,    0,    0,    0,
+     5089, 5087,    0, 5088, 5090,    0, 1572, 3368,
+     5091,    0, 2158, 1684, 3594,    0, 5092, 3569
+  },
+  { /* U+5Fxx */
+        0, 3913,    0, 5093, 4338,    0,    0,    0,
+        0, 5094, 3886, 5097, 4419, 4435,    0, 2554,
+     3563, 5098,    0, 1941, 3294, 1500, 5099, 3860,
+     2272,    0,    0, 3244,    0,    0,    0, 3369,
+        0,10835,    0,    0,    0, 4121, 2187, 2206,
+        0, 5100,    0,    0,    0, 5101,    0, 5107,
+        0, 2607,    0,    0,10836, 3295,    0, 1989,
+     5102,    0,    0,    0, 3771,    0, 3234,    0,
+        0, 5103,    0,    0,    0,10756,    0,    0,
+     5104,    0, 1990,    0, 5105,    0, 5106,    0,
+        0, 5108,    0, 3470,    0,    0, 5109, 5110,
+        0, 5111,    0,    0, 5096, 5095,    0,    0,
+        0, 5112, 2101,    0,    0,    0, 3767,10837,
+        0, 2394, 3783, 3296, 3803, 5113,    0,    0,
+     2746, 1542,    0, 5114,    0,    0,    0, 5115,
+        0, 4124,    0,    0, 3730,    0,    0, 5118,
+     1597, 2926, 5117, 5116, 2102, 3154,    0, 5122,
+     5120,    0, 5119, 4237, 2231,    0,    0,    0,
+     2721, 5121, 3428, 2662,    0,    0,    0, 3510,
+     5125, 5124,    0,    0,    0,    0, 5123,    0,
+     5126, 2232,    0,    0,    0,    0,    0,    0,
+     5127, 3852, 2691,    0,    0, 5128, 3755,    0,
+        0,    0,    0, 3511, 3297,    0,    0,10838,
+        0, 3400,    0,    0, 5129, 1891,    0,    0,
+        0,    0,    0, 2840,    0, 3772,    0,    0,
+        0,    0,    0,    0, 1873, 3578,    0,    0,
+        0,    0,    0,    0,    0,    0, 5130, 2498,
+     3974, 3975,    0,    0, 1598, 5135,10839,    0,
+     3269,    0,    0,    0, 5132,    0,    0,    0,
+        0,    0,    0, 1685,    0,    0,    0,    0,
+     5183, 5134,    0,    0,    0, 3588,    0,    0,
+     5133,    0,    0, 5131,    0, 2346,    0, 5137
+  },
+  { /* U+60xx */
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0, 5143, 5149,
+     5141,    0, 3444,    0,    0, 5146, 3821,    0,
+        0, 5140,    0, 5145, 4301, 2499,    0,    0,
+     3155, 5138,    0,    0,    0, 1942, 5148, 2927,
+     1573, 5142, 1686, 5147,    0,    0,    0, 1991,
+        0, 5144,    0,    0,    0,    0,    0,    0,
+        0,    0, 5150,    0,    0,    0,    0,    0,
+        0, 5152, 5162, 5160,    0,    0, 5157,    0,
+        0,    0, 5156, 4318,    0, 5158,    0,    0,
+     1992,    0, 2273,    0,    0, 2722,    0,    0,
+        0, 5165, 5151,    0,    0,10840,    0, 5155,
+     5139,    0, 1688, 5159, 5161, 3245,    0,    0,
+     2358, 1622, 5153, 5164, 5163, 1993,    0, 3111,
+     1762,    0,    0,    0,    0, 2103,    0, 5154,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0, 5166,    0, 5169, 5171,10841,    0,    0,
+        0, 2567,10842, 5177, 3370, 5167,    0,    0,
+        0,    0, 5175,    0, 1687,    0, 5173, 5174,
+        0,    0, 5170, 5172,    0,    0,    0, 2233,
+     4146,    0,    0, 1807,    0,    0, 1561, 5176,
+        0, 3598, 1423,    0,    0,    0,    0,    0,
+        0,    0, 3731, 5136, 5182, 5186, 4111,    0,
+     5179,    0,    0,    0, 3457, 5184,    0,    0,
+        0,    0,    0,    0,    0, 2806, 5185, 3533,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0, 4363,    0, 5181,    0,10844,    0,    0,
+     5187,    0, 2347,    0, 2957,    0,10843, 1462,
+     5180, 5178,    0, 3066,    0,    0,    0, 5168,
+     2464,    0,    0,    0,    0,    0,    0,    0,
+     3140, 5199,10846, 3067, 5194,    0, 5191, 5192,
+        0, 2608, 5195, 5198,    0,    0,    0,    0
+  },
+  { /* U+61xx */
+     5193, 2637,    0, 5196,    0,    0, 5190,    0,
+     4134, 4133,    0,    0,    0, 5200, 5201, 1463,
+        0,10847,    0,    0,    0, 5189,    0,    0,
+        0,    0, 2056, 1416,    0,    0,    0, 1808,
+    10845, 5197,    0,    0,    0,    0,    0, 5205,
+     5204,    0,    0,    0, 5209,    0,    0,    0,
+    10849,    0,    0,    0, 5210,    0,    0,10848,
+        0,    0,    0,    0, 5208, 5211, 5203, 5207,
+        0,    0, 5212,    0, 5213,    0,    0, 5202,
+     2536,    0, 5206, 3156, 2274, 5188, 2841,    0,
+        0,    0,    0, 5226,    0, 3927,    0,    0,
+     5216, 5217, 5218,    0,    0, 5225,    0, 5224,
+        0,    0, 4041, 1809,    0, 5222,    0, 2105,
+     1712,    0,    0, 5219,    0,    0, 4254, 5221,
+     1464, 5223,    0, 5214, 5220, 5227, 2104, 5215,
+        0,    0,    0,    0,    0,    0, 4197,    0,
+        0,    0, 4147,    0,    0,    0,    0, 5230,
+        0,    0, 5234,    0,    0,    0, 3102,    0,
+     4319, 5235,    0,    0, 5232,    0, 5229,    0,
+    10850, 5228, 5233,    0,    0,    0,    0,    0,
+        0,    0,    0,    0, 3870,    0,    0, 3498,
+        0, 2106,    0, 5236, 5231,    0, 5237,    0,
+        0,    0, 2159,    0,    0,    0, 1615,    0,
+        0,    0, 5245,    0,    0,    0, 1810,    0,
+        0,    0,    0, 5243,    0,    0, 5244, 2359,
+     5242, 5240, 5239, 5246, 5238, 5248,    0,    0,
+     1689,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0, 5250,    0,    0, 5249,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 3298,    0, 5253,    0, 5251, 5241,
+     2160,    0, 5252,    0, 5256, 5255, 5257, 5254
+  },
+  { /* U+62xx */
+     5258,    0,    0,    0,    0,    0,    0,    0,
+     5259, 5260, 3928,    0, 5262, 5261, 2663,    0,
+     2928, 1668, 1690,10851, 5263,    0, 1441,    0,
+        0,    0, 2958, 5264,    0, 7085, 5265, 2133,
+        0, 5266,    0,    0,    0,    0, 2993,    0,
+        0,    0, 5267,    0,    0,    0, 5268, 1906,
+     5269,    0, 5270, 5271, 3157,    0,    0,    0,
+     2207,    0,    0, 4107,    0,    0,    0, 3976,
+     2706, 5272,    0,    0,    0,    0,    0, 2994,
+     7267, 3732,    0, 2612,    0, 2395, 5273,    0,
+        0,    0,    0, 3141,    0, 3861,    0,    0,
+     3183,    0,    0, 5276,    0,    0, 5274,    0,
+     5277,    0,    0, 5275,    0,    0,    0,    0,
+     5278,    0,    0,    0,    0,    0, 3871,    0,
+        0, 1433,    0,    0,    0,    0, 3822,    0,
+        0, 3733,    0,    0, 5279,    0, 5282, 2747,
+     1907,    0, 5280, 5287, 2748,    0,    0,    0,
+        0, 5281, 3608,    0,    0,    0,    0,    0,
+        0, 4198, 5283, 5284, 5288, 3458, 5285, 2275,
+     2976,    0,    0, 5302, 3686,    0, 3184,    0,
+        0,    0,    0,    0,    0,    0,10852,    0,
+        0,    0,    0, 3734, 5371,    0,    0,    0,
+        0, 3944,    0,    0,    0, 3371,    0,    0,
+        0, 4033,    0, 5291, 1599, 3270,    0,    0,
+        0,    0, 5300,    0,    0, 3216, 5294, 5301,
+     5296, 5303, 5299,    0, 5298, 3651,    0, 5292,
+     1691, 5290, 1961, 3185, 5286,    0,    0, 5289,
+     2276, 2973,    0, 2749, 5297, 3622,    0,    0,
+     1962, 1732,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0, 1763, 2821, 5305, 5310,
+        0, 5306,    0, 2161,    0, 5311, 2446, 2329,
+        0,    0,    0,    0,    0,    0, 2638, 5293
+  },
+  { /* U+63xx */
+        0, 2537, 5308,    0,    0,    0,    0, 2500,
+     5309, 1446,    0,    0, 5304,    0,    0,    0,
+        0, 3299,    0,    0,    0,    0,    0,    0,
+        0, 1963,    0,    0,    0,    0,    0, 1994,
+        0,    0,    0,    0,    0,    0,    0, 5307,
+     1417,    0,    0, 2385,    0,    0,    0, 2842,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 3372,    0,    0, 3718, 5313, 3070,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0, 3112,    0,    0, 2455, 5314,    0, 5316,
+     5312,    0,    0,    0,    0, 3919,    0, 3319,
+        0,    0,    0,    0, 3068,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0, 3945,
+     2584, 5328,    0, 5327,    0,    0, 2908,    0,
+        0,    0, 2162,    0,    0,    0, 5321, 2751,
+        0,    0, 3550, 3589,    0,    0,    0,    0,
+     5319,    0,    0, 3069,    0,    0,    0,    0,
+     2626, 5324,    0,    0, 2750,    0, 5318, 5323,
+        0,    0, 3623,    0,    0,    0, 5317,    0,
+     2069,    0,    0, 1753,    0,    0,    0, 5325,
+     4241, 2396, 3217, 5322,    0, 2974,    0, 2277,
+     2888, 1574, 3036, 5320, 1917,    0,    0,    0,
+        0,    0, 2107,    0, 3337, 5326,    0,    0,
+        0,    0,    0, 3071,    0,    0, 5329,    0,
+     5331,    0,    0, 3125, 5337,    0, 5332,    0,
+        0, 5334,    0,    0,    0,    0,    0, 3793,
+     3373,    0, 5335,    0,    0,    0, 4148,    0,
+        0,    0, 4176, 1811,    0,    0,    0,    0,
+        0, 1424,    0, 5333,    0,    0,    0,    0,
+        0, 5330,    0,    0,    0,    0, 1874,    0,
+        0,    0,    0,    0, 1575,10853, 5336,    0,
+        0,    0, 4177,    0,    0,    0,    0,    0
+  },
+  { /* U+64xx */
+        0,    0,    0,    0,    0,    0, 5340,    0,
+        0,    0,    0,    0,    0, 3129,    0, 5347,
+        0,    0,    0, 5341,    0,    0, 5338, 5345,
+        0,    0,    0,    0, 5315,    0,    0,    0,
+        0,    0,    0,    0,    0,    0, 5342,    0,
+     5346,    0,    0,    0, 3700, 3459,    0,    0,
+        0,    0,    0,    0, 5339,    0, 5343,    0,
+        0,    0, 2108,    0,    0,    0, 2431,    0,
+        0,    0, 2975,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0, 5351,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+     3390,    0,    0,    0,    0,    0,    0,    0,
+    10854,    0,    0,    0,    0,    0,    0, 5348,
+        0, 4012,    0,    0,    0,    0,    0, 5349,
+        0,    0,    0,    0,    0,    0, 5350,    0,
+     4088,    0, 2916,    0,    0,    0,    0,    0,
+        0,    0,    0, 2134,    0,    0,    0,    0,
+     5357,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 2465, 5354,    0, 5353,    0,    0,
+        0,    0, 3590,    0,    0,10855, 3499,    0,
+        0,    0,    0,    0, 3401, 5355,    0,    0,
+        0, 5356,    0, 3839,    0, 3609, 2447,    0,
+     2995,    0, 3996,    0,    0,    0,    0,    0,
+        0, 1733,    0, 5363, 5358,    0,    0,    0,
+        0, 4178, 5365,    0,    0, 5361,    0, 5362,
+        0,    0,    0,    0,    0, 3072,10856,    0,
+        0,    0, 5360,    0, 5295,    0,    0,    0,
+     5364,    0, 5359,    0,    0,    0,    0,    0,
+     5369, 5370, 3391, 5372,    0,    0, 2448, 5367,
+        0,    0,    0,    0, 1908,    0,    0, 5373,
+        0, 5366, 5377,    0, 5376,    0, 5375,    0,
+        0,    0, 5378,    0,    0, 5380, 2807,    0
+  },
+  { /* U+65xx */
+     5379,    0,    0,    0,    0, 5383,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+     5381,    0,    0,    0, 5382, 5344,    0,    0,
+        0,    0,    0, 5385, 5384,    0,    0,    0,
+        0,    0, 5352, 5386, 5374,    0,    0, 2501,
+        0,    0,    0,    0, 5387, 5388, 5390, 5389,
+     5391, 1692,    0, 2278,    0,    0, 3946, 2929,
+        0,    0,    0,    0,    0, 2208,    0,    0,
+     5393,    0,    0,    0,    0, 5396,10857, 3810,
+        0, 1943,    0,    0,    0, 5395, 5394, 3624,
+     5397, 1995,    0,    0,    0, 5399, 5398,    0,
+        0,    0, 1812, 2466,    0,    0, 3534,    0,
+        0,    0,    0,    0, 2109,    0,    0,    0,
+     2904,    0, 5400,    0, 2930, 3392,    0, 3823,
+     5401,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 5402, 5403,    0,    0,    0, 3878,
+     4949, 2952,    0,    0, 3804,    0, 2406,    0,
+     3735, 3701,    0,    0,    0,    0,    0, 3429,
+        0, 4263,    0, 5405, 2586,    0,    0, 5406,
+        0, 1432,    0,    0, 2026, 2959,    0, 3824,
+        0,    0,    0, 5407, 2478, 3235,    0, 2503,
+     2843,    0,    0,    0,    0,    0,    0, 5408,
+        0, 3947,    0,    0, 1591, 2504,    0,    0,
+        0, 5411,    0, 5409, 5412, 4255, 5410,    0,
+        0,    0,    0, 3005, 5413,    0,    0, 3120,
+        0,    0, 5414,    0,    0,    0,    0, 1876,
+        0, 5416,    0, 5415,    0,    0,    0,    0,
+     5417, 5418, 1877,    0,    0, 3570, 3218, 1956,
+     2505, 3073,    0,    0, 2692, 1426,    0,    0,
+        0, 5419,    0,    0,    0,    0,    0,    0,
+        0,    0, 1600, 5423,    0,    0,    0,    0
+  },
+  { /* U+66xx */
+    10858,    0, 2279, 5422,    0,    0, 2361, 2752,
+        0,10861, 5421,    0, 2753,    0, 4074, 2360,
+        0,    0,    0, 1465, 2960,10859,    0,    0,
+        0,    0,    0,    0, 5428,    0,10863, 2931,
+     1543,    0,    0,    0,10864, 2685,    0, 4018,
+     2432,    0,    0,    0,    0, 2754,10862, 2921,
+        0,10752,    0,    0, 5427, 5425, 5426,    0,
+        0,    0,    0,10860, 3271,    0,    0, 5458,
+        0, 5432, 2538, 2280, 5430,    0,    0,    0,
+        0, 5431,    0, 2844,    0,    0,    0, 5429,
+        0,    0, 2459,    0,    0,    0,    0,10866,
+        0,10867,    0,    0,    0, 5434, 5433, 5438,
+        0,    0, 5439,    0, 5435,10865, 1694, 5436,
+     5437, 3719,    0,    0,    0,    0, 3825, 2110,
+     5440,    0,    0,10869, 2932,    0, 2755,    0,
+        0,    0, 3246,    0,    0,    0,    0,    0,
+        0, 2013,    0, 5441, 5445,    0,    0, 1641,
+     5442, 5444,    0,    0,    0,    0, 5443,    0,
+        0, 2707,    0,    0,    0,    0, 3236, 1447,
+     5446,10870,    0,    0,    0, 5447,    0,    0,
+    10871,    0, 3300,    0,    0,    0, 4311,    0,
+        0,    0,    0, 2479,    0,    0, 3929,    0,
+        0,    0,10872,    0, 3977,    0,    0,    0,
+     5454, 5449,    0,    0, 5452,    0, 5451,10873,
+        0, 5448,    0,    0, 5453,    0,    0, 3540,
+        0, 5450,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0, 5455,    0,
+        0, 2708, 5456,    0, 4179, 3660,    0,    0,
+     5457,    0,    0,    0,    0,    0, 5459,    0,
+        0, 5460,    0,    0,    0,    0,    0,    0,
+     5461,    0, 2016, 1544, 2281, 5462,    0, 5463,
+     2713, 3074,10874,10755, 4662, 3038, 3037, 3158
+  },
+  { /* U+67xx */
+     2389,    0,    0, 4500,    0,    0,    0,    0,
+     2146, 4149,    0, 3948,    0, 3854,10875, 5464,
+        0,    0,    0,    0, 2433, 3321, 5465, 4339,
+        0,    0,    0, 3978,    0, 3301, 5466, 1878,
+        0,    0,    0,    0,    0,    0, 5467, 5468,
+     4100,    0, 4046, 4034, 4008, 2449, 5470,    0,
+        0, 2613,    0,    0, 3997,    0, 5472, 5475,
+     5474,    0, 1875,    0,    0, 1944,    0, 5471,
+        0, 5473,    0,    0,    0,    0, 5476,    0,
+        0, 2909,    0,    0,    0,    0, 4227, 1451,
+     2414, 3130,    0, 2599,    0,    0, 2809,    0,
+        0, 5479,    0,    0, 3430,    0, 5477, 3113,
+     5478, 2808, 4103, 5480, 5481, 4208,10877,    0,
+        0,    0, 5486,    0,    0, 2282,    0, 3625,
+     5483, 3460, 5420, 5424,    0, 1927,    0, 3611,
+        0,    0,    0,    0, 5485,    0, 2756, 3702,
+        0,    0,    0,    0,    0, 5491,    0, 3756,
+        0, 5482,    0, 5488, 5487,    0,    0,    0,
+     2961,    0,    0,    0,    0, 4025,    0, 4281,
+        0,    0, 4019,    0, 1642, 2506,    0,    0,
+     4364, 5490, 2905,    0,    0,    0, 5489,    0,
+        0, 5484,    0,    0,    0,    0,    0, 2209,
+        0,    0,    0, 5496, 5494,    0, 1643, 5492,
+     5498, 5504,    0,10878,    0,    0,    0,    0,
+    10880, 3142,    0,    0, 3887,    0, 5506,    0,
+        0,    0, 3762,    0,    0,    0, 5505, 3652,
+     3979, 1813,    0, 3001, 2664,    0,    0,    0,
+     3341,    0, 4150,    0,    0, 5501, 5500,    0,
+        0,    0, 5502,    0, 5499,    0,    0, 5507,
+        0, 5497,    0,    0, 5495,    0, 5503, 5493,
+        0, 3272,    0, 4130, 2576, 2434,    0,    0,
+        0,    0,    0, 2376,    0,    0, 4027, 1725
+  },
+  { /* U+68xx */
+        0,10881, 3336, 3520, 1545,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0, 2996,    0,    0, 2934, 2078,
+        0,    0,    0,    0,    0,    0, 5509,    0,
+        0, 2283, 1784,    0,    0,    0,    0,    0,
+        0, 5511, 1776, 5517,    0,    0,    0,    0,
+        0,    0, 5514,    0, 2997,    0,    0,    0,
+     1735, 2362,    0,    0, 1734, 2397,    0,    0,
+     5512, 2137, 2111, 3461,10882,    0, 5510,    0,
+     1448,    0,    0,    0,    0, 5513, 5515,    0,
+     2019, 2080,10879, 1814, 1923,    0,    0,    0,
+        0, 5518,    0,    0, 2439, 4029,    0, 2467,
+        0,    0,    0, 5519,    0,    0,    0, 3776,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0, 5531,    0, 1617, 5520,
+        0,    0,    0,    0,    0,    0, 5537, 5521,
+        0, 4264,    0, 5528,    0, 3635,    0,    0,
+        0,    0,    0,    0,    0, 5536,    0, 5523,
+        0,    0,    0, 1430, 5525,    0,    0, 2284,
+        0,    0,    0, 5527,    0, 5526,    0, 5522,
+     5533,    0, 2757,    0,    0,    0, 4871, 2234,
+     4228,    0,    0,    0,    0, 5524,    0, 3374,
+     1695, 2363,    0, 5516,    0, 5532, 1757,    0,
+        0, 5530, 5534,    0, 3462,    0,    0,    0,
+        0,    0,    0,    0, 1880,    0, 5564,    0,
+    10753, 4083, 5539, 1879,    0, 5546,    0,10883,
+        0,    0, 3980,    0, 5547, 5549,    0, 5553,
+     5541,    0, 3206,    0,    0,    0,    0, 3463,
+     5557, 5544,    0, 5554,    0,    0,    0, 5548,
+        0,    0,    0,    0,    0,    0, 2845, 5558,
+        0,    0, 2933,    0,    0,    0,    0,    0,
+        0, 5556, 1815,    0,    0,    0,    0,    0
+  },
+  { /* U+69xx */
+     4372, 5538,    0,    0, 5552, 1466,    0,    0,
+     5540,    0,    0, 4068, 5545, 2822, 3329, 5535,
+        0,    0, 5551,    0,    0,    0,    0,    0,
+        0, 2910, 5561, 1773, 2163,    0,    0,    0,
+        0, 5563, 5542, 5562,    0, 5555, 5543,    0,
+     5559,    0, 5560,    0,    0,    0,    0,    0,
+     5577,    0,    0,    0, 3524,    0, 5550,    0,
+        0, 5573,    0,    0,    0, 5575,    0, 3346,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 4180,    0,    0,    0,    0,    0,
+        0,    0,    0, 3846, 5570, 3144,    0,    0,
+        0, 5576, 3039,    0, 5567, 5580, 5579,    0,
+     3557, 5578, 3552,    0,    0,    0,    0,    0,
+    10885,    0, 5582, 5569,    0, 2014, 5572, 2693,
+        0,    0,    0, 3636, 5574, 2017,    0, 5566,
+     5568, 5565,    0,    0, 4340, 1750, 5571,    0,
+        0, 5581, 1713,    0,    0,    0,    0,    0,
+        0,    0, 2421,    0,    0,    0, 1565,    0,
+        0, 5598,    0,    0, 4341, 5601,    0,    0,
+    10887,    0,    0, 2846, 5600,    0,    0,    0,
+     5599,    0,    0,    0,    0,    0,    0, 5596,
+        0,    0,    0,    0,    0,    0, 5584,    0,
+        0, 5613, 5583,    0, 5602,    0,    0,    0,
+        0,    0,    0, 5594,    0,    0, 5589, 5586,
+        0, 5587,    0, 5595,    0,    0,    0, 7804,
+        0,    0, 5592, 2285, 3330, 3076, 5590,    0,
+     5585,    0,    0, 5588,    0,    0,    0,    0,
+     4181, 4022,    0,    0,    0, 5593, 5603,    0,
+        0,    0,10888,    0,    0,    0,    0, 5611,
+     5604,    0,    0, 5617,    0, 5615,    0,    0,
+        0,    0, 5610,    0,    0,    0,    0,    0,
+        0, 5609,    0, 3338,    0, 3077,    0, 5607
+  },
+  { /* U+6Axx */
+        0,    0, 5605,    0,    0, 5612,    0,    0,
+        0,    0, 5618, 3751, 5624,    0,    0,    0,
+        0,    0, 5619, 5622, 5616,    0,    0, 3280,
+        0, 3784,    0, 5606,    0,    0, 5614, 2758,
+        0, 4089, 5634, 5621,    0,    0,    0,    0,
+        0, 2164, 1601, 1755,    0,    0, 5597,    0,
+    10889,    0,    0,    0,    0, 2759, 5626,    0,
+     5633, 2627, 1774,    0,    0, 3210,    0,    0,
+        0,    0,    0,    0, 5623,    0,10891, 5628,
+     5632,    0,    0, 1996,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+     1924, 5630,    0,    0,    0,    0,    0, 1881,
+        0, 3521, 5629,    0,    0,    0, 5631,    0,
+        0,    0,    0,10890,    0,    0,    0,    0,
+        0,    0, 5625,10892,    0,    0,    0,    0,
+     5627,    0,    0,    0,    0,    0,10893, 1756,
+     3237,    0,    0,    0, 5638,    0,    0,    0,
+        0,    0,    0,    0,    0, 5636, 2235,    0,
+     5635,    0,    0,    0,    0,    0,    0, 5641,
+        0,    0,    0,    0, 5508,    0,    0,    0,
+     5637,    0, 5639, 5640,    0,    0,    0,    0,
+        0,    0, 5652,    0, 5648,    0, 5529,    0,
+        0,    0,    0, 5647,    0,    0,    0,    0,
+     5646,    0,    0, 5643,    0,    0,    0,    0,
+        0, 5620, 5645, 5644,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0, 5650,    0, 4330,    0,    0,    0,    0,
+        0,    0, 5653, 2065,    0,    0, 5649, 5651,
+        0,    0,10894,    0,10895,    0,    0,    0,
+     3673,    0, 5654,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 5658, 5655,    0,    0,    0,    0
+  },
+  { /* U+6Bxx */
+        0,    0,    0,    0, 4219, 5656,    0,    0,
+        0,    0, 5608,    0,    0,    0,    0,    0,
+        0,    0, 5659,    0,    0,    0, 5660,    0,
+        0,    0,    0,    0,    0, 1525,    0, 5662,
+     2139, 2539,    0, 2027,    0,    0,    0, 1602,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 4199,    0,    0,    0,    0, 5664,
+     5663, 5666, 1909,    0,    0, 2028, 1816,    0,
+        0,    0,    0, 5669,    0,    0,    0, 5668,
+        0, 5670,    0,    0, 1644,    0, 3219,    0,
+     5671,    0,    0, 1817, 5673,    0,    0,    0,
+        0, 5672,    0, 5674,    0,    0,    0, 5675,
+        0, 5676, 2507, 2935, 2351,    0, 3840,    0,
+        0, 3920, 4360,    0,    0,    0,    0, 2529,
+        0,    0,    0, 2398, 4312,    0,    0,    0,
+     5677, 5678,    0, 2508,    0,    0,    0, 5679,
+     5680,    0,    0, 5682, 5681,    0, 4004,    0,
+        0, 2694, 2614, 2480,    0, 5683,    0,    0,
+        0,    0,    0,    0,    0, 5685, 2823,    0,
+     5684,    0,    0,    0,    0,    0, 5686,    0,
+        0,    0,    0,    0, 5687,    0,    0,    0,
+        0,    0, 5688, 5689,    0,    0,    0, 5690,
+        0, 5692, 5691, 5693, 1603, 3238,    0, 5694,
+        0,    0, 2450, 1736, 5695,    0,    0, 3418,
+     4838,    0,    0,    0,    0, 1883, 5696,    0,
+        0,    0,    0, 5697,    0, 3930, 4020,    0,
+        0,    0, 3517, 5698, 3736,    0,10896,    0,
+     3757,    0,    0, 4093,    0,    0,    0, 5699,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0, 5701, 5700,    0,    0, 5703,
+        0,    0,    0, 5702,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0
+  },
+  { /* U+6Cxx */
+        0,    0,    0,    0,    0,    0,    0,    0,
+     5705,    0,    0,    0,    0,    0,    0, 2509,
+        0, 4059,    0, 5706, 5707,    0,    0, 1884,
+        0,    0,    0, 5708,    0,    0,    0,    0,
+        0,    0,    0, 5710, 5709,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0, 2889,    0,    0, 3785,
+     1546,    0,    0,    0,    0,    0, 3703,10897,
+     3375, 2665, 1945,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0, 3704,    0,
+     2552,    0,    0,    0,    0, 5712,    0, 1818,
+        0,    0, 1592,    0,10898, 3560, 5711, 2286,
+     3247,    0, 5713,    0,    0,    0,    0,    0,
+     5721,    0, 5714,    0,    0,    0,    0,10900,
+     3135,    0, 1946, 5722,    0,    0,    0,    0,
+        0,    0, 2140,    0,    0, 1885, 5720,    0,
+        0, 5718, 5715, 4200,    0,    0,10899,    0,
+     3322,    0,    0,    0, 3535, 5716,    0,    0,
+     5724,    0, 5723, 2071,    0,    0, 1611,    0,
+        0, 2377, 5717, 5719,    0,    0,    0,    0,
+        0, 4003, 3186,    0,    0,    0,    0,    0,
+        0,    0,    0, 4035,    0,    0, 5732,    0,
+        0, 5733,    0, 1645,    0,    0,    0,    0,
+     3862, 4135, 5735, 2541, 2760, 5728, 5734, 1576,
+        0, 1997,    0,    0, 5725, 5730,    0,    0,
+        0, 2998, 3653,    0, 3737,    0,    0,    0,
+        0,    0,    0, 5727,    0, 3949,    0, 5729,
+        0, 5738,10901, 5736,    0, 5731,    0,    0,
+        0, 3950, 3612, 1947,    0, 3389,    0,    0,
+     3273,    0, 5739,    0,    0,    0,    0, 5737,
+     3159, 5726,    0, 1547,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0
+  },
+  { /* U+6Dxx */
+        0,    0,    0,    0,10902,    0,    0,    0,
+        0,    0,    0, 4182, 5750,    0,    0,    0,
+        0,    0, 5749,    0,    0,    0,    0, 3000,
+        0, 5746,    0, 4212,    0,    0, 3500, 5740,
+        0,    0,    0,    0,    0, 3327,    0,    0,
+        0, 1548, 2287, 5743,    0,    0,    0,    0,
+        0,    0, 2639, 5748,    0, 5747, 5742,    0,
+     5745,    0,    0, 1764,    0, 5744, 3613,    0,
+        0, 4244,    0,    0, 2810, 2999,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0, 5756, 5754,    0, 3805,    0,    0,    0,
+        0,    0,    0, 5751, 5753,    0, 1530,    0,
+        0, 2288, 4342,    0, 1721,    0, 3826,10904,
+        0,    0,    0,    0, 4201,    0,    0, 1696,
+     2847, 5755,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0, 5760,    0,10903,
+     2761,    0,    0,    0, 4152,    0, 5757,    0,
+        0,    0,    0, 5752,    0, 5758,10905,    0,
+        0, 4292,    0, 3467, 3512,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,10906,    0,    0, 1714,
+        0,    0, 1557,    0,    0, 5764,    0,    0,
+     5767,    0,    0,    0, 4265,    0,    0,    0,
+     4204,    0,    0,    0,    0, 5774, 5768, 5765,
+        0,    0,    0, 4282, 5771,    0,    0,10907,
+        0, 2674, 5773,    0,    0, 5778,    0,    0,
+     3465, 5776,    0,    0,    0,    0, 5770,    0,
+        0, 3220,    0,    0, 5777,    0, 5766,    0,
+     5772,    0, 5779, 1502, 5769,    0, 5780,    0,
+        0, 2848,10909, 2695,    0, 3859,    0, 2364,
+    10908, 5761, 5775, 3410,10910,    0,    0,    0
+  },
+  { /* U+6Exx */
+        0,    0,    0,    0,    0, 2936,    0, 1765,
+     2399, 2762, 5763, 2666,    0,    0,    0,    0,
+        0,    0,    0, 2112,    0, 5762,    0,    0,
+        0, 5784, 2709, 2188,    0, 5799,    0, 5793,
+     1964, 3431,    0, 5788, 5797, 1425, 1522,10913,
+        0, 1623,    0, 5790, 3114, 5781, 5783, 2289,
+        0,    0,    0,    0,    0,    0,    0,    0,
+     5800,10911, 5795,    0,10914,    0, 5787,    0,
+        0,    0,    0, 5794,    0,    0,    0,    0,
+        0,    0, 4053,    0,    0, 5792, 5796,    0,
+        0,    0,    0,    0,    0,    0, 2210,    0,
+     2763,    0,    0, 3221,10912,    0,    0, 5786,
+        0,    0,    0,    0,    0,    0,    0, 4151,
+        0,    0,    0, 5789,    0,    0, 5782, 3466,
+        0,    0, 5785,    0,    0,    0, 5791,    0,
+        0,    0,    0,    0,    0,    0, 4373, 2568,
+     4042,    0, 5801,    0,    0,    0,    0,    0,
+        0,    0,    0,    0, 3680,    0,    0, 5813,
+     2189,    0,    0,    0,    0,    0, 2696,    0,
+     5803,    0,    0,    0, 4245, 2290,    0, 5816,
+        0,    0, 1488,    0,    0, 5814,    0,    0,
+        0,    0, 5802,    0,    0,    0,    0, 5808,
+        0,    0, 5810,    0,    0,    0, 4183, 5805,
+        0,    0, 3398,    0,    0, 5807,    0,10915,
+        0,    0, 5815,    0, 5809, 4081,    0,    0,
+        0, 5804,    0, 2540, 5828,    0,    0,    0,
+        0, 1766,    0, 5806, 5811, 5812,    0,    0,
+        0,    0,    0,    0,    0, 3178, 3160,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0, 5820,    0,    0, 5826,
+        0,    0, 5824,    0, 3393,    0,    0, 5831,
+     5821,    0,    0,    0,    0,    0, 5822, 5798
+  },
+  { /* U+6Fxx */
+        0, 1969, 3786,    0,    0,    0, 2569,    0,
+        0, 2343,    0,    0,    0,    0,    0, 4343,
+        0, 5818,    0, 5830, 1577, 3078,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+     3661,    0, 1819, 4320,    0,    0,    0,    0,
+        0,    0,    0, 4043, 3340,    0,    0,    0,
+        0, 5825, 5827,    0,    0,    0,    0,    0,
+     3026,    0,    0,    0,    0,    0, 5829, 5823,
+        0, 5817,    0,    0,    0, 1821,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0, 2141,    0,    0,    0,
+     5843,    0,    0, 5838, 3002,    0,    0, 1759,
+        0,    0,    0,    0, 2697,    0, 5847,    0,
+        0,    0,    0,    0,    0, 5840, 3302, 5837,
+     3347,    0,    0,    0, 5872,    0,    0,    0,
+     5834,    0, 5833,    0, 5842,    0,    0,    0,
+     5836, 5835, 5841,    0, 2915,    0, 5832,    0,
+    10916,    0,    0,    0,    0,    0, 5844,    0,
+        0, 5845,    0,    0,    0,    0,    0, 1820,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0, 5850,    0, 5849, 5851,    0,    0,    0,
+        0,    0, 5854,    0,    0,    0,    0,    0,
+        0, 3419,    0, 5848,    0,10917,    0,    0,
+        0, 5852,    0,    0,    0,    0,    0,    0,
+     2135, 3191, 5846, 3599,    0,    0, 5853,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0, 5858, 5856,    0,    0,
+     5859,    0,    0, 5862,    0,    0,    0, 5855,
+     2330, 3580,    0,    0, 5759,    0,    0,    0,
+        0,    0,    0, 4220, 5857,    0, 5861, 3187,
+        0, 5860,    0, 5839,    0,10918, 7405,    0,
+        0,    0, 5865,    0,    0,    0, 5869,    0
+  },
+  { /* U+70xx */
+        0, 5867,    0,    0,    0,10919,    0,10920,
+        0, 5863,    0, 5864,    0,    0,    0, 5868,
+        0, 5866,    0,    0,    0, 3806,    0,    0,
+     5874,    0, 5871, 5870,    0, 5873, 3530, 5875,
+        0,    0,    0,    0,    0,    0, 3281, 3179,
+    10921,    0,    0,    0, 2919,    0,    0,    0,
+     5876,    0, 5878,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0, 5877,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0, 5819,    0,    0,    0,
+        0, 5879,    0,    0,    0,    0,    0,    0,
+     3549,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0, 5880,    0,    0,    0,    0,
+        0,    0,    0, 1646,    0,    0,    0, 3468,
+     1697,    0,    0,    0,    0,    0,    0,    0,
+     1948,    0,    0,    0, 2600, 2400,    0,    0,
+        0,    0,    0,    0,    0,10922,    0,    0,
+        0, 4331, 2890,    0,    0,    0, 1578,    0,
+        0,    0, 5882,    0,    0,    0,    0,    0,
+        0, 5881,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,10923, 5885, 3222, 5888, 5883,
+        0,    0,    0, 5887,    0,    0,    0,    0,
+     5886, 3416, 1467,10751,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+     4315,    0,    0, 5890,    0,    0,    0, 1512,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0, 5892,    0,    0,    0, 5891,    0, 5889,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0, 5884,    0,    0,    0,    0,    0,    0,
+        0, 3951,    0,    0,    0, 5894,    0,    0
+  },
+  { /* U+71xx */
+        0,    0,    0,    0,10925,    0,    0,    0,
+        0, 5893,    0,    0,    0,    0,    0,10924,
+        0,    0,    0,    0, 1579,    0,    0,    0,
+        0, 5896, 3872,    0, 5895,    0,    0,    0,
+        0, 4063,    0,    0,    0,    0, 2765,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0, 3027,    0,
+        0,    0,    0,    0, 2764,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,10927,10928,
+        0, 4321,    0,    0, 5902,    0, 3003,    0,
+        0,    0,    0,    0,    0, 5898, 5903,    0,
+        0, 1580,    0,    0,10926,    0,    0,    0,
+        0,    0, 5901,    0, 3637, 5897, 5900, 2766,
+        0, 3715,    0,    0, 5904,    0, 2587,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0, 3004,    0,    0,
+        0,    0,    0,    0, 5907,    0,    0,    0,
+     5899,    0, 2075,    0,    0,    0,    0, 5905,
+        0,    0,    0,    0, 4184, 5908,    0,    0,
+        0, 7808,    0,    0,    0,    0,    0, 2679,
+        0,    0,    0,    0,    0,    0,    0,    0,
+     5909,    0,    0,    0, 5910,    0,    0,    0,
+        0, 3586,    0,    0,    0,    0,    0,    0,
+        0, 5912,    0,    0,    0,    0, 5913,    0,
+        0,10930,    0, 3591,    0,    0,    0,    0,
+     3469, 5915,    0,    0,    0,    0, 5917,    0,
+     4283,    0, 5914,    0, 5916, 1581,    0, 5911,
+        0,    0,    0,    0,    0,    0,    0, 4759,
+     5918,    0,    0,    0,    0, 3079, 2468, 5920,
+        0,    0,    0,    0, 5919, 2824, 4663,    0,
+        0,    0,    0,    0,    0, 5921,    0,    0,
+        0, 5923,    0, 5906, 5922,    0,10931, 5924
+  },
+  { /* U+72xx */
+        0,    0,    0,    0,    0,    0, 3662,    0,
+        0,    0,    0,    0,    0, 5925,    0,    0,
+     5926,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0, 5927,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+     5928,    0, 3352,    0, 5930, 5929,    0,    0,
+     5931,    0, 5932,    0,    0, 2601, 3827,    0,
+        0,    0, 4118, 5933, 5934, 3062, 2542, 5935,
+     5936,    0,    0,    0,    0,    0, 5937, 3904,
+     3705,    0,    0, 5938, 3627,    0,    0,    0,
+        0,    0, 3303,    0,    0,    0,    0,    0,
+     5939, 1669,    0, 1957,    0, 4080,    0, 4064,
+        0, 1618, 4344,    0,    0,    0,    0, 3998,
+        0, 3864,    0,    0,    0,    0,    0,    0,
+        0,    0, 2937,    0, 5940,    0,    0,    0,
+        0, 3513,    0,    0,    0, 2165, 5941,    0,
+     2402, 5943, 5942,    0,    0,    0,    0, 5944,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 5945,    0,    0,    0, 5946,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+     1910,    0, 5947,    0,    0,    0,    0, 5948,
+        0,    0,    0,    0, 2166,    0,    0, 3706,
+        0,10932, 5950,    0,    0,    0, 2811,    0,
+        0, 5949,    0,    0,    0,    0,10933,    0,
+        0,    0, 1998, 5951, 5953,    0, 5952,    0,
+        0,    0,    0,    0,    0,    0, 5954,    0,
+     2211,    0, 5955,    0,    0,    0,    0, 2047,
+        0, 3040,    0, 2349,    0,    0,    0,    0,
+     5957, 5958, 5956,    0,    0,    0,    0,    0,
+        0, 2615,    0,    0, 3518, 1999,    0,    0,
+        0,    0,    0,    0,    0,    0,    0, 5960,
+     3208, 5959,    0,    0, 4345, 3638,    0,    0
+  },
+  { /* U+73xx */
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 5963,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0, 5965, 5962,
+        0,    0,    0, 4094, 5964, 5966,    0, 4266,
+        0,    0,    0,    0,10934, 5970,    0,    0,
+        0, 5969, 3282, 3585,    0,    0, 2167, 5968,
+        0,    0,    0,    0, 5967,    0, 4153, 4154,
+        0,    0,    0,    0,    0,    0, 5971, 1582,
+        0,    0,    0,    0, 2342, 2510,    0,    0,
+        0,    0,    0,    0,    0,    0, 5972, 5973,
+        0,    0,    0,    0,    0,    0,    0, 5975,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0, 2667,    0,    0,    0,    0,
+     5977,    0, 5976,    0,    0,    0,    0,    0,
+     5978,    0, 1737,    0,    0, 5980,    0,10936,
+     5979,    0, 5982, 5981,    0,    0,    0,    0,
+        0,    0,    0,    0, 2190,    0,    0, 4238,
+        0, 2018,    0, 1604,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0, 2048,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0, 1851,    0,    0,    0,    0,    0,    0,
+        0,    0, 4302, 5984,    0,    0,    0,    0,
+        0,    0,    0, 5986,    0,10937,    0,    0,
+     5987,    0, 1647,    0,    0,    0,    0,    0,
+     5983,10938, 2469,    0,    0, 3323, 5985,    0,
+        0,    0,10941,    0,    0,    0,10939,    0,
+        0,    0,    0,    0,    0,    0, 5990,    0,
+     2616,    0,    0,10940,    0, 5988,    0,    0,
+        0,    0, 2098,    0,    0, 3707, 5989,    0,
+        0, 6016,    0,    0,    0,10943,    0,    0,
+     5995,    0,    0,    0,    0,    0, 2191,    0
+  },
+  { /* U+74xx */
+        0,    0,    0, 1949,    0, 5992, 4229,10942,
+        0, 4246,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 3188,    0,    0, 5994,10944,    0,
+        0,10946,10945,    0,    0,    0,10947,    0,
+        0,    0, 5996, 4284, 2029, 3758, 3614,    0,
+        0,    0, 5997,    0,    0,    0,    0, 5999,
+        0, 6002,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0, 5998,    0,    0,
+        0, 6001, 2236, 1549, 6003,    0, 2900, 6000,
+     4290,    0,10948, 6006, 7806,    0,    0,    0,
+        0, 6004, 6007,    0,    0,    0,    0, 5993,
+     6005,    0,    0, 2378,    0,    0, 6008,    0,
+        0,    0,    0,    0,    0,    0, 6009,    0,
+        0,    0,    0, 4230,    0,    0,    0,    0,
+        0,10949,    0, 6010,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0, 6011,10950,
+        0,    0, 5991,    0,    0,    0,    0, 6012,
+        0,    0,    0,    0,    0,    0,    0,    0,
+     1822,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0, 2543,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 6013,    0,    0,    0,    0, 6014,
+        0,    0,    0,    0, 6015,    0,    0,    0,
+        0,    0,    0,    0, 1531,    0,    0,    0,
+     6017,    0, 3787, 6018,    0,    0, 1790, 6019,
+        0, 6020,    0,    0,    0,    0, 6021,    0,
+     6023, 6024, 6022,    0,    0,    0, 3811, 6026,
+     6025,    0,    0,    0,    0,    0,    0,    0
+  },
+  { /* U+75xx */
+        0,10951,    0, 6028, 6027, 6029,    0,    0,
+        0,    0,    0,    0, 6030, 6032, 6031,    0,
+        0, 2345,    0, 6034,    0, 6033,    0,    0,
+     1823,    0, 2871,    0, 3412,    0, 6035, 2938,
+        0,    0,    0, 2470,    0, 1593, 6036,    0,
+     4185,    0,    0, 3921, 6037,    0,    0,10820,
+     3420, 4155, 2291, 2849,    0,    0,    0, 3239,
+     4626,    0, 3304, 1670, 6038,    0,    0,    0,
+        0,    0,    0,    0, 6039,    0, 6044,    0,
+        0, 6042, 6041, 5392, 1698, 6040,    0, 1468,
+        0, 3676,    0,    0, 3708,    0,    0,    0,
+        0, 4247, 6045, 6043, 3256, 2920,    0,    0,
+     3677,    0, 3773,    0, 6047, 4242, 2113, 6048,
+        0, 6046, 3720, 6049,    0, 6050,    0,10952,
+     1469,    0,    0, 2812, 6055,    0, 6052, 3555,
+     6051,    0,    0,    0,    0,    0,    0, 1886,
+        0,    0, 6058,    0,    0,    0, 6053, 6054,
+        0, 6057, 6056, 3765,    0,    0, 3042, 3041,
+        0, 1911,    0,    0, 6059,    0,    0,    0,
+        0,    0, 6060,    0,    0, 6061,    0,    0,
+        0,    0,    0, 6063,    0, 6062,    0,    0,
+        0,    0,    0, 1558,    0,    0,    0,    0,
+        0, 6071, 3738, 6065,    0, 6067,    0,    0,
+     6069, 2850,    0,    0, 6070, 6068, 2570,    0,
+        0,    0, 6064, 6066,    0, 3794,    0, 2767,
+        0,    0, 6073,    0,    0, 6072,    0,    0,
+        0,    0, 6074,    0, 2544, 2365,    0,    0,
+     3471, 6075,    0, 3333,    0,    0, 6077,    0,
+        0,    0, 4231, 6076,    0,    0,    0,    0,
+        0, 3081,    0,    0,    0,    0,    0,    0,
+     6082,    0, 6084, 6085, 3248,    0,    0,    0,
+        0,    0, 6083,    0, 6080,    0, 6078, 6079
+  },
+  { /* U+76xx */
+        0, 6081,    0,    0,    0,    0,    0,    0,
+        0, 6088,    0, 6086,    0, 6087,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0, 6089,
+     6091, 6092, 6093,    0, 6094,    0,    0, 6090,
+        0,    0,    0,    0,    0,    0,    0,    0,
+     6096,    0,    0,    0, 6095,    0,    0,    0,
+        0,    0,    0, 6097,    0,    0,    0,    0,
+        0,    0, 4267,    0,    0,    0, 6100, 6098,
+     6099,    0,    0,    0, 1852,    0,    0,    0,
+        0,    0, 4136,    0,    0,    0, 3896,    0,
+     6102,    0,    0,    0, 6101,    0,    0,    0,
+        0, 6103, 6104,    0,    0,    0,    0, 6108,
+     6105, 6106, 6107,    0, 6109,    0,    0,    0,
+     6110,    0, 6111,    0,    0,    0, 6112,    0,
+     6113,    0, 3681, 3432, 6114, 3654, 3780,    0,
+     6115,    0,10953, 6116, 3394,    0, 1699, 2292,
+     6117,    0,    0, 6118,    0,    0, 6119,    0,
+     2453,    0,    0, 6121,    0,    0, 6120,    0,
+        0, 6122, 6123,10956,10954,    0,10955,    0,
+        0,    0,    0,    0,    0,    0,10957,    0,
+        0,    0,    0,    0,    0,    0, 3739,    0,
+     6124,    0,    0,    0, 6125,    0,    0, 7781,
+     6126, 6127, 6128,    0,    0,    0,    0, 2458,
+        0,    0, 6129, 3626,    0,    0, 4011,    0,
+     1550,    0, 1559,    0,    0, 6130,    0,    0,
+        0,    0, 6132,    0,    0,    0, 6131, 3464,
+        0,    0,    0, 2939, 5665,    0, 6133, 4075,
+        0, 6134,    0, 1824, 3721, 6135,    0, 6136,
+        0,    0, 6137,    0,    0,    0, 4102,    0,
+        0,    0, 4095,    0, 3320,    0,    0,    0,
+     3082,    0,    0, 6139,    0,    0, 2698,    0
+  },
+  { /* U+77xx */
+        0, 2768,    0,    0, 6142,    0,    0, 6141,
+     6140, 3759,    0, 1825, 2171,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0, 6148,    0,    0, 6145, 2851,
+     4060,    0,    0,    0, 6144, 6146, 6147,    0,
+        0, 6143,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0, 6149,
+     6150,    0, 3305,    0, 1853,    0,    0,    0,
+     3265,    0,    0,    0,    0,    0,10959, 6151,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 6152, 6155,    0,    0,    0,    0,
+        0, 2891,    0, 3514,    0, 6156, 3999,    0,
+     6153,    0,    0, 6154,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0, 6159,    0,    0,    0,    0, 6158, 6157,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0, 6161,    0,    0, 6160,    0,
+        0, 6162,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0, 6164,    0,
+     6163,    0,    0,    0,    0, 3899,    0,    0,
+        0,    0,    0,    0, 2686, 4268,    0,    0,
+     6165,    0,    0, 3501,    0,    0, 6166,    0,
+        0, 6167,    0, 6171, 6169, 6170,    0, 6168,
+        0,    0,    0,    0,    0,    0,    0, 6172,
+        0,    0,    0,    0,    0, 6173,    0,    0,
+        0,    0,    0,    0,    0,    0,    0, 6174,
+        0,    0, 6175, 4065, 6176,    0,    0,    0,
+        0,    0, 4122, 6177,    0, 3242,    0, 3646,
+        0, 2049,    0,    0,    0, 3223, 6178, 2000,
+        0,    0,    0, 2962,    0,    0,    0,    0,
+        0,    0,    0,    0, 6179,    0,    0,    0
+  },
+  { /* U+78xx */
+        0,    0, 2379,    0,    0,    0,    0,    0,
+        0,    0,    0,    0, 6180,    0,    0,    0,
+        0,    0, 6181,    0, 2168, 2403,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+     6183,10961,    0,    0,    0, 3438, 2404, 1926,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 3952,    0, 3615,    0,    0,    0,
+        0,    0, 3439,    0,    0,    0,    0, 2316,
+        0,    0,    0,    0,    0, 6185,    0,    0,
+        0,    0,    0,    0,    0,    0,10962,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0, 2769,    0,    0,
+        0,    0,    0,    0,10963,    0,    0,    0,
+        0,    0,    0, 4248, 2293,    0,    0, 2169,
+        0,    0, 3669,    0, 6187,    0,    0,    0,
+        0,    0,10964,    0, 6189,    0,    0,    0,
+        0, 2237,    0,    0,    0,    0, 6188, 3376,
+        0,    0,    0,    0, 6191, 1715, 6186,    0,
+        0, 3740,    0, 1520,    0, 2426,    0, 4374,
+        0,    0, 6190,    0,    0,    0,    0,    0,
+        0,    0,    0, 6192,    0,    0,    0, 3897,
+        0, 2971, 6194,    0,    0,    0,    0, 6195,
+        0,    0,    0,    0,    0, 6193,    0,    0,
+        0,    0, 1738,    0, 6201,    0, 6200,    0,
+        0, 2545,    0,    0,    0, 6202, 6197,    0,
+        0,    0, 6203, 6198,    0,    0,    0,    0,
+     3722, 6196,    0,    0, 6199,    0,    0,    0,
+        0,    0, 6206,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0, 6205,
+     4013,    0,    0,    0, 6204,    0,    0, 1485,
+        0,    0,    0,    0, 6208,    0,    0,    0,
+        0,    0,    0,    0,    0, 6207,    0,    0
+  },
+  { /* U+79xx */
+        0, 2770,    0,    0,    0,    0,    0, 6209,
+        0,    0,    0,    0,    0,    0, 3043,    0,
+        0, 6211, 6210,    0,    0,    0,    0,    0,
+        0, 6212,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0, 6182,    0,
+        0,    0, 6184, 6214, 6213,    0,    0,    0,
+    10965,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 2546,    0, 4303,    0, 2588,    0,
+     6215, 2091,    0,    0,    0,    0,    0, 1912,
+     1887, 2511,    0,    0,    0,    0,    0,    0,
+     4156,    0,    0, 6221,    0, 6220, 3044, 6217,
+        0,    0, 6219,    0,    0, 2675, 2852, 6218,
+     6216,    0, 3582,    0,    0, 2771,    0,    0,
+     3788,    0,    0,    0,    0, 2405,    0,    0,
+        0,    0,    0,    0,    0,    0,    0, 3472,
+        0,    0, 6222,    0,    0,    0,    0, 6223,
+     6245, 2030,    0,    0, 4353, 3029,    0,    0,
+        0,    0, 6224,    0,    0, 1648, 3377, 3855,
+        0,    0,    0,    0,10969,    0,    0,    0,
+        0,    0,    0,10971,    0, 6225,    0,    0,
+        0,    0,    0,    0,    0,    0, 1970, 6226,
+        0,    0, 6228,    0,    0,    0, 6229,    0,
+     3581,    0,    0, 6230,    0,    0,    0,    0,
+        0, 6231, 6232,    0,    0, 2031, 1649, 3515,
+     2640, 2512,    0,    0,    0,    0,    0,    0,
+        0, 6233,    0, 2641,    0,    0,    0,    0,
+        0, 1640, 3795,    0,    0, 6234,    0,    0,
+     3741,    0,    0,    0,    0,    0,    0, 3045,
+        0, 6237,    0, 6238, 3645,    0, 2853, 6235,
+        0, 3261,    0,    0, 6236,    0,    0,    0,
+     2772,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0, 1470,    0,    0,    0,    0
+  },
+  { /* U+7Axx */
+     1889,    0,    0,    0,    0,    0,    0,    0,
+     6239,    0,    0, 3378,    0, 6240, 2953,    0,
+        0,    0,    0,    0, 4055,    0,    0, 3763,
+     6241, 6242, 3249,    0, 4269,    0,    0, 6244,
+     6243,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0, 2617,    0,
+        0, 6246, 1490,    0,    0,    0,    0, 6249,
+        0,    0,    0, 6247, 1650, 2114, 6248, 2294,
+     2338,    0, 3924, 6250,    0,    0, 4000,    0,
+        0, 6252,    0,    0,    0, 2963, 1551, 1624,
+     1422,    0,    0,    0,    0,    0,    0, 6251,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0, 6253, 6254, 2813,    0,    0,    0,    0,
+        0, 6255,    0, 1739,    0,    0,    0,    0,
+     6257,    0,    0,    0, 2142,    0, 1950,    0,
+        0, 6258, 2059,    0,    0, 6259,    0, 3006,
+        0, 3523,    0, 2978, 2435,    0,    0,    0,
+     6260,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 3262, 3083,    0, 6262, 6264, 6261,
+     6263,    0,    0,    0,    0,    0,    0, 2070,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0, 6265, 2074,    0,    0,    0, 1951, 4186,
+     6267,    0,    0,    0,    0,    0, 6268,    0,
+        0,    0, 1518,    0,    0,    0,    0, 6271,
+        0,    0,    0, 1778, 6270, 6269,    0, 6273,
+     6266,    0, 6274, 4239,    0, 6275,    0, 6276,
+        0,10972, 4878, 6278,    0, 6277,    0,    0,
+        0, 6279, 6280,    0, 4251, 6281,    0, 7505,
+     2773, 6282, 6283, 2687,    0, 3502, 6284,10973,
+        0,    0, 3204,10975,    0, 6285,    0, 3224,
+     6286,    0,    0,    0,    0,    0, 1979,    0,
+     4543, 3257, 2557,    0,    0,    0,    0, 1826
+  },
+  { /* U+7Bxx */
+        0,    0, 6287,    0, 6300,    0, 6290,    0,
+     1952,    0, 6289, 6302,    0,    0,    0, 6288,
+        0, 2774,    0,    0,    0,    0,    0,    0,
+     6292, 6293,    0, 3395,    0,    0, 6294,    0,
+     1754,    0,    0,    0,    0, 2878, 3828,    0,
+     6296,    0,    0,    0, 3174,    0,    0,    0,
+        0,    0,    0, 6291,    0, 6295, 6297,    0,
+        0, 2441,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0, 6304, 3774,    0,
+     3672, 3473,    0, 2032, 6303, 6301,    0, 3687,
+     6298, 3258, 3475,    0, 3474,    0, 2436,    0,
+        0,    0,    0,    0,    0, 6322,    0,    0,
+        0,    0,    0,    0,    0, 6306,    0, 6308,
+        0,    0,    0,    0, 6311,    0, 6312,    0,
+     6309, 6310,    0,    0, 6307, 6305,    0,    0,
+        0,    0, 6299,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0, 3901, 1651,
+        0,    0,    0, 6319,    0, 6316,    0, 6321,
+        0,    0, 6320,    0, 3655, 4049,    0, 2471,
+     6314, 6323, 6318,    0, 6317, 6313,10976, 6315,
+        0, 1827,    0,    0,    0,    0,    0,    0,
+        0,    0, 3225,    0,    0, 3007,    0,    0,
+        0, 3668,    0,    0, 6328,    0,    0,    0,
+     3670,    0,    0,    0,    0,    0,    0,    0,
+     2979, 6325,    0,    0, 3713,    0, 6329, 3905,
+        0, 3255,    0, 6324, 6326,    0,    0, 6327,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0, 6330,    0,    0,
+     2574,    0,    0,    0, 3516, 6335, 6334,    0,
+        0, 6331,    0,    0,    0, 4346,    0,    0,
+        0,    0,    0, 6340,    0,    0, 6344, 6341,
+        0,    0,    0,    0,    0,    0,    0,    0
+  },
+  { /* U+7Cxx */
+     6337,    0,    0,    0,    0,    0,    0, 6338,
+        0,    0,    0,    0,    0, 6343,    0,    0,
+        0, 6332, 4659, 6339, 6333,    0,    0, 6342,
+        0,    0,    0,    0,    0,    0,    0, 6348,
+        0, 1828,    0, 6345,    0,    0,    0, 6346,
+        0,    0, 6347, 6350,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0, 6349,
+     3752,    0,    0,    0,    0, 6351, 4322, 3931,
+     6356,    0,    0, 6353,    0,    0,    0,    0,
+        0,    0,    0,    0, 6352, 2964,    0, 6355,
+     6357,    0,    0,    0, 6354,    0, 6361,    0,
+     6358,    0,    0,    0,    0,    0,    0, 6359,
+     6336,    0,    0,    0, 6360, 6362,    0,    0,
+        0,    0,    0,    0, 6363,    0,    0,    0,
+        0,    0,    0, 3892,    0, 6364,    0,    0,
+        0,    0,    0,    0,    0,    0, 4108,    0,
+        0, 2020, 2077, 6365,    0,    0,    0,    0,
+        0, 3874,    0, 2892,    0, 4058,    0,    0,
+     6366,    0, 4249,    0,    0, 3656,    0, 3046,
+     3592,    0,    0, 2677,    0,    0,    0, 1442,
+        0, 6371, 6369,    0, 6367, 1787,    0, 2775,
+     6372,    0,    0, 6370,    0, 6368, 6376,    0,
+        0, 6375, 6374, 6373,    0,    0,    0,    0,
+        0, 6377,    0,    0,    0, 6378, 2940,    0,
+     6379,    0, 6381,    0,    0, 6380,    0,    0,
+        0,    0, 2212,    0,    0,    0, 3032,    0,
+        0,    0, 6383,    0,    0,    0, 3476,    0,
+     6382,    0,    0,    0, 6384,    0, 3875, 3084,
+     2295,    0, 6385,    0,    0,    0,    0, 4270,
+        0,    0,    0,    0,    0,    0,    0, 6387,
+        0,    0, 6388,    0, 6389,    0, 6390,    0,
+     2513,    0, 6391, 2115,    0,    0, 1954,    0
+  },
+  { /* U+7Dxx */
+     1890,    0, 6393,    0, 4125, 2296, 6392,    0,
+        0,    0, 6396, 4112,    0, 3600,    0,    0,
+     3779,    0,    0,    0, 2699, 6395,    0, 2589,
+     2297, 2514, 1953, 3876, 6394,    0,    0,    0,
+     3047, 3982, 2437,    0,    0,    0,    0,    0,
+        0,    0,    0, 2515, 3351,    0, 6399, 4293,
+     2407,    0, 6400, 2854,    0, 6402,    0,    0,
+        0, 2776, 2366,    0,    0,    0,    0, 6401,
+        0,    0, 2642, 2192, 3048, 6397, 6403,    0,
+    10978,    0,    0, 6398, 2116,    0, 6406, 6410,
+     2143,    0,    0,    0,    0,    0, 6405,    0,
+        0,    0,    0, 6414,10979,    0, 2298,    0,
+        0, 4213, 1438, 6411,    0,    0, 1955,    0,
+     6408,    0,    0,    0,    0,    0, 6409,    0,
+        0, 3477, 6407, 6404,    0, 1700, 2982,    0,
+        0, 2170,    0,    0,    0, 6416,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0, 6413,    0,    0,    0,    0,    0, 6415,
+        0,    0,    0, 6412,    0,    0,    0,    0,
+        0, 2117, 3121, 6417, 3086,    0,    0, 6430,
+    10981,    0, 6426, 6420,    0,    0,    0,    0,
+        0,    0,    0, 6424, 2628, 1471, 6419, 6427,
+     6431, 2299, 4096,    0, 3344, 6421,    0,10980,
+     6429,    0, 6418, 3226,    0, 6423, 1439, 4084,
+        0,    0,    0,    0,    0,    0,    0, 6422,
+        0,    0, 2033, 3742,    0,    0,    0, 3085,
+        0, 4278, 2711,    0,    0, 6470,10982,    0,
+     6432,    0, 3008,    0, 6428, 6433, 6435,    0,
+     3379, 6438,    0,    0, 6434,    0,    0,    0,
+     3906, 1829,    0,    0, 4085,    0,    0, 1472,
+        0,    0, 6437,    0, 4323,    0,    0,    0,
+        0,    0,    0, 6436,    0,    0,    0,    0
+  },
+  { /* U+7Exx */
+        0, 1583,    0,    0, 3554, 6439,    0,    0,
+        0, 6446, 6440, 6447,    0,    0,    0,    0,
+        0,    0, 6443,    0,    0,    0,    0,    0,
+        0,    0,    0, 3663,    0,    0, 2580, 6445,
+        0, 6442, 6448, 6441,    0,    0, 2668,    0,
+        0,    0,    0, 3953,    0,    0, 2676,    0,
+        0, 6444, 6456,    0,    0, 6452,    0, 6455,
+        0, 6453, 6457, 6451,    0, 6425, 2965,    0,
+        0, 3709,    0, 6454,    0,    0, 6449,    0,
+        0,    0, 3009, 2118,    0, 2643,    0,    0,
+        0,    0,10983,    0, 2825, 3030, 6460,    0,
+        0, 6462, 6463,    0,    0, 6459, 6461,    0,
+        0,    0,    0,    0,    0,    0, 6450, 6458,
+        0, 6466, 6465,    0,    0, 4038,    0,    0,
+     2079,    0,    0,    0,    0,    0,    0,    0,
+        0, 6464,    0, 6468, 6467, 6471,    0, 6473,
+        0,    0, 2472, 6469,    0,    0,    0,    0,
+     6474, 6475,10745,    0, 6476,    0, 6482, 3411,
+     6478,    0, 6477, 6479, 6480,    0, 6481,    0,
+        0,    0,    0, 6483, 6484,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0
+  },
+  { /* U+7Fxx */
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0, 1830,    0,
+     6485,    0, 6486,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0, 6487,    0,10984,
+        0,    0,    0,    0, 6488, 6489, 6490,    0,
+     6491, 6492,    0,    0, 6494, 6493,    0,    0,
+     6495,    0,    0,    0,    0,    0,    0, 6496,
+     6497,    0,    0,    0,    0,    0,    0, 6500,
+     6498, 6499, 2415, 2119,    0,    0, 3250,    0,
+     3685,    0, 2712,    0,    0, 3617,    0, 3743,
+     6501, 5247,    0,    0,    0,    0,    0,    0,
+        0,    0, 6502, 6504,    0, 4205, 6503, 6506,
+     6505,    0, 4187,    0, 6507,    0, 3760,    0,
+        0,    0,    0,    0, 6508,    0,    0,    0,
+        0,    0, 6511,    0,    0, 6510, 6509,    0,
+        0,10985,    0, 6512, 2086,    0,    0,    0,
+     3010, 1913,    0,    0,    0,    0, 6516, 6513,
+        0,    0, 6514,    0,    0,    0, 6517,    0,
+     6518, 6515,    0,    0,    0, 1513,    0,    0,
+        0, 1605,    0,    0,    0, 6520, 6521,    0,
+        0,    0, 6522,    0, 4202,    0,    0,    0,
+        0,    0, 2644,    0, 6524, 6523,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+     2893, 6525,    0,    0,    0,    0, 6526,    0,
+        0, 6527,    0, 1855,    0,    0,    0,    0,
+     1831,    0,    0, 6528,    0,    0,    0,    0,
+        0, 6529,    0, 4009, 4203,    0,    0,    0
+  },
+  { /* U+80xx */
+     4188, 4347,    0, 2301, 6532, 2590, 6531,    0,
+        0,    0,    0, 6533, 2547,    0,    0,    0,
+     3151,    0, 6534,    0,    0, 2300,    0, 4097,
+     6535, 6536,    0,    0, 6537,    0,    0,    0,
+        0, 6538,    0,    0,    0,    0,    0,    0,
+     6539,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0, 2548,    0,    0, 4119,    0,
+        0,    0,    0, 6541,    0, 3227,    0, 6540,
+        0,    0,    0,    0,    0,    0, 6543,    0,
+        0,    0, 6542,    0,    0,    0,    0,    0,
+        0,    0, 6544,    0,    0,    0, 2941,    0,
+     6545,    0, 6546,    0,    0,    0, 3879, 6547,
+        0, 3087, 6548,    0,    0,    0,    0,    0,
+     6549,    0,    0,    0,    0,    0,    0, 4324,
+     6552,    0, 6551, 6550, 3306,    0, 6553, 2826,
+        0, 6554,    0,    0,    0, 6555, 4348, 6556,
+        0,    0,    0,    0, 6557, 6559, 6558, 3671,
+        0, 3567,    0, 4354, 3675,    0,    0,    0,
+        0,    0,    0, 6561,    0,    0, 2777,    0,
+     3770,    0, 6562, 6560,    0, 1832,    0,    0,
+        0, 2214, 2516,    0,    0, 3744,    0,    0,
+        0, 2172, 3983,    0, 6565, 6563,    0, 2302,
+        0, 2303, 1483,    0, 2422,    0,    0,    0,
+        0,    0, 3629,    0,    0,    0,    0,    0,
+        0,    0,    0, 1473, 6570,    0, 3228,    0,
+        0,    0,    0,    0, 3628,    0, 3161,    0,
+        0,    0,    0,    0,    0,    0, 6572,    0,
+        0, 6568, 6571, 6566,    0, 6569, 3954,    0,
+        0, 2215,    0,    0, 1503, 6567,    0,    0,
+        0,    0,    0,    0,    0,    0,    0, 6574,
+        0, 6575,    0,    0, 3503,    0,    0,    0,
+     2001,    0,    0,    0, 6586, 3601,    0,    0
+  },
+  { /* U+81xx */
+        0,    0, 2517,    0,    0, 2002, 2954, 4362,
+     4056, 6573, 2966,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 1931, 6576,    0,    0,    0,    0,
+        0,    0,    0, 6578,    0,    0,    0,    0,
+        0, 6577,    0,    0,    0,    0,    0, 6579,
+        0, 3202,    0, 3602,    0,    0,    0,    0,
+        0, 3307,    0,    0,    0,    0, 6583,    0,
+        0,    0,    0,    0,    0,    0, 6582,    0,
+        0,    0,    0, 6580,    0,    0, 2873,    0,
+     3829, 6585,    0, 6584, 2304, 4375,    0,    0,
+        0,    0,    0,    0,    0,    0,    0, 6601,
+        0,    0,    0,    0,    0, 6589, 6590,    0,
+        0,    0,    0, 2618,    0,    0, 6588,    0,
+     2344, 6587,    0,    0, 6591,    0,    0,    0,
+     3308, 3856, 3011,    0,    0,    0,    0, 3162,
+     6595,    0, 6596, 6592,    0,    0,    0,    0,
+     6593,    0, 6594,    0,    0,    0,    0, 2305,
+        0,    0,    0, 6602,    0, 6598,    0,    0,
+        0,    0, 3830,    0, 4024, 3768,    0,    0,
+     6597,    0,    0, 6600, 6599,    0,    0,    0,
+     3984, 6603,    0,    0,    0,    0,    0,    0,
+     6604,    0,    0, 3031,    0, 6605,    0,    0,
+     6607,    0, 6611,    0,    0, 6608, 6606, 3603,
+     6609,    0, 6610,    0,    0,    0, 1616,    0,
+     6617, 6612,    0,    0,    0, 6613,    0,    0,
+        0, 6614,    0, 3103,    0,    0,    0,    0,
+     6616, 6615, 6618,    0,    0,    0,    0, 6619,
+     6620,    0,    0, 2855,    0, 1671,    0, 6621,
+     4285,    0, 2549,    0,    0, 2645,    0,    0,
+        0,    0,    0, 2518, 3251,    0,    0,    0,
+        0,    0, 6622, 6623, 1521,    0, 6624,    0
+  },
+  { /* U+82xx */
+        0, 6625, 6626,    0,    0, 6627,    0, 6628,
+     2003, 5368, 6629,    0, 2983, 6630, 2581,    0,
+     6631,    0, 4434,    0,    0,    0, 6632, 3916,
+     1846,    0,    0, 3012, 2688,    0, 3841, 2646,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0, 6633, 2306, 6634, 3710,    0, 6648,    0,
+        0,    0,    0, 6636,    0, 3143, 3657, 2193,
+     6635, 3013,    0,    0,    0,    0,    0,    0,
+     6637,    0,    0,    0,    0,    0,    0, 3380,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+     6639, 6638, 6641,    0,    0, 6640,    0, 6642,
+        0,    0, 6644,    0, 6643,    0, 1833,    0,
+     6645,    0, 6646, 6647,    0,    0, 2367, 4271,
+        0, 6649, 2827,    0,    0,    0, 1584, 6650,
+     6651,    0,    0,    0,    0,    0, 6652,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0, 1492,    0, 6653,    0,    0,
+        0,    0, 6654,    0,    0,    0,    0,    0,
+        0, 3831,    0,    0,    0, 2577,    0, 6656,
+        0,    0,    0,    0,    0, 1701, 1428,    0,
+        0,    0,    0, 6655, 6658, 3618,    0, 2856,
+        0, 1652,    0, 3955,    0,    0,    0,    0,
+     2129, 2034,    0, 6657,    0, 1672,    0,    0,
+        0,    0,    0,    0,    0, 1789,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0, 1585, 6662, 4304, 3163,    0,    0, 3796,
+        0, 6674,    0, 1653, 6672,    0, 6670, 6661,
+        0, 6659,    0, 6660,    0, 2605, 2050, 3283,
+        0,    0,    0, 3527,    0,    0,    0,    0,
+        0, 1553,    0, 6664, 6663,    0,    0,    0,
+        0, 6669, 6665, 6668,    0,    0,    0,    0
+  },
+  { /* U+83xx */
+        0,10987, 4090, 6667, 1654, 1785, 6671,    0,
+        0, 6673,    0,    0,    0,    0, 2120,    0,
+        0,    0,    0,    0,    0,    0, 6677, 6686,
+     6687,    0,    0,    0, 1421,    0,    0,    0,
+        0,    0,    0, 6694,    0,    0,    0,    0,
+     1491,    0,    0, 6685,    0,    0,    0, 6684,
+        0, 6679, 6678,    0, 6676, 6675, 3263,    0,
+     3193, 6681,    0,    0,    0,    0,    0,    0,
+     6680,    0,    0,    0,    0, 6683,    0,    0,
+        0, 3088, 2121,    0,    0,    0,    0, 1537,
+     6682,    0, 2307,    0,    0,    0,    0,    0,
+     3089,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,10988,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0, 6700,    0, 6701,    0, 1655,
+        0,    0,    0, 1612, 6698,    0,    0,10989,
+        0,    0,    0,    0,    0, 6688,    0, 6696,
+        0, 6703, 6697,    0,    0,    0, 6695,    0,
+        0,    0,    0, 6666,    0,    0, 6693,    0,
+        0,    0, 6689,    0,    0,    0, 1834, 6691,
+     6702,    0, 6692,    0,    0,    0,    0,    0,
+     6704,    0, 6690, 3664,    0,    0,    0,    0,
+        0, 4209,    0,    0,    0, 6699,    0,    0,
+        0,    0,    0,    0,    0, 6721,    0,    0,
+        0, 6713,    0,    0,    0, 2911,    0,10990,
+        0,    0, 1918,    0, 2035,    0, 6708,    0,
+        0,    0,    0, 1657,    0,    0, 2778,    0,
+     6711,    0,    0,    0, 2408,    0,    0, 3433,
+     6716,    0,    0,    0,    0,    0,    0,    0,
+        0, 3932,    0, 6707,    0,    0,    0, 1656,
+     2216, 3769, 6717,    0, 6705,    0,10991, 6714,
+        0,    0,    0, 6724,    0, 6709,    0,    0
+  },
+  { /* U+84xx */
+        0,    0,    0, 6710, 3504,    0,    0, 6715,
+        0,    0,    0, 6712, 3956, 6718, 1474,    0,
+        0,    0,    0, 6706,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+     6720,    0, 6719,    0,    0,    0,    0,    0,
+        0, 3647, 6726,    0, 6737,    0,    0,    0,
+        0, 1786,    0,    0,    0, 6740,    0,    0,
+     6722,    0,    0,    0, 6727, 4214,    0,    0,
+        0,    0,    0,    0,    0,    0, 6736,    0,
+    10992, 4189,    0,    0,    0,    0, 4240,    0,
+        0,    0,    0,    0,    0,    0,    0, 3284,
+        0,    0,    0, 1767,    0,    0,    0,    0,
+        0, 3842, 6742, 3479,    0,    0, 1427,    0,
+        0, 6735,    0, 6731, 3090, 6725, 6733, 6738,
+        0, 3584,    0,    0,    0, 1420,    0, 6730,
+        0, 6739, 3848,    0,    0,    0,    0,    0,
+        0,    0, 6734,    0, 6729,    0,    0,    0,
+        0,    0,    0, 2779,    0,    0,    0,    0,
+     2647,    0,    0,    0, 2550,    0,    0,    0,
+        0, 4098,    0,    0, 3799,    0,    0, 6745,
+        0, 6754,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0, 6732,    0,    0,
+        0,    0, 1779,    0,10993,    0,    0,    0,
+     2814, 6743,    0, 6748, 3091,    0,    0, 6744,
+        0, 6751,    0,    0, 3259,    0, 6752,    0,
+        0, 4190, 6741, 1716,    0, 6747,    0,    0,
+     6750, 4054,    0,    0,    0,    0, 6753,    0,
+        0, 6746, 6749,    0,10749,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0, 3957,    0, 4325,    0,
+        0,    0,    0,    0, 6757,    0,    0,    0,
+        0,    0,    0,    0, 6764,    0,    0, 6756
+  },
+  { /* U+85xx */
+     2573,    0,    0,    0,    0,    0, 6723,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0, 3900,    0, 4044, 6763, 6762,    0, 6758,
+     6759,    0, 1526,    0,    0,    0,    0, 6761,
+        0, 6755,    0,    0,    0,    0, 3343,    0,
+        0,    0,    0,    0, 6760, 1504,    0,    0,
+        0,    0,    0,    0,    0, 3104,    0,    0,
+        0,    0,    0,    0,    0, 3889,    0,    0,
+     6765, 6769,    0, 3723,    0,    0,    0,    0,
+     6768, 2780, 2579, 6771,    0,    0, 2004,    0,
+        0,    0,    0,10994,    0, 6772,    0, 3849,
+     6767,10995, 6728,    0,    0,    0,    0,    0,
+        0,    0,    0, 6766,    0,    0,    0,    0,
+     4371, 3480, 3843,10996,    0, 6779,    0,    0,
+        0,    0,    0,    0,    0,    0,    0, 6785,
+        0,    0,    0,    0,    0,    0, 6786,    0,
+     6773,    0,    0,    0, 3658,    0,    0, 6783,
+     6775,    0, 6777,    0,    0,    0,    0,    0,
+     6787, 6776,    0,    0, 6780,    0,    0, 1586,
+        0, 3547,    0, 6781, 6784,    0,    0,    0,
+        0,    0,    0,    0, 6774,    0, 3014,    0,
+     6778, 2451, 2857, 2084, 4126,    0, 4131, 2714,
+    10998,    0,    0,    0,    0,    0,    0,    0,
+        0, 6791, 6789,    0,    0,    0,    0,    0,
+        0, 4370,    0,    0,    0,    0,    0,    0,
+        0, 6788,    0,    0,    0, 4221,    0, 6790,
+     6792,    0,    0,    0,    0, 6793,    0,    0,
+        0,    0,    0,    0, 6796, 6794,    0,    0,
+        0,    0,    0,    0, 3481, 6795,    0,    0,
+        0, 3711, 6782,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0, 2715,
+        0, 6797, 6802, 3092,    0,    0, 6801,    0
+  },
+  { /* U+86xx */
+        0,    0, 6770,    0,    0,    0, 6803, 3049,
+        0,    0, 6798, 6800,    0,    0,    0,    0,
+        0,    0,    0, 6799,    0,    0, 5657, 5642,
+        0,    0, 6805,    0,    0,    0,    0,    0,
+        0,    0, 6804,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0, 4222,    0, 6138,
+     6806,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0, 6807,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0, 6808, 2217,    0,
+     1932,    0,    0,    0, 6810, 4573,    0,    0,
+        0,    0, 1965,    0, 4256,    0, 2057, 6811,
+        0,    0,    0,    0,    0,    0,    0, 6812,
+        0,    0,    0, 3274,    0,    0,    0,    0,
+        0, 6813,    0,    0,    0,    0,    0,    0,
+        0, 3568,    0, 1436,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 1665, 6818, 6819,    0,    0,    0,
+        0,    0,    0, 6814,    0, 2473,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0, 6815, 3606,    0,    0,    0,
+        0, 6816, 6817, 6827,    0,    0,    0, 6821,
+     6824,    0,    0,    0,    0,    0, 6820,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0, 6822,    0, 6823, 2594,
+        0, 6825,    0, 3229,    0, 2122, 1726,    0,
+        0,    0,    0,    0, 6828,    0,    0,    0,
+        0, 1723,    0, 6833,    0,    0, 6829, 6832,
+        0,    0,    0,    0, 3692,    0,    0,    0,
+        0, 6830,    0,    0, 6831, 3800, 3724, 6834,
+        0,    0,    0,    0,    0,    0,    0,    0,
+     3195, 6844,    0, 6840,    0,    0, 1673,    0
+  },
+  { /* U+87xx */
+     6838,    0, 3958, 6839,    0,    0, 6836,    0,
+     6837, 6842, 6845,    0,    0, 6843,    0,    0,
+        0, 6841, 6835,    0,    0,    0,    0,    0,
+     3252,    0, 6852,    0, 4052,    0,    0,    0,
+        0,    0,    0,    0,    0, 6850,    0,    0,
+        0, 6851,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0, 6846,    0,    0, 6848,
+        0,    0,    0, 6849,    0,    0,    0, 6847,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0, 2984,    0, 4349, 6856,    0, 6857,    0,
+        0,    0,    0, 6863,    0, 2830,    0, 6859,
+        0, 6862,    0,    0,    0,    0,    0, 6854,
+     6853,    0,    0, 6864,    0,    0, 1658,    0,
+     6860,    0, 6865,    0,    0,    0, 6861,    0,
+        0,    0,    0,    0, 6858,    0, 3309,    0,
+     6855,    0,    0,    0,    0,    0,    0, 3644,
+        0,    0, 6869,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0, 4163,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0, 6868,
+        0,    0, 6867,    0,    0,    0,    0,    0,
+        0,    0,    0, 6876,    0,    0,    0, 6870,
+        0,    0,    0, 6878,    0,    0,    0,    0,
+        0,    0, 4206, 6881,    0, 6872,    0,    0,
+     6873,    0,    0,    0, 6877,    0, 6880, 6879,
+        0,    0,    0, 6871,    0,    0,    0,    0,
+     6874,    0, 6891,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+     6884,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0, 6882,
+        0,    0, 6883,    0,    0,    0, 6888, 6889,
+        0, 1702,    0, 1914,    0,    0, 6887,    0
+  },
+  { /* U+88xx */
+        0,    0,    0,    0,    0, 6866,    0,11001,
+        0,    0,    0,    0,    0, 6886, 6890, 6885,
+        0, 6892,    0,    0,    0, 6894, 6893,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0, 6896, 6895, 6826,    0,    0,    0, 6900,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0, 6897,    0,    0,    0,    0, 6898,    0,
+        0, 6899,    0, 6901,    0,    0,    0,    0,
+     2144,    0, 6903,    0, 6902,    0, 2648,    0,
+        0,    0,    0,    0, 2308, 5741,    0,    0,
+        0,    0, 6904, 2681,    0,    0,    0, 1717,
+        0, 6905,    0, 1554,    0, 2781, 6906,    0,
+        0, 2309, 6907, 1475,    0,    0,    0,    0,
+     3789,    0,    0, 6908,    0,    0,    0,    0,
+     2894,    0, 6915,    0,    0, 6912,    0, 3275,
+        0,    0,    0,    0,    0, 6913, 6910, 2036,
+        0, 6909, 6916,    0,    0,    0,    0,    0,
+     2090,    0,    0, 3164,    0, 6922,    0,    0,
+        0,    0, 6918,    0,    0,    0, 3123, 6917,
+        0, 6920,    0,    0,    0,    0, 6911,    0,
+        0,    0, 6921,    0, 6923,    0,    0,    0,
+        0,    0,    0, 3745,    0,    0, 6919,    0,
+     6924, 6926,    0,    0, 2213, 6914,    0, 1443,
+        0,    0,    0,    0,    0,    0,    0, 6925,
+        0, 2409, 4316, 6927, 6928, 3093,    0,    0,
+        0,    0,    0,    0,    0,    0,    0, 4232,
+        0,    0,    0,    0, 6929, 4157,    0,    0,
+     6930, 6931,    0,    0, 3922, 6932,    0, 2382,
+        0, 4233,    0,    0,    0,    0,    0,    0,
+     6937,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 6938, 2782, 6936,11002,    0,    0,
+     4207, 6933,    0,    0, 6935, 2943, 2914,    0
+  },
+  { /* U+89xx */
+        0,    0, 6934,    0, 6939,    0,    0, 3857,
+        0,    0, 6941,    0, 6940,    0,    0,    0,
+     1768,    0, 3959, 6942,    0,    0,    0,    0,
+        0,    0,    0,    0,10746, 6954, 6944,    0,
+        0,    0,    0,    0,    0, 6945,    0,    0,
+        0,    0, 6946, 6947,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0, 6951,    0,
+     6952,    0,    0, 6950,    0,    0,    0,    0,
+        0, 6948,    0, 6943, 6949,    0,    0,    0,
+        0,    0,    0,    0, 6953, 7449,    0,    0,
+        0,    0,    0,    0,    0,    0, 1606,    0,
+        0,    0,    0,    0,    0,    0, 6956, 2037,
+     6955,    0,    0,    0, 6958,    0, 6957,    0,
+        0,    0, 6960,    0,    0, 6959,    0, 6961,
+        0,    0, 2649,    0, 6962,    0,    0, 6963,
+        0,    0,    0,    0,    0,    0, 6964, 2944,
+        0, 4191,    0, 6965,    0,    0, 3858, 3610,
+     6966,    0, 6967, 2173,    0,    0,    0, 1892,
+        0,    0,    0, 6968,    0,    0, 2519, 3605,
+     6969,    0, 1740,    0,    0,    0,    0,    0,
+        0, 6970,    0,    0,    0,    0, 6972, 4223,
+        0, 6971, 2858,    0, 6973,    0,    0, 6974,
+        0,    0, 6975, 1835,    0,    0,    0,    0,
+        0,    0, 6976,    0,    0, 6977,    0, 6978,
+     6979,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 1741,    0,    0,    0,    0,    0,
+        0,    0, 6980,    0, 6981, 6982,    0,    0,
+        0,    0,    0, 1680,    0,    0, 2828, 6983,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0, 6984,    0,    0,    0,
+     6985,    0,    0,    0,    0,    0,    0,    0
+  },
+  { /* U+8Axx */
+     2194,    0, 3381, 6986,    0,    0,    0,    0,
+     2123,    0, 2874,    0, 6989,    0, 3482,    0,
+     6988,    0,11003, 2085,    0,    0, 6987, 3189,
+     1893,    0,    0, 6990,    0, 6991,    0, 2783,
+        0,    0,    0, 2145,    0, 6992,    0,    0,
+        0,    0, 3960,    0,    0, 2977,    0,    0,
+        0, 1966,    0, 4127, 3050,    0, 6993,11004,
+        0,    0, 2859, 3276, 2784,    0,    0,    0,
+        0, 6994,    0,    0,    0,    0, 6997,    0,
+     6998,    0,    0,    0,    0,    0,    0,    0,
+     2380, 3136, 6996,    0, 2785, 3790,    0,    0,
+        0,    0,    0, 6995,    0,    0, 2520,    0,
+     1555,    0, 7002, 2124,    0,    0, 2522,    0,
+        0, 2521,    0, 4369, 7001, 7000, 3015,    0,
+     1925, 4359, 1718, 2786,    0,    0,    0,    0,
+        0,11005,    0,    0, 6999,    0,    0,    0,
+        0,    0, 7004,    0, 7005, 7003,    0, 2218,
+        0, 4168,    0,    0, 2523, 3579,    0,    0,
+        0, 7008,    0, 2946,    0, 3230,    0,    0,
+     4158,    0, 7011,    0,    0,    0, 2238,    0,
+     2945, 7007,    0, 7012, 2239, 7009, 7010,11006,
+     7006,    0,    0,    0, 2980, 3519,    0,    0,
+     3211,    0, 1659,    0,    0,    0,    0,    0,
+        0, 3746,    0,    0, 1915,    0,11007, 3310,
+        0,    0, 7015,    0, 7013,    0,    0, 3240,
+        0,    0,    0, 2947, 1836, 7014,    0, 2879,
+        0,    0, 4272,    0,    0,    0, 4356,    0,
+        0,    0, 7016, 7027, 3311,    0, 7026,11008,
+     7023, 7031, 7024,    0, 7020,    0, 3382, 7019,
+        0,    0,    0, 7017,    0, 4137, 2524,    0,
+        0, 7021,    0, 7018,    0,    0,11010, 7025,
+     2716,    0, 2195,    0,    0,    0, 3192,    0
+  },
+  { /* U+8Bxx */
+     3985, 1562, 1476,    0, 3483,    0,    0, 7029,
+        0,    0,    0,    0, 7028,    0, 3548,    0,
+     7033,    0,    0,    0, 7022,    0, 7032, 7034,
+        0, 2174, 7030, 2310,    0, 2591,    0,    0,
+     7035, 4192,    0,    0,    0,    0, 7038,    0,
+     7041,    0,    0, 7039, 3781,    0,    0,    0,
+        0,    0,    0, 7036,    0,    0,    0,    0,
+        0, 2038,    0,    0,    0,    0, 7040,    0,
+        0, 7042,    0,    0,    0,    0,    0,    0,
+        0, 7046,    0,    0, 7043,    0, 7045, 7044,
+        0,    0,    0,11011,    0,    0, 7047,    0,
+     2555,    0, 7049, 7048, 3832,    0,    0, 7051,
+        0,    0,    0,    0,    0,    0, 2125,    0,
+        0,    0,    0, 7050, 7052,    0,    0, 7053,
+     1916, 6519, 2815,    0, 7054,    0,    0, 2240,
+        0,    0,    0,    0,    0, 7055,    0,11012,
+     7056,    0,    0, 2474,    0,    0,    0,    0,
+        0,    0, 5404,    0, 7057,    0, 7058,    0,
+     2650,    0, 7059, 7060,    0,    0, 7061,    0,
+        0, 7062, 7063,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0
+  },
+  { /* U+8Cxx */
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0, 3207,
+        0,    0, 7064,    0,    0,    0,    0, 7066,
+        0, 7065,    0,    0,    0,    0, 3484,    0,
+     7067,    0, 3961,    0, 7068,    0, 7069,    0,
+     7070,    0,    0,    0,    0, 7071,    0,    0,
+        0,    0, 3536,    0,    0,    0,    0,    0,
+        0, 2787, 7072,    0,    0,    0,    0,    0,
+        0,    0, 2331, 4432, 7073,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+     7074, 3791, 7075,    0, 7083,    0,    0,    0,
+        0,    0, 7076,    0,    0, 7078,    0,    0,
+        0, 7077, 7079,    0, 3986, 7080, 7081,    0,
+        0,    0,    0,    0, 7082,    0,    0,    0,
+     7084,    0,    0,    0,    0, 1705, 3361,    0,
+     3833, 2416, 2311,    0,    0,    0,    0, 3807,
+     1661, 3712, 7087, 1837, 2967, 7086, 7091, 3285,
+     4109,    0, 7089, 7090, 1894,    0, 7092, 3639,
+     3165,    0,    0, 3747, 3413, 7088,    0, 3987,
+     1674, 7094, 4332, 3324, 4361,    0,    0, 2525,
+     7093,    0, 3119,    0,    0, 7110, 3016,    0,
+        0, 3566,    0, 3808,    0,    0,    0,    0,
+        0,    0, 7097, 2475, 2526,    0, 2788,    0,
+     3641,    0, 2175, 7096, 7095,    0, 3834,    0,
+        0,    0, 2571,    0,    0, 3434,    0,    0,
+    11013,    0,    0,    0,11014,    0,    0,    0,
+        0,    0, 7099, 7100, 2312, 7098,    0,    0
+  },
+  { /* U+8Dxx */
+        0,    0,    0,    0, 7101, 7102,    0, 7104,
+     3105,    0, 7103, 1856,    0, 7106,    0, 7105,
+     7107,    0,11015, 7109, 7111,    0, 7112,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0, 2968,    0, 2585, 7113,
+        0,    0,    0, 1742,    0, 7114,    0,    0,
+     3094, 7115,    0, 7116, 3835,    0,11016, 1895,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0, 7117,    0,    0,    0, 3312,    0,    0,
+        0,    0, 1563,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0, 7118,    0,    0,    0,    0,    0,    0,
+        0,    0,    0, 2619,    0,    0,    0,    0,
+     2906,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0, 3115,    0,    0,    0,    0,
+        0,    0, 7121,    0,    0,    0, 7120,    0,
+        0,    0, 7119,    0,    0,    0,    0,    0,
+        0,    0,    0, 7127, 7125,    0,    0, 7122,
+        0,    0,    0,    0,    0,    0, 7124,    0,
+        0,    0, 7123, 7126,    0, 1967,    0, 7130,
+        0, 2969,    0, 7131,    0,    0,    0,    0,
+     2219,    0, 7128, 7129,    0,    0,    0, 4333,
+        0,    0,    0, 3313,    0, 3017,    0,    0,
+        0,    0,    0,    0, 7132,    0,    0, 7135
+  },
+  { /* U+8Exx */
+        0,    0,    0,    0,    0,    0,    0,    0,
+     7133, 7134, 4193,    0,    0,    0,    0, 3485,
+     7138,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0, 7136, 7137, 7139,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 7153,    0,    0,    0,    0,    0,
+     7142,    0,    0,    0, 7143, 7141,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 7140,    0, 3383,    0,    0, 7145,
+     7149, 7146, 7144,    0, 7147,    0,    0,    0,
+     7148,    0,    0,    0,    0, 7155,    0,    0,
+        0, 7150,    0,    0,    0,    0,    0, 2970,
+     7152,    0,    0, 7154, 7151,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 7157,    0, 2651,    0, 7156,    0,
+        0,    0,    0,    0, 7158,    0,    0,    0,
+        0, 7159,    0,    0, 7162, 7161,    0, 7160,
+        0,    0, 7164, 7163,    0, 4128,    0,    0,
+        0, 7166,    0, 7165, 7167,    0,    0,    0,
+        0, 7168,    0,    0,    0,    0,    0,    0,
+        0, 7170,    0,    0,    0,    0,    0,    0,
+        0,    0, 7169, 2860, 7171,    0,    0, 2051,
+     7172, 7174,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0, 7175,    0,
+        0,    0,    0,    0,    0, 7176, 7173,    0,
+     7177,    0, 2592, 7178, 1896, 2087,    0,11018,
+        0,    0, 2176,    0,    0,    0,    0,    0,
+        0,    0,    0, 7179,    0,    0,    0, 3558,
+        0,    0, 3414, 7180,    0,    0,    0,    0,
+        0,    0,    0, 7183,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+     2558,    0,    0, 7182, 7181, 2126, 7184,    0
+  },
+  { /* U+8Fxx */
+        0,    0,    0, 1743,    0, 7186,    0,    0,
+        0, 2410, 7185,    0, 7194,    0,    0,    0,
+        0,    0, 7188, 7190, 3923, 7187,    0,    0,
+        0, 7189,    0, 7193, 7191, 1897,    0, 7192,
+        0,    0,    0,    0,    0,    0, 7195,    0,
+        0, 3630, 4286,    0,    0,    0,    0, 2652,
+        0,    0,    0, 7196,    0,    0,    0,    0,
+     4138, 7198,    0, 7197,    0,    0, 7201, 4169,
+        0,    0, 7200,    0, 1769, 7199, 7204,    0,
+        0, 7203,    0,    0, 7202, 3402, 7205,    0,
+        0,    0,    0,    0,    0,    0,    0, 7206,
+        0,    0,    0,    0, 7207,    0,    0, 2332,
+        0, 2073, 7208, 7209, 7210,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0, 2861, 7211,    0, 2551, 7212,
+        0,    0,    0, 7213,    0,    0,    0, 4607,
+     4606,    0,    0,    0,    0, 7214, 6472, 7215,
+     3200, 2831, 3604,    0,    0,    0,    0, 7216,
+        0,    0, 3907, 3342, 2350,    0,    0, 3205,
+        0,    0, 1514,    0, 4036, 2875,    0,    0,
+        0,    0,    0,    0,    0,    0, 2130,    0,
+        0, 2039,    0,    0, 3908,    0,    0,    0,
+        0,    0, 7217,    0,    0,    0,    0,    0,
+        0,    0, 7219,    0,    0, 7218, 1662,    0,
+        0, 3564, 7220, 3659,    0, 3403,    0, 7221,
+     2682,    0,    0,    0, 7223,    0,    0, 4076,
+     7238, 7225, 7226,    0,    0, 3331,    0,    0
+  },
+  { /* U+90xx */
+     3166, 3095,    0, 3486,    0, 7224, 1933,    0,
+        0,    0,    0, 7233,    0, 7230, 7243, 3487,
+     3260, 7227,    0, 3384, 3435, 7228, 7232, 2884,
+        0, 3643, 3334,    0,    0, 2948, 7231, 3116,
+     3106, 7229, 1419, 4326,    0,    0,    0, 7234,
+        0,    0,    0,    0,    0,    0, 3167,    0,
+        0, 2653, 2862,    0,    0, 7236, 7235,    0,
+     1489, 7237,    0,    0, 3775,    0, 7245,    0,
+        0, 3537, 2895,    0,    0, 3253,    0, 2062,
+        0, 7244, 4159, 1535,    0, 3909, 1663, 7239,
+     7240, 7241, 7242, 3505, 3199, 1477, 7246,    0,
+     7247, 7805,    0,    0, 3131,    0, 7248,    0,
+     1587, 3052,    0, 2177,    0, 4194,    0,11021,
+     7249, 3396,    0,    0,    0, 3096, 2593, 7250,
+        0,    0, 7253,    0,    0, 2701, 7251, 3019,
+     3018,    0, 1478,    0, 4273, 7255,    0, 3748,
+     7257, 7256, 7254, 6272, 1838,    0,    0, 7222,
+        0, 7259, 7258,    0,    0,    0,    0, 7260,
+        0, 4160,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0, 3543,    0,    0, 3962,    0,
+     7261,    0, 2595,    0,    0,    0,    0, 7262,
+        0, 7263,    0,    0,    0, 7264,    0,    0,
+     3385,    0,    0,    0,    0,    0,    0,    0,
+        0, 1484,    0,    0,    0,    0,    0,    0,
+        0,    0, 2313,    0,    0,    0, 4350,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0, 7268,    0,    0,11022,    0,
+        0, 2088, 7265,    0, 7266,    0,    0,    0,
+     3844,    0,    0,    0,    0, 1744,    0,    0,
+        0,    0,    0,    0,    0, 4161,    0, 2005,
+        0,    0,    0,    0,    0, 3436,    0,    0
+  },
+  { /* U+91xx */
+        0,    0, 7269,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 7270,    0,    0,11024,    0,    0,
+        0, 7271,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,11025,
+        0,    0,    0,    0,    0, 3386,    0,    0,
+     7273,    0, 7272,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0, 3529, 7274, 2654, 2602, 3631, 3277,    0,
+        0,    0, 2620,    0, 2896,    0, 7275,    0,
+     7276,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 2881, 7277,    0, 7278,    0,    0,
+        0, 7279, 4215,    0, 2655,    0,    0,    0,
+        0,    0, 7281, 7280,    0, 2314,    0, 2339,
+     2476,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 7284,    0,    0,    0,    0, 2702,
+        0, 7283,    0, 7282,    0, 3175,    0,    0,
+     2241,    0, 2949,    0,    0,    0,    0, 3682,
+        0,    0,    0,    0, 2657,    0,    0,    0,
+        0,    0, 7285,    0, 2789,    0,    0,    0,
+        0,    0, 7288, 7286,    0,    0,    0, 7287,
+        0,    0,    0,    0, 7290, 7289,    0,    0,
+     2816,    0, 7291,    0,    0,    0,    0,    0,
+     7292, 7293,    0,    0,    0,    0, 3714, 2401,
+     2603, 7294,    0, 7295, 4234, 2669, 4120, 4274,
+     7296, 2040,    0,    0,    0,    0, 7297,11027,
+     3387,    0,11026, 7300, 1780, 2863,11028, 7298,
+        0, 7299,    0, 3354,11031,11032, 4001, 2066,
+        0,    0,    0,    0,    0,11029,11030,    0,
+        0,    0,    0,    0,    0, 7302, 7303,    0,
+        0,    0,    0,    0, 7301,    0,    0, 7305
+  },
+  { /* U+92xx */
+        0,    0,    0,    0,    0,    0,11033,    0,
+        0,    0,11035,    0,    0, 3541, 1727,    0,
+    11034, 7309,    0,    0, 7306, 7308,    0,    0,
+        0,    0,    0,    0,    0,    0, 7304,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0, 7379,    0,    0, 7307,    0,    0,    0,
+        0,    0,    0,    0, 4305,    0,    0, 2220,
+        0,11042,11036,    0,11038,    0,    0, 7317,
+    11037,    0,    0,    0, 3404, 7312,    0,    0,
+     7315, 7313,    0, 7318,    0,    0,11039,    0,
+     7319,11041,    0,    0,    0,    0,    0, 7311,
+        0,11040, 7324, 1588,    0,    0, 7310,    0,
+        0,    0, 3679,    0, 7314,    0, 2790,11043,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0, 2315,    0,    0,    0,    0,    0,11045,
+    11046,    0,    0,    0,    0,    0, 3988,    0,
+     2042,    0,    0, 2670,    0, 3506,    0,    0,
+    10748,    0,    0,    0,    0,    0,    0,    0,
+        0, 3021,    0, 7322,    0, 7316, 7321,    0,
+     4077,    0, 3314, 7323, 7320,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,11044,
+        0,    0,    0,    0,    0, 3020,    0,    0,
+        0,    0,    0,    0,    0,    0,    0, 7327,
+        0, 7326,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0, 7325,
+    11050,    0, 3963,11054,    0,11052,    0,11048,
+        0,11049,    0,    0,    0,    0,    0,    0,
+    11053,    0,    0,    0, 2723,    0,    0,11047,
+        0, 7328, 3917,    0,    0, 1556,    0,    0,
+        0,    0, 3798, 3278,    0,    0,    0,    0,
+     1968,10754, 7330,11057, 2317,    0,    0,11060
+  },
+  { /* U+93xx */
+        0,    0,11062,    0,    0,    0, 2456,    0,
+        0,    0,    0,    0,    0,    0,    0, 7329,
+     2897,    0,    0,    0,    0,    0,    0,    0,
+     2898, 7333, 7335,    0,    0,11061,11059,    0,
+     2817,11056, 7334, 7336,    0,11055, 2025,    0,
+     3797,    0,    0, 2604, 4327,    0, 7332, 2438,
+        0,    0, 4355,    0,    0, 7338,    0,    0,
+        0,    0, 7337, 7339,    0,    0,    0,    0,
+        0,    0,    0,    0, 7331,    0,    0,    0,
+    10747,    0,    0, 3551,    0, 3437,    0,    0,
+        0,    0,    0,    0, 3345,    0, 7344,11064,
+        0,    0,    0, 3231, 7340,    0,    0,    0,
+     7341,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0, 2081,    0, 7343,    0,
+    11063,    0,    0,    0,    0, 2178,    0,    0,
+        0,    0,    0,    0, 7342,    0, 2791,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0, 1781,    0,    0,    0,
+        0,    0,    0,    0, 7348,    0, 2381, 3097,
+        0,    0, 3332,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,11065,    0,    0, 1719,
+        0,    0,    0,    0, 7346, 7347, 3325,    0,
+     7345,    0,    0,    0,    0,    0,    0,    0,
+        0, 7349,    0,    0,    0,    0,    0,    0,
+        0,    0,    0, 7355,    0,    0,11066,    0,
+     7358,    0,    0,    0,    0,    0,    0,    0,
+     7357, 3397,    0,    0,    0,    0, 7350, 7351,
+     7354,    0,    0,    0,    0, 7356,11067,    0,
+        0, 2006,    0,    0, 7359, 7353,    0,    0,
+     7352,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+    11068,    0,    0,    0,    0,    0,    0,    0
+  },
+  { /* U+94xx */
+        0,    0,    0, 7363,    0,    0,    0, 7364,
+        0,    0,    0,    0,    0,    0,    0,    0,
+     7365,    0,    0, 7362, 7361,    0,    0,    0,
+     2792, 3488, 7360,    0,    0,    0,    0,    0,
+        0, 7369,    0,    0,    0,    0,    0,    0,
+        0,    0,    0, 7367,    0,    0,    0,    0,
+        0,11069,    0,    0,    0, 7368, 7366,    0,
+     3190,    0, 7370,    0,    0,    0,    0,    0,
+        0, 7371,    0,    0, 7373,11070,    0,    0,
+    11071,    0,    0,    0,    0,    0,    0,    0,
+        0, 1839, 7372, 4132,    0,    0,    0,    0,
+        0,    0, 7384, 7374,    0,    0, 7377,    0,
+     7375,    0, 7376,    0,    0,    0,    0,    0,
+        0,    0, 7378,    0,    0,    0,    0,    0,
+     7380,    0,    0,    0,    0, 7381,    0, 7382,
+        0,    0,    0,    0, 7385, 7383, 7386, 7388,
+        0, 7387,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0
+  },
+  { /* U+95xx */
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0, 3315,
+        0,    0,    0,    0,    0,    0,    0,    0,
+     4113,    0, 7389, 3022,    0,    0,    0, 7390,
+        0, 3890, 7391, 1703,    0,    0,    0, 1532,
+        0, 1841,11072, 1840, 7392,    0, 7393,    0,
+     7394, 7395,    0,    0,    0,    0,    0,    0,
+     7396,    0, 1842, 1745, 2318, 3688,    0, 7398,
+     7397,    0,    0,    0,    0, 7399,    0,    0,
+        0,    0, 1564,    0,    0,    0,    0,    0,
+        0, 7402,    0, 7401, 7400,    0, 7403,    0,
+        0,    0,    0, 7406,    0,    0,    0, 1449,
+        0,    0, 7404,    0, 7408, 7407,    0,    0,
+        0,    0,    0,    0, 7410, 7409, 7411,    0,
+     3492,    0,    0,    0, 7412,    0,    0,    0,
+        0, 7413, 7415,    0,    0, 7414,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0
+  },
+  { /* U+96xx */
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0, 3836,    0,    0,    0,
+        0, 7416,    0,    0,    0,    0,    0,    0,
+     7417,    0, 2419,    0,    0,    0, 7418, 7419,
+        0,    0, 3989,    0,    0,    0,    0,    0,
+        0,    0,    0, 3051,    0,    0,    0, 1414,
+     3145,    0, 7420,    0, 3837,    0,    0,    0,
+        0,    0,    0, 7423, 7421, 2319,    0, 7422,
+     2196,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0, 3891, 7425, 7427, 7426, 7428,
+        0,    0, 1505, 2876, 2724, 1843, 7429,    0,
+        0,    0, 3642,    0, 7431,    0,    0,    0,
+     1506,    0, 7430, 3326,    0, 4275, 3489, 7424,
+     4236,    0, 2179,    0,    0, 4195,    0,    0,
+        0,    0,    0,    0,    0, 2063, 4250,    0,
+     2076,    0, 3168, 6581,    0, 7432, 1704, 2899,
+        0,    0,    0,    0, 1746, 7434,    0, 7435,
+     7433, 2136,    0, 2411, 2793,11075,    0,    0,
+     1507,    0,    0, 4287,    0,    0,    0, 7437,
+     7252,    0, 7436,    0,    0,    0,    0,11076,
+     7440, 7438, 7439,    0, 7441,    0, 7442, 4306,
+     7443, 7444,    0, 2955, 3693,    0,    0,    0,
+     2913, 1857,    0,    0, 4162, 1675, 2656, 2221,
+        0, 7447,    0, 7446, 2527, 7448, 7445,    0,
+        0, 2452,    0,    0,    0, 7452, 6875,    0,
+        0, 4660,    0, 2907, 7450,    0,    0,    0,
+        0,    0, 4235, 3559,    0,    0,    0,    0,
+     1515,    0, 2981, 2560,    0,    0,    0,    0,
+     3877,    0, 1536,    0,    0,    0, 4307, 4211,
+        0, 7453,    0, 3421,    0,    0,    0,    0
+  },
+  { /* U+97xx */
+     2629,    0,    0,    0, 7454,    0, 7455, 2864,
+     7456,    0, 4308,    0,    0, 7451, 7458, 7460,
+        0, 7459,    0, 7457,    0,    0, 7461,    0,
+        0, 7462,    0,    0, 3098,    0, 1664,    0,
+        0,    0,    0,    0, 7463,    0,    0, 4066,
+        0,    0, 7464,    0,    0,    0,    0,    0,
+     7465,    0, 4334,11077,    0,    0,    0,    0,
+     5469, 7466,    0,11078,    0, 7467, 7468,    0,
+        0,    0, 7472,11079, 7469,    0, 7470,    0,
+     7471, 7473,    0,    0,    0,11080,    0,11081,
+        0,11082, 2950,    0,    0,11083, 4129,    0,
+        0, 2951,    0,    0, 7474,    0, 3749,    0,
+     7475, 7759, 4086,    0, 7476,    0, 7477,    0,
+     7478, 1747,    0, 7480,    0, 2877,    0,    0,
+        0, 7481,    0,    0, 2072,    0,    0,    0,
+        0, 7482, 7486,    0, 7484,    0,    0,    0,
+        0, 7485,    0,    0, 1775, 7483, 7487,    0,
+        0,    0,    0, 7488,    0, 1450,    0, 7489,
+     7490,    0,    0,    0,    0,    0,    0,    0,
+     2794,    0,    0,    0, 7491,    0,    0,    0,
+     1919,    0,    0, 7494,    0,    0, 7493,    0,
+     7492,    0,    0, 7037,    0, 3914,    0,    0,
+        0,    0,    0, 7495, 7496,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0, 7497,    0,    0, 7498,    0,
+     7499,    0,    0, 7500,    0,    0,    0,    0,
+        0,    0,    0, 1844,    0,    0,    0,    0,
+        0,    0,    0,    0, 7501,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0, 7502, 3575,    0,
+        0,    0, 7504, 1625,    0, 7507, 7506,    0,
+        0,    0,    0, 1508,    0,    0,    0, 2007
+  },
+  { /* U+98xx */
+        0, 3893, 3316, 2352,    0, 2320, 2703,    0,
+     2880,    0,    0,    0, 7509,    0,    0, 7508,
+     4170, 1858, 3716, 3538,    0,    0,    0, 2912,
+     4276,    0, 2127,    0,    0,    0,    0,    0,
+        0, 7512,    0,    0, 7511,    0,    0,    0,
+        0,    0,    0,    0, 3991, 3490,    0,    0,
+        0,    0,    0,    0, 1552,    0,    0, 7513,
+     7510,    0,    0, 3809, 4210, 7514,    0,    0,
+        0,    0,    0,    0,    0,    0, 7515,    0,
+        0,    0,    0, 7517, 3176, 1751, 1752, 7516,
+        0,    0,    0,    0, 1859, 2180,    0,11084,
+     1860,    0,    0, 3415,    0,    0, 4294,    0,
+        0,    0,    0,    0,    0,11085,    0, 2222,
+        0,    0,    0, 7518,    0,    0,    0, 7519,
+     7520, 7521,    0, 7523, 7522,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+     3847,    0, 7524,    0,    0,    0,    0, 7525,
+        0, 7526,    0,    0,    0,    0, 7527,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0, 7529, 7528,    0, 7530,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0, 3750, 6530,    0,    0, 2829,
+        0,    0, 1898,    0,    0,    0,    0,    0,
+        0, 7531,    0, 7532,    0, 4618, 5667, 3717,
+        0,    0, 1501,    0, 1437,    0,    0,    0,
+        0,    0,    0,    0, 2528, 3964, 2820,    0
+  },
+  { /* U+99xx */
+        0,    0,    0, 7533,    0, 4105,    0,    0,
+        0, 7534, 4196,    0, 1538,    0,    0,    0,
+     2477,    0, 7535, 1676, 7536,    0,    0,    0,
+     7537,    0,    0,    0,    0, 7539, 7540,    0,
+     7542, 7538,    0,    0, 7541,    0,    0,11088,
+     1845,    0,    0,    0, 7543,    0, 7544,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0, 7545, 7546,    0,
+        0,    0, 7547,    0,    0, 7549,    0,    0,
+        0, 7548,    0, 7551, 7554,    0,    0,    0,
+     7550, 7552, 7553,    0,    0, 7555,    0, 2008,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0, 2621, 7556,
+     7557, 2321,    0,    0,    0,    0,11090,    0,
+        0,    0,    0,    0,    0, 7558,    0,    0,
+     1722,    0,    0,    0, 3619, 7559, 7560,    0,
+        0,    0,    0, 3254, 3553,    0,    0,    0,
+        0,    0,    0,    0, 7561,    0,    0,    0,
+        0, 3665,    0,    0, 3146, 1560, 2052,    0,
+     2053,    0,    0,    0,    0,    0,    0,    0,
+     3279, 7566, 2054,    0,    0, 1677,    0,    0,
+     7565,    0,    0, 7563,    0, 7564,    0, 7562,
+        0,    0, 7576,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0, 7567, 7568,    0,
+        0, 7569, 7570,    0,    0,    0,    0,    0,
+     7572,    0,    0, 7571,    0,    0,    0, 2689
+  },
+  { /* U+9Axx */
+        0, 7573,    0,    0,    0, 7575,    0,    0,
+        0,    0,    0,    0,    0,    0, 1899, 7574,
+        0,    0, 3099, 2181,    0,    0,    0,    0,
+        0, 7577,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+     3147,    0,    0, 7578,    0,    0,    0,    0,
+     3491,    0,    0,    0,    0,    0,    0, 7579,
+        0,    0,    0,    0,    0,    0, 7584,    0,
+     7582,    0, 7581, 7583,    0, 7580,    0,    0,
+        0,    0,    0,    0,    0, 7586,11091,    0,
+        0,    0,    0,    0,    0, 7585,    0, 7588,
+        0,    0, 2009, 7587,    0,    0,    0, 7589,
+        0,    0, 7590,    0, 7592, 7591,    0,    0,
+        0, 7593, 7595, 7594,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+     2348,    0,    0,    0,    0, 7596,    0,    0,
+     7597,    0,    0,    0,    0,    0,    0,    0,
+     1720,    0,    0,    0, 7598,    0,    0,    0,
+     7599,    0,    0,    0, 2901,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0, 7600,
+        0, 7601,    0, 7602, 7603,    0,    0,    0,
+     2322,11092,    0,    0,11093,    0, 7604, 7605,
+        0,    0, 7606, 7607,    0,    0, 7608,    0,
+        0,    0, 3683, 7610,    0, 3766, 7611, 7609,
+        0, 7613,    0,    0, 7612,    0,    0, 7614,
+        0,    0,    0, 7615,    0,    0,    0,    0
+  },
+  { /* U+9Bxx */
+        0,    0,    0,    0,    0,    0, 7616,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+     7617,    0, 7618,    0,    0,    0,    0, 7619,
+        0,    0, 7620, 7621,    0, 7622,    0, 7623,
+     7624, 7625, 7626,    0,    0,    0, 7627, 7628,
+        0, 5661, 7629,    0,    0,    0,    0,    0,
+        0,    0,    0, 6386, 1900,    0,    0,    0,
+        0, 1693, 2368, 7631, 7630, 4047,    0,    0,
+        0,    0,    0,    0,    0, 7633, 7634, 7632,
+        0, 7635,    0,    0, 4014,    0,    0,    0,
+     7636,    0, 1971,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0, 4329,
+        0,    0,11095,    0, 7637,11094,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0, 7639,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0, 1440,11096,
+        0, 7640, 3865, 7638,    0,    0, 7641, 7642,
+        0,    0,    0,    0,    0,    0,    0, 7643,
+     7644,    0,    0,    0,    0,    0,    0,    0,
+     7645,    0, 4026, 2457,    0, 2440, 3023,    0,
+        0,11097,    0,    0, 7646,    0,    0,    0,
+        0, 7649,    0,11098,    0,    0,    0,    0,
+     7647,    0,    0,    0,    0,    0, 7650,    0,
+        0, 2243, 7648,    0,    0,    0,    0, 7651,
+        0, 7652, 7653,    0, 7657,    0, 2454,    0,
+        0,    0,    0, 3170,    0,    0,    0,    0,
+        0, 7658, 7655, 7654, 7656,    0,    0,    0,
+     2131,    0,    0,    0,    0,    0,    0,    0,
+     7662, 7661, 7660,    0,    0, 1429,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0
+  },
+  { /* U+9Cxx */
+    11099,    0,    0,    0, 7672,    0, 7668,    0,
+     7669, 7665, 7671,    0, 7667, 1758,    0,    0,
+     4368,    0, 7670, 7666, 7664, 7663,    0,    0,
+        0,    0,    0, 7674,    0,    0,    0,    0,
+        0, 7677,    0,    0, 7676, 7675,    0,    0,
+        0,    0,    0,    0,    0, 3801, 7673, 1493,
+     7678,    0, 7680,    0,    0,    0,    0,    0,
+        0, 1771, 7659, 1527,    0,    0, 7682,    0,
+        0,    0,    0,    0,    0,    0, 7681, 7679,
+     3209,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 4028,    0,    0,    0,    0, 4288,
+        0,    0, 7683,    0,    0,    0,    0,    0,
+     7684,    0,    0,    0,    0,    0,    0, 7685,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0, 7686,    0,
+     7687,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0, 3317,    0, 7688,
+        0, 3689,    0, 7693, 7689,    0,    0,    0,
+     7690,    0,    0, 3965, 4078,    0, 3526,    0,
+        0,    0,    0,    0,    0,    0,    0,    0
+  },
+  { /* U+9Dxx */
+        0,    0,    0, 7694,    0,    0, 7695, 3508,
+     7692, 7691,    0,    0,    0,    0, 1608,    0,
+        0,    0, 7703,    0,    0, 7702,    0,    0,
+        0,    0,    0, 1589,    0,    0,    0, 7700,
+        0,    0,    0, 7699,    0,    0, 7697,    0,
+     1783,    0, 7696, 2556, 1607,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0, 2323,    0,    0, 7706, 7705,
+        0, 7704,    0,    0, 7701,    0, 7707,    0,
+     7708,    0,    0,    0,    0,    0,    0,    0,
+     7713, 7712,    0,    0,    0,    0,    0,    0,
+        0, 7714,    0,    0, 1517, 7709, 7710,    0,
+     2340, 4067,    0,    0, 7711,    0,    0,    0,
+        0,    0,    0,11101, 3966,    0,    0, 7719,
+    11100,    0, 7715,    0,    0,    0,    0,    0,
+        0,    0, 7720,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0, 7717,
+        0, 7716,    0,    0,    0,    0,    0, 2128,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 7721,    0,    0,    0,    0,    0,
+        0,    0,    0,    0, 7722,    0,    0,    0,
+        0, 7723,    0, 7718,    0,    0,    0, 7698,
+        0,    0, 7724,    0, 3355,    0,    0,    0,
+     7728,    0, 7729, 7727,    0,    0,    0,    0,
+        0, 7726, 7732,    0, 7725,    0, 7730,    0,
+        0,    0,    0,    0,    0,    0,    0, 7731,
+        0,    0,    0, 7734,    0,    0,    0,    0,
+        0, 7733,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0, 7736,    0,
+        0,    0,    0,    0,    0, 7737,    0, 7738,
+        0,    0, 4365,    0,    0,    0,    0,    0,
+     7735, 3177, 2427,    0,    0, 7739,    0,    0
+  },
+  { /* U+9Exx */
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,11103, 7740, 7741,    0,    0, 7742,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0, 7743,    0,    0,
+     2182, 7744,    0,    0,    0, 7745,    0, 2553,
+        0, 7746,    0,    0,    0,    0,    0,    0,
+     7747,    0,    0, 7748, 7749,    0,    0,    0,
+        0, 7752, 7750, 4352,    0, 7751,    0, 4309,
+        0,    0,    0,    0,    0, 7753,    0, 4289,
+        0,    0,    0,    0,    0, 7754, 3666,    0,
+        0, 7755, 7757,    0,    0, 7758,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+     7756, 2333, 4087, 4015, 5069,    0, 5704, 4039,
+        0,    0,    0,    0, 1609,    0,    0,    0,
+        0,    0,    0,    0, 7760, 1928, 7761, 7762,
+     7763,11104, 2341,    0, 7764,    0,    0,    0,
+     5974, 4101,    0, 3169, 7765, 7767, 7766,    0,
+     7768,    0,    0,    0,    0, 7769,    0,    0,
+     7770,    0,    0,    0,    0,    0,    0, 7771,
+        0,    0,    0,    0, 7772,    0, 7773, 7774,
+        0, 7775,    0, 7776, 7777, 7778,    0,    0
+  },
+  { /* U+9Fxx */
+        0,    0,    0,    0,    0,    0,    0, 7779,
+     7780,    0,    0,    0,    0,    0, 3388,    0,
+        0,    0,    0, 2223,    0, 7782,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+     3053, 7783,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0, 7784,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0, 3761,    0,    0, 7785,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0, 7786, 6227,    0,    0, 7108, 7503,
+        0,    0, 7787,    0, 7788,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0, 7790,
+     7791, 7792, 4310, 7789,    0,    0, 7793, 7794,
+        0,    0, 7796,    0, 7795,    0,    0,    0,
+        0,    0, 7798,    0,    0,    0, 7799, 7797,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0, 4252,    0,    0,
+        0,    0,    0,    0,    0, 7800,    0,    0,
+        0,    0,    0,    0, 7801, 6256,    0,    0,
+     7802,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0
+  },
+  { /* U+E0xx */
+     8837, 8838, 8839, 8840, 8841, 8842, 8843, 8844,
+     8845, 8846, 8847, 8848, 8849, 8850, 8851, 8852,
+     8853, 8854, 8855, 8856, 8857, 8858, 8859, 8860,
+     8861, 8862, 8863, 8864, 8865, 8866, 8867, 8868,
+     8869, 8870, 8871, 8872, 8873, 8874, 8875, 8876,
+     8877, 8878, 8879, 8880, 8881, 8882, 8883, 8884,
+     8885, 8886, 8887, 8888, 8889, 8890, 8891, 8892,
+     8893, 8894, 8895, 8896, 8897, 8898, 8899, 8900,
+     8901, 8902, 8903, 8904, 8905, 8906, 8907, 8908,
+     8909, 8910, 8911, 8912, 8913, 8914, 8915, 8916,
+     8917, 8918, 8919, 8920, 8921, 8922, 8923, 8924,
+     8925, 8926, 8927, 8928, 8929, 8930, 8931, 8932,
+     8933, 8934, 8935, 8936, 8937, 8938, 8939, 8940,
+     8941, 8942, 8943, 8944, 8945, 8946, 8947, 8948,
+     8949, 8950, 8951, 8952, 8953, 8954, 8955, 8956,
+     8957, 8958, 8959, 8960, 8961, 8962, 8963, 8964,
+     8965, 8966, 8967, 8968, 8969, 8970, 8971, 8972,
+     8973, 8974, 8975, 8976, 8977, 8978, 8979, 8980,
+     8981, 8982, 8983, 8984, 8985, 8986, 8987, 8988,
+     8989, 8990, 8991, 8992, 8993, 8994, 8995, 8996,
+     8997, 8998, 8999, 9000, 9001, 9002, 9003, 9004,
+     9005, 9006, 9007, 9008, 9009, 9010, 9011, 9012,
+     9013, 9014, 9015, 9016, 9017, 9018, 9019, 9020,
+     9021, 9022, 9023, 9024, 9025, 9026, 9027, 9028,
+     9029, 9030, 9031, 9032, 9033, 9034, 9035, 9036,
+     9037, 9038, 9039, 9040, 9041, 9042, 9043, 9044,
+     9045, 9046, 9047, 9048, 9049, 9050, 9051, 9052,
+     9053, 9054, 9055, 9056, 9057, 9058, 9059, 9060,
+     9061, 9062, 9063, 9064, 9065, 9066, 9067, 9068,
+     9069, 9070, 9071, 9072, 9073, 9074, 9075, 9076,
+     9077, 9078, 9079, 9080, 9081, 9082, 9083, 9084,
+     9085, 9086, 9087, 9088, 9089, 9090, 9091, 9092
+  },
+  { /* U+E1xx */
+     9093, 9094, 9095, 9096, 9097, 9098, 9099, 9100,
+     9101, 9102, 9103, 9104, 9105, 9106, 9107, 9108,
+     9109, 9110, 9111, 9112, 9113, 9114, 9115, 9116,
+     9117, 9118, 9119, 9120, 9121, 9122, 9123, 9124,
+     9125, 9126, 9127, 9128, 9129, 9130, 9131, 9132,
+     9133, 9134, 9135, 9136, 9137, 9138, 9139, 9140,
+     9141, 9142, 9143, 9144, 9145, 9146, 9147, 9148,
+     9149, 9150, 9151, 9152, 9153, 9154, 9155, 9156,
+     9157, 9158, 9159, 9160, 9161, 9162, 9163, 9164,
+     9165, 9166, 9167, 9168, 9169, 9170, 9171, 9172,
+     9173, 9174, 9175, 9176, 9177, 9178, 9179, 9180,
+     9181, 9182, 9183, 9184, 9185, 9186, 9187, 9188,
+     9189, 9190, 9191, 9192, 9193, 9194, 9195, 9196,
+     9197, 9198, 9199, 9200, 9201, 9202, 9203, 9204,
+     9205, 9206, 9207, 9208, 9209, 9210, 9211, 9212,
+     9213, 9214, 9215, 9216, 9217, 9218, 9219, 9220,
+     9221, 9222, 9223, 9224, 9225, 9226, 9227, 9228,
+     9229, 9230, 9231, 9232, 9233, 9234, 9235, 9236,
+     9237, 9238, 9239, 9240, 9241, 9242, 9243, 9244,
+     9245, 9246, 9247, 9248, 9249, 9250, 9251, 9252,
+     9253, 9254, 9255, 9256, 9257, 9258, 9259, 9260,
+     9261, 9262, 9263, 9264, 9265, 9266, 9267, 9268,
+     9269, 9270, 9271, 9272, 9273, 9274, 9275, 9276,
+     9277, 9278, 9279, 9280, 9281, 9282, 9283, 9284,
+     9285, 9286, 9287, 9288, 9289, 9290, 9291, 9292,
+     9293, 9294, 9295, 9296, 9297, 9298, 9299, 9300,
+     9301, 9302, 9303, 9304, 9305, 9306, 9307, 9308,
+     9309, 9310, 9311, 9312, 9313, 9314, 9315, 9316,
+     9317, 9318, 9319, 9320, 9321, 9322, 9323, 9324,
+     9325, 9326, 9327, 9328, 9329, 9330, 9331, 9332,
+     9333, 9334, 9335, 9336, 9337, 9338, 9339, 9340,
+     9341, 9342, 9343, 9344, 9345, 9346, 9347, 9348
+  },
+  { /* U+E2xx */
+     9349, 9350, 9351, 9352, 9353, 9354, 9355, 9356,
+     9357, 9358, 9359, 9360, 9361, 9362, 9363, 9364,
+     9365, 9366, 9367, 9368, 9369, 9370, 9371, 9372,
+     9373, 9374, 9375, 9376, 9377, 9378, 9379, 9380,
+     9381, 9382, 9383, 9384, 9385, 9386, 9387, 9388,
+     9389, 9390, 9391, 9392, 9393, 9394, 9395, 9396,
+     9397, 9398, 9399, 9400, 9401, 9402, 9403, 9404,
+     9405, 9406, 9407, 9408, 9409, 9410, 9411, 9412,
+     9413, 9414, 9415, 9416, 9417, 9418, 9419, 9420,
+     9421, 9422, 9423, 9424, 9425, 9426, 9427, 9428,
+     9429, 9430, 9431, 9432, 9433, 9434, 9435, 9436,
+     9437, 9438, 9439, 9440, 9441, 9442, 9443, 9444,
+     9445, 9446, 9447, 9448, 9449, 9450, 9451, 9452,
+     9453, 9454, 9455, 9456, 9457, 9458, 9459, 9460,
+     9461, 9462, 9463, 9464, 9465, 9466, 9467, 9468,
+     9469, 9470, 9471, 9472, 9473, 9474, 9475, 9476,
+     9477, 9478, 9479, 9480, 9481, 9482, 9483, 9484,
+     9485, 9486, 9487, 9488, 9489, 9490, 9491, 9492,
+     9493, 9494, 9495, 9496, 9497, 9498, 9499, 9500,
+     9501, 9502, 9503, 9504, 9505, 9506, 9507, 9508,
+     9509, 9510, 9511, 9512, 9513, 9514, 9515, 9516,
+     9517, 9518, 9519, 9520, 9521, 9522, 9523, 9524,
+     9525, 9526, 9527, 9528, 9529, 9530, 9531, 9532,
+     9533, 9534, 9535, 9536, 9537, 9538, 9539, 9540,
+     9541, 9542, 9543, 9544, 9545, 9546, 9547, 9548,
+     9549, 9550, 9551, 9552, 9553, 9554, 9555, 9556,
+     9557, 9558, 9559, 9560, 9561, 9562, 9563, 9564,
+     9565, 9566, 9567, 9568, 9569, 9570, 9571, 9572,
+     9573, 9574, 9575, 9576, 9577, 9578, 9579, 9580,
+     9581, 9582, 9583, 9584, 9585, 9586, 9587, 9588,
+     9589, 9590, 9591, 9592, 9593, 9594, 9595, 9596,
+     9597, 9598, 9599, 9600, 9601, 9602, 9603, 9604
+  },
+  { /* U+E3xx */
+     9605, 9606, 9607, 9608, 9609, 9610, 9611, 9612,
+     9613, 9614, 9615, 9616, 9617, 9618, 9619, 9620,
+     9621, 9622, 9623, 9624, 9625, 9626, 9627, 9628,
+     9629, 9630, 9631, 9632, 9633, 9634, 9635, 9636,
+     9637, 9638, 9639, 9640, 9641, 9642, 9643, 9644,
+     9645, 9646, 9647, 9648, 9649, 9650, 9651, 9652,
+     9653, 9654, 9655, 9656, 9657, 9658, 9659, 9660,
+     9661, 9662, 9663, 9664, 9665, 9666, 9667, 9668,
+     9669, 9670, 9671, 9672, 9673, 9674, 9675, 9676,
+     9677, 9678, 9679, 9680, 9681, 9682, 9683, 9684,
+     9685, 9686, 9687, 9688, 9689, 9690, 9691, 9692,
+     9693, 9694, 9695, 9696, 9697, 9698, 9699, 9700,
+     9701, 9702, 9703, 9704, 9705, 9706, 9707, 9708,
+     9709, 9710, 9711, 9712, 9713, 9714, 9715, 9716,
+     9717, 9718, 9719, 9720, 9721, 9722, 9723, 9724,
+     9725, 9726, 9727, 9728, 9729, 9730, 9731, 9732,
+     9733, 9734, 9735, 9736, 9737, 9738, 9739, 9740,
+     9741, 9742, 9743, 9744, 9745, 9746, 9747, 9748,
+     9749, 9750, 9751, 9752, 9753, 9754, 9755, 9756,
+     9757, 9758, 9759, 9760, 9761, 9762, 9763, 9764,
+     9765, 9766, 9767, 9768, 9769, 9770, 9771, 9772,
+     9773, 9774, 9775, 9776, 9777, 9778, 9779, 9780,
+     9781, 9782, 9783, 9784, 9785, 9786, 9787, 9788,
+     9789, 9790, 9791, 9792, 9793, 9794, 9795, 9796,
+     9797, 9798, 9799, 9800, 9801, 9802, 9803, 9804,
+     9805, 9806, 9807, 9808, 9809, 9810, 9811, 9812,
+     9813, 9814, 9815, 9816, 9817, 9818, 9819, 9820,
+     9821, 9822, 9823, 9824, 9825, 9826, 9827, 9828,
+     9829, 9830, 9831, 9832, 9833, 9834, 9835, 9836,
+     9837, 9838, 9839, 9840, 9841, 9842, 9843, 9844,
+     9845, 9846, 9847, 9848, 9849, 9850, 9851, 9852,
+     9853, 9854, 9855, 9856, 9857, 9858, 9859, 9860
+  },
+  { /* U+E4xx */
+     9861, 9862, 9863, 9864, 9865, 9866, 9867, 9868,
+     9869, 9870, 9871, 9872, 9873, 9874, 9875, 9876,
+     9877, 9878, 9879, 9880, 9881, 9882, 9883, 9884,
+     9885, 9886, 9887, 9888, 9889, 9890, 9891, 9892,
+     9893, 9894, 9895, 9896, 9897, 9898, 9899, 9900,
+     9901, 9902, 9903, 9904, 9905, 9906, 9907, 9908,
+     9909, 9910, 9911, 9912, 9913, 9914, 9915, 9916,
+     9917, 9918, 9919, 9920, 9921, 9922, 9923, 9924,
+     9925, 9926, 9927, 9928, 9929, 9930, 9931, 9932,
+     9933, 9934, 9935, 9936, 9937, 9938, 9939, 9940,
+     9941, 9942, 9943, 9944, 9945, 9946, 9947, 9948,
+     9949, 9950, 9951, 9952, 9953, 9954, 9955, 9956,
+     9957, 9958, 9959, 9960, 9961, 9962, 9963, 9964,
+     9965, 9966, 9967, 9968, 9969, 9970, 9971, 9972,
+     9973, 9974, 9975, 9976, 9977, 9978, 9979, 9980,
+     9981, 9982, 9983, 9984, 9985, 9986, 9987, 9988,
+     9989, 9990, 9991, 9992, 9993, 9994, 9995, 9996,
+     9997, 9998, 9999,10000,10001,10002,10003,10004,
+    10005,10006,10007,10008,10009,10010,10011,10012,
+    10013,10014,10015,10016,10017,10018,10019,10020,
+    10021,10022,10023,10024,10025,10026,10027,10028,
+    10029,10030,10031,10032,10033,10034,10035,10036,
+    10037,10038,10039,10040,10041,10042,10043,10044,
+    10045,10046,10047,10048,10049,10050,10051,10052,
+    10053,10054,10055,10056,10057,10058,10059,10060,
+    10061,10062,10063,10064,10065,10066,10067,10068,
+    10069,10070,10071,10072,10073,10074,10075,10076,
+    10077,10078,10079,10080,10081,10082,10083,10084,
+    10085,10086,10087,10088,10089,10090,10091,10092,
+    10093,10094,10095,10096,10097,10098,10099,10100,
+    10101,10102,10103,10104,10105,10106,10107,10108,
+    10109,10110,10111,10112,10113,10114,10115,10116
+  },
+  { /* U+E5xx */
+    10117,10118,10119,10120,10121,10122,10123,10124,
+    10125,10126,10127,10128,10129,10130,10131,10132,
+    10133,10134,10135,10136,10137,10138,10139,10140,
+    10141,10142,10143,10144,10145,10146,10147,10148,
+    10149,10150,10151,10152,10153,10154,10155,10156,
+    10157,10158,10159,10160,10161,10162,10163,10164,
+    10165,10166,10167,10168,10169,10170,10171,10172,
+    10173,10174,10175,10176,10177,10178,10179,10180,
+    10181,10182,10183,10184,10185,10186,10187,10188,
+    10189,10190,10191,10192,10193,10194,10195,10196,
+    10197,10198,10199,10200,10201,10202,10203,10204,
+    10205,10206,10207,10208,10209,10210,10211,10212,
+    10213,10214,10215,10216,10217,10218,10219,10220,
+    10221,10222,10223,10224,10225,10226,10227,10228,
+    10229,10230,10231,10232,10233,10234,10235,10236,
+    10237,10238,10239,10240,10241,10242,10243,10244,
+    10245,10246,10247,10248,10249,10250,10251,10252,
+    10253,10254,10255,10256,10257,10258,10259,10260,
+    10261,10262,10263,10264,10265,10266,10267,10268,
+    10269,10270,10271,10272,10273,10274,10275,10276,
+    10277,10278,10279,10280,10281,10282,10283,10284,
+    10285,10286,10287,10288,10289,10290,10291,10292,
+    10293,10294,10295,10296,10297,10298,10299,10300,
+    10301,10302,10303,10304,10305,10306,10307,10308,
+    10309,10310,10311,10312,10313,10314,10315,10316,
+    10317,10318,10319,10320,10321,10322,10323,10324,
+    10325,10326,10327,10328,10329,10330,10331,10332,
+    10333,10334,10335,10336,10337,10338,10339,10340,
+    10341,10342,10343,10344,10345,10346,10347,10348,
+    10349,10350,10351,10352,10353,10354,10355,10356,
+    10357,10358,10359,10360,10361,10362,10363,10364,
+    10365,10366,10367,10368,10369,10370,10371,10372
+  },
+  { /* U+E6xx */
+    10373,10374,10375,10376,10377,10378,10379,10380,
+    10381,10382,10383,10384,10385,10386,10387,10388,
+    10389,10390,10391,10392,10393,10394,10395,10396,
+    10397,10398,10399,10400,10401,10402,10403,10404,
+    10405,10406,10407,10408,10409,10410,10411,10412,
+    10413,10414,10415,10416,10417,10418,10419,10420,
+    10421,10422,10423,10424,10425,10426,10427,10428,
+    10429,10430,10431,10432,10433,10434,10435,10436,
+    10437,10438,10439,10440,10441,10442,10443,10444,
+    10445,10446,10447,10448,10449,10450,10451,10452,
+    10453,10454,10455,10456,10457,10458,10459,10460,
+    10461,10462,10463,10464,10465,10466,10467,10468,
+    10469,10470,10471,10472,10473,10474,10475,10476,
+    10477,10478,10479,10480,10481,10482,10483,10484,
+    10485,10486,10487,10488,10489,10490,10491,10492,
+    10493,10494,10495,10496,10497,10498,10499,10500,
+    10501,10502,10503,10504,10505,10506,10507,10508,
+    10509,10510,10511,10512,10513,10514,10515,10516,
+    10517,10518,10519,10520,10521,10522,10523,10524,
+    10525,10526,10527,10528,10529,10530,10531,10532,
+    10533,10534,10535,10536,10537,10538,10539,10540,
+    10541,10542,10543,10544,10545,10546,10547,10548,
+    10549,10550,10551,10552,10553,10554,10555,10556,
+    10557,10558,10559,10560,10561,10562,10563,10564,
+    10565,10566,10567,10568,10569,10570,10571,10572,
+    10573,10574,10575,10576,10577,10578,10579,10580,
+    10581,10582,10583,10584,10585,10586,10587,10588,
+    10589,10590,10591,10592,10593,10594,10595,10596,
+    10597,10598,10599,10600,10601,10602,10603,10604,
+    10605,10606,10607,10608,10609,10610,10611,10612,
+    10613,10614,10615,10616,10617,10618,10619,10620,
+    10621,10622,10623,10624,10625,10626,10627,10628
+  },
+  { /* U+E7xx */
+    10629,10630,10631,10632,10633,10634,10635,10636,
+    10637,10638,10639,10640,10641,10642,10643,10644,
+    10645,10646,10647,10648,10649,10650,10651,10652,
+    10653,10654,10655,10656,10657,10658,10659,10660,
+    10661,10662,10663,10664,10665,10666,10667,10668,
+    10669,10670,10671,10672,10673,10674,10675,10676,
+    10677,10678,10679,10680,10681,10682,10683,10684,
+    10685,10686,10687,10688,10689,10690,10691,10692,
+    10693,10694,10695,10696,10697,10698,10699,10700,
+    10701,10702,10703,10704,10705,10706,10707,10708,
+    10709,10710,10711,10712,10713,10714,10715,10716,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0
+  },
+  { /* U+F9xx */
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,10876,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,11073,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0
+  },
+  { /* U+FAxx */
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,10796,10807,
+    10808,10829,10868,10884,10886,10929,10935,10958,
+    10966,10967,10968,10970,10974,10977,10986,10997,
+    10999,11000,11009,11017,11019,11020,11023,11051,
+    11058,11074,11086,11087,11089,11102,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0
+  },
+  { /* U+FFxx */
+        0,   10,10740,   84,   80,   83,   85,10739,
+       42,   43,   86,   60,    4,   61,    5,   31,
+      204,  205,  206,  207,  208,  209,  210,  211,
+      212,  213,    7,    8,   67,   65,   68,    9,
+       87,  221,  222,  223,  224,  225,  226,  227,
+      228,  229,  230,  231,  232,  233,  234,  235,
+      236,  237,  238,  239,  240,  241,  242,  243,
+      244,  245,  246,   46,   32,   47,   16,   18,
+       14,  253,  254,  255,  256,  257,  258,  259,
+      260,  261,  262,  263,  264,  265,  266,  267,
+      268,  269,  270,  271,  272,  273,  274,  275,
+      276,  277,  278,   48,   35,   49,   33,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+       81,   82,  138,   17,10738,   79,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0
+  }
+};
+
+static const unsigned short nec_index[ibm_codes] = {
+   8635, 8636, 8637, 8638, 8639, 8640, 8641, 8642,
+   8643, 8644,    0,    0,    0,    0,    0,    0,
+      0,    0,    0,    0,    0, 8646, 8647, 8648,
+      0,    0,    0,    0, 8273, 8274, 8275, 8276,
+   8277, 8278, 8279, 8280, 8281, 8282, 8283, 8284,
+   8285, 8286, 8287, 8288, 8289, 8290, 8291, 8292,
+   8293, 8294, 8295, 8296, 8297, 8298, 8299, 8300,
+   8301, 8302, 8303, 8304, 8305, 8306, 8307, 8308,
+   8309, 8310, 8311, 8312, 8313, 8314, 8315, 8316,
+   8317, 8318, 8319, 8320, 8321, 8322, 8323, 8324,
+   8325, 8326, 8327, 8328, 8329, 8330, 8331, 8332,
+   8333, 8334, 8335, 8336, 8337, 8338, 8339, 8340,
+   8341, 8342, 8343, 8344, 8345, 8346, 8347, 8348,
+   8349, 8350, 8351, 8352, 8353, 8354, 8355, 8356,
+   8357, 8358, 8359, 8360, 8361, 8362, 8363, 8364,
+   8365, 8366, 8367, 8368, 8369, 8370, 8371, 8372,
+   8373, 8374, 8375, 8376, 8377, 8378, 8379, 8380,
+   8381, 8382, 8383, 8384, 8385, 8386, 8387, 8388,
+   8389, 8390, 8391, 8392, 8393, 8394, 8395, 8396,
+   8397, 8398, 8399, 8400, 8401, 8402, 8403, 8404,
+   8405, 8406, 8407, 8408, 8409, 8410, 8411, 8412,
+   8413, 8414, 8415, 8416, 8417, 8418, 8419, 8420,
+   8421, 8422, 8423, 8424, 8425, 8426, 8427, 8428,
+   8429, 8430, 8431, 8432, 8433, 8434, 8435, 8436,
+   8437, 8438, 8439, 8440, 8441, 8442, 8443, 8444,
+   8445, 8446, 8447, 8448, 8449, 8450, 8451, 8452,
+   8453, 8454, 8455, 8456, 8457, 8458, 8459, 8460,
+   8461, 8462, 8463, 8464, 8465, 8466, 8467, 8468,
+   8469, 8470, 8471, 8472, 8473, 8474, 8475, 8476,
+   8477, 8478, 8479, 8480, 8481, 8482, 8483, 8484,
+   8485, 8486, 8487, 8488, 8489, 8490, 8491, 8492,
+   8493, 8494, 8495, 8496, 8497, 8498, 8499, 8500,
+   8501, 8502, 8503, 8504, 8505, 8506, 8507, 8508,
+   8509, 8510, 8511, 8512, 8513, 8514, 8515, 8516,
+   8517, 8518, 8519, 8520, 8521, 8522, 8523, 8524,
+   8525, 8526, 8527, 8528, 8529, 8530, 8531, 8532,
+   8533, 8534, 8535, 8536, 8537, 8538, 8539, 8540,
+   8541, 8542, 8543, 8544, 8545, 8546, 8547, 8548,
+   8549, 8550, 8551, 8552, 8553, 8554, 8555, 8556,
+   8557, 8558, 8559, 8560, 8561, 8562, 8563, 8564,
+   8565, 8566, 8567, 8568, 8569, 8570, 8571, 8572,
+   8573, 8574, 8575, 8576, 8577, 8578, 8579, 8580,
+   8581, 8582, 8583, 8584, 8585, 8586, 8587, 8588,
+   8589, 8590, 8591, 8592, 8593, 8594, 8595, 8596,
+   8597, 8598, 8599, 8600, 8601, 8602, 8603, 8604,
+   8605, 8606, 8607, 8608, 8609, 8610, 8611, 8612,
+   8613, 8614, 8615, 8616, 8617, 8618, 8619, 8620,
+   8621, 8622, 8623, 8624, 8625, 8626, 8627, 8628,
+   8629, 8630, 8631, 8632
+};
+
+/* The ISO-2022-JP character sets, with their escape sequences: */
+
+enum { shift_ascii, shift_kana, shift_kanji };
+
+#define ESC 0x1B
+
+static const char designate[3][3] = {
+  { ESC, '(', 'B' }, { ESC, '(', 'I' }, { ESC, '$', 'B' }
+};
+
+/* code_index() returns the index of code point c in the charset, */
+/* or -1 if it has none:                                          */
+
+static long code_index(int charset, punycode_uint c)
+{
+  long index;
+
+  if (c > 0xFFFF) return -1;
+  index = (long) index_of[index_page[c >> 8]][c & 0xFF] - 1;
+
+  if (charset != punycode_sjis && index >= jis_codes) {
+    index = index >= ibm_first && index - ibm_first < ibm_codes ?
+            (long) nec_index[index - ibm_first] - 1 : -1;
+  }
+
+  return index;
+}
+
+/*** UTF-8 ***/
+
+/* utf8_length(c) is the number of bytes of code point c in UTF-8, */
+/* which is never more than three for the code points here:        */
+
+#define utf8_length(c) ((c) < 0x80 ? 1 : (c) < 0x800 ? 2 : 3)
+
+static void put_utf8(punycode_uint c, char output[])
+{
+  if (c < 0x80) output[0] = (char) c;
+  else if (c < 0x800) {
+    output[0] = (char) (0xC0 | c >> 6);
+    output[1] = (char) (0x80 | (c & 0x3F));
+  }
+  else {
+    output[0] = (char) (0xE0 | c >> 12);
+    output[1] = (char) (0x80 | (c >> 6 & 0x3F));
+    output[2] = (char) (0x80 | (c & 0x3F));
+  }
+}
+
+/* get_utf8() decodes the UTF-8 sequence at input[*j], advancing *j */
+/* past it, and returns its code point, or -1 if it is ill-formed.  */
+
+static long get_utf8(size_t input_length, const unsigned char input[],
+                     size_t *j)
+{
+  size_t k, n;
+  unsigned long c = input[*j];
+  static const unsigned long min[4] = { 0, 0x80, 0x800, 0x10000 };
+
+  if (c < 0x80) {
+    ++*j;
+    return (long) c;
+  }
+
+  if (c < 0xC2) return -1;
+  else if (c < 0xE0) n = 1, c &= 0x1F;
+  else if (c < 0xF0) n = 2, c &= 0x0F;
+  else if (c < 0xF5) n = 3, c &= 0x07;
+  else return -1;
+
+  if (input_length - *j <= n) return -1;
+
+  for (k = 1;  k <= n;  ++k) {
+    if ((input[*j + k] & 0xC0) != 0x80) return -1;
+    c = c << 6 | (input[*j + k] & 0x3F);
+  }
+
+  if (c < min[n] || c > 0x10FFFF || (c >= 0xD800 && c < 0xE000)) {
+    return -1;
+  }
+
+  *j += n + 1;
+  return (long) c;
+}
+
+/*** Decoding ***/
+
+/* decode_char() decodes the character at input[*j], advancing *j   */
+/* past it, and stores its code point in *c.  In ISO-2022-JP, an    */
+/* escape sequence only changes *shift.  Returns 1 for a character, */
+/* 0 for an escape sequence, and -1 for invalid input.              */
+
+static int decode_char(int charset, int *shift, size_t input_length,
+                       const unsigned char input[], size_t *j,
+                       punycode_uint *c)
+{
+  const unsigned char *s = input + *j;
+  size_t rest = input_length - *j;
+  unsigned lead = s[0], trail;
+  long index;
+
+  if (lead < 0x80 && (*shift == shift_ascii || lead == ESC)) {
+    if (lead == ESC && charset >= punycode_jis7) {
+      if (rest < 3) return -1;
+      if (s[1] == '(' && (s[2] == 'B' || s[2] == 'J')) *shift = shift_ascii;
+      else if (s[1] == '(' && s[2] == 'I') *shift = shift_kana;
+      else if (s[1] == '$' && (s[2] == 'B' || s[2] == '@')) {
+        *shift = shift_kanji;
+      }
+      else return -1;
+      *j += 3;
+      return 0;
+    }
+
+    *c = lead;
+    ++*j;
+    return 1;
+  }
+
+  /* Half-width katakana: */
+
+  if (charset != punycode_euc_jp && *shift == shift_ascii &&
+      lead - 0xA1 < 0x3F) {
+    *c = lead + 0xFEC0;
+    ++*j;
+    return 1;
+  }
+
+  if (*shift == shift_kana) {
+    if (lead - 0x21 >= 0x3F) return -1;
+    *c = lead + 0xFF40;
+    ++*j;
+    return 1;
+  }
+
+  if (rest < 2) return -1;
+  trail = s[1];
+
+  switch (charset) {
+    case punycode_sjis:
+      if (lead - 0x81 < 0x1F) index = (long) (lead - 0x81) * 188;
+      else if (lead - 0xE0 < 0x1D) index = (long) (lead - 0xC1) * 188;
+      else return -1;
+
+      if (trail - 0x40 < 0x3F) index += trail - 0x40;
+      else if (trail - 0x80 < 0x7D) index += trail - 0x41;
+      else return -1;
+      break;
+
+    case punycode_euc_jp:
+      if (lead == 0x8E) {
+        if (trail - 0xA1 >= 0x3F) return -1;
+        *c = trail + 0xFEC0;
+        *j += 2;
+        return 1;
+      }
+
+      if (lead - 0xA1 >= 0x5E || trail - 0xA1 >= 0x5E) return -1;
+      index = (long) (lead - 0xA1) * 94 + (trail - 0xA1);
+      break;
+
+    default:
+      if (lead - 0x21 >= 0x5E || trail - 0x21 >= 0x5E) return -1;
+      index = (long) (lead - 0x21) * 94 + (trail - 0x21);
+  }
+
+  *c = jct[index];
+  *j += 2;
+  return 1;
+}
+
+/* decode() is punycode_jis_decode() if utf8 is null, and otherwise */
+/* punycode_jis_to_utf8() with utf8 for its output:                 */
+
+static enum punycode_status decode(
+  int charset,
+  size_t input_length,
+  const char input[],
+  size_t *output_length,
+  punycode_uint output[],
+  char utf8[] )
+{
+  const unsigned char *s = (const unsigned char *) input;
+  size_t j = 0, out = 0, max_out = *output_length, n;
+  int shift = shift_ascii, r;
+  punycode_uint c;
+
+  while (j < input_length) {
+    r = decode_char(charset, &shift, input_length, s, &j, &c);
+    if (r < 0) return punycode_bad_input;
+    if (r == 0) continue;
+
+    if (utf8 == 0) {
+      if (out == max_out) return punycode_big_output;
+      output[out++] = c;
+    }
+    else {
+      n = utf8_length(c);
+      if (max_out - out < n) return punycode_big_output;
+      put_utf8(c, utf8 + out);
+      out += n;
+    }
+  }
+
+  *output_length = out;
+  return punycode_success;
+}
+
+/*** Encoding ***/
+
+/* encode_char() writes code point c to output, which has room for */
+/* five bytes, preceded by any escape sequence it needs, and       */
+/* returns the number of bytes written.                            */
+
+static size_t encode_char(int charset, int *shift, punycode_uint c,
+                          char output[])
+{
+  size_t n = 0;
+  int want;
+  long index;
+
+  if (c < 0x80) want = shift_ascii;
+  else if (c - 0xFF61 < 0x3F) {
+    want = charset == punycode_jis7 ? shift_kana : shift_ascii;
+  }
+  else want = shift_kanji;
+
+  if (charset >= punycode_jis7 && want != *shift) {
+    memcpy(output, designate[want], 3);
+    *shift = want;
+    n = 3;
+  }
+
+  if (c < 0x80) {
+    output[n] = (char) c;
+    return n + 1;
+  }
+
+  if (want != shift_kanji) {
+    if (charset == punycode_euc_jp) output[n++] = (char) 0x8E;
+    output[n] = (char) (c - (want == shift_kana ? 0xFF40 : 0xFEC0));
+    return n + 1;
+  }
+
+  index = code_index(charset, c);
+  if (index < 0) index = middle_dot;
+
+  switch (charset) {
+    case punycode_sjis:
+      output[n] = (char) (index / 188 + (index < 31 * 188 ? 0x81 : 0xC1));
+      index %= 188;
+      output[n + 1] = (char) (index + (index < 63 ? 0x40 : 0x41));
+      break;
+
+    case punycode_euc_jp:
+      output[n] = (char) (index / 94 + 0xA1);
+      output[n + 1] = (char) (index % 94 + 0xA1);
+      break;
+
+    default:
+      output[n] = (char) (index / 94 + 0x21);
+      output[n + 1] = (char) (index % 94 + 0x21);
+  }
+
+  return n + 2;
+}
+
+/* encode() is punycode_jis_encode() if utf8 is null, and otherwise */
+/* punycode_jis_from_utf8() with utf8 for its input:                */
+
+static enum punycode_status encode(
+  int charset,
+  size_t input_length,
+  const punycode_uint input[],
+  const char utf8[],
+  size_t *output_length,
+  char output[] )
+{
+  const unsigned char *s = (const unsigned char *) utf8;
+  size_t j = 0, out = 0, max_out = *output_length, n;
+  int shift = shift_ascii;
+  char bytes[5];
+  long c;
+
+  while (j < input_length) {
+    if (utf8 == 0) c = (long) input[j++];
+    else if ((c = get_utf8(input_length, s, &j)) < 0) {
+      return punycode_bad_input;
+    }
+
+    n = encode_char(charset, &shift, (punycode_uint) c, bytes);
+    if (max_out - out < n) return punycode_big_output;
+    memcpy(output + out, bytes, n);
+    out += n;
+  }
+
+  if (shift != shift_ascii) {
+    if (max_out - out < 3) return punycode_big_output;
+    memcpy(output + out, designate[shift_ascii], 3);
+    out += 3;
+  }
+
+  *output_length = out;
+  return punycode_success;
+}
+
+/*** Entry points ***/
+
+enum punycode_status punycode_jis_decode(
+  int charset,
+  size_t input_length,
+  const char input[],
+  size_t *output_length,
+  punycode_uint output[] )
+{
+  return decode(charset, input_length, input, output_length, output, 0);
+}
+
+enum punycode_status punycode_jis_encode(
+  int charset,
+  size_t input_length,
+  const punycode_uint input[],
+  size_t *output_length,
+  char output[] )
+{
+  return encode(charset, input_length, input, 0, output_length, output);
+}
+
+enum punycode_status punycode_jis_to_utf8(
+  int charset,
+  size_t input_length,
+  const char input[],
+  size_t *output_length,
+  char output[] )
+{
+  return decode(charset, input_length, input, output_length, 0, output);
+}
+
+enum punycode_status punycode_jis_from_utf8(
+  int charset,
+  size_t input_length,
+  const char input[],
+  size_t *output_length,
+  char output[] )
+{
+  return encode(charset, input_length, 0, input, output_length, output);
+}
+
+enum punycode_status punycode_jis_to_ascii(
+  int charset,
+  size_t input_length,
+  const char input[],
+  size_t *label_count,
+  struct punycode_slice labels[],
+  size_t *scratch_length,
+  char scratch[] )
+{
+  size_t length = *scratch_length, rest;
+  enum punycode_status status;
+
+  status = decode(charset, input_length, input, &length, 0, scratch);
+  if (status != punycode_success) return status;
+
+  rest = *scratch_length - length;
+  status = punycode_to_ascii(length, scratch, label_count, labels, &rest,
+                             scratch + length);
+  if (status == punycode_success) *scratch_length = length + rest;
+  return status;
+}
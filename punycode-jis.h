@@ -0,0 +1,130 @@
+/*
+punycode-jis.h
+
+This is ANSI C code (C89) converting text between Unicode and the
+legacy Japanese encodings that ecl_array.js handles:  Shift_JIS,
+EUC-JP, and ISO-2022-JP in its 7-bit and 8-bit forms.  The character
+set is that of ecl_array.js, JCT11280, which is JIS X 0208 with the
+NEC and IBM extensions of Windows code page 932, so the conversions
+agree with its EscapeSJIS(), UnescapeSJIS() and the others, only in
+linear time:  each character is looked up directly in tables built
+into punycode-jis.c instead of being searched for in JCT11280.
+
+*/
+
+#ifndef PUNYCODE_JIS_H
+#define PUNYCODE_JIS_H
+
+#include "punycode-idna.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The encodings, as named by the charset object of ecl_array.js: */
+
+enum punycode_jis_charset {
+  punycode_sjis   = 0,  /* Shift_JIS (code page 932)              */
+  punycode_euc_jp = 1,  /* EUC-JP, without JIS X 0212             */
+  punycode_jis7   = 2,  /* ISO-2022-JP, half-width katakana after */
+                        /* ESC ( I                                */
+  punycode_jis8   = 3   /* likewise, with half-width katakana as  */
+                        /* bytes A1..DF among ASCII               */
+};
+
+enum punycode_status punycode_jis_decode(
+  int,                     /* charset       */
+  size_t,                  /* input_length  */
+  const char [],           /* input         */
+  size_t *,                /* output_length */
+  punycode_uint []         /* output        */
+);
+
+enum punycode_status punycode_jis_encode(
+  int,                     /* charset       */
+  size_t,                  /* input_length  */
+  const punycode_uint [],  /* input         */
+  size_t *,                /* output_length */
+  char []                  /* output        */
+);
+
+/*
+    punycode_jis_decode() converts input_length bytes of text in the
+    charset to code points, which can be passed straight to
+    punycode_encode(), and punycode_jis_encode() converts code points
+    back.  *output_length is as for punycode_encode():  the caller
+    passes in the size of the output, which receives the number of
+    code points or bytes used.  The output is not null-terminated.
+
+    Decoding maps half-width katakana to U+FF61..U+FF9F and double-byte
+    characters through JCT11280, where unassigned codes stand for
+    U+30FB, as in ecl_array.js.  In ISO-2022-JP, the escape sequences
+    ESC ( B and ESC ( J select ASCII, ESC ( I half-width katakana, and
+    ESC $ B and ESC $ @ JIS X 0208; bytes A1..DF are accepted as
+    half-width katakana in either form.
+
+    Encoding writes ASCII as is and a code point with no code in the
+    charset as U+30FB, again as ecl_array.js does, so it cannot fail
+    for lack of a mapping.  A code point found more than once in
+    JCT11280 gets its first code, except that Shift_JIS uses the IBM
+    extension rather than the NEC selection of it.  ISO-2022-JP output
+    switches to ASCII before it ends.
+
+    Return value:
+
+        punycode_bad_input if the input is not text in the charset:  a
+        byte that cannot begin a character, a double-byte character
+        cut short or with an invalid second byte, an unknown escape
+        sequence, or a JIS X 0212 character (which JCT11280 lacks).
+        punycode_big_output if the output is too small.  If not
+        punycode_success, the output might contain garbage.
+*/
+
+enum punycode_status punycode_jis_to_utf8(
+  int,                     /* charset       */
+  size_t,                  /* input_length  */
+  const char [],           /* input         */
+  size_t *,                /* output_length */
+  char []                  /* output        */
+);
+
+enum punycode_status punycode_jis_from_utf8(
+  int,                     /* charset       */
+  size_t,                  /* input_length  */
+  const char [],           /* input         */
+  size_t *,                /* output_length */
+  char []                  /* output        */
+);
+
+/*
+    These are punycode_jis_decode() and punycode_jis_encode() with
+    UTF-8 in place of code points.  The UTF-8 output is at most three
+    times as long as the input; punycode_jis_from_utf8() also returns
+    punycode_bad_input if its input is not well-formed UTF-8.
+*/
+
+enum punycode_status punycode_jis_to_ascii(
+  int,                     /* charset        */
+  size_t,                  /* input_length   */
+  const char [],           /* input          */
+  size_t *,                /* label_count    */
+  struct punycode_slice [],/* labels         */
+  size_t *,                /* scratch_length */
+  char []                  /* scratch        */
+);
+
+/*
+    punycode_jis_to_ascii() is punycode_to_ascii() (see
+    punycode-idna.h) for a host name in the charset.  The name is
+    converted to UTF-8 at the beginning of scratch and from there to
+    ACE, so every label points into scratch, which must hold up to
+    three times input_length chars more than punycode_to_ascii()
+    needs.  The ideographic and full-width full stops that legacy text
+    often has between labels are separators there too.
+*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PUNYCODE_JIS_H */
@@ -0,0 +1,86 @@
+/*
+punycode-lookup.h
+
+This is ANSI C code (C89) declaring the internal functions behind the
+cached conversions of punycode-batch.h and punycode-idna.h.  They are
+implemented in punycode-batch.c and punycode-idna.c, which reach the
+cache only through the function pointers of a punycode_lookup, so that
+the uncached conversions do not need punycode-cache.c.  The cached
+conversions, in punycode-cached.c, fill one in with the functions of
+punycode-cache.c.
+
+*/
+
+#ifndef PUNYCODE_LOOKUP_H
+#define PUNYCODE_LOOKUP_H
+
+#include "punycode-batch.h"
+#include "punycode-idna.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* A cache and punycode_cache_find() and punycode_cache_add() */
+/* (see punycode-cache.h) or functions behaving like them:    */
+
+struct punycode_lookup {
+  struct punycode_cache *cache;
+
+  int (*find)(struct punycode_cache *, int, size_t, const void *,
+              size_t *, void *);
+
+  void (*add)(struct punycode_cache *, int, size_t, const void *,
+              size_t, const void *);
+};
+
+size_t punycode_encode_batch_lookup(
+  const struct punycode_lookup *,/* lookup  */
+  size_t,                        /* count   */
+  const struct punycode_label [],/* inputs  */
+  struct punycode_arena *,       /* arena   */
+  size_t [],                     /* offsets */
+  enum punycode_status []        /* status  */
+);
+
+size_t punycode_decode_batch_lookup(
+  const struct punycode_lookup *,/* lookup  */
+  size_t,                        /* count   */
+  const struct punycode_ace [],  /* inputs  */
+  struct punycode_arena *,       /* arena   */
+  size_t [],                     /* offsets */
+  enum punycode_status []        /* status  */
+);
+
+enum punycode_status punycode_to_ascii_lookup(
+  const struct punycode_lookup *,/* lookup         */
+  size_t,                        /* input_length   */
+  const char [],                 /* input          */
+  size_t *,                      /* label_count    */
+  struct punycode_slice [],      /* labels         */
+  size_t *,                      /* scratch_length */
+  char []                        /* scratch        */
+);
+
+enum punycode_status punycode_to_unicode_lookup(
+  const struct punycode_lookup *,/* lookup         */
+  size_t,                        /* input_length   */
+  const char [],                 /* input          */
+  size_t *,                      /* label_count    */
+  struct punycode_slice [],      /* labels         */
+  size_t *,                      /* scratch_length */
+  char []                        /* scratch        */
+);
+
+/*
+    These are the cached conversions with the cache given by lookup,
+    which may be a null pointer for none.  Inputs are looked up with
+    lookup->find() and successful conversions added with
+    lookup->add(), under the kinds of enum punycode_cache_kind.
+*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PUNYCODE_LOOKUP_H */
@@ -0,0 +1,806 @@
+/*
+punycode-simd.c
+
+This is C code implementing the basic-code-point scanning kernels
+declared in punycode.h and the lane decoder declared in
+punycode-batch.h.  The portable versions are ANSI C (C89).  When
+compiled by GCC or Clang for x86, SSE2 and AVX2 versions are added
+and chosen at run time according to what the processor supports.
+
+*/
+
+#include <string.h>
+
+#include "punycode-batch.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) && \
+    (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__)))
+#define PUNYCODE_X86 1
+#include <immintrin.h>
+#endif
+
+enum { delimiter = 0x2D };
+
+/* digit(c) tests whether c is a Punycode digit (an ASCII letter */
+/* or decimal digit), the same set decode_digit() accepts:       */
+
+#define digit(c) \
+  ((unsigned char) ((c) | 0x20) - 97u < 26 || (unsigned char) (c) - 48u < 10)
+
+/*** Portable kernels ***/
+
+static size_t copy_basic_scalar(
+  size_t length, const punycode_uint input[], char output[] )
+{
+  size_t j;
+
+  for (j = 0;  j < length && input[j] < 0x80;  ++j) {
+    output[j] = (char) input[j];
+  }
+
+  return j;
+}
+
+static size_t last_delimiter_scalar(size_t length, const char input[])
+{
+  while (length > 0) {
+    if (input[--length] == delimiter) return length;
+  }
+
+  return 0;
+}
+
+static size_t valid_basic_scalar(size_t begin, size_t end,
+                                 const char input[])
+{
+  for (;  begin < end;  ++begin) {
+    if ((unsigned char) input[begin] >= 0x80) break;
+  }
+
+  return begin;
+}
+
+static size_t valid_digits_scalar(size_t begin, size_t end,
+                                  const char input[])
+{
+  for (;  begin < end;  ++begin) {
+    if (!digit(input[begin])) break;
+  }
+
+  return begin;
+}
+
+#ifdef PUNYCODE_X86
+
+/*** SSE2 kernels (always available on x86-64) ***/
+
+/* Sixteen code points are loaded at a time; if none of them has a */
+/* bit above bit 6 set they are narrowed to bytes with saturating  */
+/* packs, which cannot saturate since every value is below 0x80.   */
+
+static size_t copy_basic_sse2(
+  size_t length, const punycode_uint input[], char output[] )
+{
+  const __m128i high = _mm_set1_epi32(~0x7F), zero = _mm_setzero_si128();
+  __m128i a, b, c, d;
+  size_t j;
+
+  for (j = 0;  j + 16 <= length;  j += 16) {
+    a = _mm_loadu_si128((const __m128i *) (input + j));
+    b = _mm_loadu_si128((const __m128i *) (input + j + 4));
+    c = _mm_loadu_si128((const __m128i *) (input + j + 8));
+    d = _mm_loadu_si128((const __m128i *) (input + j + 12));
+    if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(
+          _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)), high),
+          zero)) != 0xFFFF) break;
+    _mm_storeu_si128((__m128i *) (output + j), _mm_packus_epi16(
+      _mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+  }
+
+  return j + copy_basic_scalar(length - j, input + j, output + j);
+}
+
+static size_t last_delimiter_sse2(size_t length, const char input[])
+{
+  const __m128i dash = _mm_set1_epi8(delimiter);
+  unsigned mask;
+
+  for (;  length >= 16;  length -= 16) {
+    mask = _mm_movemask_epi8(_mm_cmpeq_epi8(dash,
+             _mm_loadu_si128((const __m128i *) (input + length - 16))));
+    if (mask != 0) return length - 16 + 31 - __builtin_clz(mask);
+  }
+
+  return last_delimiter_scalar(length, input);
+}
+
+static size_t valid_basic_sse2(size_t begin, size_t end,
+                               const char input[])
+{
+  unsigned mask;
+
+  for (;  begin + 16 <= end;  begin += 16) {
+    mask = _mm_movemask_epi8(
+             _mm_loadu_si128((const __m128i *) (input + begin)));
+    if (mask != 0) return begin + __builtin_ctz(mask);
+  }
+
+  return valid_basic_scalar(begin, end, input);
+}
+
+/* A byte is a digit if, folded to lowercase, it lies in a..z, or */
+/* if it lies in 0..9.  Each range test shifts the range down to  */
+/* start at -128 so that one signed comparison checks both ends.  */
+
+static size_t valid_digits_sse2(size_t begin, size_t end,
+                                const char input[])
+{
+  const __m128i fold = _mm_set1_epi8(0x20),
+                to_letters = _mm_set1_epi8((char) (0x80 - 97)),
+                letters = _mm_set1_epi8(-128 + 26),
+                to_decimals = _mm_set1_epi8((char) (0x80 - 48)),
+                decimals = _mm_set1_epi8(-128 + 10);
+  __m128i v;
+  unsigned mask;
+
+  for (;  begin + 16 <= end;  begin += 16) {
+    v = _mm_loadu_si128((const __m128i *) (input + begin));
+    mask = ~_mm_movemask_epi8(_mm_or_si128(
+             _mm_cmplt_epi8(_mm_add_epi8(_mm_or_si128(v, fold), to_letters),
+                            letters),
+             _mm_cmplt_epi8(_mm_add_epi8(v, to_decimals), decimals)))
+           & 0xFFFF;
+    if (mask != 0) return begin + __builtin_ctz(mask);
+  }
+
+  return valid_digits_scalar(begin, end, input);
+}
+
+/*** AVX2 kernels ***/
+
+#define AVX2 __attribute__((target("avx2")))
+
+/* Each kernel finishes the last bytes with its SSE2 version, which */
+/* does not use the VEX encoding, so it first clears the upper      */
+/* halves of the registers; mixing the two with those halves in use  */
+/* costs a state transition on many processors.                     */
+
+/* The 256-bit packs work within 128-bit lanes, so the dwords of the */
+/* packed result come out in the order a0 b0 c0 d0 a1 b1 c1 d1 and  */
+/* are permuted back into a0 a1 b0 b1 c0 c1 d0 d1.                  */
+
+AVX2 static size_t copy_basic_avx2(
+  size_t length, const punycode_uint input[], char output[] )
+{
+  const __m256i high = _mm256_set1_epi32(~0x7F),
+                order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+  __m256i a, b, c, d;
+  size_t j;
+
+  for (j = 0;  j + 32 <= length;  j += 32) {
+    a = _mm256_loadu_si256((const __m256i *) (input + j));
+    b = _mm256_loadu_si256((const __m256i *) (input + j + 8));
+    c = _mm256_loadu_si256((const __m256i *) (input + j + 16));
+    d = _mm256_loadu_si256((const __m256i *) (input + j + 24));
+    if (!_mm256_testz_si256(_mm256_or_si256(_mm256_or_si256(a, b),
+                                            _mm256_or_si256(c, d)), high)) {
+      break;
+    }
+    _mm256_storeu_si256((__m256i *) (output + j),
+      _mm256_permutevar8x32_epi32(_mm256_packus_epi16(
+        _mm256_packs_epi32(a, b), _mm256_packs_epi32(c, d)), order));
+  }
+
+  _mm256_zeroupper();
+  return j + copy_basic_sse2(length - j, input + j, output + j);
+}
+
+AVX2 static size_t last_delimiter_avx2(size_t length, const char input[])
+{
+  const __m256i dash = _mm256_set1_epi8(delimiter);
+  unsigned mask;
+
+  for (;  length >= 32;  length -= 32) {
+    mask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(dash,
+             _mm256_loadu_si256((const __m256i *) (input + length - 32))));
+    if (mask != 0) return length - 32 + 31 - __builtin_clz(mask);
+  }
+
+  _mm256_zeroupper();
+  return last_delimiter_sse2(length, input);
+}
+
+AVX2 static size_t valid_basic_avx2(size_t begin, size_t end,
+                                    const char input[])
+{
+  unsigned mask;
+
+  for (;  begin + 32 <= end;  begin += 32) {
+    mask = _mm256_movemask_epi8(
+             _mm256_loadu_si256((const __m256i *) (input + begin)));
+    if (mask != 0) return begin + __builtin_ctz(mask);
+  }
+
+  _mm256_zeroupper();
+  return valid_basic_sse2(begin, end, input);
+}
+
+AVX2 static size_t valid_digits_avx2(size_t begin, size_t end,
+                                     const char input[])
+{
+  const __m256i fold = _mm256_set1_epi8(0x20),
+                to_letters = _mm256_set1_epi8((char) (0x80 - 97)),
+                letters = _mm256_set1_epi8(-128 + 26),
+                to_decimals = _mm256_set1_epi8((char) (0x80 - 48)),
+                decimals = _mm256_set1_epi8(-128 + 10);
+  __m256i v;
+  unsigned mask;
+
+  for (;  begin + 32 <= end;  begin += 32) {
+    v = _mm256_loadu_si256((const __m256i *) (input + begin));
+    mask = ~(unsigned) _mm256_movemask_epi8(_mm256_or_si256(
+             _mm256_cmpgt_epi8(letters, _mm256_add_epi8(
+               _mm256_or_si256(v, fold), to_letters)),
+             _mm256_cmpgt_epi8(decimals, _mm256_add_epi8(v, to_decimals))));
+    if (mask != 0) return begin + __builtin_ctz(mask);
+  }
+
+  _mm256_zeroupper();
+  return valid_digits_sse2(begin, end, input);
+}
+
+/*** AVX2 lane decoder ***/
+
+/* Each of eight lanes decodes one label, with the state variables */
+/* of punycode_decode() kept as eight 32-bit elements per vector,  */
+/* and all lanes take one digit per step.  A lane whose label is   */
+/* done or has failed gets the next label, so the lanes stay full. */
+/*                                                                 */
+/* The lanes share rings of lane_rows rows, indexed by step.  A    */
+/* lane that gets a label at step s writes the value of its j-th   */
+/* digit (or 0xFF for a non-digit) to its column of row s + j of   */
+/* digits, so that each step loads one row.  Rather than insert    */
+/* code points into the outputs, which would mean branching on     */
+/* which lanes finished a delta, each step stores in a row of      */
+/* places and values the code point every lane would insert and    */
+/* where, and in inserted which lanes did; these are played back   */
+/* into a lane's output once its label is done.  A step is a long  */
+/* chain of dependent operations, so two groups of lanes are       */
+/* stepped in turn to let the processor overlap them.              */
+/*                                                                 */
+/* Labels longer than lane_length are left to punycode_decode(),   */
+/* which keeps every value small enough for the divisions below to */
+/* be done exactly in doubles.                                     */
+
+enum {
+  lane_count = 8,
+  lane_groups = 2,
+  lane_length = 64,
+  lane_rows = 128        /* a power of two above lane_length */
+};
+
+struct lanes {
+  punycode_uint n[lane_count], i[lane_count], bias[lane_count],
+    oldi[lane_count], w[lane_count], k[lane_count], out[lane_count],
+    max_out[lane_count], basic[lane_count], start[lane_count],
+    end[lane_count];
+  punycode_uint places[lane_rows][lane_count],
+    values[lane_rows][lane_count];
+  unsigned char digits[lane_rows][lane_count], inserted[lane_rows];
+  punycode_uint *output[lane_count];
+  size_t label[lane_count];
+  punycode_uint step;
+  unsigned active;                 /* bit l is set if lane l is busy */
+};
+
+/* The arguments of punycode_decode_lanes(), and its progress: */
+
+struct lane_batch {
+  size_t count, next, failed;
+  const struct punycode_ace *inputs;
+  size_t max_output;
+  punycode_uint *output;
+  size_t *output_length;
+  enum punycode_status *status;
+};
+
+static void finish_label(struct lane_batch *batch, size_t label,
+                         size_t length, enum punycode_status status)
+{
+  batch->output_length[label] = status == punycode_success ? length : 0;
+  batch->status[label] = status;
+  if (status != punycode_success) ++batch->failed;
+}
+
+/* digit_values[c] is the value of c as a digit, or 0xFF if c */
+/* is not a digit:                                              */
+
+static const unsigned char digit_values[256] = {
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+   26, 27, 28, 29, 30, 31, 32, 33, 34, 35,255,255,255,255,255,255,
+  255,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,
+   15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,255,255,255,255,255,
+  255,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,
+   15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,
+  255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255
+};
+
+/* fill_lane() gives lane l the next label that needs decoding, */
+/* handling the basic code points as punycode_decode() does and */
+/* finishing labels that take no digits or are too long on the  */
+/* spot.  If there are no labels left, the lane goes idle.      */
+
+static void fill_lane(struct lanes *s, unsigned l, struct lane_batch *batch)
+{
+  const struct punycode_ace *ace;
+  punycode_uint *output;
+  size_t label, b, j, begin;
+  unsigned c;
+
+  while (batch->next < batch->count) {
+    label = batch->next++;
+    ace = &batch->inputs[label];
+    output = batch->output + label * batch->max_output;
+
+    if (ace->length > lane_length) {
+      b = batch->max_output;
+      finish_label(batch, label, b,
+                   punycode_decode(ace->length, ace->input, &b, output, 0));
+      continue;
+    }
+
+    for (b = ace->length;  b > 0 && ace->input[b - 1] != delimiter;  --b) {}
+    b -= b > 0;
+    begin = b > 0 ? b + 1 : 0;
+
+    if (b > batch->max_output) {
+      finish_label(batch, label, 0, punycode_big_output);
+      continue;
+    }
+
+    for (c = 0, j = 0;  j < b;  ++j) {
+      c |= (unsigned char) ace->input[j];
+      output[j] = (unsigned char) ace->input[j];
+    }
+
+    if (c >= 0x80) {
+      finish_label(batch, label, 0, punycode_bad_input);
+      continue;
+    }
+
+    if (begin == ace->length) {
+      finish_label(batch, label, b, punycode_success);
+      continue;
+    }
+
+    for (j = begin;  j < ace->length;  ++j) {
+      s->digits[(s->step + j - begin) % lane_rows][l] =
+        digit_values[(unsigned char) ace->input[j]];
+    }
+
+    s->n[l] = 0x80;
+    s->i[l] = s->oldi[l] = 0;
+    s->bias[l] = 72;
+    s->w[l] = 1;
+    s->k[l] = 36;
+    s->out[l] = s->basic[l] = (punycode_uint) b;
+    s->max_out[l] = batch->max_output > lane_length ?
+                    lane_length : (punycode_uint) batch->max_output;
+    s->start[l] = s->step;
+    s->end[l] = s->step + (punycode_uint) (ace->length - begin);
+    s->output[l] = output;
+    s->label[l] = label;
+    s->active |= 1u << l;
+    return;
+  }
+
+  s->n[l] = s->i[l] = s->oldi[l] = s->out[l] = s->max_out[l] = 0;
+  s->bias[l] = 72;
+  s->w[l] = 1;
+  s->k[l] = 36;
+  s->active &= ~(1u << l);
+}
+
+/* play_back() puts the code points decoded by lane l into its    */
+/* output.  Rather than shifting the output for each insertion, it */
+/* works out where each code point ends up:  an insertion at index */
+/* p moves everything at p or later one place to the right, so the */
+/* final index of a code point is where it was inserted (or, for a */
+/* basic code point, copied) plus one for each later insertion at  */
+/* or before its index at the time.                                */
+
+static void play_back(struct lanes *s, unsigned l)
+{
+  punycode_uint places[lane_length], values[lane_length], count = 0,
+    *output = s->output[l], r, row, e, f, j;
+
+  for (r = s->start[l];  r != s->end[l];  ++r) {
+    row = r % lane_rows;
+    places[count] = s->places[row][l];
+    values[count] = s->values[row][l];
+    count += s->inserted[row] >> l & 1;
+  }
+
+  for (e = s->basic[l];  e-- > 0;  ) {
+    for (j = e, f = 0;  f < count;  ++f) j += places[f] <= j;
+    output[j] = output[e];
+  }
+
+  for (e = 0;  e < count;  ++e) {
+    for (j = places[e], f = e + 1;  f < count;  ++f) j += places[f] <= j;
+    output[j] = values[e];
+  }
+}
+
+/* Unsigned 32-bit comparison and division, the latter through */
+/* doubles:  for a, b < 2**32 the rounded quotient a/b is never */
+/* pushed past the next integer, so its floor is exact.         */
+
+#define sign_bit() _mm256_set1_epi32(-0x7FFFFFFF - 1)
+
+#define ugt(a,b) _mm256_cmpgt_epi32(_mm256_xor_si256((a), sign_bit()), \
+                                    _mm256_xor_si256((b), sign_bit()))
+
+AVX2 static __m256d to_double(__m128i x)
+{
+  return _mm256_add_pd(_mm256_set1_pd(2147483648.0), _mm256_cvtepi32_pd(
+           _mm_xor_si128(x, _mm_set1_epi32(-0x7FFFFFFF - 1))));
+}
+
+AVX2 static __m128i from_double(__m256d x)
+{
+  return _mm_xor_si128(_mm_set1_epi32(-0x7FFFFFFF - 1), _mm256_cvttpd_epi32(
+           _mm256_sub_pd(x, _mm256_set1_pd(2147483648.0))));
+}
+
+AVX2 static __m256i divide(__m256i a, __m256i b)
+{
+  __m256d low = _mm256_floor_pd(_mm256_div_pd(
+                  to_double(_mm256_castsi256_si128(a)),
+                  to_double(_mm256_castsi256_si128(b)))),
+          high = _mm256_floor_pd(_mm256_div_pd(
+                   to_double(_mm256_extracti128_si256(a, 1)),
+                   to_double(_mm256_extracti128_si256(b, 1))));
+
+  return _mm256_inserti128_si256(_mm256_castsi128_si256(from_double(low)),
+                                 from_double(high), 1);
+}
+
+/* multiply(a,b,high) returns the low halves of the 64-bit products */
+/* a*b and sets *high to their high halves:                         */
+
+AVX2 static __m256i multiply(__m256i a, __m256i b, __m256i *high)
+{
+  __m256i even = _mm256_mul_epu32(a, b),
+          odd = _mm256_mul_epu32(_mm256_srli_epi64(a, 32),
+                                 _mm256_srli_epi64(b, 32));
+
+  *high = _mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0xAA);
+  return _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA);
+}
+
+#define load_lanes(a) _mm256_loadu_si256((const __m256i *) (a))
+#define store_lanes(a,v) _mm256_storeu_si256((__m256i *) (a), (v))
+#define choose(mask,a,b) _mm256_blendv_epi8((b), (a), (mask))
+#define bits(mask) \
+  ((unsigned) _mm256_movemask_ps(_mm256_castsi256_ps(mask)))
+
+/* adapt_half() is the rest of adapt() for four lanes, once delta  */
+/* has been damped.  With numpoints = np it computes                */
+/*                                                                  */
+/*   delta + delta / np = floor(x / np),  x = delta * (np + 1),     */
+/*                                                                  */
+/* and its loop divides that by base - tmin = 35 while it is above  */
+/* 455, that is, c times, where c counts the limits 456 * 35**j it  */
+/* is not below; floor(floor(x / np) / 35**c) = floor(x / (np *     */
+/* 35**c)), so one division is enough.  x stays below 2**39 since   */
+/* np is at most lane_length + 1, so every step is exact.           */
+
+AVX2 static __m128i adapt_half(__m128i delta, __m128i numpoints)
+{
+  static const double limits[5] =
+    { 456.0, 15960.0, 558600.0, 19551000.0, 684285000.0 };
+  __m256d np = _mm256_cvtepi32_pd(numpoints),
+          x = _mm256_mul_pd(to_double(delta),
+                            _mm256_add_pd(np, _mm256_set1_pd(1.0))),
+          divisor = np, k = _mm256_setzero_pd(), over;
+  int j;
+
+  for (j = 0;  j < 5;  ++j) {
+    over = _mm256_cmp_pd(x, _mm256_mul_pd(np, _mm256_set1_pd(limits[j])),
+                         _CMP_GE_OQ);
+    divisor = _mm256_blendv_pd(divisor, _mm256_mul_pd(divisor,
+                _mm256_set1_pd(35.0)), over);
+    k = _mm256_add_pd(k, _mm256_and_pd(over, _mm256_set1_pd(36.0)));
+  }
+
+  x = _mm256_floor_pd(_mm256_div_pd(x, divisor));
+  return _mm256_cvttpd_epi32(_mm256_add_pd(k, _mm256_floor_pd(
+           _mm256_div_pd(_mm256_mul_pd(x, _mm256_set1_pd(36.0)),
+                         _mm256_add_pd(x, _mm256_set1_pd(38.0))))));
+}
+
+/* adapt_lanes() is adapt() for every lane.  delta / damp is a      */
+/* multiplication by ceil(2**40 / 700), exact for 32-bit deltas.   */
+
+AVX2 static __m256i adapt_lanes(__m256i delta, __m256i numpoints,
+                                __m256i firsttime)
+{
+  const __m256i magic = _mm256_set1_epi32(0x5D9F7391);
+  __m256i damped;
+
+  damped = _mm256_blend_epi32(
+             _mm256_srli_epi64(_mm256_mul_epu32(delta, magic), 40),
+             _mm256_slli_epi64(_mm256_srli_epi64(_mm256_mul_epu32(
+               _mm256_srli_epi64(delta, 32), magic), 40), 32), 0xAA);
+  delta = choose(firsttime, damped, _mm256_srli_epi32(delta, 1));
+
+  return _mm256_inserti128_si256(_mm256_castsi128_si256(
+           adapt_half(_mm256_castsi256_si128(delta),
+                      _mm256_castsi256_si128(numpoints))),
+           adapt_half(_mm256_extracti128_si256(delta, 1),
+                      _mm256_extracti128_si256(numpoints, 1)), 1);
+}
+
+/* step_lanes() takes one digit in every busy lane of a group, */
+/* or else retires the lanes that have used up their digits:   */
+
+AVX2 static void step_lanes(struct lanes *s, struct lane_batch *batch)
+{
+  const __m256i one = _mm256_set1_epi32(1),
+                maxint = _mm256_set1_epi32(-1),
+                base = _mm256_set1_epi32(36),
+                lane_bits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+  __m256i live, n, i, bias, oldi, w, k, out, digit, t, high, product,
+          overflow, invalid, done, next, full, q, position, numpoints;
+  unsigned l, mask, row = s->step % lane_rows;
+
+  live = _mm256_cmpeq_epi32(lane_bits, _mm256_and_si256(lane_bits,
+           _mm256_set1_epi32((int) s->active)));
+
+  /* A lane that has used up its digits is done if they */
+  /* ended with a delta, and has failed otherwise:      */
+
+  mask = bits(_mm256_and_si256(live,
+           _mm256_cmpeq_epi32(_mm256_set1_epi32((int) s->step),
+                              load_lanes(s->end))));
+
+  if (mask != 0) {
+    for (l = 0;  l < lane_count;  ++l) {
+      if (!(mask >> l & 1)) continue;
+
+      if (s->k[l] == 36) {
+        play_back(s, l);
+        finish_label(batch, s->label[l], s->out[l], punycode_success);
+      }
+      else finish_label(batch, s->label[l], 0, punycode_bad_input);
+
+      fill_lane(s, l, batch);
+    }
+
+    return;
+  }
+
+  n = load_lanes(s->n);
+  i = load_lanes(s->i);
+  bias = load_lanes(s->bias);
+  oldi = load_lanes(s->oldi);
+  w = load_lanes(s->w);
+  k = load_lanes(s->k);
+  out = load_lanes(s->out);
+
+  /* Take the next digit: */
+
+  digit = _mm256_cvtepu8_epi32(
+            _mm_loadl_epi64((const __m128i *) s->digits[row]));
+  invalid = _mm256_cmpgt_epi32(digit, _mm256_set1_epi32(35));
+
+  product = multiply(digit, w, &high);
+  overflow = _mm256_or_si256(
+               _mm256_xor_si256(maxint, _mm256_cmpeq_epi32(high,
+                                          _mm256_setzero_si256())),
+               ugt(product, _mm256_sub_epi32(maxint, i)));
+  i = _mm256_add_epi32(i, product);
+
+  t = _mm256_max_epi32(one, _mm256_min_epi32(_mm256_set1_epi32(26),
+                                              _mm256_sub_epi32(k, bias)));
+  done = _mm256_cmpgt_epi32(t, digit);
+
+  product = multiply(w, _mm256_sub_epi32(base, t), &high);
+  overflow = _mm256_or_si256(overflow, _mm256_andnot_si256(done,
+               _mm256_xor_si256(maxint, _mm256_cmpeq_epi32(high,
+                                          _mm256_setzero_si256()))));
+  w = choose(done, one, product);
+  k = choose(done, base, _mm256_add_epi32(k, base));
+
+  /* Every lane works out the code point it would insert; those */
+  /* that finished a delta insert it, unless it overflows n or  */
+  /* the output is full:                                        */
+
+  numpoints = _mm256_add_epi32(out, one);
+  next = _mm256_andnot_si256(_mm256_or_si256(invalid, overflow),
+                             _mm256_and_si256(done, live));
+  bias = choose(next, adapt_lanes(_mm256_sub_epi32(i, oldi), numpoints,
+                                  _mm256_cmpeq_epi32(oldi,
+                                    _mm256_setzero_si256())), bias);
+  q = divide(i, numpoints);
+  overflow = _mm256_or_si256(overflow, _mm256_and_si256(next,
+               ugt(q, _mm256_sub_epi32(maxint, n))));
+  next = _mm256_andnot_si256(overflow, next);
+  full = _mm256_andnot_si256(ugt(load_lanes(s->max_out), out), next);
+  next = _mm256_andnot_si256(full, next);
+  n = choose(next, _mm256_add_epi32(n, q), n);
+  position = _mm256_sub_epi32(i, _mm256_mullo_epi32(q, numpoints));
+  i = choose(next, _mm256_add_epi32(position, one), i);
+  oldi = choose(next, i, oldi);
+
+  store_lanes(s->places[row], position);
+  store_lanes(s->values[row], n);
+  s->inserted[row] = (unsigned char) bits(next);
+  ++s->step;
+
+  store_lanes(s->n, n);
+  store_lanes(s->i, i);
+  store_lanes(s->bias, bias);
+  store_lanes(s->oldi, oldi);
+  store_lanes(s->w, w);
+  store_lanes(s->k, k);
+  store_lanes(s->out, _mm256_sub_epi32(out, next));
+
+  /* Retire the lanes that failed, with the status of the */
+  /* first check punycode_decode() would have failed:     */
+
+  invalid = _mm256_and_si256(invalid, live);
+  overflow = _mm256_andnot_si256(invalid, _mm256_and_si256(overflow, live));
+  mask = bits(_mm256_or_si256(_mm256_or_si256(invalid, overflow), full));
+
+  for (l = 0;  mask != 0;  ++l, mask >>= 1) {
+    if (!(mask & 1)) continue;
+    finish_label(batch, s->label[l], 0,
+                 bits(invalid) >> l & 1 ? punycode_bad_input :
+                 bits(overflow) >> l & 1 ? punycode_overflow :
+                 punycode_big_output);
+    fill_lane(s, l, batch);
+  }
+}
+
+AVX2 static void decode_lanes_avx2(struct lane_batch *batch)
+{
+  struct lanes s[lane_groups];
+  unsigned g, l, active;
+
+  for (g = 0;  g < lane_groups;  ++g) {
+    s[g].step = 0;
+    s[g].active = 0;
+    for (l = 0;  l < lane_count;  ++l) fill_lane(&s[g], l, batch);
+  }
+
+  do {
+    for (active = g = 0;  g < lane_groups;  ++g) {
+      step_lanes(&s[g], batch);
+      active |= s[g].active;
+    }
+  } while (active != 0);
+}
+
+#undef sign_bit
+#undef ugt
+#undef load_lanes
+#undef store_lanes
+#undef choose
+#undef bits
+
+#undef AVX2
+
+/* have_avx2() reads the feature flags that the compiler runtime */
+/* fills in at startup, so testing it on every call costs a load. */
+
+#define have_avx2() __builtin_cpu_supports("avx2")
+
+#endif /* PUNYCODE_X86 */
+
+/*** Dispatching entry points ***/
+
+size_t punycode_copy_basic(
+  size_t input_length,
+  const punycode_uint input[],
+  char output[] )
+{
+#ifdef PUNYCODE_X86
+  if (sizeof (punycode_uint) == 4) {
+    return have_avx2() ? copy_basic_avx2(input_length, input, output)
+                       : copy_basic_sse2(input_length, input, output);
+  }
+#endif
+  return copy_basic_scalar(input_length, input, output);
+}
+
+size_t punycode_basic_length(size_t input_length, const char input[])
+{
+#ifdef PUNYCODE_X86
+  return have_avx2() ? last_delimiter_avx2(input_length, input)
+                     : last_delimiter_sse2(input_length, input);
+#else
+  return last_delimiter_scalar(input_length, input);
+#endif
+}
+
+size_t punycode_scan_ace(
+  size_t input_length,
+  const char input[],
+  size_t *basic_length )
+{
+  size_t b, valid;
+
+#ifdef PUNYCODE_X86
+  if (have_avx2()) {
+    b = last_delimiter_avx2(input_length, input);
+    valid = valid_basic_avx2(0, b, input);
+    if (valid == b) {
+      valid = valid_digits_avx2(b > 0 ? b + 1 : 0, input_length, input);
+    }
+  }
+  else {
+    b = last_delimiter_sse2(input_length, input);
+    valid = valid_basic_sse2(0, b, input);
+    if (valid == b) {
+      valid = valid_digits_sse2(b > 0 ? b + 1 : 0, input_length, input);
+    }
+  }
+#else
+  b = last_delimiter_scalar(input_length, input);
+  valid = valid_basic_scalar(0, b, input);
+  if (valid == b) {
+    valid = valid_digits_scalar(b > 0 ? b + 1 : 0, input_length, input);
+  }
+#endif
+
+  *basic_length = b;
+  return valid;
+}
+
+size_t punycode_decode_lanes(
+  size_t count,
+  const struct punycode_ace inputs[],
+  size_t max_output,
+  punycode_uint output[],
+  size_t output_length[],
+  enum punycode_status status[] )
+{
+  size_t k, length, failed = 0;
+
+#ifdef PUNYCODE_X86
+  if (sizeof (punycode_uint) == 4 && have_avx2()) {
+    struct lane_batch batch;
+
+    batch.count = count;
+    batch.next = batch.failed = 0;
+    batch.inputs = inputs;
+    batch.max_output = max_output;
+    batch.output = output;
+    batch.output_length = output_length;
+    batch.status = status;
+    decode_lanes_avx2(&batch);
+    return batch.failed;
+  }
+#endif
+
+  for (k = 0;  k < count;  ++k) {
+    length = max_output;
+    status[k] = punycode_decode(inputs[k].length, inputs[k].input, &length,
+                                output + k * max_output, 0);
+    output_length[k] = status[k] == punycode_success ? length : 0;
+    if (status[k] != punycode_success) ++failed;
+  }
+
+  return failed;
+}
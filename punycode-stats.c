@@ -0,0 +1,281 @@
+/*
+punycode-stats.c
+
+This is C code implementing the instrumentation declared in
+punycode-stats.h.  Without PUNYCODE_STATS it is ANSI C (C89) and only
+provides all-zero snapshots; with it, it needs C11.
+
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "punycode-stats.h"
+
+/* The counters are handled as an array of words, in the order of */
+/* the fields of struct punycode_stats:                           */
+
+enum {
+  counter_words = sizeof (struct punycode_stats_counters) /
+                  sizeof (unsigned long),
+  stats_words = punycode_stats_operations * counter_words
+};
+
+#define word(op,field) ((op) * counter_words + \
+  offsetof(struct punycode_stats_counters, field) / sizeof (unsigned long))
+
+#ifdef PUNYCODE_STATS
+
+#include <stdatomic.h>
+#include <stdlib.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <x86intrin.h>
+#define PUNYCODE_TSC 1
+#endif
+
+/* Every thread has a block of counters, allocated on its first    */
+/* instrumented call and pushed onto a list that snapshots walk.   */
+/* Only the owning thread writes a block, with relaxed loads and   */
+/* stores rather than read-modify-write operations, so that counts */
+/* cost about what plain increments do; the atomics only make the  */
+/* concurrent reads by snapshots well defined.  Blocks are never   */
+/* freed, so the counts of exited threads are kept.                */
+
+struct block {
+  atomic_ulong words[stats_words];
+  struct block *next;
+};
+
+static _Atomic(struct block *) blocks;
+static _Thread_local struct block *mine;
+
+static struct block *local_block(void)
+{
+  struct block *b = mine;
+  unsigned j;
+
+  if (b != 0) return b;
+
+  b = malloc(sizeof *b);
+  if (b == 0) return 0;
+  for (j = 0;  j < stats_words;  ++j) atomic_init(&b->words[j], 0);
+
+  b->next = atomic_load_explicit(&blocks, memory_order_relaxed);
+  while (!atomic_compare_exchange_weak_explicit(&blocks, &b->next, b,
+           memory_order_release, memory_order_relaxed)) {}
+
+  return mine = b;
+}
+
+static void bump(struct block *b, size_t w, unsigned long n)
+{
+  atomic_store_explicit(&b->words[w],
+    atomic_load_explicit(&b->words[w], memory_order_relaxed) + n,
+    memory_order_relaxed);
+}
+
+unsigned long punycode_stats_ticks(void)
+{
+#ifdef PUNYCODE_TSC
+  return (unsigned long) __rdtsc();
+#else
+  return (unsigned long) clock();
+#endif
+}
+
+void punycode_stats_start(struct punycode_stats_call *call, int operation,
+                          size_t input_length)
+{
+  call->operation = operation;
+  call->input_length = input_length;
+  call->output_length = 0;
+  call->scan_ticks = call->insert_ticks = call->moved = 0;
+  call->start = punycode_stats_ticks();
+}
+
+enum punycode_status punycode_stats_finish(struct punycode_stats_call *call,
+                                           enum punycode_status status)
+{
+  unsigned long ticks = punycode_stats_ticks() - call->start;
+  struct block *b = local_block();
+  int op = call->operation;
+  size_t length = call->input_length;
+  unsigned bucket = 0;
+
+  if (b == 0) return status;
+
+  while (length > 0 && bucket < punycode_stats_length_buckets - 1) {
+    length >>= 1;
+    ++bucket;
+  }
+
+  bump(b, word(op, calls), 1);
+  bump(b, word(op, status) + status, 1);
+  bump(b, word(op, input_units), call->input_length);
+  if (status == punycode_success) {
+    bump(b, word(op, output_units), call->output_length);
+  }
+  bump(b, word(op, lengths) + bucket, 1);
+  bump(b, word(op, ticks), ticks);
+  bump(b, word(op, scan_ticks), call->scan_ticks);
+  bump(b, word(op, insert_ticks), call->insert_ticks);
+  bump(b, word(op, moved), call->moved);
+
+  return status;
+}
+
+#endif /* PUNYCODE_STATS */
+
+void punycode_stats_snapshot(struct punycode_stats *stats)
+{
+  unsigned long sum[stats_words];
+#ifdef PUNYCODE_STATS
+  struct block *b;
+#endif
+  unsigned j;
+
+  for (j = 0;  j < stats_words;  ++j) sum[j] = 0;
+
+#ifdef PUNYCODE_STATS
+  b = atomic_load_explicit(&blocks, memory_order_acquire);
+
+  for (;  b != 0;  b = b->next) {
+    for (j = 0;  j < stats_words;  ++j) {
+      sum[j] += atomic_load_explicit(&b->words[j], memory_order_relaxed);
+    }
+  }
+#endif
+
+  memcpy(stats, sum, sizeof *stats);
+}
+
+/*** Export ***/
+
+static const char *const operation_names[punycode_stats_operations] = {
+  "encode", "decode", "encode_utf8", "decode_utf8", "encode_utf16",
+  "decode_utf16"
+};
+
+static const char *const status_names[punycode_stats_statuses] = {
+  "success", "bad_input", "big_output", "overflow"
+};
+
+/* A metric that is one counter per operation: */
+
+struct metric {
+  const char *name, *help;
+  size_t offset;
+};
+
+static const struct metric metrics[] = {
+  { "punycode_calls_total", "Calls of each function.",
+    offsetof(struct punycode_stats_counters, calls) },
+  { "punycode_input_units_total",
+    "Code points, chars, bytes or UTF-16 units passed in.",
+    offsetof(struct punycode_stats_counters, input_units) },
+  { "punycode_output_units_total",
+    "Code points, chars, bytes or UTF-16 units returned by successful "
+    "calls.",
+    offsetof(struct punycode_stats_counters, output_units) },
+  { "punycode_ticks_total", "Ticks spent in each function.",
+    offsetof(struct punycode_stats_counters, ticks) },
+  { "punycode_scan_ticks_total",
+    "Ticks the encoders spent finding the next code point.",
+    offsetof(struct punycode_stats_counters, scan_ticks) },
+  { "punycode_insert_ticks_total",
+    "Ticks the decoders spent inserting code points.",
+    offsetof(struct punycode_stats_counters, insert_ticks) },
+  { "punycode_moved_units_total",
+    "Units the decoders moved to make room for insertions.",
+    offsetof(struct punycode_stats_counters, moved) }
+};
+
+/* put() appends a line to the output, failing if it does not fit: */
+
+static int put(const char line[], size_t *out, size_t max_out,
+               char output[])
+{
+  size_t length = strlen(line);
+
+  if (length > max_out - *out) return 0;
+  memcpy(output + *out, line, length);
+  *out += length;
+  return 1;
+}
+
+enum punycode_status punycode_stats_export(
+  const struct punycode_stats *stats,
+  size_t *output_length,
+  char output[] )
+{
+  const struct punycode_stats_counters *c;
+  char line[192];
+  size_t out = 0, max_out = *output_length, m;
+  unsigned long value, cumulative;
+  unsigned op, j;
+
+#define emit(line) \
+  if (!put(line, &out, max_out, output)) return punycode_big_output
+
+  for (m = 0;  m < sizeof metrics / sizeof *metrics;  ++m) {
+    sprintf(line, "# HELP %s %s\n", metrics[m].name, metrics[m].help);
+    emit(line);
+    sprintf(line, "# TYPE %s counter\n", metrics[m].name);
+    emit(line);
+
+    for (op = 0;  op < punycode_stats_operations;  ++op) {
+      memcpy(&value, (const char *) &stats->operation[op] + metrics[m].offset,
+             sizeof value);
+      sprintf(line, "%s{operation=\"%s\"} %lu\n", metrics[m].name,
+              operation_names[op], value);
+      emit(line);
+    }
+  }
+
+  emit("# HELP punycode_status_total Calls by returned status.\n");
+  emit("# TYPE punycode_status_total counter\n");
+
+  for (op = 0;  op < punycode_stats_operations;  ++op) {
+    for (j = 0;  j < punycode_stats_statuses;  ++j) {
+      sprintf(line, "punycode_status_total{operation=\"%s\",status=\"%s\"} "
+              "%lu\n", operation_names[op], status_names[j],
+              stats->operation[op].status[j]);
+      emit(line);
+    }
+  }
+
+  emit("# HELP punycode_input_length Input length of each call.\n");
+  emit("# TYPE punycode_input_length histogram\n");
+
+  for (op = 0;  op < punycode_stats_operations;  ++op) {
+    c = &stats->operation[op];
+
+    for (cumulative = 0, j = 0;  j < punycode_stats_length_buckets;  ++j) {
+      cumulative += c->lengths[j];
+      if (j + 1 < punycode_stats_length_buckets) {
+        sprintf(line, "punycode_input_length_bucket{operation=\"%s\","
+                "le=\"%lu\"} %lu\n", operation_names[op],
+                (1UL << j) - 1, cumulative);
+      }
+      else {
+        sprintf(line, "punycode_input_length_bucket{operation=\"%s\","
+                "le=\"+Inf\"} %lu\n", operation_names[op], cumulative);
+      }
+      emit(line);
+    }
+
+    sprintf(line, "punycode_input_length_sum{operation=\"%s\"} %lu\n",
+            operation_names[op], c->input_units);
+    emit(line);
+    sprintf(line, "punycode_input_length_count{operation=\"%s\"} %lu\n",
+            operation_names[op], c->calls);
+    emit(line);
+  }
+
+#undef emit
+
+  *output_length = out;
+  return punycode_success;
+}
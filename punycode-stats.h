@@ -0,0 +1,127 @@
+/*
+punycode-stats.h
+
+This is ANSI C code (C89) declaring the optional instrumentation of
+punycode.c:  counters of calls, outcomes, input lengths and where the
+time goes, kept per thread and added up on demand.  It is compiled in
+only when PUNYCODE_STATS is defined for punycode.c and
+punycode-stats.c; otherwise punycode.c contains no trace of it and
+snapshots are all zero.  With PUNYCODE_STATS, punycode-stats.c needs a
+C11 compiler (it uses <stdatomic.h> and _Thread_local).
+
+*/
+
+#ifndef PUNYCODE_STATS_H
+#define PUNYCODE_STATS_H
+
+#include <stddef.h>
+
+#include "punycode.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The instrumented functions: */
+
+enum punycode_stats_operation {
+  punycode_stats_encode       = 0,  /* punycode_encode()       */
+  punycode_stats_decode       = 1,  /* punycode_decode()       */
+  punycode_stats_encode_utf8  = 2,  /* punycode_encode_utf8()  */
+  punycode_stats_decode_utf8  = 3,  /* punycode_decode_utf8()  */
+  punycode_stats_encode_utf16 = 4,  /* punycode_encode_utf16() */
+  punycode_stats_decode_utf16 = 5,  /* punycode_decode_utf16() */
+  punycode_stats_operations   = 6
+};
+
+enum {
+  punycode_stats_statuses = 4,      /* one per punycode_status */
+  punycode_stats_length_buckets = 16
+};
+
+/* The counters of one function.  Input and output are counted in  */
+/* the units of its arguments:  code points, chars, UTF-8 bytes, or */
+/* UTF-16 code units.                                               */
+/* Calls are counted into lengths[] by the bit length of their      */
+/* input length:  bucket 0 holds empty inputs, bucket k inputs of   */
+/* 2**(k-1) to 2**k - 1 units, and the last bucket everything from  */
+/* 2**14 up.  Ticks are those of the processor's time stamp counter */
+/* where there is one, otherwise of clock().                        */
+
+struct punycode_stats_counters {
+  unsigned long calls;
+  unsigned long status[punycode_stats_statuses];
+  unsigned long input_units;
+  unsigned long output_units;       /* of successful calls only      */
+  unsigned long lengths[punycode_stats_length_buckets];
+  unsigned long ticks;              /* in the function altogether    */
+  unsigned long scan_ticks;         /* encoders:  finding the next   */
+                                    /* code point to encode; the     */
+                                    /* rest is counting and emitting */
+  unsigned long insert_ticks;       /* decoders:  inserting decoded  */
+                                    /* code points into the output   */
+  unsigned long moved;              /* decoders:  units moved by     */
+                                    /* those insertions              */
+};
+
+struct punycode_stats {
+  struct punycode_stats_counters operation[punycode_stats_operations];
+};
+
+void punycode_stats_snapshot(struct punycode_stats *);
+
+/*
+    punycode_stats_snapshot() adds up the counters of every thread that
+    has called an instrumented function, including threads that have
+    since exited.  Each thread only ever writes its own counters, so
+    counting never contends; a snapshot taken while other threads are
+    converting is consistent per counter but not across counters.  The
+    counters wrap around if they exceed ULONG_MAX, so a scraper should
+    look at differences between snapshots.
+*/
+
+enum punycode_status punycode_stats_export(
+  const struct punycode_stats *,   /* stats         */
+  size_t *,                        /* output_length */
+  char []                          /* output        */
+);
+
+/*
+    punycode_stats_export() writes a snapshot as text in the Prometheus
+    exposition format, with the operation as a label and the input
+    lengths as a histogram.  The caller passes in the size of the
+    output in *output_length, which receives the number of chars used;
+    the output is not null-terminated.  Returns punycode_big_output if
+    the output is too small; 16384 chars is always enough.
+*/
+
+/* The hooks called by punycode.c when built with PUNYCODE_STATS: */
+
+struct punycode_stats_call {
+  int operation;
+  size_t input_length, output_length;
+  unsigned long start, scan_ticks, insert_ticks, moved;
+};
+
+unsigned long punycode_stats_ticks(void);
+
+void punycode_stats_start(struct punycode_stats_call *, int operation,
+                          size_t input_length);
+
+enum punycode_status punycode_stats_finish(struct punycode_stats_call *,
+                                           enum punycode_status);
+
+/*
+    An instrumented function calls punycode_stats_start() on entry and
+    returns through punycode_stats_finish(), which adds the call to the
+    calling thread's counters and returns the status it is given.  In
+    between, the function subtracts punycode_stats_ticks() from
+    scan_ticks or insert_ticks when a phase begins and adds it back
+    when the phase ends, and sets output_length before succeeding.
+*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PUNYCODE_STATS_H */
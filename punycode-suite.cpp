@@ -0,0 +1,647 @@
+/*
+punycode-suite.cpp
+
+This is C++17 code timing every encoder and decoder in this package
+(those of punycode.c, punycode-batch.c and punycode-simd.c, and the
+Punycode, Base64 and Base85 codecs of bootstring.hpp) on generated
+corpora:  all-ASCII, Latin with diacritics, CJK, and emoji, cut into
+labels of 1, 4, 16 and 63 code points and into long blobs.  For each
+engine and workload it reports the time per label, the throughput in
+megabytes of UTF-8 text per second, and the calls to malloc() per
+label, and it can save the results as JSON and compare them with a
+previous run, so that a build that got slower is caught.
+
+punycode-bench.c and bootstring-bench.cpp remain for the narrower
+questions they answer (crossover points and the bias tables).
+
+Build the C files with a C compiler and link them in, for example:
+
+    cc -O2 -c punycode.c punycode-simd.c punycode-batch.c
+    c++ -std=c++17 -O2 -o punycode-suite punycode-suite.cpp \
+        punycode.o punycode-simd.o punycode-batch.o
+
+Allocations are counted by wrapping malloc() and its relatives, which
+is only done with the GNU C library; elsewhere they are reported as
+unknown.
+
+*/
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "bootstring.hpp"
+#include "punycode.h"
+#include "punycode-batch.h"
+
+/*** Allocation counting ***/
+
+namespace {
+
+unsigned long allocations;
+bool counting_allocations;
+
+} /* namespace */
+
+#ifdef __GLIBC__
+
+extern "C" {
+
+void *__libc_malloc(std::size_t);
+void *__libc_calloc(std::size_t, std::size_t);
+void *__libc_realloc(void *, std::size_t);
+
+void *malloc(std::size_t size) __THROW
+{
+  ++allocations;
+  return __libc_malloc(size);
+}
+
+void *calloc(std::size_t count, std::size_t size) __THROW
+{
+  ++allocations;
+  return __libc_calloc(count, size);
+}
+
+void *realloc(void *p, std::size_t size) __THROW
+{
+  ++allocations;
+  return __libc_realloc(p, size);
+}
+
+} /* extern "C" */
+
+namespace {
+
+struct enable_counting {
+  enable_counting() { counting_allocations = true; }
+} enabled;
+
+} /* namespace */
+
+#endif /* __GLIBC__ */
+
+namespace {
+
+/*** Corpora ***/
+
+enum {
+  total_length = 1 << 14,     /* code points per workload         */
+  blob_length = 1 << 12,      /* code points in a blob            */
+  max_ace_length = 8 * total_length
+};
+
+/* The corpora are those of punycode-bench.c: */
+
+struct corpus {
+  const char *name;
+  unsigned basic_percent;     /* share of ASCII letters           */
+  punycode_uint first, count; /* range of non-basic code points   */
+};
+
+const corpus corpora[] = {
+  { "ascii", 100, 0x80, 1 },
+  { "latin", 80, 0xC0, 0xC0 },
+  { "cjk", 10, 0x4E00, 0x5200 },
+  { "emoji", 20, 0x1F300, 0x300 }
+};
+
+const std::size_t label_lengths[] = { 1, 4, 16, 63, blob_length };
+
+unsigned long seed = 1;
+
+unsigned long next_random()
+{
+  seed = (seed * 1103515245UL + 12345UL) & 0xFFFFFFFFUL;
+  return seed >> 8;
+}
+
+std::size_t utf8_length(punycode_uint c)
+{
+  return c < 0x80 ? 1 : c < 0x800 ? 2 : c < 0x10000 ? 3 : 4;
+}
+
+/* A parameter set, with its codec from bootstring.hpp: */
+
+typedef enum punycode_status (*bootstring_encoder)(
+  std::size_t, const punycode_uint [], const unsigned char [],
+  std::size_t *, char []);
+
+typedef enum punycode_status (*bootstring_decoder)(
+  std::size_t, const char [], std::size_t *, punycode_uint [],
+  unsigned char []);
+
+struct parameter_set {
+  const char *name;
+  bootstring_encoder encode;
+  bootstring_decoder decode;
+};
+
+const parameter_set parameter_sets[] = {
+  { "punycode", bootstring::punycode::encode, bootstring::punycode::decode },
+  { "base64", bootstring::base64::encode, bootstring::base64::decode },
+  { "base85", bootstring::base85::encode, bootstring::base85::decode }
+};
+
+enum { parameter_set_count = sizeof parameter_sets / sizeof *parameter_sets };
+
+/* A workload is total_length code points of one corpus cut into */
+/* labels of one length, with their encodings under each         */
+/* parameter set and the inputs of the batch functions.          */
+
+struct encoded {
+  std::string ace;
+  std::vector<std::size_t> offsets;   /* label k is offsets[k..k+1] */
+  std::vector<punycode_ace> aces;     /* for the batch functions    */
+};
+
+struct workload {
+  const corpus *c;
+  std::size_t length;
+  std::vector<punycode_uint> input;
+  std::vector<std::size_t> offsets;   /* label k is offsets[k..k+1] */
+  std::vector<punycode_label> labels; /* for the batch functions    */
+  std::size_t utf8_bytes;
+  encoded ace[parameter_set_count];
+
+  std::size_t count() const { return labels.size(); }
+};
+
+void generate(workload &w, const corpus &c, std::size_t length)
+{
+  std::size_t j, k, ace_length;
+  std::vector<char> ace(max_ace_length);
+
+  w.c = &c;
+  w.length = length;
+  w.input.resize(total_length);
+  w.utf8_bytes = 0;
+
+  for (j = 0;  j < total_length;  ++j) {
+    w.input[j] = next_random() % 100 < c.basic_percent ?
+                 'a' + next_random() % 26 :
+                 c.first + next_random() % c.count;
+    w.utf8_bytes += utf8_length(w.input[j]);
+  }
+
+  for (j = 0;  j < total_length;  j += length) w.offsets.push_back(j);
+  w.offsets.push_back(total_length);
+
+  for (k = 0;  k + 1 < w.offsets.size();  ++k) {
+    punycode_label label;
+    label.length = w.offsets[k + 1] - w.offsets[k];
+    label.input = &w.input[w.offsets[k]];
+    label.case_flags = 0;
+    w.labels.push_back(label);
+  }
+
+  for (j = 0;  j < parameter_set_count;  ++j) {
+    encoded &e = w.ace[j];
+
+    for (k = 0;  k < w.count();  ++k) {
+      ace_length = max_ace_length;
+      e.offsets.push_back(e.ace.size());
+      if (parameter_sets[j].encode(w.labels[k].length, w.labels[k].input, 0,
+                                   &ace_length, &ace[0])
+          != punycode_success) {
+        std::fputs("encoding a workload failed\n", stderr);
+        std::exit(EXIT_FAILURE);
+      }
+      e.ace.append(&ace[0], ace_length);
+    }
+
+    e.offsets.push_back(e.ace.size());
+
+    for (k = 0;  k < w.count();  ++k) {
+      punycode_ace a;
+      a.length = e.offsets[k + 1] - e.offsets[k];
+      a.input = e.ace.data() + e.offsets[k];
+      e.aces.push_back(a);
+    }
+  }
+}
+
+/*** Engines ***/
+
+/* An engine converts a whole workload, returning false if any   */
+/* label fails.  The scratch space is big enough for any output, */
+/* including the rows of punycode_decode_lanes(), which round    */
+/* the last label up to a whole row.                             */
+
+struct scratch {
+  std::vector<char> ace;
+  std::vector<punycode_uint> code_points;
+  std::vector<std::size_t> offsets, lengths;
+  std::vector<punycode_status> status;
+
+  scratch() : ace(max_ace_length), code_points(2 * total_length),
+              offsets(total_length + 1), lengths(total_length),
+              status(total_length) {}
+};
+
+typedef bool (*engine_function)(const workload &, scratch &);
+
+template <enum punycode_status (*F)(std::size_t, const punycode_uint [],
+                                    const unsigned char [], std::size_t *,
+                                    char [])>
+bool encode_labels(const workload &w, scratch &s)
+{
+  std::size_t k, length;
+
+  for (k = 0;  k < w.count();  ++k) {
+    length = max_ace_length;
+    if (F(w.labels[k].length, w.labels[k].input, 0, &length, &s.ace[0])
+        != punycode_success) return false;
+  }
+
+  return true;
+}
+
+template <enum punycode_status (*F)(std::size_t, const char [],
+                                    std::size_t *, punycode_uint [],
+                                    unsigned char [])>
+bool decode_labels(const workload &w, scratch &s)
+{
+  const encoded &e = w.ace[0];
+  std::size_t k, length;
+
+  for (k = 0;  k < w.count();  ++k) {
+    length = total_length;
+    if (F(e.aces[k].length, e.aces[k].input, &length, &s.code_points[0], 0)
+        != punycode_success) return false;
+  }
+
+  return true;
+}
+
+bool encode_wide(const workload &w, scratch &s)
+{
+  std::size_t k, length;
+
+  for (k = 0;  k < w.count();  ++k) {
+    length = max_ace_length;
+    if (punycode_encode_wide(w.labels[k].length, w.labels[k].input,
+                             &length, &s.ace[0]) != punycode_success) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool decode_wide(const workload &w, scratch &s)
+{
+  const encoded &e = w.ace[0];
+  std::size_t k, length;
+
+  for (k = 0;  k < w.count();  ++k) {
+    length = total_length;
+    if (punycode_decode_wide(e.aces[k].length, e.aces[k].input, &length,
+                             &s.code_points[0]) != punycode_success) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+/* The batch engines use a caller-provided arena, so that what is */
+/* timed is the conversion rather than the growing of the arena:  */
+
+bool encode_batch(const workload &w, scratch &s)
+{
+  punycode_arena arena = { &s.ace[0], 0, 0, max_ace_length, 0 };
+
+  return punycode_encode_batch(w.count(), w.labels.data(), &arena,
+                               &s.offsets[0], &s.status[0]) == 0;
+}
+
+bool decode_batch(const workload &w, scratch &s)
+{
+  punycode_arena arena = { &s.code_points[0], 0, 0, total_length, 0 };
+
+  return punycode_decode_batch(w.count(), w.ace[0].aces.data(), &arena,
+                               &s.offsets[0], &s.status[0]) == 0;
+}
+
+bool decode_lanes(const workload &w, scratch &s)
+{
+  return punycode_decode_lanes(w.count(), w.ace[0].aces.data(), w.length,
+                               &s.code_points[0], &s.lengths[0],
+                               &s.status[0]) == 0;
+}
+
+template <std::size_t P>
+bool encode_bootstring(const workload &w, scratch &s)
+{
+  std::size_t k, length;
+
+  for (k = 0;  k < w.count();  ++k) {
+    length = max_ace_length;
+    if (parameter_sets[P].encode(w.labels[k].length, w.labels[k].input, 0,
+                                 &length, &s.ace[0]) != punycode_success) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+template <std::size_t P>
+bool decode_bootstring(const workload &w, scratch &s)
+{
+  const encoded &e = w.ace[P];
+  std::size_t k, length;
+
+  for (k = 0;  k < w.count();  ++k) {
+    length = total_length;
+    if (parameter_sets[P].decode(e.aces[k].length, e.aces[k].input,
+                                 &length, &s.code_points[0], 0)
+        != punycode_success) return false;
+  }
+
+  return true;
+}
+
+struct engine {
+  const char *name;
+  const char *direction;
+  const char *params;
+  engine_function run;
+};
+
+const engine engines[] = {
+  { "punycode_encode", "encode", "punycode",
+    encode_labels<punycode_encode> },
+  { "punycode_encode_sorted", "encode", "punycode",
+    encode_labels<punycode_encode_sorted> },
+  { "punycode_encode_wide", "encode", "punycode", encode_wide },
+  { "punycode_encode_batch", "encode", "punycode", encode_batch },
+  { "bootstring::punycode", "encode", "punycode", encode_bootstring<0> },
+  { "bootstring::base64", "encode", "base64", encode_bootstring<1> },
+  { "bootstring::base85", "encode", "base85", encode_bootstring<2> },
+  { "punycode_decode", "decode", "punycode",
+    decode_labels<punycode_decode> },
+  { "punycode_decode_deferred", "decode", "punycode",
+    decode_labels<punycode_decode_deferred> },
+  { "punycode_decode_wide", "decode", "punycode", decode_wide },
+  { "punycode_decode_batch", "decode", "punycode", decode_batch },
+  { "punycode_decode_lanes", "decode", "punycode", decode_lanes },
+  { "bootstring::punycode", "decode", "punycode", decode_bootstring<0> },
+  { "bootstring::base64", "decode", "base64", decode_bootstring<1> },
+  { "bootstring::base85", "decode", "base85", decode_bootstring<2> }
+};
+
+/*** Timing ***/
+
+struct result {
+  std::string engine, direction, params, corpus;
+  std::size_t length, labels;
+  double ns_per_label, mb_per_s;
+  double allocations_per_label;       /* negative if unknown */
+};
+
+double min_seconds = 0.1;
+
+/* measure() runs an engine once untimed, counting allocations, */
+/* then repeatedly for at least min_seconds.  It returns false  */
+/* if the engine fails on the workload.                         */
+
+bool measure(const engine &e, const workload &w, scratch &s, result &r)
+{
+  typedef std::chrono::steady_clock clock;
+  clock::time_point start;
+  double elapsed;
+  unsigned long calls = 0, batch = 1, before, j;
+
+  before = allocations;
+  if (!e.run(w, s)) return false;
+  r.allocations_per_label = counting_allocations ?
+    static_cast<double>(allocations - before) / w.count() : -1;
+
+  start = clock::now();
+
+  do {
+    for (j = 0;  j < batch;  ++j) e.run(w, s);
+    calls += batch;
+    batch *= 2;
+    elapsed = std::chrono::duration<double>(clock::now() - start).count();
+  } while (elapsed < min_seconds);
+
+  r.engine = e.name;
+  r.direction = e.direction;
+  r.params = e.params;
+  r.corpus = w.c->name;
+  r.length = w.length;
+  r.labels = w.count();
+  r.ns_per_label = elapsed * 1e9 / calls / w.count();
+  r.mb_per_s = w.utf8_bytes * static_cast<double>(calls) / elapsed / 1e6;
+  return true;
+}
+
+/*** JSON ***/
+
+/* Results are written one object per line, with the keys always */
+/* in the same order, so that read_results() can read them back  */
+/* without a general JSON parser.                                */
+
+const char result_format[] =
+  "{\"engine\": \"%s\", \"direction\": \"%s\", \"params\": \"%s\", "
+  "\"corpus\": \"%s\", \"length\": %lu, \"labels\": %lu, "
+  "\"ns_per_label\": %.3f, \"mb_per_s\": %.3f, "
+  "\"allocations_per_label\": ";
+
+void write_results(const char *path, const std::vector<result> &results)
+{
+  std::FILE *f = std::fopen(path, "w");
+  std::size_t j;
+
+  if (f == 0) {
+    std::perror(path);
+    std::exit(EXIT_FAILURE);
+  }
+
+  std::fputs("{\"results\": [\n", f);
+
+  for (j = 0;  j < results.size();  ++j) {
+    const result &r = results[j];
+    std::fprintf(f, result_format, r.engine.c_str(), r.direction.c_str(),
+                 r.params.c_str(), r.corpus.c_str(),
+                 static_cast<unsigned long>(r.length),
+                 static_cast<unsigned long>(r.labels),
+                 r.ns_per_label, r.mb_per_s);
+    if (r.allocations_per_label < 0) std::fputs("null", f);
+    else std::fprintf(f, "%.3f", r.allocations_per_label);
+    std::fputs(j + 1 < results.size() ? "},\n" : "}\n", f);
+  }
+
+  std::fputs("]}\n", f);
+
+  if (std::fclose(f) != 0) {
+    std::perror(path);
+    std::exit(EXIT_FAILURE);
+  }
+}
+
+std::vector<result> read_results(const char *path)
+{
+  std::FILE *f = std::fopen(path, "r");
+  std::vector<result> results;
+  char line[1024], name[128], direction[16], params[16], corpus[16];
+  unsigned long length, labels;
+  double ns, mb;
+
+  if (f == 0) {
+    std::perror(path);
+    std::exit(EXIT_FAILURE);
+  }
+
+  while (std::fgets(line, sizeof line, f)) {
+    if (std::sscanf(line,
+          "{\"engine\": \"%127[^\"]\", \"direction\": \"%15[^\"]\", "
+          "\"params\": \"%15[^\"]\", \"corpus\": \"%15[^\"]\", "
+          "\"length\": %lu, \"labels\": %lu, \"ns_per_label\": %lf, "
+          "\"mb_per_s\": %lf", name, direction, params, corpus,
+          &length, &labels, &ns, &mb) == 8) {
+      result r;
+      r.engine = name;
+      r.direction = direction;
+      r.params = params;
+      r.corpus = corpus;
+      r.length = length;
+      r.labels = labels;
+      r.ns_per_label = ns;
+      r.mb_per_s = mb;
+      r.allocations_per_label = -1;
+      results.push_back(r);
+    }
+  }
+
+  std::fclose(f);
+  return results;
+}
+
+/* compare() prints the results that are slower than the baseline */
+/* by more than the tolerance and returns how many there are.     */
+
+std::size_t compare(const std::vector<result> &results,
+                    const std::vector<result> &baseline, double tolerance)
+{
+  std::size_t j, k, slower = 0;
+
+  for (j = 0;  j < results.size();  ++j) {
+    const result &r = results[j];
+
+    for (k = 0;  k < baseline.size();  ++k) {
+      const result &b = baseline[k];
+      if (b.engine != r.engine || b.direction != r.direction ||
+          b.corpus != r.corpus || b.length != r.length) continue;
+
+      if (r.ns_per_label > b.ns_per_label * (1 + tolerance)) {
+        if (slower++ == 0) std::puts("\nslower than the baseline:");
+        std::printf("%-26s %-6s %-6s %6lu %10.1f -> %10.1f ns/label\n",
+                    r.engine.c_str(), r.direction.c_str(),
+                    r.corpus.c_str(), static_cast<unsigned long>(r.length),
+                    b.ns_per_label, r.ns_per_label);
+      }
+      break;
+    }
+  }
+
+  return slower;
+}
+
+void usage(char **argv)
+{
+  std::fprintf(stderr,
+    "\n"
+    "%s [-t milliseconds] [-o results.json] [-c baseline.json]\n"
+    "   [-r percent] [engine...]\n"
+    "\n"
+    "times the encoders and decoders, only those named if any are\n"
+    "given, for at least the given time per workload (default 100).\n"
+    "-o saves the results as JSON; -c compares them with saved ones\n"
+    "and exits with status 2 if any is more than the given percentage\n"
+    "(default 10) slower.\n"
+    "\n", argv[0]);
+  std::exit(EXIT_FAILURE);
+}
+
+bool selected(const engine &e, int argc, char **argv, int first)
+{
+  int j;
+
+  if (first == argc) return true;
+  for (j = first;  j < argc;  ++j) {
+    if (std::strcmp(argv[j], e.name) == 0) return true;
+  }
+  return false;
+}
+
+} /* namespace */
+
+int main(int argc, char **argv)
+{
+  const char *output = 0, *baseline = 0;
+  double tolerance = 0.1;
+  std::vector<result> results;
+  std::size_t j, k, m;
+  int argi = 1;
+  scratch s;
+
+  for (;  argi + 1 < argc && argv[argi][0] == '-';  argi += 2) {
+    if (std::strcmp(argv[argi], "-t") == 0) {
+      min_seconds = std::atof(argv[argi + 1]) / 1000;
+    }
+    else if (std::strcmp(argv[argi], "-o") == 0) output = argv[argi + 1];
+    else if (std::strcmp(argv[argi], "-c") == 0) baseline = argv[argi + 1];
+    else if (std::strcmp(argv[argi], "-r") == 0) {
+      tolerance = std::atof(argv[argi + 1]) / 100;
+    }
+    else usage(argv);
+  }
+
+  if (argi < argc && argv[argi][0] == '-') usage(argv);
+
+  std::printf("%-26s %-6s %-6s %6s %12s %10s %8s\n", "engine", "dir",
+              "corpus", "length", "ns/label", "MB/s", "allocs");
+
+  for (j = 0;  j < sizeof corpora / sizeof *corpora;  ++j) {
+    for (k = 0;  k < sizeof label_lengths / sizeof *label_lengths;  ++k) {
+      workload w;
+      generate(w, corpora[j], label_lengths[k]);
+
+      for (m = 0;  m < sizeof engines / sizeof *engines;  ++m) {
+        result r;
+        if (!selected(engines[m], argc, argv, argi)) continue;
+
+        if (!measure(engines[m], w, s, r)) {
+          std::printf("%-26s %-6s %-6s %6lu %12s\n", engines[m].name,
+                      engines[m].direction, corpora[j].name,
+                      static_cast<unsigned long>(label_lengths[k]),
+                      "failed");
+          continue;
+        }
+
+        std::printf("%-26s %-6s %-6s %6lu %12.1f %10.1f ",
+                    r.engine.c_str(), r.direction.c_str(),
+                    r.corpus.c_str(), static_cast<unsigned long>(r.length),
+                    r.ns_per_label, r.mb_per_s);
+        if (r.allocations_per_label < 0) std::puts("       ?");
+        else std::printf("%8.2f\n", r.allocations_per_label);
+        std::fflush(stdout);
+        results.push_back(r);
+      }
+    }
+  }
+
+  if (output) write_results(output, results);
+  if (baseline && compare(results, read_results(baseline), tolerance)) {
+    return 2;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,1569 @@
+/*
+punycode-sample.c 2.0.0 (2004-Mar-21-Sun)
+http://www.nicemice.net/idn/
+Adam M. Costello
+http://www.nicemice.net/amc/
+
+This is ANSI C code (C89) implementing Punycode 1.0.x.
+
+This file is the implementation; the interface is in punycode.h and
+the wrapper for testing is in punycode-test.c.
+
+*/
+
+/*******************/
+/* Implementation: */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "punycode.h"
+
+/*** Instrumentation ***/
+
+/* With PUNYCODE_STATS defined, the main functions count their calls */
+/* through the hooks in punycode-stats.h:  stats(s) is the statement */
+/* s, and finish(status) returns status after recording the call.    */
+/* Otherwise stats(s) is nothing and finish(status) a plain return.  */
+
+#ifdef PUNYCODE_STATS
+#include "punycode-stats.h"
+#define stats(s) s
+#define finish(status) return punycode_stats_finish(&call, (status))
+#else
+#define stats(s)
+#define finish(status) return (status)
+#endif
+
+/*** Bootstring parameters for Punycode ***/
+
+enum { base = 36, tmin = 1, tmax = 26, skew = 38, damp = 700,
+       initial_bias = 72, initial_n = 0x80, delimiter = 0x2D };
+
+/* basic(cp) tests whether cp is a basic code point: */
+#define basic(cp) ((punycode_uint)(cp) < 0x80)
+
+/* delim(cp) tests whether cp is a delimiter: */
+#define delim(cp) ((cp) == delimiter)
+
+/* decode_digit(cp) returns the numeric value of a basic code */
+/* point (for use in representing integers) in the range 0 to */
+/* base-1, or base if cp does not represent a value.          */
+
+static punycode_uint decode_digit(punycode_uint cp)
+{
+  return  cp - 48 < 10 ? cp - 22 :  cp - 65 < 26 ? cp - 65 :
+          cp - 97 < 26 ? cp - 97 :  base;
+}
+
+/* encode_digit(d,flag) returns the basic code point whose value      */
+/* (when used for representing integers) is d, which needs to be in   */
+/* the range 0 to base-1.  The lowercase form is used unless flag is  */
+/* nonzero, in which case the uppercase form is used.  The behavior   */
+/* is undefined if flag is nonzero and digit d has no uppercase form. */
+
+static char encode_digit(punycode_uint d, int flag)
+{
+  return d + 22 + 75 * (d < 26) - ((flag != 0) << 5);
+  /*  0..25 map to ASCII a..z or A..Z */
+  /* 26..35 map to ASCII 0..9         */
+}
+
+/* flagged(bcp) tests whether a basic code point is flagged */
+/* (uppercase).  The behavior is undefined if bcp is not a  */
+/* basic code point.                                        */
+
+#define flagged(bcp) ((punycode_uint)(bcp) - 65 < 26)
+
+/* encode_basic(bcp,flag) forces a basic code point to lowercase */
+/* if flag is zero, uppercase if flag is nonzero, and returns    */
+/* the resulting code point.  The code point is unchanged if it  */
+/* is caseless.  The behavior is undefined if bcp is not a basic */
+/* code point.                                                   */
+
+static char encode_basic(punycode_uint bcp, int flag)
+{
+  bcp -= (bcp - 97 < 26) << 5;
+  return bcp + ((!flag && (bcp - 65 < 26)) << 5);
+}
+
+/*** Case flags ***/
+
+/* Case flags come one per unsigned char, or packed one per bit, */
+/* flag j being bit j % CHAR_BIT of byte j / CHAR_BIT.           */
+/* get_flag(f,packed,j) reads flag j, and put_flag(f,packed,j,v) */
+/* sets it to v, which must be 0 or 1.                           */
+
+#define get_flag(f,packed,j) ((packed) ? \
+  (f)[(j) / CHAR_BIT] >> (j) % CHAR_BIT & 1 : (f)[j])
+
+#define put_flag(f,packed,j,v) ((packed) ? \
+  ((f)[(j) / CHAR_BIT] = (unsigned char) (((f)[(j) / CHAR_BIT] & \
+    ~(1u << (j) % CHAR_BIT)) | (unsigned) (v) << (j) % CHAR_BIT)) : \
+  ((f)[j] = (unsigned char) (v)))
+
+/* insert_bit(bits,i,count,v) inserts the packed flag v at position */
+/* i of count flags, moving flags i..count-1 up by one, a byte at a */
+/* time rather than a flag at a time.                               */
+
+static void insert_bit(unsigned char bits[], punycode_uint i,
+                       punycode_uint count, int v)
+{
+  size_t first = i / CHAR_BIT, k;
+  unsigned low = (1u << i % CHAR_BIT) - 1;
+
+  for (k = count / CHAR_BIT;  k > first;  --k) {
+    bits[k] = (unsigned char) (bits[k] << 1 | bits[k - 1] >> (CHAR_BIT - 1));
+  }
+
+  bits[first] = (unsigned char) ((bits[first] & low) |
+                                 (bits[first] & ~low) << 1 |
+                                 (unsigned) v << i % CHAR_BIT);
+}
+
+/*** Basic code points ***/
+
+/* The kernels of punycode-simd.c are chosen when they are called, */
+/* which costs more than a scalar loop saves on the short labels   */
+/* that are most of the traffic.  Inputs shorter than copy_min     */
+/* code points or scan_min chars are handled by scalar loops:      */
+
+enum { copy_min = 16, scan_min = 8 };
+
+/* basic_length() returns the number of input code points before */
+/* the last delimiter, or 0 if there is none:                    */
+
+static size_t basic_length(size_t input_length, const char input[])
+{
+  size_t b, j;
+
+  if (input_length >= scan_min) {
+    return punycode_basic_length(input_length, input);
+  }
+
+  for (b = j = 0;  j < input_length;  ++j) {
+    if (delim(input[j])) b = j;
+  }
+
+  return b;
+}
+
+/*** Platform-specific constants ***/
+
+/* maxint is the maximum value of a punycode_uint variable: */
+static const punycode_uint maxint = -1;
+/* Because maxint is unsigned, -1 becomes the maximum value. */
+
+/*** Bias adaptation function ***/
+
+static punycode_uint adapt(
+  punycode_uint delta, punycode_uint numpoints, int firsttime )
+{
+  punycode_uint k;
+
+  delta = firsttime ? delta / damp : delta >> 1;
+  /* delta >> 1 is a faster way of doing delta / 2 */
+  delta += delta / numpoints;
+
+  for (k = 0;  delta > ((base - tmin) * tmax) / 2;  k += base) {
+    delta /= base - tmin;
+  }
+
+  return k + (base - tmin + 1) * delta / (delta + skew);
+}
+
+/*** Main encode function ***/
+
+/* encode() and decode() are punycode_encode() and punycode_decode() */
+/* with the case flags packed if packed is nonzero:                  */
+
+static enum punycode_status encode(
+  size_t input_length_orig,
+  const punycode_uint input[],
+  const unsigned char case_flags[],
+  int packed,
+  size_t *output_length,
+  char output[] )
+{
+  punycode_uint input_length, n, delta, h, b, bias, j, m, q, k, t;
+  size_t out, max_out;
+  stats(struct punycode_stats_call call;)
+
+  stats(punycode_stats_start(&call, punycode_stats_encode,
+                             input_length_orig);)
+
+  /* The Punycode spec assumes that the input length is the same type */
+  /* of integer as a code point, so we need to convert the size_t to  */
+  /* a punycode_uint, which could overflow.                           */
+
+  if (input_length_orig > maxint) finish(punycode_overflow);
+  input_length = (punycode_uint) input_length_orig;
+
+  /* Initialize the state: */
+
+  n = initial_n;
+  delta = 0;
+  out = 0;
+  max_out = *output_length;
+  bias = initial_bias;
+
+  /* Handle the basic code points.  Without case flags a leading run */
+  /* of them is copied in bulk, which for a label that needs no      */
+  /* encoding is the whole input:                                     */
+
+  if (!case_flags && input_length >= copy_min && max_out > input_length) {
+    out = punycode_copy_basic(input_length, input, output);
+  }
+
+  for (j = (punycode_uint) out;  j < input_length;  ++j) {
+    if (basic(input[j])) {
+      if (max_out - out < 2) finish(punycode_big_output);
+      output[out++] = case_flags ?
+        encode_basic(input[j], get_flag(case_flags, packed, j))
+        : (char) input[j];
+    }
+    /* else if (input[j] < n) return punycode_bad_input; */
+    /* (not needed for Punycode with unsigned code points) */
+  }
+
+  h = b = (punycode_uint) out;
+  /* cannot overflow because out <= input_length <= maxint */
+
+  /* h is the number of code points that have been handled, b is the  */
+  /* number of basic code points, and out is the number of ASCII code */
+  /* points that have been output.                                    */
+
+  if (b > 0) output[out++] = delimiter;
+
+  /* Main encoding loop: */
+
+  while (h < input_length) {
+    /* All non-basic code points < n have been     */
+    /* handled already.  Find the next larger one: */
+
+    stats(call.scan_ticks -= punycode_stats_ticks();)
+
+    for (m = maxint, j = 0;  j < input_length;  ++j) {
+      /* if (basic(input[j])) continue; */
+      /* (not needed for Punycode) */
+      if (input[j] >= n && input[j] < m) m = input[j];
+    }
+
+    stats(call.scan_ticks += punycode_stats_ticks();)
+
+    /* Increase delta enough to advance the decoder's    */
+    /* <n,i> state to <m,0>, but guard against overflow: */
+
+    if (m - n > (maxint - delta) / (h + 1)) finish(punycode_overflow);
+    delta += (m - n) * (h + 1);
+    n = m;
+
+    for (j = 0;  j < input_length;  ++j) {
+      /* Punycode does not need to check whether input[j] is basic: */
+      if (input[j] < n /* || basic(input[j]) */ ) {
+        if (++delta == 0) finish(punycode_overflow);
+      }
+
+      if (input[j] == n) {
+        /* Represent delta as a generalized variable-length integer: */
+
+        for (q = delta, k = base;  ;  k += base) {
+          if (out >= max_out) finish(punycode_big_output);
+          t = k <= bias /* + tmin */ ? tmin :     /* +tmin not needed */
+              k >= bias + tmax ? tmax : k - bias;
+          if (q < t) break;
+          output[out++] = encode_digit(t + (q - t) % (base - t), 0);
+          q = (q - t) / (base - t);
+        }
+
+        output[out++] = encode_digit(q, case_flags &&
+                                        get_flag(case_flags, packed, j));
+        bias = adapt(delta, h + 1, h == b);
+        delta = 0;
+        ++h;
+      }
+    }
+
+    ++delta, ++n;
+  }
+
+  *output_length = out;
+  stats(call.output_length = out;)
+  finish(punycode_success);
+}
+
+enum punycode_status punycode_encode(
+  size_t input_length,
+  const punycode_uint input[],
+  const unsigned char case_flags[],
+  size_t *output_length,
+  char output[] )
+{
+  return encode(input_length, input, case_flags, 0, output_length, output);
+}
+
+enum punycode_status punycode_encode_packed(
+  size_t input_length,
+  const punycode_uint input[],
+  const unsigned char case_bits[],
+  size_t *output_length,
+  char output[] )
+{
+  return encode(input_length, input, case_bits, 1, output_length, output);
+}
+
+/*** Main decode function ***/
+
+static enum punycode_status decode(
+  size_t input_length,
+  const char input[],
+  size_t *output_length,
+  punycode_uint output[],
+  unsigned char case_flags[],
+  int packed )
+{
+  punycode_uint n, out, i, max_out, bias, oldi, w, k, digit, t;
+  size_t b, j, in;
+  stats(struct punycode_stats_call call;)
+
+  stats(punycode_stats_start(&call, punycode_stats_decode, input_length);)
+
+  /* Initialize the state: */
+
+  n = initial_n;
+  out = i = 0;
+  max_out = *output_length > maxint ? maxint
+            : (punycode_uint) *output_length;
+  bias = initial_bias;
+
+  /* Handle the basic code points:  Let b be the number of input code */
+  /* points before the last delimiter, or 0 if there is none, then    */
+  /* copy the first b code points to the output.                      */
+
+  b = basic_length(input_length, input);
+  if (b > max_out) finish(punycode_big_output);
+
+  for (j = 0;  j < b;  ++j) {
+    if (case_flags) put_flag(case_flags, packed, out, flagged(input[j]));
+    if (!basic(input[j])) finish(punycode_bad_input);
+    output[out++] = input[j];
+  }
+
+  /* Main decoding loop:  Start just after the last delimiter if any  */
+  /* basic code points were copied; start at the beginning otherwise. */
+
+  for (in = b > 0 ? b + 1 : 0;  in < input_length;  ++out) {
+
+    /* in is the index of the next ASCII code point to be consumed, */
+    /* and out is the number of code points in the output array.    */
+
+    /* Decode a generalized variable-length integer into delta,  */
+    /* which gets added to i.  The overflow checking is easier   */
+    /* if we increase i as we go, then subtract off its starting */
+    /* value at the end to obtain delta.                         */
+
+    for (oldi = i, w = 1, k = base;  ;  k += base) {
+      if (in >= input_length) finish(punycode_bad_input);
+      digit = decode_digit(input[in++]);
+      if (digit >= base) finish(punycode_bad_input);
+      if (digit > (maxint - i) / w) finish(punycode_overflow);
+      i += digit * w;
+      t = k <= bias /* + tmin */ ? tmin :     /* +tmin not needed */
+          k >= bias + tmax ? tmax : k - bias;
+      if (digit < t) break;
+      if (w > maxint / (base - t)) finish(punycode_overflow);
+      w *= (base - t);
+    }
+
+    bias = adapt(i - oldi, out + 1, oldi == 0);
+
+    /* i was supposed to wrap around from out+1 to 0,   */
+    /* incrementing n each time, so we'll fix that now: */
+
+    if (i / (out + 1) > maxint - n) finish(punycode_overflow);
+    n += i / (out + 1);
+    i %= (out + 1);
+
+    /* Insert n at position i of the output: */
+
+    /* not needed for Punycode: */
+    /* if (basic(n)) return punycode_bad_input; */
+    if (out >= max_out) finish(punycode_big_output);
+
+    stats(call.insert_ticks -= punycode_stats_ticks();)
+    stats(call.moved += out - i;)
+
+    if (case_flags && packed) {
+      insert_bit(case_flags, i, out, flagged(input[in - 1]));
+    }
+    else if (case_flags) {
+      memmove(case_flags + i + 1, case_flags + i, out - i);
+      /* Case of last ASCII code point determines case flag: */
+      case_flags[i] = flagged(input[in - 1]);
+    }
+
+    memmove(output + i + 1, output + i, (out - i) * sizeof *output);
+    output[i++] = n;
+    stats(call.insert_ticks += punycode_stats_ticks();)
+  }
+
+  *output_length = (size_t) out;
+  /* cannot overflow because out <= old value of *output_length */
+  stats(call.output_length = out;)
+  finish(punycode_success);
+}
+
+enum punycode_status punycode_decode(
+  size_t input_length,
+  const char input[],
+  size_t *output_length,
+  punycode_uint output[],
+  unsigned char case_flags[] )
+{
+  return decode(input_length, input, output_length, output, case_flags, 0);
+}
+
+enum punycode_status punycode_decode_packed(
+  size_t input_length,
+  const char input[],
+  size_t *output_length,
+  punycode_uint output[],
+  unsigned char case_bits[] )
+{
+  return decode(input_length, input, output_length, output, case_bits, 1);
+}
+
+/* In place, the input is first moved to the end of the buffer's       */
+/* first input_length code points, so with s-byte code points it       */
+/* begins at byte (s - 1) * input_length.  Code point k of the output  */
+/* ends at byte s * (k + 1) and is written only once k + 1 input chars */
+/* have been consumed, and as k + 1 <= input_length, that is never     */
+/* past the first unconsumed char.  Insertions move code points no     */
+/* further than the end of the newest one.  This relies on             */
+/* punycode_decode() reading each input char before writing over it,   */
+/* which punycode_decode_deferred() does not do.                       */
+
+enum punycode_status punycode_decode_in_place(
+  size_t input_length,
+  punycode_uint buffer[],
+  size_t *output_length,
+  unsigned char case_flags[] )
+{
+  char *input = (char *) buffer + (sizeof *buffer - 1) * input_length;
+
+  if (*output_length < input_length) return punycode_big_output;
+  memmove(input, buffer, input_length);
+  return punycode_decode(input_length, input, output_length, buffer,
+                         case_flags);
+}
+
+/*** Sorted encode function ***/
+
+/* An occurrence of a non-basic code point.  Sorting by value and */
+/* then by position puts the occurrences in the order in which    */
+/* punycode_encode() emits them.                                  */
+
+struct occurrence {
+  punycode_uint cp, pos;
+};
+
+static int occurrence_compare(const void *a, const void *b)
+{
+  const struct occurrence *x = a, *y = b;
+
+  if (x->cp != y->cp) return x->cp < y->cp ? -1 : 1;
+  return x->pos < y->pos ? -1 : x->pos > y->pos;
+}
+
+/* The binary indexed tree has one node per input position, counting */
+/* the positions whose code points have already been handled (those  */
+/* less than n).  tree_prefix(tree,p) counts them in positions 0..p-1 */
+/* and tree_insert(tree,size,p) marks position p as handled.          */
+
+static punycode_uint tree_prefix(const punycode_uint tree[], punycode_uint p)
+{
+  punycode_uint sum = 0;
+
+  for (;  p > 0;  p &= p - 1) sum += tree[p];
+  return sum;
+}
+
+static void tree_insert(punycode_uint tree[], punycode_uint size,
+                        punycode_uint p)
+{
+  for (++p;  p <= size;  p += p & (0 - p)) ++tree[p];
+}
+
+/* sorted_deltas() runs the main encoding loop of punycode_encode()  */
+/* for an input with b basic code points, one iteration per distinct */
+/* non-basic code point, appending the deltas to the output at *out, */
+/* or only counting them if output is a null pointer.  occ has room  */
+/* for input_length-b occurrences followed by input_length+1 nodes.  */
+
+static enum punycode_status sorted_deltas(
+  punycode_uint input_length,
+  const punycode_uint input[],
+  const unsigned char case_flags[],
+  punycode_uint b,
+  struct occurrence occ[],
+  size_t *out,
+  size_t max_out,
+  char output[] )
+{
+  punycode_uint n, delta, h, bias, j, m, q, k, t;
+  punycode_uint count, r, s, prefix, handled;
+  punycode_uint *tree;
+
+  n = initial_n;
+  delta = 0;
+  h = b;
+  bias = initial_bias;
+  count = input_length - b;
+  tree = (punycode_uint *) (occ + count);
+  tree[0] = 0;
+
+  for (r = j = 0;  j < input_length;  ++j) {
+    tree[j + 1] = basic(input[j]);
+
+    if (!basic(input[j])) {
+      occ[r].cp = input[j];
+      occ[r].pos = j;
+      ++r;
+    }
+  }
+
+  /* Build the tree in place in linear time: */
+
+  for (j = 1;  j <= input_length;  ++j) {
+    k = j + (j & (0 - j));
+    if (k <= input_length) tree[k] += tree[j];
+  }
+
+  qsort(occ, count, sizeof *occ, occurrence_compare);
+
+  /* Main encoding loop, one iteration per distinct code point: */
+
+  for (r = 0;  r < count;  r = s) {
+    m = occ[r].cp;
+
+    if (m - n > (maxint - delta) / (h + 1)) return punycode_overflow;
+    delta += (m - n) * (h + 1);
+    n = m;
+
+    /* Every position before an occurrence of n that holds a smaller */
+    /* code point increments delta, and those are exactly the tree's */
+    /* handled positions, since occurrences of n are not yet in it.  */
+
+    handled = h;
+    prefix = 0;
+
+    for (s = r;  s < count && occ[s].cp == n;  ++s) {
+      j = tree_prefix(tree, occ[s].pos);
+      if (j - prefix > maxint - delta) return punycode_overflow;
+      delta += j - prefix;
+      prefix = j;
+
+      for (q = delta, k = base;  ;  k += base) {
+        if (*out >= max_out) return punycode_big_output;
+        t = k <= bias ? tmin : k >= bias + tmax ? tmax : k - bias;
+        if (q < t) break;
+        if (output) output[*out] = encode_digit(t + (q - t) % (base - t), 0);
+        ++*out;
+        q = (q - t) / (base - t);
+      }
+
+      if (output) {
+        output[*out] = encode_digit(q, case_flags && case_flags[occ[s].pos]);
+      }
+
+      ++*out;
+      bias = adapt(delta, h + 1, h == b);
+      delta = 0;
+      ++h;
+    }
+
+    /* The handled positions after the last occurrence: */
+
+    if (handled - prefix > maxint - delta) return punycode_overflow;
+    delta += handled - prefix;
+
+    for (j = r;  j < s;  ++j) tree_insert(tree, input_length, occ[j].pos);
+
+    ++delta, ++n;
+  }
+
+  return punycode_success;
+}
+
+enum punycode_status punycode_encode_sorted(
+  size_t input_length_orig,
+  const punycode_uint input[],
+  const unsigned char case_flags[],
+  size_t *output_length,
+  char output[] )
+{
+  punycode_uint input_length, b, j;
+  struct occurrence *occ;
+  size_t out, max_out;
+  enum punycode_status status;
+
+  if (input_length_orig > maxint) return punycode_overflow;
+  input_length = (punycode_uint) input_length_orig;
+
+  out = 0;
+  max_out = *output_length;
+
+  /* Handle the basic code points exactly as punycode_encode() does: */
+
+  if (!case_flags && input_length >= copy_min && max_out > input_length) {
+    out = punycode_copy_basic(input_length, input, output);
+  }
+
+  for (j = (punycode_uint) out;  j < input_length;  ++j) {
+    if (basic(input[j])) {
+      if (max_out - out < 2) return punycode_big_output;
+      output[out++] = case_flags ?
+        encode_basic(input[j], case_flags[j]) : (char) input[j];
+    }
+  }
+
+  b = (punycode_uint) out;
+  if (b > 0) output[out++] = delimiter;
+
+  if (b == input_length) {
+    *output_length = out;
+    return punycode_success;
+  }
+
+  /* One allocation holds the occurrences followed by the tree, */
+  /* at most input_length + 1 of each, counted in size_t:       */
+
+  if (input_length_orig >=
+      ((size_t) -1) / (sizeof *occ + sizeof (punycode_uint))) {
+    return punycode_encode(input_length_orig, input, case_flags,
+                           output_length, output);
+  }
+
+  occ = malloc((input_length - b) * sizeof *occ +
+               (input_length + 1) * sizeof (punycode_uint));
+
+  if (occ == 0) {
+    return punycode_encode(input_length_orig, input, case_flags,
+                           output_length, output);
+  }
+
+  status = sorted_deltas(input_length, input, case_flags, b, occ,
+                         &out, max_out, output);
+  free(occ);
+  if (status == punycode_success) *output_length = out;
+  return status;
+}
+
+/*** Deferred decode function ***/
+
+/* tree_select(tree,size,step,rank) returns the position of the free */
+/* slot preceded by exactly rank other free slots, in a tree that    */
+/* counts free slots; step is the largest power of 2 not above size. */
+/* tree_remove(tree,size,p) marks slot p as no longer free.          */
+
+static punycode_uint tree_select(const punycode_uint tree[],
+  punycode_uint size, punycode_uint step, punycode_uint rank)
+{
+  punycode_uint p = 0;
+
+  for (;  step > 0;  step >>= 1) {
+    if (p + step <= size && tree[p + step] <= rank) {
+      p += step;
+      rank -= tree[p];
+    }
+  }
+
+  return p;
+}
+
+static void tree_remove(punycode_uint tree[], punycode_uint size,
+                        punycode_uint p)
+{
+  for (++p;  p <= size;  p += p & (0 - p)) --tree[p];
+}
+
+enum punycode_status punycode_decode_deferred(
+  size_t input_length,
+  const char input[],
+  size_t *output_length,
+  punycode_uint output[],
+  unsigned char case_flags[] )
+{
+  punycode_uint n, out, i, max_out, bias, oldi, w, k, digit, t;
+  punycode_uint r, p, step, *tree, *pos, *cps;
+  unsigned char *flags;
+  size_t b, j, in, count;
+
+  n = initial_n;
+  out = i = 0;
+  max_out = *output_length > maxint ? maxint
+            : (punycode_uint) *output_length;
+  bias = initial_bias;
+
+  if (punycode_scan_ace(input_length, input, &b) < b) {
+    return b > max_out ? punycode_big_output : punycode_bad_input;
+  }
+
+  if (b > max_out) return punycode_big_output;
+
+  out = (punycode_uint) b;
+  in = b > 0 ? b + 1 : 0;
+
+  /* Each decoded code point consumes at least one input code point, */
+  /* which bounds both the number of insertions and the output size. */
+
+  count = input_length - in;
+
+  if (input_length >= ((size_t) -1) / (4 * sizeof *tree)) {
+    return punycode_decode(input_length, input, output_length,
+                           output, case_flags);
+  }
+
+  tree = malloc((b + 3 * count + 1) * sizeof *tree + count);
+
+  if (tree == 0) {
+    return punycode_decode(input_length, input, output_length,
+                           output, case_flags);
+  }
+
+  pos = tree + b + count + 1;
+  cps = pos + count;
+  flags = (unsigned char *) (cps + count);
+
+  /* First pass:  Run the decoder's state machine exactly as */
+  /* punycode_decode() does, but only record the insertions. */
+
+  for (r = 0;  in < input_length;  ++out, ++r) {
+    for (oldi = i, w = 1, k = base;  ;  k += base) {
+      if (in >= input_length) goto bad_input;
+      digit = decode_digit(input[in++]);
+      if (digit >= base) goto bad_input;
+      if (digit > (maxint - i) / w) goto overflow;
+      i += digit * w;
+      t = k <= bias ? tmin : k >= bias + tmax ? tmax : k - bias;
+      if (digit < t) break;
+      if (w > maxint / (base - t)) goto overflow;
+      w *= (base - t);
+    }
+
+    bias = adapt(i - oldi, out + 1, oldi == 0);
+
+    if (i / (out + 1) > maxint - n) goto overflow;
+    n += i / (out + 1);
+    i %= (out + 1);
+
+    if (out >= max_out) goto big_output;
+
+    pos[r] = i++;
+    cps[r] = n;
+    flags[r] = flagged(input[in - 1]);
+  }
+
+  /* Second pass:  The last insertion at position i ends up in the */
+  /* output slot preceded by i free slots once every later one has */
+  /* been placed, so place them backwards.  Slots holding a value  */
+  /* below initial_n are still free; the basic code points fill    */
+  /* them in order at the end.                                     */
+
+  for (p = 1;  p <= out;  ++p) tree[p] = p & (0 - p);
+  for (step = 1;  step <= out / 2;  step <<= 1) ;
+  for (p = 0;  p < out;  ++p) output[p] = 0;
+
+  while (r-- > 0) {
+    p = tree_select(tree, out, step, pos[r]);
+    tree_remove(tree, out, p);
+    output[p] = cps[r];
+    if (case_flags) case_flags[p] = flags[r];
+  }
+
+  for (p = 0, j = 0;  j < b;  ++p) {
+    if (output[p] < initial_n) {
+      if (case_flags) case_flags[p] = flagged(input[j]);
+      output[p] = input[j++];
+    }
+  }
+
+  free(tree);
+  *output_length = (size_t) out;
+  return punycode_success;
+
+bad_input:
+  free(tree);
+  return punycode_bad_input;
+
+overflow:
+  free(tree);
+  return punycode_overflow;
+
+big_output:
+  free(tree);
+  return punycode_big_output;
+}
+
+/*** UTF-8 and UTF-16 helpers ***/
+
+/* scalar(cp) tests whether cp is a Unicode scalar value: */
+#define scalar(cp) ((cp) <= 0x10FFFF && ((cp) < 0xD800 || (cp) > 0xDFFF))
+
+/* utf8_length(cp) and utf16_length(cp) return the number */
+/* of code units needed to encode the scalar value cp:    */
+
+#define utf8_length(cp) ((cp) < 0x80 ? 1 : (cp) < 0x800 ? 2 : \
+                         (cp) < 0x10000 ? 3 : 4)
+#define utf16_length(cp) ((cp) < 0x10000 ? 1 : 2)
+
+/* utf8_lead_length(c) returns the length of the UTF-8 sequence */
+/* beginning with byte c, which must be a valid lead byte:      */
+
+#define utf8_lead_length(c) ((unsigned char) (c) < 0x80 ? 1 : \
+  (unsigned char) (c) < 0xE0 ? 2 : (unsigned char) (c) < 0xF0 ? 3 : 4)
+
+/* utf8_check() returns the length of the UTF-8 sequence at the */
+/* start of s, which has n bytes, and stores its value in *cp,  */
+/* or returns 0 if it is not the shortest form of a scalar value. */
+
+static size_t utf8_check(const unsigned char s[], size_t n,
+                         punycode_uint *cp)
+{
+  static const punycode_uint min[5] = { 0, 0, 0x80, 0x800, 0x10000 };
+  size_t length, j;
+
+  if (s[0] < 0x80) {
+    *cp = s[0];
+    return 1;
+  }
+
+  if (s[0] < 0xC2 || s[0] > 0xF4) return 0;
+  length = utf8_lead_length(s[0]);
+  if (n < length) return 0;
+  *cp = s[0] & (0x7F >> length);
+
+  for (j = 1;  j < length;  ++j) {
+    if ((s[j] & 0xC0) != 0x80) return 0;
+    *cp = *cp << 6 | (s[j] & 0x3F);
+  }
+
+  return *cp >= min[length] && scalar(*cp) ? length : 0;
+}
+
+/* utf8_next() and utf16_next() decode the code point at index *j */
+/* of input already checked to be well-formed and advance *j past */
+/* it.  The ASCII (or BMP) case is tested first and inlined.      */
+
+#define utf8_next(s,j) ((s)[*(j)] < 0x80 ? (punycode_uint) (s)[(*(j))++] \
+                                          : utf8_next_long(s, j))
+
+static punycode_uint utf8_next_long(const unsigned char s[], size_t *j)
+{
+  size_t length = utf8_lead_length(s[*j]), k;
+  punycode_uint cp = s[*j] & (0x7F >> length);
+
+  for (k = 1;  k < length;  ++k) cp = cp << 6 | (s[*j + k] & 0x3F);
+  *j += length;
+  return cp;
+}
+
+#define utf16_next(s,j) ((s)[*(j)] - 0xD800u >= 0x800 ? \
+  (punycode_uint) (s)[(*(j))++] : utf16_next_pair(s, j))
+
+static punycode_uint utf16_next_pair(const punycode_utf16 s[], size_t *j)
+{
+  punycode_uint cp = 0x10000 + ((s[*j] & 0x3FFUL) << 10) + (s[*j + 1] & 0x3FF);
+
+  *j += 2;
+  return cp;
+}
+
+static void utf8_put(punycode_uint cp, size_t length, char s[])
+{
+  size_t k;
+
+  if (length == 1) {
+    s[0] = (char) cp;
+    return;
+  }
+
+  for (k = length - 1;  k > 0;  --k) {
+    s[k] = (char) (0x80 | (cp & 0x3F));
+    cp >>= 6;
+  }
+
+  s[0] = (char) ((0xF00 >> length & 0xFF) | cp);
+}
+
+static void utf16_put(punycode_uint cp, size_t length, punycode_utf16 s[])
+{
+  if (length == 1) s[0] = (punycode_utf16) cp;
+  else {
+    cp -= 0x10000;
+    s[0] = (punycode_utf16) (0xD800 | cp >> 10);
+    s[1] = (punycode_utf16) (0xDC00 | (cp & 0x3FF));
+  }
+}
+
+/* emit_delta() represents delta as a generalized variable-length */
+/* integer as punycode_encode() does, returning 0 if the output   */
+/* runs out of room.                                              */
+
+static int emit_delta(punycode_uint q, punycode_uint bias,
+                      size_t *out, size_t max_out, char output[])
+{
+  punycode_uint k, t;
+
+  for (k = base;  ;  k += base) {
+    if (*out >= max_out) return 0;
+    t = k <= bias ? tmin : k >= bias + tmax ? tmax : k - bias;
+    if (q < t) break;
+    output[(*out)++] = encode_digit(t + (q - t) % (base - t), 0);
+    q = (q - t) / (base - t);
+  }
+
+  output[(*out)++] = encode_digit(q, 0);
+  return 1;
+}
+
+/*** UTF-8 and UTF-16 encode functions ***/
+
+/* Both follow punycode_encode() step by step.  The first pass */
+/* over the input also checks that it is well-formed and counts */
+/* its code points; the later passes decode it without checks.  */
+
+enum punycode_status punycode_encode_utf8(
+  size_t input_length,
+  const char input[],
+  size_t *output_length,
+  char output[] )
+{
+  const unsigned char *s = (const unsigned char *) input;
+  punycode_uint n, delta, h, b, bias, m, cp;
+  size_t j, l, count, out, max_out;
+  int full = 0;
+  stats(struct punycode_stats_call call;)
+
+  stats(punycode_stats_start(&call, punycode_stats_encode_utf8,
+                             input_length);)
+
+  n = initial_n;
+  delta = 0;
+  out = 0;
+  max_out = *output_length;
+  bias = initial_bias;
+
+  for (count = j = 0;  j < input_length;  j += l, ++count) {
+    l = utf8_check(s + j, input_length - j, &cp);
+    if (l == 0) finish(punycode_bad_input);
+
+    if (basic(cp) && !full) {
+      if (max_out - out < 2) full = 1;
+      else output[out++] = (char) cp;
+    }
+  }
+
+  if (count > maxint) finish(punycode_overflow);
+  if (full) finish(punycode_big_output);
+
+  h = b = (punycode_uint) out;
+  if (b > 0) output[out++] = delimiter;
+
+  while (h < count) {
+    stats(call.scan_ticks -= punycode_stats_ticks();)
+
+    for (m = maxint, j = 0;  j < input_length;  ) {
+      cp = utf8_next(s, &j);
+      if (cp >= n && cp < m) m = cp;
+    }
+
+    stats(call.scan_ticks += punycode_stats_ticks();)
+
+    if (m - n > (maxint - delta) / (h + 1)) finish(punycode_overflow);
+    delta += (m - n) * (h + 1);
+    n = m;
+
+    for (j = 0;  j < input_length;  ) {
+      cp = utf8_next(s, &j);
+
+      if (cp < n) {
+        if (++delta == 0) finish(punycode_overflow);
+      }
+
+      if (cp == n) {
+        if (!emit_delta(delta, bias, &out, max_out, output)) {
+          finish(punycode_big_output);
+        }
+        bias = adapt(delta, h + 1, h == b);
+        delta = 0;
+        ++h;
+      }
+    }
+
+    ++delta, ++n;
+  }
+
+  *output_length = out;
+  stats(call.output_length = out;)
+  finish(punycode_success);
+}
+
+enum punycode_status punycode_encode_utf16(
+  size_t input_length,
+  const punycode_utf16 input[],
+  size_t *output_length,
+  char output[] )
+{
+  punycode_uint n, delta, h, b, bias, m, cp;
+  size_t j, count, out, max_out;
+  int full = 0;
+  stats(struct punycode_stats_call call;)
+
+  stats(punycode_stats_start(&call, punycode_stats_encode_utf16,
+                             input_length);)
+
+  n = initial_n;
+  delta = 0;
+  out = 0;
+  max_out = *output_length;
+  bias = initial_bias;
+
+  for (count = j = 0;  j < input_length;  ++j, ++count) {
+    cp = input[j];
+
+    if (cp - 0xD800 < 0x800) {
+      if (cp >= 0xDC00 || j + 1 == input_length ||
+          input[j + 1] - 0xDC00u >= 0x400) finish(punycode_bad_input);
+      ++j;
+    }
+    else if (basic(cp) && !full) {
+      if (max_out - out < 2) full = 1;
+      else output[out++] = (char) cp;
+    }
+  }
+
+  if (count > maxint) finish(punycode_overflow);
+  if (full) finish(punycode_big_output);
+
+  h = b = (punycode_uint) out;
+  if (b > 0) output[out++] = delimiter;
+
+  while (h < count) {
+    stats(call.scan_ticks -= punycode_stats_ticks();)
+
+    for (m = maxint, j = 0;  j < input_length;  ) {
+      cp = utf16_next(input, &j);
+      if (cp >= n && cp < m) m = cp;
+    }
+
+    stats(call.scan_ticks += punycode_stats_ticks();)
+
+    if (m - n > (maxint - delta) / (h + 1)) finish(punycode_overflow);
+    delta += (m - n) * (h + 1);
+    n = m;
+
+    for (j = 0;  j < input_length;  ) {
+      cp = utf16_next(input, &j);
+
+      if (cp < n) {
+        if (++delta == 0) finish(punycode_overflow);
+      }
+
+      if (cp == n) {
+        if (!emit_delta(delta, bias, &out, max_out, output)) {
+          finish(punycode_big_output);
+        }
+        bias = adapt(delta, h + 1, h == b);
+        delta = 0;
+        ++h;
+      }
+    }
+
+    ++delta, ++n;
+  }
+
+  *output_length = out;
+  stats(call.output_length = out;)
+  finish(punycode_success);
+}
+
+/*** UTF-8 and UTF-16 decode functions ***/
+
+/* Both follow punycode_decode() step by step, inserting each code   */
+/* point into the encoded output.  To find the code unit offset of a */
+/* code point index they keep a cursor just past the last insertion  */
+/* and walk from there, since successive insertions tend to be close. */
+
+enum punycode_status punycode_decode_utf8(
+  size_t input_length,
+  const char input[],
+  size_t *output_length,
+  char output[] )
+{
+  punycode_uint n, out, i, bias, oldi, w, k, digit, t, cursor;
+  size_t b, j, in, units, max_out, at, l;
+  stats(struct punycode_stats_call call;)
+
+  stats(punycode_stats_start(&call, punycode_stats_decode_utf8,
+                             input_length);)
+
+  n = initial_n;
+  out = i = 0;
+  max_out = *output_length;
+  bias = initial_bias;
+
+  b = basic_length(input_length, input);
+  if (b > max_out) finish(punycode_big_output);
+
+  for (j = 0;  j < b;  ++j) {
+    if (!basic(input[j])) finish(punycode_bad_input);
+    output[out++] = input[j];
+  }
+
+  units = b;
+  cursor = 0;
+  at = 0;
+
+  for (in = b > 0 ? b + 1 : 0;  in < input_length;  ++out) {
+    for (oldi = i, w = 1, k = base;  ;  k += base) {
+      if (in >= input_length) finish(punycode_bad_input);
+      digit = decode_digit(input[in++]);
+      if (digit >= base) finish(punycode_bad_input);
+      if (digit > (maxint - i) / w) finish(punycode_overflow);
+      i += digit * w;
+      t = k <= bias ? tmin : k >= bias + tmax ? tmax : k - bias;
+      if (digit < t) break;
+      if (w > maxint / (base - t)) finish(punycode_overflow);
+      w *= (base - t);
+    }
+
+    bias = adapt(i - oldi, out + 1, oldi == 0);
+
+    if (i / (out + 1) > maxint - n) finish(punycode_overflow);
+    n += i / (out + 1);
+    i %= (out + 1);
+
+    if (!scalar(n)) finish(punycode_bad_input);
+    l = utf8_length(n);
+    if (out == maxint || max_out - units < l) finish(punycode_big_output);
+
+    stats(call.insert_ticks -= punycode_stats_ticks();)
+
+    for (;  cursor < i;  ++cursor) at += utf8_lead_length(output[at]);
+
+    for (;  cursor > i;  --cursor) {
+      do --at; while ((output[at] & 0xC0) == 0x80);
+    }
+
+    stats(call.moved += units - at;)
+    memmove(output + at + l, output + at, units - at);
+    utf8_put(n, l, output + at);
+    units += l;
+    at += l;
+    cursor = ++i;
+    stats(call.insert_ticks += punycode_stats_ticks();)
+  }
+
+  *output_length = units;
+  stats(call.output_length = units;)
+  finish(punycode_success);
+}
+
+enum punycode_status punycode_decode_utf16(
+  size_t input_length,
+  const char input[],
+  size_t *output_length,
+  punycode_utf16 output[] )
+{
+  punycode_uint n, out, i, bias, oldi, w, k, digit, t, cursor;
+  size_t b, j, in, units, max_out, at, l;
+  stats(struct punycode_stats_call call;)
+
+  stats(punycode_stats_start(&call, punycode_stats_decode_utf16,
+                             input_length);)
+
+  n = initial_n;
+  out = i = 0;
+  max_out = *output_length;
+  bias = initial_bias;
+
+  b = basic_length(input_length, input);
+  if (b > max_out) finish(punycode_big_output);
+
+  for (j = 0;  j < b;  ++j) {
+    if (!basic(input[j])) finish(punycode_bad_input);
+    output[out++] = input[j];
+  }
+
+  units = b;
+  cursor = 0;
+  at = 0;
+
+  for (in = b > 0 ? b + 1 : 0;  in < input_length;  ++out) {
+    for (oldi = i, w = 1, k = base;  ;  k += base) {
+      if (in >= input_length) finish(punycode_bad_input);
+      digit = decode_digit(input[in++]);
+      if (digit >= base) finish(punycode_bad_input);
+      if (digit > (maxint - i) / w) finish(punycode_overflow);
+      i += digit * w;
+      t = k <= bias ? tmin : k >= bias + tmax ? tmax : k - bias;
+      if (digit < t) break;
+      if (w > maxint / (base - t)) finish(punycode_overflow);
+      w *= (base - t);
+    }
+
+    bias = adapt(i - oldi, out + 1, oldi == 0);
+
+    if (i / (out + 1) > maxint - n) finish(punycode_overflow);
+    n += i / (out + 1);
+    i %= (out + 1);
+
+    if (!scalar(n)) finish(punycode_bad_input);
+    l = utf16_length(n);
+    if (out == maxint || max_out - units < l) finish(punycode_big_output);
+
+    stats(call.insert_ticks -= punycode_stats_ticks();)
+
+    for (;  cursor < i;  ++cursor) {
+      at += output[at] - 0xD800u < 0x400 ? 2 : 1;
+    }
+
+    for (;  cursor > i;  --cursor) {
+      at -= output[at - 1] - 0xDC00u < 0x400 ? 2 : 1;
+    }
+
+    stats(call.moved += units - at;)
+    memmove(output + at + l, output + at, (units - at) * sizeof *output);
+    utf16_put(n, l, output + at);
+    units += l;
+    at += l;
+    cursor = ++i;
+    stats(call.insert_ticks += punycode_stats_ticks();)
+  }
+
+  *output_length = units;
+  stats(call.output_length = units;)
+  finish(punycode_success);
+}
+
+/*** Length functions ***/
+
+/* Inputs at least this long are counted with sorted_deltas(), */
+/* as punycode-batch.c encodes them with punycode_encode_sorted(): */
+
+enum { sorted_min_length = 64 };
+
+enum punycode_status punycode_encoded_length(
+  size_t input_length_orig,
+  const punycode_uint input[],
+  size_t *output_length )
+{
+  punycode_uint input_length, n, delta, h, b, bias, j, m, q, k, t;
+  struct occurrence *occ;
+  size_t out;
+  enum punycode_status status;
+
+  if (input_length_orig > maxint) return punycode_overflow;
+  input_length = (punycode_uint) input_length_orig;
+
+  /* Every basic code point is copied, followed by a delimiter */
+  /* if there are any, whatever the case flags:                */
+
+  for (b = j = 0;  j < input_length;  ++j) b += basic(input[j]);
+  out = b + (b > 0);
+
+  if (b == input_length) {
+    *output_length = out;
+    return punycode_success;
+  }
+
+  if (input_length >= sorted_min_length &&
+      input_length_orig <
+        ((size_t) -1) / (sizeof *occ + sizeof (punycode_uint))) {
+    occ = malloc((input_length - b) * sizeof *occ +
+                 (input_length + 1) * sizeof (punycode_uint));
+
+    if (occ != 0) {
+      status = sorted_deltas(input_length, input, 0, b, occ,
+                             &out, (size_t) -1, 0);
+      free(occ);
+      if (status == punycode_success) *output_length = out;
+      return status;
+    }
+  }
+
+  /* Otherwise follow punycode_encode(), counting digits: */
+
+  n = initial_n;
+  delta = 0;
+  h = b;
+  bias = initial_bias;
+
+  while (h < input_length) {
+    for (m = maxint, j = 0;  j < input_length;  ++j) {
+      if (input[j] >= n && input[j] < m) m = input[j];
+    }
+
+    if (m - n > (maxint - delta) / (h + 1)) return punycode_overflow;
+    delta += (m - n) * (h + 1);
+    n = m;
+
+    for (j = 0;  j < input_length;  ++j) {
+      if (input[j] < n) {
+        if (++delta == 0) return punycode_overflow;
+      }
+
+      if (input[j] == n) {
+        for (q = delta, k = base;  ;  k += base, ++out) {
+          t = k <= bias ? tmin : k >= bias + tmax ? tmax : k - bias;
+          if (q < t) break;
+          q = (q - t) / (base - t);
+        }
+
+        ++out;
+        bias = adapt(delta, h + 1, h == b);
+        delta = 0;
+        ++h;
+      }
+    }
+
+    ++delta, ++n;
+  }
+
+  *output_length = out;
+  return punycode_success;
+}
+
+/* decode_count() runs the state machine of punycode_decode()   */
+/* without inserting anything, storing in *count the number     */
+/* of code points it would output.  If scalars is nonzero, it   */
+/* also fails with punycode_bad_input on a decoded code point   */
+/* that is not a Unicode scalar value.                          */
+
+static enum punycode_status decode_count(
+  size_t input_length,
+  const char input[],
+  int scalars,
+  punycode_uint *count )
+{
+  punycode_uint n, out, i, bias, oldi, w, k, digit, t;
+  size_t b, in;
+
+  n = initial_n;
+  i = 0;
+  bias = initial_bias;
+
+  if (punycode_scan_ace(input_length, input, &b) < b) {
+    return punycode_bad_input;
+  }
+
+  if (b > maxint) return punycode_big_output;
+
+  for (out = (punycode_uint) b, in = b > 0 ? b + 1 : 0;
+       in < input_length;  ++out) {
+    for (oldi = i, w = 1, k = base;  ;  k += base) {
+      if (in >= input_length) return punycode_bad_input;
+      digit = decode_digit(input[in++]);
+      if (digit >= base) return punycode_bad_input;
+      if (digit > (maxint - i) / w) return punycode_overflow;
+      i += digit * w;
+      t = k <= bias ? tmin : k >= bias + tmax ? tmax : k - bias;
+      if (digit < t) break;
+      if (w > maxint / (base - t)) return punycode_overflow;
+      w *= (base - t);
+    }
+
+    bias = adapt(i - oldi, out + 1, oldi == 0);
+
+    if (i / (out + 1) > maxint - n) return punycode_overflow;
+    n += i / (out + 1);
+    i %= (out + 1);
+
+    if (scalars && !scalar(n)) return punycode_bad_input;
+    if (out == maxint) return punycode_big_output;
+    ++i;
+  }
+
+  *count = out;
+  return punycode_success;
+}
+
+enum punycode_status punycode_decoded_length(
+  size_t input_length,
+  const char input[],
+  size_t *output_length )
+{
+  punycode_uint count;
+  enum punycode_status status;
+
+  status = decode_count(input_length, input, 0, &count);
+  if (status == punycode_success) *output_length = count;
+  return status;
+}
+
+/*** Validate function ***/
+
+enum punycode_status punycode_validate(
+  size_t input_length,
+  const char input[],
+  size_t *output_length )
+{
+  punycode_uint count;
+  enum punycode_status status;
+
+  status = decode_count(input_length, input, 1, &count);
+  if (status == punycode_success && output_length) *output_length = count;
+  return status;
+}
+
+/*** Wide encode and decode functions ***/
+
+/* maxwide is the maximum value of a punycode_wide variable: */
+static const punycode_wide maxwide = -1;
+
+/* adapt_wide() is adapt() for punycode_wide deltas; the */
+/* bias it returns is small, so it is a punycode_uint.  */
+
+static punycode_uint adapt_wide(
+  punycode_wide delta, punycode_wide numpoints, int firsttime )
+{
+  punycode_uint k;
+
+  delta = firsttime ? delta / damp : delta >> 1;
+  delta += delta / numpoints;
+
+  for (k = 0;  delta > ((base - tmin) * tmax) / 2;  k += base) {
+    delta /= base - tmin;
+  }
+
+  return k + (punycode_uint) ((base - tmin + 1) * delta / (delta + skew));
+}
+
+enum punycode_status punycode_encode_wide(
+  size_t input_length,
+  const punycode_uint input[],
+  size_t *output_length,
+  char output[] )
+{
+  punycode_wide delta, h, b, q;
+  punycode_uint n, bias, m, k, t;
+  size_t j, out, max_out;
+
+  if (input_length > maxwide) return punycode_overflow;
+
+  n = initial_n;
+  delta = 0;
+  out = 0;
+  max_out = *output_length;
+  bias = initial_bias;
+
+  if (input_length >= copy_min && max_out > input_length) {
+    out = punycode_copy_basic(input_length, input, output);
+  }
+
+  for (j = out;  j < input_length;  ++j) {
+    if (basic(input[j])) {
+      if (max_out - out < 2) return punycode_big_output;
+      output[out++] = (char) input[j];
+    }
+  }
+
+  h = b = out;
+  if (b > 0) output[out++] = delimiter;
+
+  /* Main encoding loop, as in punycode_encode(): */
+
+  while (h < input_length) {
+    for (m = maxint, j = 0;  j < input_length;  ++j) {
+      if (input[j] >= n && input[j] < m) m = input[j];
+    }
+
+    if (m - n > (maxwide - delta) / (h + 1)) return punycode_overflow;
+    delta += (m - n) * (h + 1);
+    n = m;
+
+    for (j = 0;  j < input_length;  ++j) {
+      if (input[j] < n) {
+        if (++delta == 0) return punycode_overflow;
+      }
+
+      if (input[j] == n) {
+        for (q = delta, k = base;  ;  k += base) {
+          if (out >= max_out) return punycode_big_output;
+          t = k <= bias ? tmin : k >= bias + tmax ? tmax : k - bias;
+          if (q < t) break;
+          output[out++] =
+            encode_digit((punycode_uint) (t + (q - t) % (base - t)), 0);
+          q = (q - t) / (base - t);
+        }
+
+        output[out++] = encode_digit((punycode_uint) q, 0);
+        bias = adapt_wide(delta, h + 1, h == b);
+        delta = 0;
+        ++h;
+      }
+    }
+
+    ++delta, ++n;
+  }
+
+  *output_length = out;
+  return punycode_success;
+}
+
+enum punycode_status punycode_decode_wide(
+  size_t input_length,
+  const char input[],
+  size_t *output_length,
+  punycode_uint output[] )
+{
+  punycode_wide out, i, max_out, oldi, w, digit;
+  punycode_uint n, bias, k, t;
+  size_t b, j, in;
+
+  n = initial_n;
+  out = i = 0;
+  max_out = *output_length > maxwide ? maxwide : *output_length;
+  bias = initial_bias;
+
+  b = basic_length(input_length, input);
+  if (b > max_out) return punycode_big_output;
+
+  for (j = 0;  j < b;  ++j) {
+    if (!basic(input[j])) return punycode_bad_input;
+    output[out++] = input[j];
+  }
+
+  /* Main decoding loop, as in punycode_decode(): */
+
+  for (in = b > 0 ? b + 1 : 0;  in < input_length;  ++out) {
+    for (oldi = i, w = 1, k = base;  ;  k += base) {
+      if (in >= input_length) return punycode_bad_input;
+      digit = decode_digit(input[in++]);
+      if (digit >= base) return punycode_bad_input;
+      if (digit > (maxwide - i) / w) return punycode_overflow;
+      i += digit * w;
+      t = k <= bias ? tmin : k >= bias + tmax ? tmax : k - bias;
+      if (digit < t) break;
+      if (w > maxwide / (base - t)) return punycode_overflow;
+      w *= (base - t);
+    }
+
+    bias = adapt_wide(i - oldi, out + 1, oldi == 0);
+
+    /* The code point itself must still fit a punycode_uint: */
+
+    if (i / (out + 1) > maxint - n) return punycode_overflow;
+    n += (punycode_uint) (i / (out + 1));
+    i %= (out + 1);
+
+    if (out >= max_out) return punycode_big_output;
+
+    memmove(output + i + 1, output + i, (size_t) (out - i) * sizeof *output);
+    output[i++] = n;
+  }
+
+  *output_length = (size_t) out;
+  return punycode_success;
+}
@@ -0,0 +1,475 @@
+/*
+punycode-sample.c 2.0.0 (2004-Mar-21-Sun)
+http://www.nicemice.net/idn/
+Adam M. Costello
+http://www.nicemice.net/amc/
+
+This is ANSI C code (C89) implementing Punycode 1.0.x.
+
+The sample was distributed as a single file bundling an interface,
+an implementation, and a wrapper for testing.  It has been split apart
+into punycode.h (this file), punycode.c, and punycode-test.c.
+
+*/
+
+#ifndef PUNYCODE_H
+#define PUNYCODE_H
+
+/********************/
+/* Public interface: */
+
+#include <limits.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+enum punycode_status {
+  punycode_success    = 0,
+  punycode_bad_input  = 1, /* Input is invalid.                       */
+  punycode_big_output = 2, /* Output would exceed the space provided. */
+  punycode_overflow   = 3  /* Wider integers needed to process input. */
+};
+
+/* punycode_uint needs to be unsigned and needs to be */
+/* at least 26 bits wide.  The particular type can be */
+/* specified by defining PUNYCODE_UINT, otherwise a   */
+/* suitable type will be chosen automatically.        */
+
+#ifdef PUNYCODE_UINT
+  typedef PUNYCODE_UINT punycode_uint;
+#elif UINT_MAX >= (1 << 26) - 1
+  typedef unsigned int punycode_uint;
+#else
+  typedef unsigned long punycode_uint;
+#endif
+
+/* punycode_wide is the wider unsigned type used for the deltas */
+/* of punycode_encode_wide() and punycode_decode_wide().  It can */
+/* be specified by defining PUNYCODE_WIDE, otherwise the widest  */
+/* standard type the compiler offers is chosen.                  */
+
+#ifdef PUNYCODE_WIDE
+  typedef PUNYCODE_WIDE punycode_wide;
+#elif defined(ULLONG_MAX)
+  typedef unsigned long long punycode_wide;
+#else
+  typedef unsigned long punycode_wide;
+#endif
+
+/* punycode_utf16 holds a UTF-16 code unit, so it needs to be */
+/* unsigned and at least 16 bits wide.                        */
+
+typedef unsigned short punycode_utf16;
+
+enum punycode_status punycode_encode(
+  size_t,                 /* input_length  */
+  const punycode_uint [], /* input         */
+  const unsigned char [], /* case_flags    */
+  size_t *,               /* output_length */
+  char []                 /* output        */
+);
+
+/*
+    punycode_encode() converts a sequence of code points (presumed to be
+    Unicode code points) to Punycode.
+
+    Input arguments (to be supplied by the caller):
+
+        input_length
+            The number of code points in the input array and the number
+            of flags in the case_flags array.
+
+        input
+            An array of code points.  They are presumed to be Unicode
+            code points, but that is not strictly necessary.  The
+            array contains code points, not code units.  UTF-16 uses
+            code units D800 through DFFF to refer to code points
+            10000..10FFFF.  The code points D800..DFFF do not occur in
+            any valid Unicode string.  The code points that can occur in
+            Unicode strings (0..D7FF and E000..10FFFF) are also called
+            Unicode scalar values.
+
+        case_flags
+            A null pointer or an array of boolean values parallel to
+            the input array.  Nonzero (true, flagged) suggests that the
+            corresponding Unicode character be forced to uppercase after
+            being decoded (if possible), and zero (false, unflagged)
+            suggests that it be forced to lowercase (if possible).
+            ASCII code points (0..7F) are encoded literally, except that
+            ASCII letters are forced to uppercase or lowercase according
+            to the corresponding case flags.  If case_flags is a null
+            pointer then ASCII letters are left as they are, and other
+            code points are treated as unflagged.
+
+    Output arguments (to be filled in by the function):
+
+        output
+            An array of ASCII code points.  It is *not* null-terminated;
+            it will contain zeros if and only if the input contains
+            zeros.  (Of course the caller can leave room for a
+            terminator and add one if needed.)
+
+    Input/output arguments (to be supplied by the caller and overwritten
+    by the function):
+
+        output_length
+            The caller passes in the maximum number of ASCII code points
+            that it can receive.  On successful return it will contain
+            the number of ASCII code points actually output.
+
+    Return value:
+
+        Can be any of the punycode_status values defined above except
+        punycode_bad_input.  If not punycode_success, then output_size
+        and output might contain garbage.
+*/
+
+enum punycode_status punycode_decode(
+  size_t,           /* input_length  */
+  const char [],    /* input         */
+  size_t *,         /* output_length */
+  punycode_uint [], /* output        */
+  unsigned char []  /* case_flags    */
+);
+
+/*
+    punycode_decode() converts Punycode to a sequence of code points
+    (presumed to be Unicode code points).
+
+    Input arguments (to be supplied by the caller):
+
+        input_length
+            The number of ASCII code points in the input array.
+
+        input
+            An array of ASCII code points (0..7F).
+
+    Output arguments (to be filled in by the function):
+
+        output
+            An array of code points like the input argument of
+            punycode_encode() (see above).
+
+        case_flags
+            A null pointer (if the flags are not needed by the caller)
+            or an array of boolean values parallel to the output array.
+            Nonzero (true, flagged) suggests that the corresponding
+            Unicode character be forced to uppercase by the caller (if
+            possible), and zero (false, unflagged) suggests that it
+            be forced to lowercase (if possible).  ASCII code points
+            (0..7F) are output already in the proper case, but their
+            flags will be set appropriately so that applying the flags
+            would be harmless.
+
+    Input/output arguments (to be supplied by the caller and overwritten
+    by the function):
+
+        output_length
+            The caller passes in the maximum number of code points
+            that it can receive into the output array (which is also
+            the maximum number of flags that it can receive into the
+            case_flags array, if case_flags is not a null pointer).  On
+            successful return it will contain the number of code points
+            actually output (which is also the number of flags actually
+            output, if case_flags is not a null pointer).  The decoder
+            will never need to output more code points than the number
+            of ASCII code points in the input, because of the way the
+            encoding is defined.  The number of code points output
+            cannot exceed the maximum possible value of a punycode_uint,
+            even if the supplied output_length is greater than that.
+
+    Return value:
+
+        Can be any of the punycode_status values defined above.  If not
+        punycode_success, then output_length, output, and case_flags
+        might contain garbage.
+*/
+
+enum punycode_status punycode_encode_sorted(
+  size_t,                 /* input_length  */
+  const punycode_uint [], /* input         */
+  const unsigned char [], /* case_flags    */
+  size_t *,               /* output_length */
+  char []                 /* output        */
+);
+
+/*
+    punycode_encode_sorted() takes the same arguments and produces the
+    same output and return value as punycode_encode(), but instead of
+    rescanning the whole input once per distinct non-basic code point
+    it sorts the non-basic code points once and counts the handled code
+    points between them with a binary indexed tree, so it runs in
+    O(n log n) time rather than O(n * k) for k distinct code points.
+
+    It makes a single call to malloc() for its working storage.  If
+    that fails, it falls back to punycode_encode(), so it never fails
+    for lack of memory.  For short inputs such as single DNS labels the
+    setup costs more than it saves; punycode-bench.c measures where the
+    two functions cross over.
+*/
+
+enum punycode_status punycode_decode_deferred(
+  size_t,           /* input_length  */
+  const char [],    /* input         */
+  size_t *,         /* output_length */
+  punycode_uint [], /* output        */
+  unsigned char []  /* case_flags    */
+);
+
+/*
+    punycode_decode_deferred() takes the same arguments and produces
+    the same output and return value as punycode_decode(), but instead
+    of inserting each code point into the output as it is decoded,
+    which moves O(n) code points and case flags per insertion, it
+    records the insertion positions in a first pass and then places
+    every code point at its final position in a second pass, working
+    backwards and using a binary indexed tree to find the free slot
+    that each insertion ends up in.  It runs in O(n log n) time.
+
+    Like punycode_encode_sorted(), it makes a single call to malloc()
+    and falls back to punycode_decode() if that fails.
+*/
+
+enum punycode_status punycode_encode_packed(
+  size_t,                 /* input_length  */
+  const punycode_uint [], /* input         */
+  const unsigned char [], /* case_bits     */
+  size_t *,               /* output_length */
+  char []                 /* output        */
+);
+
+enum punycode_status punycode_decode_packed(
+  size_t,           /* input_length  */
+  const char [],    /* input         */
+  size_t *,         /* output_length */
+  punycode_uint [], /* output        */
+  unsigned char []  /* case_bits     */
+);
+
+/*
+    punycode_encode_packed() and punycode_decode_packed() are
+    punycode_encode() and punycode_decode() with the case flags packed
+    into bits:  flag j is bit j % CHAR_BIT (counting from the least
+    significant) of case_bits[j / CHAR_BIT], so n flags take
+    (n + CHAR_BIT - 1) / CHAR_BIT bytes.  The decoder then moves the
+    flags after each insertion point a byte, not a flag, at a time.
+    It may change the bits past the last flag in the final byte.  As
+    with the unpacked functions, a null case_bits costs nothing.
+*/
+
+enum punycode_status punycode_decode_in_place(
+  size_t,           /* input_length  */
+  punycode_uint [], /* buffer        */
+  size_t *,         /* output_length */
+  unsigned char []  /* case_flags    */
+);
+
+/*
+    punycode_decode_in_place() is punycode_decode() with the input and
+    output sharing one buffer, so that no second buffer is needed:  no
+    output is longer than its input, and every code point is written
+    over input that has already been read.  The caller places the
+    input_length chars of input at the start of buffer and passes in
+    *output_length the size of buffer in code points, which must be at
+    least input_length (otherwise the result is punycode_big_output).
+    On return the output is at the start of buffer and the input has
+    been overwritten, whatever the status.  It takes time quadratic in
+    the input length in the worst case, like punycode_decode().
+*/
+
+size_t punycode_copy_basic(
+  size_t,                 /* input_length */
+  const punycode_uint [], /* input        */
+  char []                 /* output       */
+);
+
+/*
+    punycode_copy_basic() copies the leading run of basic code points
+    of the input to the output as ASCII code points and returns its
+    length, which equals input_length if the input is all basic.  The
+    output needs room for input_length code points.  punycode_encode()
+    uses it to pass labels that need no encoding straight through.
+*/
+
+size_t punycode_scan_ace(
+  size_t,       /* input_length */
+  const char [],/* input        */
+  size_t *      /* basic_length */
+);
+
+/*
+    punycode_scan_ace() finds the basic code points of a Punycode
+    string and checks its alphabet without decoding it.  It stores in
+    *basic_length the index of the last delimiter, or 0 if there is
+    none, which is the number of basic code points punycode_decode()
+    copies to its output.  It returns the length of the longest prefix
+    of the input in which every code point before that delimiter is
+    basic and every code point after it (or every code point, if
+    there are no basic code points) is a digit.  If that is less than
+    input_length, punycode_decode() will fail with punycode_bad_input
+    or an earlier error.
+*/
+
+size_t punycode_basic_length(
+  size_t,       /* input_length */
+  const char [] /* input        */
+);
+
+/*
+    punycode_basic_length() returns the index of the last delimiter of
+    a Punycode string, or 0 if there is none, as punycode_scan_ace()
+    stores it in *basic_length, without checking the alphabet.
+
+    These three functions have SSE2 and AVX2 versions on x86, chosen
+    when they are called according to what the processor supports.
+    Each call pays for that choice, which a short label does not repay,
+    so punycode_encode() only copies labels of 16 or more code points
+    with punycode_copy_basic(), and punycode_decode() only calls
+    punycode_basic_length() on strings of 8 or more chars, using
+    scalar loops below that.
+*/
+
+enum punycode_status punycode_encode_utf8(
+  size_t,                  /* input_length  */
+  const char [],           /* input         */
+  size_t *,                /* output_length */
+  char []                  /* output        */
+);
+
+enum punycode_status punycode_encode_utf16(
+  size_t,                  /* input_length  */
+  const punycode_utf16 [], /* input         */
+  size_t *,                /* output_length */
+  char []                  /* output        */
+);
+
+/*
+    punycode_encode_utf8() and punycode_encode_utf16() are like
+    punycode_encode() with a null case_flags, except that the input
+    is UTF-8 or UTF-16 and input_length counts code units (bytes or
+    16-bit units) rather than code points.  The code points are
+    decoded inside the encoding loops as they are needed, so no array
+    of code points is ever built.  They return punycode_bad_input if
+    the input is not well-formed: in UTF-8, a truncated, overlong or
+    out-of-range sequence or an encoded surrogate; in UTF-16, an
+    unpaired surrogate.
+*/
+
+enum punycode_status punycode_decode_utf8(
+  size_t,                  /* input_length  */
+  const char [],           /* input         */
+  size_t *,                /* output_length */
+  char []                  /* output        */
+);
+
+enum punycode_status punycode_decode_utf16(
+  size_t,                  /* input_length  */
+  const char [],           /* input         */
+  size_t *,                /* output_length */
+  punycode_utf16 []        /* output        */
+);
+
+/*
+    punycode_decode_utf8() and punycode_decode_utf16() are like
+    punycode_decode() with a null case_flags, except that the decoded
+    code points are inserted directly into UTF-8 or UTF-16 output, and
+    *output_length counts code units rather than code points.  They
+    return punycode_bad_input if a decoded code point is not a Unicode
+    scalar value (0..D7FF or E000..10FFFF) and so has no encoding.
+*/
+
+enum punycode_status punycode_encoded_length(
+  size_t,                  /* input_length  */
+  const punycode_uint [],  /* input         */
+  size_t *                 /* output_length */
+);
+
+enum punycode_status punycode_decoded_length(
+  size_t,                  /* input_length  */
+  const char [],           /* input         */
+  size_t *                 /* output_length */
+);
+
+/*
+    punycode_encoded_length() stores in *output_length the exact number
+    of ASCII code points punycode_encode() outputs for the input (with
+    any case flags, which do not affect the length), and
+    punycode_decoded_length() the exact number of code points that
+    punycode_decode() outputs, so that the output can be allocated at
+    its final size before converting.  Neither produces any output.
+
+    punycode_encoded_length() follows the encoder, so it takes about as
+    long as the encoder minus writing the output; for long inputs it
+    counts the way punycode_encode_sorted() encodes, in O(n log n) time
+    with a call to malloc(), and the slower way if that fails.
+    punycode_decoded_length() runs the decoder's digit and overflow
+    checks without inserting anything, in linear time and without
+    allocating.
+
+    Return value:
+
+        The status punycode_encode() or punycode_decode() returns given
+        an output that is large enough, except that
+        punycode_decoded_length() returns punycode_big_output if the
+        output would have more code points than a punycode_uint can
+        count.  If not punycode_success, *output_length is unchanged.
+*/
+
+enum punycode_status punycode_validate(
+  size_t,                  /* input_length  */
+  const char [],           /* input         */
+  size_t *                 /* output_length */
+);
+
+/*
+    punycode_validate() checks whether the input is Punycode that
+    decodes to a sequence of Unicode scalar values (0..D7FF and
+    E000..10FFFF), without decoding it.  It runs the same digit and
+    overflow checks as punycode_decode(), plus the range check of
+    punycode_decode_utf8(), in linear time, with no output buffer and
+    no allocation, for callers that only need to filter labels.
+
+    output_length is a null pointer or receives, on success, the number
+    of code points punycode_decode() would output.
+
+    Return value:
+
+        punycode_success if the input is valid, otherwise the status
+        punycode_decode_utf8() would return given enough output space.
+*/
+
+enum punycode_status punycode_encode_wide(
+  size_t,                  /* input_length  */
+  const punycode_uint [],  /* input         */
+  size_t *,                /* output_length */
+  char []                  /* output        */
+);
+
+enum punycode_status punycode_decode_wide(
+  size_t,                  /* input_length  */
+  const char [],           /* input         */
+  size_t *,                /* output_length */
+  punycode_uint []         /* output        */
+);
+
+/*
+    punycode_encode_wide() and punycode_decode_wide() are like
+    punycode_encode() and punycode_decode() without case flags, except
+    that delta and the decoder's i and w are punycode_wide, so that
+    long inputs do not fail with punycode_overflow once the deltas
+    outgrow a punycode_uint:  with 64 bits that takes some 10**13 code
+    points.  Their output is Punycode, which punycode_decode() can
+    decode as long as every delta fits a punycode_uint.
+
+    Like punycode_encode() and punycode_decode() they take time
+    quadratic in the input length in the worst case, so very long
+    inputs are better split into blocks with punycode-frame.h.
+*/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PUNYCODE_H */
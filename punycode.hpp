@@ -0,0 +1,585 @@
+/*
+punycode.hpp
+
+This is C++20 code wrapping the functions of punycode.h in an interface
+taking std::span and std::string_view and returning labels that hold
+up to a DNS label's worth of output in place, so that converting a
+label makes no heap allocation.  Longer outputs move to the heap.  It
+is header-only, but the program must be linked with punycode.c and
+punycode-simd.c, as for the C interface.
+
+Host names known when compiling can instead be converted by the
+compiler, with the constexpr encoder of bootstring.hpp:  ace<"bücher">
+and "bücher"_ace are the constant "xn--bcher-kva", and an invalid name
+does not compile.  The source must then be compiled as UTF-8, which is
+the default of GCC and Clang.
+
+*/
+
+#ifndef PUNYCODE_HPP
+#define PUNYCODE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <type_traits>
+
+#include "bootstring.hpp"
+#include "punycode.h"
+
+namespace punycode {
+
+/* The longest DNS label, in octets, and the most UTF-8 bytes a */
+/* label can need once decoded:  the code points of an encoded  */
+/* label with its four-character "xn--" prefix, four bytes each. */
+
+inline constexpr std::size_t label_capacity = 63;
+inline constexpr std::size_t utf8_label_capacity = 4 * (label_capacity - 4);
+
+/*** Labels ***/
+
+template <class T, std::size_t N>
+class basic_label {
+public:
+  static_assert(std::is_trivially_copyable_v<T>, "T must be trivial");
+
+  basic_label() noexcept {}
+  basic_label(const basic_label &other) { assign(other.data(), other.size_); }
+  basic_label(basic_label &&other) noexcept { steal(other); }
+  ~basic_label() { delete[] heap_; }
+
+  basic_label &operator=(const basic_label &other)
+  {
+    if (this != &other) assign(other.data(), other.size_);
+    return *this;
+  }
+
+  basic_label &operator=(basic_label &&other) noexcept
+  {
+    if (this != &other) {
+      delete[] heap_;
+      steal(other);
+    }
+    return *this;
+  }
+
+  T *data() noexcept { return heap_ ? heap_ : local_; }
+  const T *data() const noexcept { return heap_ ? heap_ : local_; }
+  std::size_t size() const noexcept { return size_; }
+  std::size_t capacity() const noexcept { return heap_ ? capacity_ : N; }
+  bool empty() const noexcept { return size_ == 0; }
+  bool on_heap() const noexcept { return heap_ != nullptr; }
+
+  const T *begin() const noexcept { return data(); }
+  const T *end() const noexcept { return data() + size_; }
+  const T &operator[](std::size_t j) const noexcept { return data()[j]; }
+
+  std::span<const T> span() const noexcept { return { data(), size_ }; }
+
+  std::basic_string_view<T> view() const noexcept
+  {
+    return { data(), size_ };
+  }
+
+  operator std::basic_string_view<T>() const noexcept { return view(); }
+
+  friend bool operator==(const basic_label &a, const basic_label &b) noexcept
+  {
+    return a.view() == b.view();
+  }
+
+  /* reserve(n) makes room for n elements, dropping the contents; */
+  /* resize(n) then sets how many of them are the label.          */
+
+  void reserve(std::size_t n)
+  {
+    if (n <= capacity()) return;
+    T *heap = new T[n];
+    delete[] heap_;
+    heap_ = heap;
+    capacity_ = n;
+    size_ = 0;
+  }
+
+  void resize(std::size_t n) noexcept { size_ = n; }
+
+private:
+  void assign(const T *source, std::size_t n)
+  {
+    reserve(n);
+    if (n > 0) std::memcpy(data(), source, n * sizeof (T));
+    size_ = n;
+  }
+
+  /* A label on the heap is moved by taking its pointer; one in */
+  /* place by copying its size_ elements, at most N.            */
+
+  void steal(basic_label &other) noexcept
+  {
+    heap_ = other.heap_;
+    capacity_ = other.capacity_;
+    size_ = other.size_;
+    if (!heap_ && size_ > 0) {
+      std::memcpy(local_, other.local_, size_ * sizeof (T));
+    }
+    other.heap_ = nullptr;
+    other.size_ = 0;
+  }
+
+  T *heap_ = nullptr;
+  std::size_t size_ = 0, capacity_ = 0;
+  T local_[N];
+};
+
+/*
+    basic_label<T,N> holds a sequence of up to N elements of T in place
+    and longer ones on the heap.  Copying and moving cost at most N
+    elements plus a few words, and moving a label from the heap costs
+    nothing more.  It converts to std::basic_string_view<T>.
+*/
+
+typedef basic_label<char, label_capacity> ace_label;
+typedef basic_label<char32_t, label_capacity> unicode_label;
+typedef basic_label<char, utf8_label_capacity> utf8_label;
+
+/* A result is a label and the punycode_status of its conversion; */
+/* the label is empty unless the status is punycode_success.      */
+
+template <class L>
+struct result {
+  L value;
+  enum punycode_status status = punycode_success;
+
+  explicit operator bool() const noexcept
+  {
+    return status == punycode_success;
+  }
+};
+
+/*** Conversions ***/
+
+result<ace_label> encode(std::span<const char32_t> input,
+                         std::span<const unsigned char> case_flags = {});
+
+result<unicode_label> decode(std::string_view input);
+
+result<unicode_label> decode(std::string_view input,
+                             basic_label<unsigned char, label_capacity>
+                               &case_flags);
+
+result<ace_label> encode_utf8(std::string_view input);
+
+result<utf8_label> decode_utf8(std::string_view input);
+
+/*
+    encode() and decode() are punycode_encode() and punycode_decode(),
+    encode_utf8() and decode_utf8() punycode_encode_utf8() and
+    punycode_decode_utf8().  The case flags of encode() are either
+    empty or one per code point (otherwise the result is
+    punycode_bad_input); decode() can fill in case flags as well.  An
+    output too long for a label in place is written once the exact
+    length (for encode() and decode()) or a long enough one (for the
+    UTF-8 functions) is known, so punycode_big_output is never
+    returned.
+*/
+
+/*** Implementation ***/
+
+namespace detail {
+
+/* The C functions take punycode_uint rather than char32_t, so */
+/* code points are copied into one, in place for a label:      */
+
+class code_points {
+public:
+  explicit code_points(std::span<const char32_t> input)
+  {
+    punycode_uint *p = local_;
+
+    if (input.size() > label_capacity) {
+      heap_.reset(new punycode_uint[input.size()]);
+      p = heap_.get();
+    }
+
+    std::copy(input.begin(), input.end(), p);
+    data_ = p;
+  }
+
+  const punycode_uint *data() const noexcept { return data_; }
+
+private:
+  punycode_uint local_[label_capacity];
+  std::unique_ptr<punycode_uint[]> heap_;
+  const punycode_uint *data_;
+};
+
+/* grow() doubles the room for an output of the UTF-8 functions, */
+/* returning false if that is no longer possible.               */
+
+template <class L>
+bool grow(L &label)
+{
+  std::size_t n = label.capacity();
+  if (n > static_cast<std::size_t>(-1) / 2) return false;
+  label.reserve(2 * n);
+  return true;
+}
+
+template <class F>
+result<unicode_label> decode(std::string_view input, F decode_into)
+{
+  result<unicode_label> r;
+  punycode_uint local[label_capacity];
+  std::unique_ptr<punycode_uint[]> heap;
+  punycode_uint *output = local;
+  std::size_t length = label_capacity;
+
+  r.status = decode_into(output, length);
+
+  if (r.status == punycode_big_output) {
+    r.status = punycode_decoded_length(input.size(), input.data(), &length);
+    if (r.status != punycode_success) return r;
+    heap.reset(new punycode_uint[length]);
+    output = heap.get();
+    r.status = decode_into(output, length);
+  }
+
+  if (r.status != punycode_success) return r;
+
+  r.value.reserve(length);
+  std::copy(output, output + length, r.value.data());
+  r.value.resize(length);
+  return r;
+}
+
+} /* namespace detail */
+
+inline result<ace_label> encode(std::span<const char32_t> input,
+                                std::span<const unsigned char> case_flags)
+{
+  result<ace_label> r;
+  const unsigned char *flags = case_flags.empty() ? nullptr
+                                                  : case_flags.data();
+  std::size_t length = r.value.capacity();
+
+  if (flags && case_flags.size() != input.size()) {
+    r.status = punycode_bad_input;
+    return r;
+  }
+
+  detail::code_points cp(input);
+  r.status = punycode_encode(input.size(), cp.data(), flags, &length,
+                             r.value.data());
+
+  if (r.status == punycode_big_output) {
+    r.status = punycode_encoded_length(input.size(), cp.data(), &length);
+    if (r.status != punycode_success) return r;
+    r.value.reserve(length);
+    r.status = punycode_encode(input.size(), cp.data(), flags, &length,
+                               r.value.data());
+  }
+
+  if (r.status == punycode_success) r.value.resize(length);
+  return r;
+}
+
+inline result<unicode_label> decode(std::string_view input)
+{
+  return detail::decode(input, [&](punycode_uint *output,
+                                   std::size_t &length) {
+    return punycode_decode(input.size(), input.data(), &length, output,
+                           nullptr);
+  });
+}
+
+inline result<unicode_label> decode(
+  std::string_view input,
+  basic_label<unsigned char, label_capacity> &case_flags)
+{
+  result<unicode_label> r;
+
+  r = detail::decode(input, [&](punycode_uint *output,
+                                std::size_t &length) {
+    case_flags.reserve(length);
+    return punycode_decode(input.size(), input.data(), &length, output,
+                           case_flags.data());
+  });
+
+  case_flags.resize(r.value.size());
+  return r;
+}
+
+inline result<ace_label> encode_utf8(std::string_view input)
+{
+  result<ace_label> r;
+  std::size_t length;
+
+  do {
+    length = r.value.capacity();
+    r.status = punycode_encode_utf8(input.size(), input.data(), &length,
+                                    r.value.data());
+  } while (r.status == punycode_big_output && detail::grow(r.value));
+
+  if (r.status == punycode_success) r.value.resize(length);
+  return r;
+}
+
+inline result<utf8_label> decode_utf8(std::string_view input)
+{
+  result<utf8_label> r;
+  std::size_t length;
+
+  do {
+    length = r.value.capacity();
+    r.status = punycode_decode_utf8(input.size(), input.data(), &length,
+                                    r.value.data());
+  } while (r.status == punycode_big_output && detail::grow(r.value));
+
+  if (r.status == punycode_success) r.value.resize(length);
+  return r;
+}
+
+/*** Host name literals ***/
+
+/* A fixed_string is a string literal passed as a template argument: */
+
+template <std::size_t N>
+struct fixed_string {
+  char chars[N];
+
+  consteval fixed_string(const char (&s)[N]) { std::copy_n(s, N, chars); }
+
+  constexpr std::string_view view() const noexcept
+  {
+    return { chars, N - 1 };
+  }
+};
+
+/* An ace_name<N> is a converted host name of N chars, followed */
+/* by a null character:                                         */
+
+template <std::size_t N>
+struct ace_name {
+  char chars[N + 1];
+
+  constexpr const char *c_str() const noexcept { return chars; }
+  constexpr std::size_t size() const noexcept { return N; }
+
+  constexpr std::string_view view() const noexcept
+  {
+    return { chars, N };
+  }
+
+  constexpr operator std::string_view() const noexcept { return view(); }
+};
+
+namespace detail {
+
+enum {
+  ace_prefix_length = 4,
+  max_code_points = label_capacity - ace_prefix_length
+};
+
+/* utf8_check() returns the length of the UTF-8 sequence at input[j], */
+/* which must end by input[end - 1], and stores its value in *cp, or  */
+/* returns 0 if it is not the shortest form of a scalar value.        */
+
+constexpr std::size_t utf8_check(std::string_view input, std::size_t j,
+                                 std::size_t end, punycode_uint *cp)
+{
+  constexpr punycode_uint min[5] = { 0, 0, 0x80, 0x800, 0x10000 };
+  unsigned char c = static_cast<unsigned char>(input[j]);
+  std::size_t length = 0, k = 0;
+
+  if (c < 0x80) {
+    *cp = c;
+    return 1;
+  }
+
+  if (c < 0xC2 || c > 0xF4) return 0;
+  length = c < 0xE0 ? 2 : c < 0xF0 ? 3 : 4;
+  if (end - j < length) return 0;
+  *cp = c & (0x7F >> length);
+
+  for (k = 1;  k < length;  ++k) {
+    c = static_cast<unsigned char>(input[j + k]);
+    if ((c & 0xC0) != 0x80) return 0;
+    *cp = *cp << 6 | (c & 0x3F);
+  }
+
+  return *cp >= min[length] && *cp <= 0x10FFFF &&
+         (*cp < 0xD800 || *cp > 0xDFFF) ? length : 0;
+}
+
+/* split() finds the label beginning at input[begin] as in */
+/* punycode-idna.c, returning its end and setting *next    */
+/* and *ascii:                                             */
+
+constexpr std::size_t split(std::string_view input, std::size_t begin,
+                            std::size_t *next, bool *ascii)
+{
+  std::size_t j = 0;
+  unsigned char c = 0, c1 = 0, c2 = 0;
+
+  *ascii = true;
+
+  for (j = begin;  j < input.size();  ++j) {
+    c = static_cast<unsigned char>(input[j]);
+
+    if (c == '.') {
+      *next = j + 1;
+      return j;
+    }
+
+    if (c >= 0x80) {
+      if (j + 2 < input.size()) {
+        c1 = static_cast<unsigned char>(input[j + 1]);
+        c2 = static_cast<unsigned char>(input[j + 2]);
+
+        if ((c == 0xE3 && c1 == 0x80 && c2 == 0x82) ||
+            (c == 0xEF && c1 == 0xBC && c2 == 0x8E) ||
+            (c == 0xEF && c1 == 0xBD && c2 == 0xA1)) {
+          *next = j + 3;
+          return j;
+        }
+      }
+
+      *ascii = false;
+    }
+  }
+
+  *next = input.size() + 1;
+  return input.size();
+}
+
+/* to_ascii() converts a host name as punycode_to_ascii() does, */
+/* but writes the labels joined by full stops into output:      */
+
+constexpr enum punycode_status to_ascii(std::string_view input,
+                                        std::size_t *output_length,
+                                        char output[])
+{
+  punycode_uint code_points[4 * max_code_points] = {};
+  std::size_t begin = 0, end = 0, next = 0, count = 0, j = 0, n = 0;
+  std::size_t out = 0, max_out = *output_length, length = 0, l = 0;
+  punycode_uint cp = 0;
+  bool ascii = true;
+  enum punycode_status status = punycode_success;
+
+  if (input.empty()) return punycode_bad_input;
+
+  for (begin = 0;  begin <= input.size();  begin = next) {
+    end = split(input, begin, &next, &ascii);
+
+    if (end == begin && (next <= input.size() || count == 0)) {
+      return punycode_bad_input;
+    }
+
+    if (count++ > 0) {
+      if (out == max_out) return punycode_big_output;
+      output[out++] = '.';
+    }
+
+    if (ascii) {
+      if (end - begin > label_capacity) return punycode_bad_input;
+      if (end - begin > max_out - out) return punycode_big_output;
+      for (j = begin;  j < end;  ++j) output[out++] = input[j];
+      continue;
+    }
+
+    if (end - begin >= ace_prefix_length &&
+        (input[begin] | 0x20) == 'x' && (input[begin + 1] | 0x20) == 'n' &&
+        input[begin + 2] == '-' && input[begin + 3] == '-') {
+      return punycode_bad_input;
+    }
+
+    if (end - begin > 4 * max_code_points) return punycode_bad_input;
+
+    for (n = 0, j = begin;  j < end;  j += l) {
+      l = utf8_check(input, j, end, &cp);
+      if (l == 0) return punycode_bad_input;
+      code_points[n++] = cp;
+    }
+
+    if (max_out - out < ace_prefix_length) return punycode_big_output;
+    for (j = 0;  j < ace_prefix_length;  ++j) output[out++] = "xn--"[j];
+
+    length = std::min<std::size_t>(max_out - out, max_code_points);
+    status = bootstring::punycode::encode(n, code_points, nullptr,
+                                          &length, output + out);
+
+    if (status == punycode_big_output && max_out - out >= max_code_points) {
+      return punycode_bad_input;
+    }
+
+    if (status != punycode_success) return status;
+    out += length;
+  }
+
+  *output_length = out;
+  return punycode_success;
+}
+
+/* invalid_host_name() is not constexpr, so a literal */
+/* that reaches it fails to compile, naming it:      */
+
+inline void invalid_host_name(enum punycode_status) {}
+
+/* Every label of the input becomes at most 63 chars and */
+/* a separator, so 64 chars per input char is plenty:    */
+
+template <fixed_string S>
+consteval std::size_t ace_length()
+{
+  char output[64 * sizeof S.chars];
+  std::size_t length = sizeof output;
+  enum punycode_status status = to_ascii(S.view(), &length, output);
+
+  if (status != punycode_success) invalid_host_name(status);
+  return length;
+}
+
+template <fixed_string S>
+consteval ace_name<ace_length<S>()> make_ace()
+{
+  ace_name<ace_length<S>()> name{};
+  std::size_t length = name.size();
+
+  to_ascii(S.view(), &length, name.chars);
+  return name;
+}
+
+} /* namespace detail */
+
+template <fixed_string S>
+inline constexpr ace_name<detail::ace_length<S>()> ace =
+  detail::make_ace<S>();
+
+namespace literals {
+
+template <fixed_string S>
+consteval const auto &operator""_ace()
+{
+  return ace<S>;
+}
+
+} /* namespace literals */
+
+/*
+    ace<S> is the host name in the string literal S (in UTF-8)
+    converted as by punycode_to_ascii(), with the labels joined by
+    full stops:  every label containing non-ASCII characters becomes
+    "xn--" and its Punycode encoding, and the other labels are kept as
+    they are.  It is a constant worked out by the compiler, so it costs
+    nothing at startup, and input that punycode_to_ascii() would reject
+    is a compile-time error in detail::invalid_host_name().  With
+    using namespace punycode::literals, "bücher.example"_ace is a
+    reference to ace<"bücher.example">.
+*/
+
+} /* namespace punycode */
+
+#endif /* PUNYCODE_HPP */